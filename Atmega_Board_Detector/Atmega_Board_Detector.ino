@@ -1,7 +1,7 @@
 // Atmega chip fuse detector
 // Author: Nick Gammon
 // Date: 19nd March 2017
-// Version: 1.20
+// Version: 1.21
 
 // Version 1.1 added signatures for Attiny24/44/84 (5 May 2012)
 // Version 1.2 added signatures for ATmeag8U2/16U2/32U2 (7 May 2012)
@@ -23,8 +23,9 @@
 // Version 1.18: Got rid of compiler warnings in IDE 1.6.7
 // Version 1.19: Added more signatures: ATmega168V, ATmega328PB, ATmega1284
 // Version 1.20: Added MD5 sum for Pro Mini Optiboot bootloader (19 March 2017 by Patrick Bouffel)
+// Version 1.21: Signature table generated from devices.txt, found with an indexed lookup
 
-const char Version [] = "1.20";
+const char Version [] = "1.21";
 
 // make true to use the high-voltage parallel wiring
 #define HIGH_VOLTAGE_PARALLEL false
@@ -358,21 +359,17 @@ void getSignature ()
 
   Serial.println ();
 
-  for (int j = 0; j < NUMITEMS (signatures); j++)
+  foundSig = findSignature (sig);
+  if (foundSig != -1)
     {
-    memcpy_P (&currentSignature, &signatures [j], sizeof currentSignature);
-
-    if (memcmp (sig, currentSignature.sig, sizeof sig) == 0)
-      {
-      foundSig = j;
-      Serial.print (F("Processor = "));
-      Serial.println (currentSignature.desc);
-      Serial.print (F("Flash memory size = "));
-      Serial.print (currentSignature.flashSize, DEC);
-      Serial.println (F(" bytes."));
-      return;
-      }  // end of signature found
-    }  // end of for each signature
+    memcpy_P (&currentSignature, &signatures [foundSig], sizeof currentSignature);
+    Serial.print (F("Processor = "));
+    Serial.println (currentSignature.desc);
+    Serial.print (F("Flash memory size = "));
+    Serial.print (currentSignature.flashSize, DEC);
+    Serial.println (F(" bytes."));
+    return;
+    }  // end of signature found
 
   Serial.println (F("Unrecogized signature."));
   }  // end of getSignature
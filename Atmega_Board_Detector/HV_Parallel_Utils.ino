@@ -123,6 +123,39 @@ void writeFlash (unsigned long addr, const byte data)
   
   } // end of writeFlash  
 
+
+// read a byte from EEPROM
+byte readEEPROM (unsigned long addr)
+  {
+  HVprogram (ACTION_LOAD_COMMAND, CMD_READ_EEPROM);
+  HVprogram (ACTION_LOAD_ADDRESS, addr >> 8, HIGH);
+  HVprogram (ACTION_LOAD_ADDRESS, addr, LOW);
+
+  return HVreadData (LOW);
+  } // end of readEEPROM
+
+// write a byte to the EEPROM page buffer (ready for committing)
+void writeEEPROM (unsigned long addr, const byte data)
+  {
+  HVprogram (ACTION_LOAD_COMMAND, CMD_WRITE_EEPROM);
+  HVprogram (ACTION_LOAD_ADDRESS, addr >> 8, HIGH);
+  HVprogram (ACTION_LOAD_ADDRESS, addr, LOW);
+  HVprogram (ACTION_LOAD_DATA, data, LOW);
+  digitalWrite (PAGEL, HIGH);  // pulse PAGEL to latch data into page buffer
+  digitalWrite (PAGEL, LOW);
+  } // end of writeEEPROM
+
+// commit EEPROM page buffer to EEPROM (the address is still loaded from the last byte)
+void commitEEPROMPage (unsigned long addr)
+  {
+  showProgress ();
+
+  digitalWrite (BS1, LOW);
+  digitalWrite (WR, LOW);  // pulse WR to program the page
+  digitalWrite (WR, HIGH);
+  pollUntilReady ();
+  HVprogram (ACTION_LOAD_COMMAND, CMD_NO_OPERATION);
+  }  // end of commitEEPROMPage
   
 byte readFuse (const byte which)
   {
@@ -161,11 +194,12 @@ void pollUntilReady ()
   {
   // wait until not busy
   while (digitalRead (RDY) == LOW)
-    { }
+    if (whileBusy)
+      whileBusy ();
   }  // end of pollUntilReady
 
 // commit page to flash memory
-void commitPage (unsigned long addr, bool showMessage)
+void commitPage (unsigned long addr, bool showMessage, bool clearAfter)
   {
   if (showMessage)
     {
@@ -181,7 +215,8 @@ void commitPage (unsigned long addr, bool showMessage)
   digitalWrite (WR, LOW);
   digitalWrite (WR, HIGH);
   pollUntilReady (); 
-  clearPage();  // clear ready for next page full
+  if (clearAfter)
+    clearPage();  // clear ready for next page full
   HVprogram (ACTION_LOAD_COMMAND, CMD_NO_OPERATION);
   }  // end of commitPage
 
@@ -194,6 +229,7 @@ void eraseMemory ()
     
   pollUntilReady (); 
   clearPage();  // clear temporary page
+  fuses [lockByte] = readFuse (lockByte);  // erasing clears the lock bits
   }  // end of eraseMemory
 
 // write specified value to specified fuse/lock byte
@@ -237,7 +273,8 @@ void writeFuse (const byte newValue, const byte whichFuse)
 // put chip into programming mode    
 bool startProgramming ()
   {
-  Serial.println (F("Activating high-voltage PARALLEL programming mode."));
+  if (!serialIsBinary)
+    Serial.println (F("Activating high-voltage PARALLEL programming mode."));
 
   digitalWrite (PAGEL, LOW);
   digitalWrite (XA1, LOW);
@@ -261,7 +298,8 @@ void stopProgramming ()
     if (i != RDY)
       digitalWrite (i, LOW);
     }
-  Serial.println (F("Programming mode off."));
+  if (!serialIsBinary)
+    Serial.println (F("Programming mode off."));
   } // end of stopProgramming  
 
 // called from setup()  
@@ -1,7 +1,7 @@
 // Atmega chip programmer
 // Author: Nick Gammon
 // Date: 22nd May 2012
-// Version: 1.37
+// Version: 1.44
 
 // IMPORTANT: If you get a compile or verification error, due to the sketch size,
 // make some of these false to reduce compile size (the ones you don't want).
@@ -65,8 +65,14 @@ Tools -> Boards menu.
 // Version 1.36: Got rid of compiler warnings in IDE 1.6.7
 // Version 1.37: Got rid of compiler warnings in IDE 1.6.9, added more information about where bootloaders came from
 // Version 1.38: Added Atmega328PB to list of supported bootloaders
+// Version 1.39: Only changed fuses are written (lock byte last) and read back once; no fixed delays to latch the clock fuse
+// Version 1.40: Signature table generated from devices.txt, found with an indexed lookup
+// Version 1.41: Bootloader images packed (by convertHexToByteArray), unpacked a page at a time as written and verified
+// Version 1.42: Each page verified as soon as it is committed, progress shown as a bar, verifying stops after 100 errors
+// Version 1.43: Optionally burn bootloaders from an SD card, as listed in BOOTLDRS.TXT on the card
+// Version 1.44: Fixed extended fuse for ATmega1280 and ATmega32U4 to read-back values, so they no longer fail to verify
 
-#define VERSION "1.38"
+#define VERSION "1.44"
 
 // make true to use the high-voltage parallel wiring
 #define HIGH_VOLTAGE_PARALLEL false
@@ -75,6 +81,14 @@ Tools -> Boards menu.
 // make true to use ICSP programming
 #define ICSP_PROGRAMMING true
 
+// make true to also burn bootloaders from an SD card (see SD_Bootloaders.ino)
+#define SD_BOOTLOADERS false
+
+// make true to use bit-banged SPI for programming (needed if using the SD card)
+#define USE_BIT_BANGED_SPI false
+
+#define USE_ETHERNET_SHIELD false  // Use the Arduino Ethernet Shield for the SD card
+
 #if HIGH_VOLTAGE_PARALLEL && HIGH_VOLTAGE_SERIAL
   #error Cannot use both high-voltage parallel and serial at the same time
 #endif
@@ -87,6 +101,10 @@ Tools -> Boards menu.
   #error Choose a programming mode: HIGH_VOLTAGE_PARALLEL, HIGH_VOLTAGE_SERIAL or ICSP_PROGRAMMING
 #endif
 
+#if ICSP_PROGRAMMING && SD_BOOTLOADERS && !USE_BIT_BANGED_SPI
+  #error If you are using an SD card you need to use bit-banged SPI for the programmer
+#endif
+
 const int ENTER_PROGRAMMING_ATTEMPTS = 50;
 
 /*
@@ -120,6 +138,11 @@ const int ENTER_PROGRAMMING_ATTEMPTS = 50;
 #include <SPI.h>
 #include <avr/pgmspace.h>
 
+#if SD_BOOTLOADERS
+  // for SDFat library see: https://github.com/greiman/SdFat
+  #include <SdFat.h>
+#endif
+
 
 const unsigned long BAUD_RATE = 115200;
 
@@ -127,7 +150,9 @@ const byte CLOCKOUT = 9;
 
 #if ICSP_PROGRAMMING
 
-  #ifdef ARDUINO_PINOCCIO
+  #if USE_BIT_BANGED_SPI
+    const byte RESET = 5;   // --> goes to reset on the target board (SPI pins are used by the SD card)
+  #elif defined(ARDUINO_PINOCCIO)
     const byte RESET = SS;  // --> goes to reset on the target board
   #else
     const byte RESET = 10;  // --> goes to reset on the target board
@@ -139,6 +164,102 @@ const byte CLOCKOUT = 9;
 
 #endif // ICSP_PROGRAMMING
 
+#if USE_BIT_BANGED_SPI
+
+  // bit banged SPI pins
+  #ifdef __AVR_ATmega2560__
+    // Atmega2560
+    #if USE_ETHERNET_SHIELD
+      const byte MSPIM_SCK = 3;  // port E bit 5
+    #else
+      const byte MSPIM_SCK = 4;  // port G bit 5
+    #endif
+    const byte MSPIM_SS  = 5;  // port E bit 3
+    const byte BB_MISO   = 6;  // port H bit 3
+    const byte BB_MOSI   = 7;  // port H bit 4
+  #elif defined(__AVR_ATmega1284P__)
+    // Atmega1284P
+    const byte MSPIM_SCK = 11;  // port D bit 3
+    const byte MSPIM_SS  = 12;  // port D bit 4
+    const byte BB_MISO   = 13;  // port D bit 5
+    const byte BB_MOSI   = 14;  // port D bit 6
+  #else
+    // Atmega328
+    #if USE_ETHERNET_SHIELD
+      const byte MSPIM_SCK = 3;  // port D bit 3
+    #else
+      const byte MSPIM_SCK = 4;  // port D bit 4
+    #endif
+    const byte MSPIM_SS  = 5;  // port D bit 5
+    const byte BB_MISO   = 6;  // port D bit 6
+    const byte BB_MOSI   = 7;  // port D bit 7
+  #endif
+
+
+  /*
+
+  Connect target processor like this:
+
+    D4: (SCK)   --> SCK as per datasheet (If using Ethernet shield, use D3 instead)
+    D5: (SS)    --> goes to /RESET on target
+    D6: (MISO)  --> MISO as per datasheet
+    D7: (MOSI)  --> MOSI as per datasheet
+
+    D9: 8 Mhz clock signal if required by target
+
+  Connect SD card like this:
+
+    D10: SS   (chip select)
+    D11: MOSI (DI - data into SD card)
+    D12: MISO (DO - data out from SD card)
+    D13: SCK  (CLK - clock)
+
+  Both SD card and target processor will need +5V and Gnd connected.
+
+  */
+
+  // for fast port access
+  #ifdef __AVR_ATmega2560__
+    // Atmega2560
+    #define BB_MISO_PORT PINH
+    #define BB_MOSI_PORT PORTH
+    #if USE_ETHERNET_SHIELD
+      #define BB_SCK_PORT PORTE   // Pin D3
+    #else
+      #define BB_SCK_PORT PORTG   // Pind D4
+    #endif
+    const byte BB_SCK_BIT = 5;
+    const byte BB_MISO_BIT = 3;
+    const byte BB_MOSI_BIT = 4;
+  #elif defined(__AVR_ATmega1284P__)
+    // Atmega1284P
+    #define BB_MISO_PORT PIND
+    #define BB_MOSI_PORT PORTD
+    #define BB_SCK_PORT PORTD
+    const byte BB_SCK_BIT = 3;
+    const byte BB_MISO_BIT = 5;
+    const byte BB_MOSI_BIT = 6;
+  #else
+    // Atmega328
+    #define BB_MISO_PORT PIND
+    #define BB_MOSI_PORT PORTD
+    #define BB_SCK_PORT PORTD
+    #if USE_ETHERNET_SHIELD
+      const byte BB_SCK_BIT = 3;  // Pin D3
+    #else
+      const byte BB_SCK_BIT = 4;  // Pind D4
+    #endif
+    const byte BB_MISO_BIT = 6;
+    const byte BB_MOSI_BIT = 7;
+  #endif
+
+  // control speed of programming
+  const byte BB_DELAY_MICROSECONDS = 6;
+
+
+
+#endif // USE_BIT_BANGED_SPI
+
 
 #include "HV_Pins.h"
 #include "Signatures.h"
@@ -149,11 +270,27 @@ const byte CLOCKOUT = 9;
 typedef struct {
    byte sig [3];                // chip signature
    unsigned long loaderStart;   // start address of bootloader (bytes)
-   const byte * bootloader;     // address of bootloader hex data
-   unsigned int loaderLength;   // length of bootloader hex data (bytes)
-   byte lowFuse, highFuse, extFuse, lockByte;  // what to set the fuses, lock bits to.
+   const byte * bootloader;     // address of bootloader hex data (packed, see unpackByte)
+   unsigned int loaderLength;   // length of bootloader hex data, unpacked (bytes)
+   byte lowFuse, highFuse, extFuse, lockByte;  // what to set the fuses, lock bits to (0 = leave alone)
 } bootloaderType;
 
+// Fuse values are as they read back, ie. with unused bits as 1, so they can be compared.
+
+// state of unpacking a bootloader image, see unpackByte
+typedef struct {
+   const byte * next;           // next packed byte (in PROGMEM)
+   unsigned int count;          // bytes left in the current run
+   byte code;                   // code byte which started the current run
+   byte value;                  // byte being repeated, or distance back (less 1) being copied from
+   byte pos;                    // where the next unpacked byte goes in window (wraps around)
+   byte window [256];           // last 256 unpacked bytes
+#if SD_BOOTLOADERS
+   SdFile * file;               // if not NULL, the image is read from here instead (not packed)
+   bool readError;              // set if the file was shorter than expected
+#endif
+} unpackType;
+
 
 // hex bootloader data
 
@@ -198,93 +335,93 @@ const bootloaderType bootloaders [] PROGMEM =
         0x3E00,               // start address
   #if USE_ATMEGA168
         atmega168_optiboot,   // loader image
-        sizeof atmega168_optiboot,
+        atmega168_optiboot_length,
   #else
         0, 0,
   #endif
         0xC6,         // fuse low byte: external full-swing crystal
         0xDD,         // fuse high byte: SPI enable, brown-out detection at 2.7V
-        0x04,         // fuse extended byte: boot into bootloader, 512 byte bootloader
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFC,         // fuse extended byte: boot into bootloader, 512 byte bootloader
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega328P
   { { 0x1E, 0x95, 0x0F },
         0x7E00,               // start address
         atmega328_optiboot,   // loader image
-        sizeof atmega328_optiboot,
+        atmega328_optiboot_length,
         0xFF,         // fuse low byte: external clock, max start-up time
         0xDE,         // fuse high byte: SPI enable, boot into bootloader, 512 byte bootloader
-        0x05,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFD,         // fuse extended byte: brown-out detection at 2.7V
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega328
   { { 0x1E, 0x95, 0x14 },
         0x7E00,               // start address
         atmega328_optiboot,   // loader image
-        sizeof atmega328_optiboot,
+        atmega328_optiboot_length,
         0xFF,         // fuse low byte: external clock, max start-up time
         0xDE,         // fuse high byte: SPI enable, boot into bootloader, 512 byte bootloader
-        0x05,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFD,         // fuse extended byte: brown-out detection at 2.7V
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega328PB
   { { 0x1E, 0x95, 0x16 },
         0x7E00,               // start address
         atmega328_optiboot,   // loader image
-        sizeof atmega328_optiboot,
+        atmega328_optiboot_length,
         0xFF,         // fuse low byte: external clock, max start-up time
         0xDE,         // fuse high byte: SPI enable, boot into bootloader, 512 byte bootloader
-        0x05,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFD,         // fuse extended byte: brown-out detection at 2.7V
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega1280
   { { 0x1E, 0x97, 0x03 },
         0x1FC00,      // start address
   #if USE_ATMEGA1280
         optiboot_atmega1280_hex,
-        sizeof optiboot_atmega1280_hex,
+        optiboot_atmega1280_hex_length,
   #else
         0, 0,
   #endif
         0xFF,         // fuse low byte: external clock, max start-up time
         0xDE,         // fuse high byte: SPI enable, boot into bootloader, 1280 byte bootloader
-        0xF5,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFD,         // fuse extended byte: brown-out detection at 2.7V
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega2560
   { { 0x1E, 0x98, 0x01 },
         0x3E000,      // start address
   #if USE_ATMEGA2560
         atmega2560_bootloader_hex,// loader image
-        sizeof atmega2560_bootloader_hex,
+        atmega2560_bootloader_hex_length,
   #else
         0, 0,
   #endif
         0xFF,         // fuse low byte: external clock, max start-up time
         0xD8,         // fuse high byte: SPI enable, boot into bootloader, 8192 byte bootloader
         0xFD,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega256rfr2
   { { 0x1E, 0xA8, 0x02 },
         0x3E000,      // start address
   #if USE_ATMEGA256RFR2
         atmega256rfr2_bootloader_hex,// loader image
-        sizeof atmega256rfr2_bootloader_hex,
+        atmega256rfr2_bootloader_hex_length,
   #else
         0, 0,
   #endif
         0xDE,         // fuse low byte: internal transceiver clock, max start-up time
         0xD0,         // fuse high byte: SPI enable, EE save, boot into bootloader, 8192 byte bootloader
         0xFE,         // fuse extended byte: brown-out detection at 1.8V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega16U2
   { { 0x1E, 0x94, 0x89 },
         0x3000,      // start address
   #if USE_ATMEGA16U2
         Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex,// loader image
-        sizeof Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex,
+        Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex_length,
   #else
         0, 0,
   #endif
@@ -298,14 +435,14 @@ const bootloaderType bootloaders [] PROGMEM =
         0x7000,      // start address
   #if USE_ATMEGA32U4
         leonardo_hex,// loader image
-        sizeof leonardo_hex,
+        leonardo_hex_length,
   #else
         0, 0,
   #endif
         0xFF,         // fuse low byte: external clock, max start-up time
         0xD8,         // fuse high byte: SPI enable, boot into bootloader, 1280 byte bootloader
-        0xCB,         // fuse extended byte: brown-out detection at 2.6V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xFB,         // fuse extended byte: brown-out detection at 2.6V
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // ATmega1284P family
 
@@ -314,14 +451,14 @@ const bootloaderType bootloaders [] PROGMEM =
         0x1FC00,      // start address
   #if USE_ATMEGA1284
         optiboot_atmega1284p_hex,
-        sizeof optiboot_atmega1284p_hex,
+        optiboot_atmega1284p_hex_length,
   #else
         0, 0,
   #endif
         0xFF,         // fuse low byte: external clock, max start-up time
         0xDE,         // fuse high byte: SPI enable, boot into bootloader, 1024 byte bootloader
         0xFD,         // fuse extended byte: brown-out detection at 2.7V
-        0x2F },       // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0xEF },       // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   // Atmega8A family
 
@@ -330,42 +467,170 @@ const bootloaderType bootloaders [] PROGMEM =
         0x1C00,      // start address
   #if USE_ATMEGA8
         atmega8_hex,
-        sizeof atmega8_hex,
+        atmega8_hex_length,
   #else
         0, 0,
   #endif
         0xE4,         // fuse low byte: external clock, max start-up time
         0xCA,         // fuse high byte: SPI enable, boot into bootloader, 1024 byte bootloader
-        0xFD,         // fuse extended byte: brown-out detection at 2.7V
-        0x0F  },      // lock bits: SPM is not allowed to write to the Boot Loader section.
+        0,            // fuse extended byte: (none on this chip)
+        0xCF  },      // lock bits: SPM is not allowed to write to the Boot Loader section.
 
   };  // end of bootloaders
 
 
 
+#if USE_BIT_BANGED_SPI
+
+  // Bit Banged SPI transfer
+  byte BB_SPITransfer (byte c)
+  {
+    byte bit;
+
+    for (bit = 0; bit < 8; bit++)
+      {
+      // write MOSI on falling edge of previous clock
+      if (c & 0x80)
+          BB_MOSI_PORT |= bit (BB_MOSI_BIT);
+      else
+          BB_MOSI_PORT &= ~bit (BB_MOSI_BIT);
+      c <<= 1;
+
+      // read MISO
+      c |= (BB_MISO_PORT & bit (BB_MISO_BIT)) != 0;
+
+     // clock high
+      BB_SCK_PORT |= bit (BB_SCK_BIT);
+
+      // delay between rise and fall of clock
+      delayMicroseconds (BB_DELAY_MICROSECONDS);
+
+      // clock low
+      BB_SCK_PORT &= ~bit (BB_SCK_BIT);
+
+      // delay between rise and fall of clock
+      delayMicroseconds (BB_DELAY_MICROSECONDS);
+      }
+
+    return c;
+    }  // end of BB_SPITransfer
+
+#endif // USE_BIT_BANGED_SPI
+
 void getFuseBytes ()
   {
+  for (byte i = lowFuse; i <= calibrationByte; i++)
+    fuses [i] = readFuse (i);
+
   Serial.print (F("LFuse = "));
-  showHex (readFuse (lowFuse), true);
+  showHex (fuses [lowFuse], true);
   Serial.print (F("HFuse = "));
-  showHex (readFuse (highFuse), true);
+  showHex (fuses [highFuse], true);
   Serial.print (F("EFuse = "));
-  showHex (readFuse (extFuse), true);
+  showHex (fuses [extFuse], true);
   Serial.print (F("Lock byte = "));
-  showHex (readFuse (lockByte), true);
+  showHex (fuses [lockByte], true);
   Serial.print (F("Clock calibration = "));
-  showHex (readFuse (calibrationByte), true);
+  showHex (fuses [calibrationByte], true);
   }  // end of getFuseBytes
 
 bootloaderType currentBootloader;
 
+#if SD_BOOTLOADERS
+  // SD chip select pin
+  #if USE_ETHERNET_SHIELD
+    const uint8_t chipSelect = 4;   // Ethernet shield uses D4 as SD select
+  #else
+    const uint8_t chipSelect = SS;  // Otherwise normal slave select
+  #endif
+
+  // file system object
+  SdFat sd;
+
+  // the image being written or verified (see SD_Bootloaders.ino)
+  SdFile bootloaderFile;
+#endif
+
+// verifying stops after this many errors
+const unsigned int MAX_ERRORS_SHOWN = 100;
+
+// start unpacking a bootloader image
+void startUnpacking (unpackType & unpack, const byte * image)
+  {
+  unpack.next = image;
+  unpack.count = 0;
+  unpack.pos = 0;
+#if SD_BOOTLOADERS
+  unpack.file = NULL;
+  unpack.readError = false;
+#endif
+  }  // end of startUnpacking
+
+// Get the next byte of a bootloader image, packed by convertHexToByteArray.
+// Each run starts with a code byte:
+//   0x00 to 0x7F: (code + 1) bytes follow, as they are
+//   0x80 to 0xBF: the low 6 bits and the next byte are a count, (count + 1) copies of the byte after
+//   0xC0 to 0xFF: ((code & 0x3F) + 3) bytes copied from (next byte + 1) bytes back
+// So each page is unpacked straight into the target as it is written, or verified.
+byte unpackByte (unpackType & unpack)
+  {
+#if SD_BOOTLOADERS
+  if (unpack.file)
+    {
+    int c = unpack.file->read ();
+    if (c < 0)
+      {
+      unpack.readError = true;
+      c = 0xFF;
+      }
+    unpack.window [unpack.pos++] = c;
+    return c;
+    }  // end of reading from the SD card
+#endif
+
+  if (unpack.count == 0)
+    {
+    unpack.code = pgm_read_byte (unpack.next++);
+    if (unpack.code < 0x80)
+      unpack.count = unpack.code + 1;
+    else if (unpack.code < 0xC0)
+      {
+      unpack.count = (word (unpack.code & 0x3F, pgm_read_byte (unpack.next++))) + 1;
+      unpack.value = pgm_read_byte (unpack.next++);
+      }
+    else
+      {
+      unpack.count = (unpack.code & 0x3F) + 3;
+      unpack.value = pgm_read_byte (unpack.next++);
+      }
+    }  // end of starting a new run
+
+  byte b;
+  if (unpack.code < 0x80)
+    b = pgm_read_byte (unpack.next++);
+  else if (unpack.code < 0xC0)
+    b = unpack.value;
+  else
+    b = unpack.window [(byte) (unpack.pos - unpack.value - 1)];
+
+  unpack.count--;
+  unpack.window [unpack.pos++] = b;
+  return b;
+  }  // end of unpackByte
+
 
 // burn the bootloader to the target device
 void writeBootloader ()
   {
   bool foundBootloader = false;
+  bool fromSD = false;
 
-  for (unsigned int j = 0; j < NUMITEMS (bootloaders); j++)
+#if SD_BOOTLOADERS
+  // ones on the SD card take priority over the ones built in
+  fromSD = foundBootloader = findSDBootloader ();
+#endif
+
+  for (unsigned int j = 0; j < NUMITEMS (bootloaders) && !foundBootloader; j++)
     {
 
     memcpy_P (&currentBootloader, &bootloaders [j], sizeof currentBootloader);
@@ -390,27 +655,21 @@ void writeBootloader ()
     return;
     }
 
-  unsigned int i;
-
-  byte lFuse = readFuse (lowFuse);
-
   byte newlFuse = currentBootloader.lowFuse;
   byte newhFuse = currentBootloader.highFuse;
-  byte newextFuse = currentBootloader.extFuse;
-  byte newlockByte = currentBootloader.lockByte;
 
 
   unsigned long addr = currentBootloader.loaderStart;
   unsigned int  len = currentBootloader.loaderLength;
-  unsigned long pagesize = currentSignature.pageSize;
-  unsigned long pagemask = ~(pagesize - 1);
   const byte * bootloader = currentBootloader.bootloader;
+  unpackType unpack;
 
 
   byte subcommand = 'U';
 
   // Atmega328P or Atmega328
-  if (currentBootloader.sig [0] == 0x1E &&
+  if (!fromSD &&
+      currentBootloader.sig [0] == 0x1E &&
       currentBootloader.sig [1] == 0x95 &&
       (currentBootloader.sig [2] == 0x0F || currentBootloader.sig [2] == 0x14)
       )
@@ -428,7 +687,7 @@ void writeBootloader ()
       newlFuse = 0xE2;  // internal 8 MHz oscillator
       newhFuse = 0xDA;  //  2048 byte bootloader, SPI enabled
       addr = 0x7800;
-      len = sizeof ATmegaBOOT_168_atmega328_pro_8MHz_hex;
+      len = ATmegaBOOT_168_atmega328_pro_8MHz_hex_length;
       }  // end of using the 8 MHz clock
     else
       Serial.println (F("Using Uno Optiboot 16 MHz loader."));
@@ -441,9 +700,6 @@ void writeBootloader ()
   Serial.print (len);
   Serial.println (F(" bytes."));
 
-
-  unsigned long oldPage = addr & pagemask;
-
   Serial.println (F("Type 'Q' to quit, 'V' to verify, or 'G' to program the chip with the bootloader ..."));
   char command;
   do
@@ -459,73 +715,97 @@ void writeBootloader ()
     {
 
     // Automatically fix up fuse to run faster, then write to device
-    if (lFuse != newlFuse)
+    if (fuses [lowFuse] != newlFuse)
       {
-      if ((lFuse & 0x80) == 0)
+      if ((fuses [lowFuse] & 0x80) == 0)
         Serial.println (F("Clearing 'Divide clock by 8' fuse bit."));
 
       Serial.println (F("Fixing low fuse setting ..."));
-      writeFuse (newlFuse, lowFuse);
-      delay (1000);
-      stopProgramming ();  // latch fuse
-      if (!startProgramming ())
+      fusePlanType clockPlan;
+      clockPlan.fuses [lowFuse] = newlFuse;
+      clockPlan.mask = bit (lowFuse);
+      if (writeFusePlan (clockPlan) || !relatchFuses ())
         return;
-      delay (1000);
       }
 
     Serial.println (F("Erasing chip ..."));
     eraseMemory ();
     Serial.println (F("Writing bootloader ..."));
-    for (i = 0; i < len; i += 2)
-      {
-      unsigned long thisPage = (addr + i) & pagemask;
-      // page changed? commit old one
-      if (thisPage != oldPage)
-        {
-        commitPage (oldPage, true);
-        oldPage = thisPage;
-        }
-      writeFlash (addr + i, pgm_read_byte(bootloader + i));
-      writeFlash (addr + i + 1, pgm_read_byte(bootloader + i + 1));
-      }  // end while doing each word
-
-    // commit final page
-    commitPage (oldPage, true);
-    Serial.println (F("Written."));
     }  // end if programming
+  else
+    Serial.println (F("Verifying ..."));
 
-  Serial.println (F("Verifying ..."));
-
-  // count errors
+  // Each page is unpacked into the page buffer, committed, and then read back straight
+  // away, comparing it to the bytes just unpacked (which are still in unpack.window).
+  const unsigned int pageSize = currentSignature.pageSize;  // no more than 256, the size of unpack.window
   unsigned int errors = 0;
-  // check each byte
-  for (i = 0; i < len; i++)
+  progressBarCount = 0;
+  startUnpacking (unpack, bootloader);
+#if SD_BOOTLOADERS
+  if (fromSD)
+    unpack.file = &bootloaderFile;
+#endif
+  for (unsigned int offset = 0; offset < len && errors < MAX_ERRORS_SHOWN; offset += pageSize)
     {
-    byte found = readFlash (addr + i);
-    byte expected = pgm_read_byte(bootloader + i);
-    if (found != expected)
+    // how much of the image is in this page
+    const unsigned int count = min (pageSize, len - offset);
+
+    if (command == 'G')
+      {
+      // only the low bits of the address matter when loading the page buffer;
+      // the rest of the last page is filled with 0xFF, so it needn't be cleared after committing
+      for (unsigned int j = 0; j < pageSize; j++)
+        writeFlash (j, (j < count) ? unpackByte (unpack) : 0xFF);
+      commitPage (addr + offset, false, false);
+      }
+    else
       {
-      if (errors <= 100)
+      for (unsigned int j = 0; j < count; j++)
+        unpackByte (unpack);
+      showProgress ();
+      }
+
+    for (unsigned int j = 0; j < count && errors < MAX_ERRORS_SHOWN; j++)
+      {
+      byte found = readFlash (addr + offset + j);
+      byte expected = unpack.window [(byte) (unpack.pos - count + j)];
+      if (found != expected)
         {
+        if (errors == 0)
+          Serial.println ();
         Serial.print (F("Verification error at address "));
-        Serial.print (addr + i, HEX);
+        Serial.print (addr + offset + j, HEX);
         Serial.print (F(". Got: "));
         showHex (found);
         Serial.print (F(" Expected: "));
         showHex (expected, true);
-        }  // end of haven't shown 100 errors yet
-      errors++;
-      }  // end if error
-    }  // end of for
+        errors++;
+        }  // end if error
+      }  // end of for each byte in the page
+    }  // end of for each page
+
+  Serial.println ();
+
+#if SD_BOOTLOADERS
+  if (unpack.readError)
+    {
+    Serial.println (F("Error reading bootloader from SD card."));
+    return;  // don't change fuses if errors
+    }
+#endif
 
   if (errors == 0)
+    {
+    if (command == 'G')
+      Serial.println (F("Written."));
     Serial.println (F("No errors found."));
+    }
   else
     {
     Serial.print (errors, DEC);
     Serial.println (F(" verification error(s)."));
-    if (errors > 100)
-      Serial.println (F("First 100 shown."));
+    if (errors >= MAX_ERRORS_SHOWN)
+      Serial.println (F("Stopped after that many."));
     return;  // don't change fuses if errors
     }  // end if
 
@@ -533,13 +813,19 @@ void writeBootloader ()
     {
     Serial.println (F("Writing fuses ..."));
 
-    writeFuse (newlFuse, lowFuse);
-    writeFuse (newhFuse, highFuse);
-    writeFuse (newextFuse, extFuse);
-    writeFuse (newlockByte, lockByte);
-
-    // confirm them
-    getFuseBytes ();
+    // only the ones which changed are written (lock byte last), then read back
+    fusePlanType plan;
+    plan.fuses [lowFuse]  = newlFuse;
+    plan.fuses [highFuse] = newhFuse;
+    plan.fuses [extFuse]  = currentBootloader.extFuse;
+    plan.fuses [lockByte] = currentBootloader.lockByte;
+    plan.mask = 0;
+    for (byte j = lowFuse; j <= lockByte; j++)
+      if (plan.fuses [j])
+        plan.mask |= bit (j);
+
+    if (writeFusePlan (plan))
+      return;
     }  // end if programming
 
   Serial.println (F("Done."));
@@ -558,24 +844,19 @@ void getSignature ()
 
   Serial.println ();
 
-  for (unsigned int j = 0; j < NUMITEMS (signatures); j++)
+  foundSig = findSignature (sig);
+  if (foundSig != -1)
     {
-
-    memcpy_P (&currentSignature, &signatures [j], sizeof currentSignature);
-
-    if (memcmp (sig, currentSignature.sig, sizeof sig) == 0)
-      {
-      foundSig = j;
-      Serial.print (F("Processor = "));
-      Serial.println (currentSignature.desc);
-      Serial.print (F("Flash memory size = "));
-      Serial.print (currentSignature.flashSize, DEC);
-      Serial.println (F(" bytes."));
-      if (currentSignature.timedWrites)
-        Serial.println (F("Writes are timed, not polled."));
-      return;
-      }  // end of signature found
-    }  // end of for each signature
+    memcpy_P (&currentSignature, &signatures [foundSig], sizeof currentSignature);
+    Serial.print (F("Processor = "));
+    Serial.println (currentSignature.desc);
+    Serial.print (F("Flash memory size = "));
+    Serial.print (currentSignature.flashSize, DEC);
+    Serial.println (F(" bytes."));
+    if (currentSignature.timedWrites)
+      Serial.println (F("Writes are timed, not polled."));
+    return;
+    }  // end of signature found
 
   Serial.println (F("Unrecogized signature."));
   }  // end of getSignature
@@ -592,6 +873,10 @@ void setup ()
 
   initPins ();
 
+#if SD_BOOTLOADERS
+  initSDBootloaders ();
+#endif
+
  }  // end of setup
 
 void loop ()
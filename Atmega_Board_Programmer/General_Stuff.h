@@ -25,6 +25,11 @@ unsigned int errors;
 const unsigned long NO_PAGE = 0xFFFFFFFF;
 
 unsigned int progressBarCount;
+// true if the serial port is carrying binary data (eg. serial upload), so no progress or messages are shown
+bool serialIsBinary;
+
+// if set, called over and over while waiting for the target to finish writing (see pollUntilReady)
+void (* whileBusy) ();
 
 // if signature found in signature table, this is its index
 int foundSig = -1;
@@ -32,6 +37,12 @@ byte lastAddressMSB = 0;
 // copy of current signature entry for matching processor
 signatureType currentSignature;
 
+// fuses (and lock byte) wanted for a chip, see writeFusePlan
+typedef struct {
+  byte fuses [4];   // indexed by lowFuse, highFuse, extFuse, lockByte
+  byte mask;        // one bit for each of those wanted
+} fusePlanType;
+
       
 // number of items in an array
 #define NUMITEMS(arg) ((unsigned int) (sizeof (arg) / sizeof (arg [0])))
@@ -42,4 +53,4 @@ signatureType currentSignature;
 
 void showHex (const byte b, const boolean newline = false, const boolean show0x = true);
 void showYesNo (const boolean b, const boolean newline = false);
-void commitPage (unsigned long addr, bool showMessage = false);
+void commitPage (unsigned long addr, bool showMessage = false, bool clearAfter = true);
@@ -105,6 +105,41 @@ void writeFlash (unsigned long addr, const byte data)
   
   } // end of writeFlash  
 
+// read a byte from EEPROM
+byte readEEPROM (unsigned long addr)
+  {
+  HVtransfer (SII_LOAD_COMMAND, CMD_READ_EEPROM);
+  HVtransfer (SII_LOAD_ADDRESS_LOW, addr & 0xFF);
+  HVtransfer (SII_LOAD_ADDRESS_HIGH, (addr >> 8) & 0xFF);
+  HVtransfer (SII_READ_EEPROM, 0);
+  return HVtransfer (SII_READ_EEPROM | SII_OR_MASK, 0);
+  } // end of readEEPROM
+
+// write a byte to the EEPROM page buffer (ready for committing)
+void writeEEPROM (unsigned long addr, const byte data)
+  {
+  HVtransfer (SII_LOAD_COMMAND, CMD_WRITE_EEPROM);
+  HVtransfer (SII_LOAD_ADDRESS_LOW, addr & 0xFF);
+  HVtransfer (SII_LOAD_ADDRESS_HIGH, (addr >> 8) & 0xFF);
+  HVtransfer (SII_LOAD_LOW_BYTE, data);
+
+  // latch data into page buffer
+  HVtransfer (SII_PROGRAM_LOW_BYTE, 0);
+  HVtransfer (SII_PROGRAM_LOW_BYTE | SII_OR_MASK, 0);
+  } // end of writeEEPROM
+
+// commit EEPROM page buffer to EEPROM
+void commitEEPROMPage (unsigned long addr)
+  {
+  showProgress ();
+
+  HVtransfer (SII_WRITE_LOW_BYTE, 0);
+  HVtransfer (SII_WRITE_LOW_BYTE | SII_OR_MASK, 0);
+
+  pollUntilReady ();
+  HVtransfer (SII_LOAD_COMMAND, CMD_NO_OPERATION);
+  }  // end of commitEEPROMPage
+
 // read a fuse byte
 byte readFuse (const byte which)
   {
@@ -157,12 +192,13 @@ void pollUntilReady ()
   {
   // wait until not busy
   while (digitalRead (SDO) == LOW)
-    { }
+    if (whileBusy)
+      whileBusy ();
     
   }  // end of pollUntilReady
 
 // commit page to flash memory
-void commitPage (unsigned long addr, bool showMessage)
+void commitPage (unsigned long addr, bool showMessage, bool clearAfter)
   {
   if (showMessage)
     {
@@ -179,7 +215,8 @@ void commitPage (unsigned long addr, bool showMessage)
   HVtransfer (SII_WRITE_LOW_BYTE | SII_OR_MASK, 0);
   
   pollUntilReady (); 
-  clearPage();  // clear ready for next page full
+  if (clearAfter)
+    clearPage();  // clear ready for next page full
   HVtransfer (SII_LOAD_COMMAND, CMD_NO_OPERATION);
   
   }  // end of commitPage
@@ -193,6 +230,7 @@ void eraseMemory ()
   
   pollUntilReady (); 
   clearPage();  // clear temporary page
+  fuses [lockByte] = readFuse (lockByte);  // erasing clears the lock bits
   }  // end of eraseMemory
 
 // write specified value to specified fuse/lock byte
@@ -242,7 +280,8 @@ void writeFuse (const byte newValue, const byte whichFuse)
 // put chip into programming mode    
 bool startProgramming ()
   {
-  Serial.println (F("Activating high-voltage SERIAL programming mode."));
+  if (!serialIsBinary)
+    Serial.println (F("Activating high-voltage SERIAL programming mode."));
   pinMode (SDI, OUTPUT);
   pinMode (SII, OUTPUT);
   pinMode (SDO, OUTPUT);
@@ -267,7 +306,8 @@ void stopProgramming ()
   pinMode (SII, INPUT);
   pinMode (SDO, INPUT);
   pinMode (SCI, INPUT);
-  Serial.println (F("Programming mode off."));
+  if (!serialIsBinary)
+    Serial.println (F("Programming mode off."));
   } // end of stopProgramming  
 
 // called from setup()  
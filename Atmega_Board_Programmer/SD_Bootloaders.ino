@@ -0,0 +1,235 @@
+// SD_Bootloaders.ino
+//
+// Bootloaders read from an SD card, as well as (or instead of) the ones built into the sketch
+//
+// Author: Nick Gammon
+
+#if SD_BOOTLOADERS
+
+/*
+
+The SD card has an index file, BOOTLDRS.TXT, with one line per bootloader, like this:
+
+  # signature  start  lfuse hfuse efuse lock  file
+  1E 95 0F     7E00   FF    DE    FD    EF    OPTI328.BIN
+
+All numbers are in hex. The fuses are as they read back (see bootloaders []), 0 means leave it alone.
+Lines starting with # are comments.
+
+Each image is a binary (not .hex) file, which is written to flash starting at the start address.
+You can make one from a .hex file like this:
+
+  avr-objcopy -I ihex -O binary --gap-fill 0xFF optiboot_atmega328.hex OPTI328.BIN
+
+Without --gap-fill any gaps in the .hex file come out as 0x00, which are then written
+into the bootloader area instead of leaving it erased.
+
+The index is read once, at startup. Bootloaders on the card are used instead of the built-in ones
+for the same chip, so you can make the USE_ATMEGAxxx defines false to save program memory.
+
+*/
+
+#define BOOTLOADER_INDEX "BOOTLDRS.TXT"
+
+const int MAX_FILENAME = 13;          // 8.3 plus the trailing null
+const byte MAX_SD_BOOTLOADERS = 10;   // each one takes about 30 bytes of RAM
+
+// what we know about each bootloader on the card
+typedef struct {
+   bootloaderType loader;       // as in bootloaders [] (but loader.bootloader is not used)
+   char fileName [MAX_FILENAME];
+} sdBootloaderType;
+
+sdBootloaderType sdBootloaders [MAX_SD_BOOTLOADERS];
+byte sdBootloaderCount;
+
+// get a hex number, moving p past it, returns true if there wasn't one
+bool getHexNumber (char * & p, unsigned long & value)
+  {
+  char * start = p;
+  value = strtoul (start, &p, 16);
+  return p == start;
+  }  // end of getHexNumber
+
+// parse one line of the index into the next entry in sdBootloaders, returns true on error
+bool parseBootloaderLine (char * p, const unsigned int lineNumber)
+  {
+  sdBootloaderType & entry = sdBootloaders [sdBootloaderCount];
+
+  // signature (3), start address, fuses (4)
+  unsigned long values [8];
+  bool error = false;
+  for (byte i = 0; i < NUMITEMS (values) && !error; i++)
+    error = getHexNumber (p, values [i]) || (i != 3 && values [i] > 0xFF);
+
+  // file name
+  while (isspace (*p))
+    p++;
+  byte len = 0;
+  while (*p && !isspace (*p) && len < MAX_FILENAME - 1)
+    entry.fileName [len++] = *p++;
+  entry.fileName [len] = 0;
+  if (len == 0 || (*p && !isspace (*p)))
+    error = true;
+
+  Serial.print (F(BOOTLOADER_INDEX " line "));
+  Serial.print (lineNumber);
+  Serial.print (F(": "));
+
+  if (error)
+    {
+    Serial.println (F("Expected: signature (3 bytes), start address, 4 fuses, file name"));
+    return true;
+    }
+
+  for (byte i = 0; i < 3; i++)
+    entry.loader.sig [i] = values [i];
+  entry.loader.loaderStart = values [3];
+  entry.loader.bootloader = NULL;
+  entry.loader.lowFuse  = values [4];
+  entry.loader.highFuse = values [5];
+  entry.loader.extFuse  = values [6];
+  entry.loader.lockByte = values [7];
+
+  // check it will fit the chip it is for
+  const int sigIndex = findSignature (entry.loader.sig);
+  if (sigIndex == -1)
+    {
+    Serial.println (F("Unknown signature"));
+    return true;
+    }
+
+  signatureType sig;
+  memcpy_P (&sig, &signatures [sigIndex], sizeof sig);
+
+  SdFile image;
+  if (!image.open (entry.fileName, O_READ))
+    {
+    Serial.print (F("Cannot open "));
+    Serial.println (entry.fileName);
+    return true;
+    }
+  const unsigned long size = image.fileSize ();
+  image.close ();
+
+  if (size == 0 || size > 0xFFFF || (entry.loader.loaderStart % sig.pageSize) != 0 ||
+      entry.loader.loaderStart + size > sig.flashSize)
+    {
+    Serial.print (entry.fileName);
+    Serial.print (F(" does not fit the "));
+    Serial.println (sig.desc);
+    return true;
+    }
+
+  entry.loader.loaderLength = size;
+
+  Serial.print (entry.fileName);
+  Serial.print (F(" for "));
+  Serial.print (sig.desc);
+  Serial.print (F(" at 0x"));
+  Serial.print (entry.loader.loaderStart, HEX);
+  Serial.print (F(" ("));
+  Serial.print (size);
+  Serial.println (F(" bytes)"));
+  return false;
+  }  // end of parseBootloaderLine
+
+// read the index of bootloaders on the SD card into sdBootloaders
+void initSDBootloaders ()
+  {
+  sdBootloaderCount = 0;
+
+  Serial.println (F("Reading SD card ..."));
+
+  // initialize the SD card at SPI_HALF_SPEED to avoid bus errors with
+  // breadboards.  use SPI_FULL_SPEED for better performance.
+  if (!sd.begin (chipSelect, SPI_HALF_SPEED))
+    {
+    sd.initErrorPrint();
+    return;
+    }
+
+  SdFile index;
+  if (!index.open (BOOTLOADER_INDEX, O_READ))
+    {
+    Serial.println (F("No " BOOTLOADER_INDEX " on SD card."));
+    return;
+    }
+
+  char line [60];
+  unsigned int lineNumber = 0;
+  while (index.fgets (line, sizeof line) > 0)
+    {
+    lineNumber++;
+
+    char * p = line;
+    while (isspace (*p))
+      p++;
+    if (*p == 0 || *p == '#')
+      continue;  // blank or comment
+
+    if (sdBootloaderCount >= MAX_SD_BOOTLOADERS)
+      {
+      Serial.println (F("Too many bootloaders on SD card, the rest are ignored."));
+      break;
+      }
+
+    if (!parseBootloaderLine (p, lineNumber))
+      sdBootloaderCount++;
+    }  // end of for each line
+
+  index.close ();
+
+  Serial.print (sdBootloaderCount);
+  Serial.println (F(" bootloader(s) on SD card."));
+  }  // end of initSDBootloaders
+
+// look for a bootloader on the SD card for the current signature, letting them choose if there
+// are several, returns true (with currentBootloader set up and bootloaderFile open) if found
+bool findSDBootloader ()
+  {
+  byte matches [MAX_SD_BOOTLOADERS];
+  byte count = 0;
+
+  // only 9 can be chosen from, by a single digit
+  for (byte i = 0; i < sdBootloaderCount && count < 9; i++)
+    if (memcmp (sdBootloaders [i].loader.sig, currentSignature.sig, sizeof currentSignature.sig) == 0)
+      matches [count++] = i;
+
+  if (count == 0)
+    return false;
+
+  byte choice = 0;
+  if (count > 1)
+    {
+    Serial.println (F("Bootloaders on SD card for this chip:"));
+    for (byte i = 0; i < count; i++)
+      {
+      Serial.print (i + 1);
+      Serial.print (F(": "));
+      Serial.println (sdBootloaders [matches [i]].fileName);
+      }
+    Serial.println (F("Type the number of the one to use ..."));
+    do
+      {
+      choice = Serial.read () - '1';
+      } while (choice >= count);
+    }  // end of more than one
+
+  const sdBootloaderType & entry = sdBootloaders [matches [choice]];
+  bootloaderFile.close ();  // in case still open from last time
+  if (!bootloaderFile.open (entry.fileName, O_READ))
+    {
+    Serial.print (F("Cannot open "));
+    Serial.println (entry.fileName);
+    return false;
+    }
+
+  currentBootloader = entry.loader;
+  Serial.print (F("Using "));
+  Serial.print (entry.fileName);
+  Serial.println (F(" from SD card."));
+  return true;
+  }  // end of findSDBootloader
+
+#endif // SD_BOOTLOADERS
@@ -5,9 +5,10 @@
 // Author: Nick Gammon
 
 /* ----------------------------------------------------------------------------
-NOTE: This file should only be modified in the Atmega_Hex_Uploader directory.
-Copies in other directories are hard-linked to this one.
-After modifying it run the shell script:
+NOTE: This file is generated from devices.txt by generateDeviceTables.
+Change devices.txt and regenerate it, rather than editing it here.
+Copies in other directories are hard-linked to the one in Atmega_Hex_Uploader.
+After regenerating it run the shell script:
   fixup_links.sh
 This script needs to be run in the directories:
   Atmega_Board_Programmer and Atmega_Board_Detector
@@ -36,83 +37,104 @@ typedef struct {
    unsigned long pageSize;      // flash programming page size (bytes)
    byte fuseWithBootloaderSize; // ie. one of: lowFuse, highFuse, extFuse
    bool timedWrites;            // true if pollUntilReady won't work by polling the chip
+   unsigned int eepromSize;     // how big the EEPROM is (bytes)
+   byte eepromPageSize;         // EEPROM programming page size (bytes), 0 if byte writes only
 } signatureType;
 
 const unsigned long kb = 1024;
 const byte NO_FUSE = 0xFF;
 
 
-// see Atmega datasheets
+// see Atmega datasheets - sorted by signature, for findSignature ()
 const signatureType signatures [] PROGMEM =
   {
-//     signature        description   flash size   bootloader  flash  fuse     timed
-//                                                     size    page    to      writes
-//                                                             size   change
+  { { 0x1E, 0x90, 0x07 }, "ATtiny13A",       1 * kb,         0,   32, NO_FUSE,  false,    64, 4 },  // ATtiny13 family
+  { { 0x1E, 0x91, 0x08 }, "ATtiny25",        2 * kb,         0,   32, NO_FUSE,  false,   128, 4 },  // Attiny85 family
+  { { 0x1E, 0x91, 0x0A }, "ATtiny2313A",     2 * kb,         0,   32, NO_FUSE,  false,   128, 4 },  // ATtiny4313 family
+  { { 0x1E, 0x91, 0x0B }, "ATtiny24",        2 * kb,         0,   32, NO_FUSE,  false,   128, 4 },  // Attiny84 family
+  { { 0x1E, 0x92, 0x06 }, "ATtiny45",        4 * kb,         0,   64, NO_FUSE,  false,   256, 4 },  // Attiny85 family
+  { { 0x1E, 0x92, 0x07 }, "ATtiny44",        4 * kb,         0,   64, NO_FUSE,  false,   256, 4 },  // Attiny84 family
+  { { 0x1E, 0x92, 0x0A }, "ATmega48PA",      4 * kb,         0,   64, NO_FUSE,  false,   256, 4 },  // Atmega328 family
+  { { 0x1E, 0x92, 0x0D }, "ATtiny4313",      4 * kb,         0,   64, NO_FUSE,  false,   256, 4 },  // ATtiny4313 family
+  { { 0x1E, 0x93, 0x07 }, "ATmega8A",        8 * kb,       256,   64, highFuse, true,    512, 0 },  // Atmega8A family
+  { { 0x1E, 0x93, 0x0B }, "ATtiny85",        8 * kb,         0,   64, NO_FUSE,  false,   512, 4 },  // Attiny85 family
+  { { 0x1E, 0x93, 0x0C }, "ATtiny84",        8 * kb,         0,   64, NO_FUSE,  false,   512, 4 },  // Attiny84 family
+  { { 0x1E, 0x93, 0x0F }, "ATmega88PA",      8 * kb,       256,  128, extFuse,  false,   512, 4 },  // Atmega328 family
+  { { 0x1E, 0x93, 0x82 }, "At90USB82",       8 * kb,       512,  128, highFuse, false,   512, 4 },  // AT90USB family
+  { { 0x1E, 0x93, 0x89 }, "ATmega8U2",       8 * kb,       512,  128, highFuse, false,   512, 4 },  // Atmega32U2 family
+  { { 0x1E, 0x94, 0x06 }, "ATmega168V",     16 * kb,       256,  128, extFuse,  false,   512, 4 },  // Atmega328 family
+  { { 0x1E, 0x94, 0x0A }, "ATmega164P",     16 * kb,       256,  128, highFuse, false,   512, 4 },  // Atmega644 family
+  { { 0x1E, 0x94, 0x0B }, "ATmega168PA",    16 * kb,       256,  128, extFuse,  false,   512, 4 },  // Atmega328 family
+  { { 0x1E, 0x94, 0x82 }, "At90USB162",     16 * kb,       512,  128, highFuse, false,   512, 4 },  // AT90USB family
+  { { 0x1E, 0x94, 0x88 }, "ATmega16U4",     16 * kb,       512,  128, highFuse, false,   512, 4 },  // Atmega32U4 family
+  { { 0x1E, 0x94, 0x89 }, "ATmega16U2",     16 * kb,       512,  128, highFuse, false,   512, 4 },  // Atmega32U2 family
+  { { 0x1E, 0x95, 0x08 }, "ATmega324P",     32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega644 family
+  { { 0x1E, 0x95, 0x0F }, "ATmega328P",     32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega328 family
+  { { 0x1E, 0x95, 0x14 }, "ATmega328",      32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega328 family
+  { { 0x1E, 0x95, 0x16 }, "ATmega328PB",    32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega328 family
+  { { 0x1E, 0x95, 0x87 }, "ATmega32U4",     32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega32U4 family
+  { { 0x1E, 0x95, 0x8A }, "ATmega32U2",     32 * kb,       512,  128, highFuse, false,  1024, 4 },  // Atmega32U2 family
+  { { 0x1E, 0x96, 0x08 }, "ATmega640",      64 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // Atmega2560 family
+  { { 0x1E, 0x96, 0x0A }, "ATmega644P",     64 * kb,    1 * kb,  256, highFuse, false,  2048, 8 },  // Atmega644 family
+  { { 0x1E, 0x97, 0x03 }, "ATmega1280",    128 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // Atmega2560 family
+  { { 0x1E, 0x97, 0x04 }, "ATmega1281",    128 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // Atmega2560 family
+  { { 0x1E, 0x97, 0x05 }, "ATmega1284P",   128 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // ATmega1284P family
+  { { 0x1E, 0x97, 0x06 }, "ATmega1284",    128 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // ATmega1284P family
+  { { 0x1E, 0x98, 0x01 }, "ATmega2560",    256 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // Atmega2560 family
+  { { 0x1E, 0x98, 0x02 }, "ATmega2561",    256 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // Atmega2560 family
+  { { 0x1E, 0xA6, 0x02 }, "ATmega64rfr2",  256 * kb,    1 * kb,  256, highFuse, false,  2048, 8 },  // ATmega64rfr2 family
+  { { 0x1E, 0xA7, 0x02 }, "ATmega128rfr2", 256 * kb,    1 * kb,  256, highFuse, false,  4096, 8 },  // ATmega64rfr2 family
+  { { 0x1E, 0xA8, 0x02 }, "ATmega256rfr2", 256 * kb,    1 * kb,  256, highFuse, false,  8192, 8 },  // ATmega64rfr2 family
 
-  // Attiny84 family
-  { { 0x1E, 0x91, 0x0B }, "ATtiny24",   2 * kb,           0,   32,   NO_FUSE,  false  },
-  { { 0x1E, 0x92, 0x07 }, "ATtiny44",   4 * kb,           0,   64,   NO_FUSE,  false  },
-  { { 0x1E, 0x93, 0x0C }, "ATtiny84",   8 * kb,           0,   64,   NO_FUSE,  false  },
-
-  // Attiny85 family
-  { { 0x1E, 0x91, 0x08 }, "ATtiny25",   2 * kb,           0,   32,   NO_FUSE,  false  },
-  { { 0x1E, 0x92, 0x06 }, "ATtiny45",   4 * kb,           0,   64,   NO_FUSE,  false  },
-  { { 0x1E, 0x93, 0x0B }, "ATtiny85",   8 * kb,           0,   64,   NO_FUSE,  false  },
-
-  // Atmega328 family
-  { { 0x1E, 0x92, 0x0A }, "ATmega48PA",   4 * kb,         0,    64,  NO_FUSE,  false  },
-  { { 0x1E, 0x93, 0x0F }, "ATmega88PA",   8 * kb,       256,   128,  extFuse,  false },
-  { { 0x1E, 0x94, 0x0B }, "ATmega168PA", 16 * kb,       256,   128,  extFuse,  false },
-  { { 0x1E, 0x94, 0x06 }, "ATmega168V",  16 * kb,       256,   128,  extFuse,  false },
-  { { 0x1E, 0x95, 0x0F }, "ATmega328P",  32 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x16 }, "ATmega328PB", 32 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x14 }, "ATmega328",   32 * kb,       512,   128,  highFuse, false },
-
-  // Atmega644 family
-  { { 0x1E, 0x94, 0x0A }, "ATmega164P",   16 * kb,      256,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x08 }, "ATmega324P",   32 * kb,      512,   128,  highFuse, false },
-  { { 0x1E, 0x96, 0x0A }, "ATmega644P",   64 * kb,   1 * kb,   256,  highFuse, false },
-
-  // Atmega2560 family
-  { { 0x1E, 0x96, 0x08 }, "ATmega640",    64 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x97, 0x03 }, "ATmega1280",  128 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x97, 0x04 }, "ATmega1281",  128 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x98, 0x01 }, "ATmega2560",  256 * kb,   1 * kb,   256,  highFuse, false },
-
-  { { 0x1E, 0x98, 0x02 }, "ATmega2561",  256 * kb,   1 * kb,   256,  highFuse, false },
-
-  // AT90USB family
-  { { 0x1E, 0x93, 0x82 }, "At90USB82",    8 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x94, 0x82 }, "At90USB162",  16 * kb,       512,   128,  highFuse, false },
-
-  // Atmega32U2 family
-  { { 0x1E, 0x93, 0x89 }, "ATmega8U2",    8 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x94, 0x89 }, "ATmega16U2",  16 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x8A }, "ATmega32U2",  32 * kb,       512,   128,  highFuse, false },
-
-  // Atmega32U4 family -  (datasheet is wrong about flash page size being 128 words)
-  { { 0x1E, 0x94, 0x88 }, "ATmega16U4",  16 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x87 }, "ATmega32U4",  32 * kb,       512,   128,  highFuse, false },
-
-  // ATmega1284P family
-  { { 0x1E, 0x97, 0x05 }, "ATmega1284P", 128 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x97, 0x06 }, "ATmega1284",  128 * kb,   1 * kb,   256,  highFuse, false },
-
-  // ATtiny4313 family
-  { { 0x1E, 0x91, 0x0A }, "ATtiny2313A",   2 * kb,        0,    32,  NO_FUSE,  false   },
-  { { 0x1E, 0x92, 0x0D }, "ATtiny4313",    4 * kb,        0,    64,  NO_FUSE,  false   },
-
-  // ATtiny13 family
-  { { 0x1E, 0x90, 0x07 }, "ATtiny13A",     1 * kb,        0,    32,  NO_FUSE,  false  },
+  };  // end of signatures
 
-   // Atmega8A family
-  { { 0x1E, 0x93, 0x07 }, "ATmega8A",      8 * kb,      256,    64,  highFuse, true },
+// signatures [] entries with a middle byte of n start at
+//   signatureIndex [n - FIRST_SIGNATURE_MIDDLE] and stop before the next one
+const byte FIRST_SIGNATURE_MIDDLE = 0x90;
+const byte LAST_SIGNATURE_MIDDLE = 0xA8;
 
-  // ATmega64rfr2 family
-  { { 0x1E, 0xA6, 0x02 }, "ATmega64rfr2",  256 * kb, 1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0xA7, 0x02 }, "ATmega128rfr2", 256 * kb, 1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0xA8, 0x02 }, "ATmega256rfr2", 256 * kb, 1 * kb,   256,  highFuse, false },
+const byte signatureIndex [] PROGMEM =
+  {
+   0,  // 0x90
+   1,  // 0x91
+   4,  // 0x92
+   8,  // 0x93
+  14,  // 0x94
+  20,  // 0x95
+  26,  // 0x96
+  28,  // 0x97
+  32,  // 0x98
+  34,  // 0x99
+  34,  // 0x9A
+  34,  // 0x9B
+  34,  // 0x9C
+  34,  // 0x9D
+  34,  // 0x9E
+  34,  // 0x9F
+  34,  // 0xA0
+  34,  // 0xA1
+  34,  // 0xA2
+  34,  // 0xA3
+  34,  // 0xA4
+  34,  // 0xA5
+  34,  // 0xA6
+  35,  // 0xA7
+  36,  // 0xA8
+  37,  // 0xA9
+  };  // end of signatureIndex
+
+// returns the index into signatures [] of this signature, or -1 if not known
+int findSignature (const byte sig [3])
+  {
+  if (sig [0] != 0x1E || sig [1] < FIRST_SIGNATURE_MIDDLE || sig [1] > LAST_SIGNATURE_MIDDLE)
+    return -1;
 
-  };  // end of signatures
+  const byte * bucket = &signatureIndex [sig [1] - FIRST_SIGNATURE_MIDDLE];
+  const byte stop = pgm_read_byte (bucket + 1);
+  for (byte j = pgm_read_byte (bucket); j < stop; j++)
+    if (pgm_read_byte (&signatures [j].sig [2]) == sig [2])
+      return j;
 
+  return -1;
+  }  // end of findSignature
 
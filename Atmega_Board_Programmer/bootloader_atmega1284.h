@@ -2,38 +2,39 @@
 // Loader start: 1FC00, length: 1024
 // MD5 sum = 71 DD C2 84 64 C4 73 27 D2 33 01 1E FA E1 24 4B 
 
+// Packed by convertHexToByteArray: 499 bytes, 508 unpacked
+const unsigned int optiboot_atmega1284p_hex_length = 508;
 const byte optiboot_atmega1284p_hex [] PROGMEM = {
-0x0F, 0x92, 0xCD, 0xB7, 0xDE, 0xB7, 0x11, 0x24, 0x84, 0xB7, 0x14, 0xBE, 0x81, 0xFF, 0xF1, 0xD0, 
-0x85, 0xE0, 0x80, 0x93, 0x81, 0x00, 0x82, 0xE0, 0x80, 0x93, 0xC0, 0x00, 0x88, 0xE1, 0x80, 0x93, 
-0xC1, 0x00, 0x86, 0xE0, 0x80, 0x93, 0xC2, 0x00, 0x80, 0xE1, 0x80, 0x93, 0xC4, 0x00, 0x8E, 0xE0, 
-0xCA, 0xD0, 0x20, 0x9A, 0x26, 0xE0, 0x80, 0xE3, 0x9C, 0xEF, 0x31, 0xE0, 0x90, 0x93, 0x85, 0x00, 
-0x80, 0x93, 0x84, 0x00, 0x36, 0xBB, 0xB0, 0x9B, 0xFE, 0xCF, 0x18, 0x9A, 0xA8, 0x95, 0x21, 0x50, 
-0xA9, 0xF7, 0x00, 0xE0, 0x10, 0xE0, 0xEE, 0x24, 0xE3, 0x94, 0xE1, 0xE1, 0xDE, 0x2E, 0xF3, 0xE0, 
-0xFF, 0x2E, 0xA5, 0xD0, 0x81, 0x34, 0x71, 0xF4, 0xA2, 0xD0, 0x89, 0x83, 0xB2, 0xD0, 0x89, 0x81, 
-0x82, 0x38, 0x09, 0xF4, 0x8B, 0xC0, 0x81, 0x38, 0x11, 0xF4, 0x84, 0xE0, 0x01, 0xC0, 0x83, 0xE0, 
-0x8F, 0xD0, 0x8B, 0xC0, 0x82, 0x34, 0x11, 0xF4, 0x84, 0xE1, 0x03, 0xC0, 0x85, 0x34, 0x19, 0xF4, 
-0x85, 0xE0, 0xA7, 0xD0, 0x82, 0xC0, 0x85, 0x35, 0x91, 0xF4, 0x89, 0xD0, 0xA8, 0x2E, 0xBB, 0x24, 
-0x86, 0xD0, 0x08, 0x2F, 0x10, 0xE0, 0x10, 0x2F, 0x00, 0x27, 0x0A, 0x29, 0x1B, 0x29, 0x81, 0x2F, 
-0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F, 0x8B, 0xBF, 0x00, 0x0F, 0x11, 0x1F, 0x6D, 0xC0, 0x86, 0x35, 
-0x21, 0xF4, 0x84, 0xE0, 0x8E, 0xD0, 0x80, 0xE0, 0xDB, 0xCF, 0x84, 0x36, 0x09, 0xF0, 0x40, 0xC0, 
-0x6E, 0xD0, 0x6D, 0xD0, 0xC8, 0x2E, 0x6B, 0xD0, 0x80, 0xEE, 0x00, 0x30, 0x18, 0x07, 0x18, 0xF4, 
-0xF8, 0x01, 0xF7, 0xBE, 0xE8, 0x95, 0xA1, 0x2C, 0x51, 0xE0, 0xB5, 0x2E, 0x60, 0xD0, 0xF5, 0x01, 
-0x81, 0x93, 0x5F, 0x01, 0xCE, 0x16, 0xD1, 0xF7, 0xF0, 0xEE, 0x00, 0x30, 0x1F, 0x07, 0x18, 0xF0, 
-0xF8, 0x01, 0xF7, 0xBE, 0xE8, 0x95, 0x65, 0xD0, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xF8, 0x01, 
-0xA0, 0xE0, 0xB1, 0xE0, 0x2C, 0x91, 0x30, 0xE0, 0x11, 0x96, 0x8C, 0x91, 0x11, 0x97, 0x90, 0xE0, 
-0x98, 0x2F, 0x88, 0x27, 0x82, 0x2B, 0x93, 0x2B, 0x12, 0x96, 0x0C, 0x01, 0xE7, 0xBE, 0xE8, 0x95, 
-0x11, 0x24, 0x32, 0x96, 0x82, 0xE0, 0xA0, 0x30, 0xB8, 0x07, 0x61, 0xF7, 0x85, 0xE0, 0xF8, 0x01, 
-0x87, 0xBF, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xD7, 0xBE, 0xE8, 0x95, 0x25, 0xC0, 
-0x84, 0x37, 0xA9, 0xF4, 0x2C, 0xD0, 0x2B, 0xD0, 0xB8, 0x2E, 0x29, 0xD0, 0x3A, 0xD0, 0xCB, 0x2C, 
-0x48, 0x01, 0xF4, 0x01, 0x86, 0x91, 0x1C, 0xD0, 0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C, 0xCA, 0x94, 
-0xC1, 0xF7, 0x0F, 0x5F, 0x1F, 0x4F, 0xBA, 0x94, 0x0B, 0x0D, 0x11, 0x1D, 0x0E, 0xC0, 0x85, 0x37, 
-0x39, 0xF4, 0x27, 0xD0, 0x8E, 0xE1, 0x0C, 0xD0, 0x87, 0xE9, 0x0A, 0xD0, 0x85, 0xE0, 0x78, 0xCF, 
-0x81, 0x35, 0x11, 0xF4, 0x88, 0xE0, 0x17, 0xD0, 0x1C, 0xD0, 0x80, 0xE1, 0x01, 0xD0, 0x61, 0xCF, 
-0x90, 0x91, 0xC0, 0x00, 0x95, 0xFF, 0xFC, 0xCF, 0x80, 0x93, 0xC6, 0x00, 0x08, 0x95, 0x80, 0x91, 
-0xC0, 0x00, 0x87, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x84, 0xFD, 0x01, 0xC0, 0xA8, 0x95, 
-0x80, 0x91, 0xC6, 0x00, 0x08, 0x95, 0xE0, 0xE6, 0xF0, 0xE0, 0x98, 0xE1, 0x90, 0x83, 0x80, 0x83, 
-0x08, 0x95, 0xED, 0xDF, 0x80, 0x32, 0x19, 0xF0, 0x88, 0xE0, 0xF5, 0xDF, 0xFF, 0xCF, 0x84, 0xE1, 
-0xDF, 0xCF, 0xCF, 0x93, 0xC8, 0x2F, 0xE3, 0xDF, 0xC1, 0x50, 0xE9, 0xF7, 0xF2, 0xDF, 0xCF, 0x91, 
-0x08, 0x95, 0x80, 0xE0, 0xE8, 0xDF, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94 
-}; // end of optiboot_atmega1284p_hex
-
+0x16, 0x0F, 0x92, 0xCD, 0xB7, 0xDE, 0xB7, 0x11, 0x24, 0x84, 0xB7, 0x14, 0xBE, 0x81, 0xFF, 0xF1,
+0xD0, 0x85, 0xE0, 0x80, 0x93, 0x81, 0x00, 0x82, 0xC0, 0x05, 0x08, 0xC0, 0x00, 0x88, 0xE1, 0x80,
+0x93, 0xC1, 0x00, 0x86, 0xC0, 0x0B, 0x02, 0xC2, 0x00, 0x80, 0xC0, 0x0B, 0x59, 0xC4, 0x00, 0x8E,
+0xE0, 0xCA, 0xD0, 0x20, 0x9A, 0x26, 0xE0, 0x80, 0xE3, 0x9C, 0xEF, 0x31, 0xE0, 0x90, 0x93, 0x85,
+0x00, 0x80, 0x93, 0x84, 0x00, 0x36, 0xBB, 0xB0, 0x9B, 0xFE, 0xCF, 0x18, 0x9A, 0xA8, 0x95, 0x21,
+0x50, 0xA9, 0xF7, 0x00, 0xE0, 0x10, 0xE0, 0xEE, 0x24, 0xE3, 0x94, 0xE1, 0xE1, 0xDE, 0x2E, 0xF3,
+0xE0, 0xFF, 0x2E, 0xA5, 0xD0, 0x81, 0x34, 0x71, 0xF4, 0xA2, 0xD0, 0x89, 0x83, 0xB2, 0xD0, 0x89,
+0x81, 0x82, 0x38, 0x09, 0xF4, 0x8B, 0xC0, 0x81, 0x38, 0x11, 0xF4, 0x84, 0xE0, 0x01, 0xC0, 0x83,
+0xE0, 0x8F, 0xD0, 0x8B, 0xC0, 0x82, 0x34, 0xC0, 0x0D, 0x37, 0xE1, 0x03, 0xC0, 0x85, 0x34, 0x19,
+0xF4, 0x85, 0xE0, 0xA7, 0xD0, 0x82, 0xC0, 0x85, 0x35, 0x91, 0xF4, 0x89, 0xD0, 0xA8, 0x2E, 0xBB,
+0x24, 0x86, 0xD0, 0x08, 0x2F, 0x10, 0xE0, 0x10, 0x2F, 0x00, 0x27, 0x0A, 0x29, 0x1B, 0x29, 0x81,
+0x2F, 0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F, 0x8B, 0xBF, 0x00, 0x0F, 0x11, 0x1F, 0x6D, 0xC0, 0x86,
+0x35, 0x21, 0xC0, 0x47, 0x34, 0x8E, 0xD0, 0x80, 0xE0, 0xDB, 0xCF, 0x84, 0x36, 0x09, 0xF0, 0x40,
+0xC0, 0x6E, 0xD0, 0x6D, 0xD0, 0xC8, 0x2E, 0x6B, 0xD0, 0x80, 0xEE, 0x00, 0x30, 0x18, 0x07, 0x18,
+0xF4, 0xF8, 0x01, 0xF7, 0xBE, 0xE8, 0x95, 0xA1, 0x2C, 0x51, 0xE0, 0xB5, 0x2E, 0x60, 0xD0, 0xF5,
+0x01, 0x81, 0x93, 0x5F, 0x01, 0xCE, 0x16, 0xD1, 0xF7, 0xF0, 0xC0, 0x1F, 0x03, 0x1F, 0x07, 0x18,
+0xF0, 0xC3, 0x1F, 0x26, 0x65, 0xD0, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xF8, 0x01, 0xA0, 0xE0,
+0xB1, 0xE0, 0x2C, 0x91, 0x30, 0xE0, 0x11, 0x96, 0x8C, 0x91, 0x11, 0x97, 0x90, 0xE0, 0x98, 0x2F,
+0x88, 0x27, 0x82, 0x2B, 0x93, 0x2B, 0x12, 0x96, 0x0C, 0x01, 0xE7, 0xC0, 0x29, 0x13, 0x11, 0x24,
+0x32, 0x96, 0x82, 0xE0, 0xA0, 0x30, 0xB8, 0x07, 0x61, 0xF7, 0x85, 0xE0, 0xF8, 0x01, 0x87, 0xBF,
+0xE8, 0x95, 0xC3, 0x3B, 0x00, 0xD7, 0xC0, 0x1D, 0x60, 0x25, 0xC0, 0x84, 0x37, 0xA9, 0xF4, 0x2C,
+0xD0, 0x2B, 0xD0, 0xB8, 0x2E, 0x29, 0xD0, 0x3A, 0xD0, 0xCB, 0x2C, 0x48, 0x01, 0xF4, 0x01, 0x86,
+0x91, 0x1C, 0xD0, 0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C, 0xCA, 0x94, 0xC1, 0xF7, 0x0F, 0x5F, 0x1F,
+0x4F, 0xBA, 0x94, 0x0B, 0x0D, 0x11, 0x1D, 0x0E, 0xC0, 0x85, 0x37, 0x39, 0xF4, 0x27, 0xD0, 0x8E,
+0xE1, 0x0C, 0xD0, 0x87, 0xE9, 0x0A, 0xD0, 0x85, 0xE0, 0x78, 0xCF, 0x81, 0x35, 0x11, 0xF4, 0x88,
+0xE0, 0x17, 0xD0, 0x1C, 0xD0, 0x80, 0xE1, 0x01, 0xD0, 0x61, 0xCF, 0x90, 0x91, 0xC0, 0x00, 0x95,
+0xFF, 0xFC, 0xCF, 0x80, 0x93, 0xC6, 0x00, 0x08, 0x95, 0x80, 0xC0, 0x0D, 0x00, 0x87, 0xC1, 0x0D,
+0xC0, 0x07, 0x04, 0x84, 0xFD, 0x01, 0xC0, 0xA8, 0xC0, 0x11, 0xC1, 0x17, 0x29, 0xE0, 0xE6, 0xF0,
+0xE0, 0x98, 0xE1, 0x90, 0x83, 0x80, 0x83, 0x08, 0x95, 0xED, 0xDF, 0x80, 0x32, 0x19, 0xF0, 0x88,
+0xE0, 0xF5, 0xDF, 0xFF, 0xCF, 0x84, 0xE1, 0xDF, 0xCF, 0xCF, 0x93, 0xC8, 0x2F, 0xE3, 0xDF, 0xC1,
+0x50, 0xE9, 0xF7, 0xF2, 0xDF, 0xCF, 0x91, 0xC0, 0x43, 0x08, 0xE0, 0xE8, 0xDF, 0xEE, 0x27, 0xFF,
+0x27, 0x09, 0x94,
+};  // end of optiboot_atmega1284p_hex
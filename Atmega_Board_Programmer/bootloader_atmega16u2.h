@@ -7,218 +7,187 @@
 // This file from Aduino IDE 1.6.9
 // This file is for flashing the Atmega16U2 chip on the Arduino Uno (the USB interface chip)
 
+// Packed by convertHexToByteArray: 2878 bytes, 3380 unpacked
+const unsigned int Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex_length = 3380;
 const byte Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex [] PROGMEM = {
-0x4B, 0xC0, 0x00, 0x00, 0x64, 0xC0, 0x00, 0x00, 0x62, 0xC0, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00,
-0x5E, 0xC0, 0x00, 0x00, 0x5C, 0xC0, 0x00, 0x00, 0x5A, 0xC0, 0x00, 0x00, 0x58, 0xC0, 0x00, 0x00,
-0x56, 0xC0, 0x00, 0x00, 0x54, 0xC0, 0x00, 0x00, 0x52, 0xC0, 0x00, 0x00, 0xEE, 0xC4, 0x00, 0x00,
-0x4E, 0xC0, 0x00, 0x00, 0x4C, 0xC0, 0x00, 0x00, 0x4A, 0xC0, 0x00, 0x00, 0x48, 0xC0, 0x00, 0x00,
-0x46, 0xC0, 0x00, 0x00, 0x44, 0xC0, 0x00, 0x00, 0x42, 0xC0, 0x00, 0x00, 0x40, 0xC0, 0x00, 0x00,
-0x3E, 0xC0, 0x00, 0x00, 0x3C, 0xC0, 0x00, 0x00, 0x3A, 0xC0, 0x00, 0x00, 0x38, 0xC0, 0x00, 0x00,
-0x36, 0xC0, 0x00, 0x00, 0x34, 0xC0, 0x00, 0x00, 0x32, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00,
-0x2E, 0xC0, 0x00, 0x00, 0x2C, 0xC0, 0x00, 0x00, 0x2A, 0xC0, 0x00, 0x00, 0x28, 0xC0, 0x00, 0x00,
-0x26, 0xC0, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22, 0xC0, 0x00, 0x00, 0x20, 0xC0, 0x00, 0x00,
-0x1E, 0xC0, 0x00, 0x00, 0x1C, 0xC0, 0x00, 0x00, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD2, 0xE0,
-0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xEA, 0xEF, 0xFC, 0xE3, 0x02, 0xC0,
-0x05, 0x90, 0x0D, 0x92, 0xAA, 0x33, 0xB1, 0x07, 0xD9, 0xF7, 0x11, 0xE0, 0xAA, 0xE3, 0xB1, 0xE0,
-0x01, 0xC0, 0x1D, 0x92, 0xAB, 0x35, 0xB1, 0x07, 0xE1, 0xF7, 0x72, 0xD3, 0x14, 0xC6, 0x98, 0xCF,
-0x98, 0x2F, 0x15, 0xC0, 0x80, 0x91, 0xF2, 0x00, 0x88, 0x23, 0x71, 0xF4, 0x80, 0x91, 0xE8, 0x00,
-0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x51, 0xF0, 0x80, 0x91,
-0xE8, 0x00, 0x82, 0xFF, 0xF9, 0xCF, 0x02, 0xC0, 0x80, 0x91, 0xF1, 0x00, 0x91, 0x50, 0x99, 0x23,
+0x04, 0x4B, 0xC0, 0x00, 0x00, 0x64, 0xC0, 0x03, 0x00, 0x62, 0xC0, 0x03, 0x00, 0x60, 0xC0, 0x03,
+0x00, 0x5E, 0xC0, 0x03, 0x00, 0x5C, 0xC0, 0x03, 0x00, 0x5A, 0xC0, 0x03, 0x00, 0x58, 0xC0, 0x03,
+0x00, 0x56, 0xC0, 0x03, 0x00, 0x54, 0xC0, 0x03, 0x00, 0x52, 0xC0, 0x03, 0x04, 0xEE, 0xC4, 0x00,
+0x00, 0x4E, 0xC0, 0x07, 0x00, 0x4C, 0xC0, 0x03, 0x00, 0x4A, 0xC0, 0x03, 0x00, 0x48, 0xC0, 0x03,
+0x00, 0x46, 0xC0, 0x03, 0x00, 0x44, 0xC0, 0x03, 0x00, 0x42, 0xC0, 0x03, 0x00, 0x40, 0xC0, 0x03,
+0x00, 0x3E, 0xC0, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0x3A, 0xC0, 0x03, 0x00, 0x38, 0xC0, 0x03,
+0x00, 0x36, 0xC0, 0x03, 0x00, 0x34, 0xC0, 0x03, 0x00, 0x32, 0xC0, 0x03, 0x00, 0x30, 0xC0, 0x03,
+0x00, 0x2E, 0xC0, 0x03, 0x00, 0x2C, 0xC0, 0x03, 0x00, 0x2A, 0xC0, 0x03, 0x00, 0x28, 0xC0, 0x03,
+0x00, 0x26, 0xC0, 0x03, 0x00, 0x24, 0xC0, 0x03, 0x00, 0x22, 0xC0, 0x03, 0x00, 0x20, 0xC0, 0x03,
+0x00, 0x1E, 0xC0, 0x03, 0x00, 0x1C, 0xC0, 0x03, 0x55, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD2,
+0xE0, 0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xEA, 0xEF, 0xFC, 0xE3, 0x02,
+0xC0, 0x05, 0x90, 0x0D, 0x92, 0xAA, 0x33, 0xB1, 0x07, 0xD9, 0xF7, 0x11, 0xE0, 0xAA, 0xE3, 0xB1,
+0xE0, 0x01, 0xC0, 0x1D, 0x92, 0xAB, 0x35, 0xB1, 0x07, 0xE1, 0xF7, 0x72, 0xD3, 0x14, 0xC6, 0x98,
+0xCF, 0x98, 0x2F, 0x15, 0xC0, 0x80, 0x91, 0xF2, 0x00, 0x88, 0x23, 0x71, 0xF4, 0x80, 0x91, 0xE8,
+0x00, 0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x51, 0xF0, 0xC1,
+0x11, 0x04, 0x82, 0xFF, 0xF9, 0xCF, 0x02, 0xC0, 0x23, 0x22, 0xF1, 0x00, 0x91, 0x50, 0x99, 0x23,
 0x49, 0xF7, 0x08, 0x95, 0x20, 0x91, 0x4A, 0x01, 0x30, 0x91, 0x49, 0x01, 0x80, 0x91, 0x48, 0x01,
-0x90, 0x91, 0x47, 0x01, 0x80, 0x93, 0x3F, 0x01, 0x90, 0x93, 0x40, 0x01, 0xC9, 0x01, 0x80, 0x93,
-0x41, 0x01, 0x90, 0x93, 0x42, 0x01, 0x08, 0x95, 0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0, 0x00, 0xD0,
-0x00, 0xD0, 0xCD, 0xB7, 0xDE, 0xB7, 0x80, 0x91, 0x45, 0x01, 0x84, 0x30, 0x09, 0xF4, 0x5A, 0xC0,
-0x85, 0x30, 0x30, 0xF4, 0x81, 0x30, 0x59, 0xF0, 0x83, 0x30, 0x09, 0xF0, 0xD7, 0xC0, 0x1F, 0xC0,
-0x85, 0x30, 0x09, 0xF4, 0xA0, 0xC0, 0x86, 0x30, 0x09, 0xF0, 0xD0, 0xC0, 0xC3, 0xC0, 0x80, 0x91,
-0x46, 0x01, 0x82, 0x30, 0x08, 0xF0, 0xCA, 0xC0, 0xCD, 0xDF, 0x80, 0x91, 0x46, 0x01, 0x88, 0x23,
-0x61, 0xF4, 0x80, 0x91, 0x3F, 0x01, 0x90, 0x91, 0x40, 0x01, 0x23, 0xE0, 0xFC, 0x01, 0x20, 0x93,
-0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x85, 0xE0, 0x08, 0xC0, 0x80, 0x91,
-0x46, 0x01, 0x88, 0x23, 0x11, 0xF0, 0x82, 0x30, 0x29, 0xF4, 0xB4, 0xDF, 0x89, 0xE0, 0x80, 0x93,
-0x01, 0x01, 0xAC, 0xC0, 0x81, 0x30, 0x09, 0xF0, 0xA9, 0xC0, 0x20, 0xE0, 0x30, 0xE0, 0x40, 0xE0,
-0x50, 0xE0, 0xF9, 0x01, 0x84, 0x91, 0x8F, 0x3F, 0x81, 0xF0, 0xCA, 0x01, 0xAA, 0x27, 0xBB, 0x27,
-0x80, 0x93, 0x3E, 0x01, 0x30, 0x93, 0x40, 0x01, 0x20, 0x93, 0x3F, 0x01, 0x8A, 0xE0, 0x80, 0x93,
-0x01, 0x01, 0x85, 0xE0, 0x80, 0x93, 0x3B, 0x01, 0x91, 0xC0, 0x2F, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F,
-0x5F, 0x4F, 0x20, 0x30, 0xF0, 0xE3, 0x3F, 0x07, 0xF0, 0xE0, 0x4F, 0x07, 0xF0, 0xE0, 0x5F, 0x07,
-0x01, 0xF7, 0x84, 0xC0, 0x80, 0x91, 0x46, 0x01, 0x83, 0x30, 0x51, 0xF5, 0x81, 0xE0, 0x80, 0x93,
-0x3A, 0x01, 0x80, 0x91, 0x4B, 0x01, 0x90, 0x91, 0x4C, 0x01, 0x89, 0x2B, 0x71, 0xF0, 0x80, 0x91,
-0x47, 0x01, 0x81, 0x30, 0x09, 0xF0, 0x72, 0xC0, 0x80, 0x91, 0x4A, 0x01, 0x90, 0x91, 0x49, 0x01,
-0x90, 0x93, 0x3D, 0x01, 0x80, 0x93, 0x3C, 0x01, 0x69, 0xC0, 0x80, 0x91, 0x47, 0x01, 0x88, 0x23,
-0x61, 0xF4, 0x2C, 0xE0, 0x88, 0xE1, 0x90, 0xE0, 0x0F, 0xB6, 0xF8, 0x94, 0xA8, 0x95, 0x80, 0x93,
-0x60, 0x00, 0x0F, 0xBE, 0x20, 0x93, 0x60, 0x00, 0x59, 0xC0, 0x10, 0x92, 0x00, 0x01, 0x56, 0xC0,
-0x88, 0x23, 0x09, 0xF0, 0x53, 0xC0, 0x80, 0x91, 0x47, 0x01, 0x8F, 0x3F, 0x09, 0xF0, 0x4E, 0xC0,
-0xE0, 0xE0, 0xF0, 0xE0, 0x93, 0xE0, 0x85, 0xE0, 0x90, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6,
-0x00, 0xFC, 0xFD, 0xCF, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF,
-0xE0, 0x58, 0xFF, 0x4F, 0x20, 0xE3, 0xE0, 0x30, 0xF2, 0x07, 0x71, 0xF7, 0x81, 0xE1, 0x80, 0x93,
-0x57, 0x00, 0xE8, 0x95, 0x33, 0xC0, 0xDE, 0x01, 0x11, 0x96, 0xE5, 0xE0, 0xF1, 0xE0, 0x83, 0xE0,
-0x01, 0x90, 0x0D, 0x92, 0x81, 0x50, 0xE1, 0xF7, 0xDE, 0x01, 0x14, 0x96, 0xE2, 0xE0, 0xF1, 0xE0,
-0x83, 0xE0, 0x01, 0x90, 0x0D, 0x92, 0x81, 0x50, 0xE1, 0xF7, 0x90, 0x91, 0x47, 0x01, 0x80, 0x91,
-0x46, 0x01, 0x88, 0x23, 0x29, 0xF4, 0xFE, 0x01, 0xE9, 0x0F, 0xF1, 0x1D, 0x81, 0x81, 0x07, 0xC0,
-0x81, 0x30, 0xA1, 0xF4, 0xFE, 0x01, 0xBC, 0x97, 0xE9, 0x0F, 0xF1, 0x1D, 0x80, 0x81, 0x80, 0x93,
-0x50, 0x01, 0x0C, 0xC0, 0x80, 0x91, 0x46, 0x01, 0x83, 0x30, 0x41, 0xF4, 0x80, 0x91, 0x47, 0x01,
-0x88, 0x23, 0x21, 0xF4, 0x80, 0x91, 0x48, 0x01, 0x80, 0x93, 0x3E, 0x01, 0x26, 0x96, 0x0F, 0xB6,
-0xF8, 0x94, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF, 0xCF, 0x91, 0xDF, 0x91, 0x08, 0x95, 0x2F, 0x92,
-0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92,
-0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93,
-0x80, 0x91, 0x59, 0x01, 0x90, 0x91, 0x5A, 0x01, 0x90, 0x93, 0x4C, 0x01, 0x80, 0x93, 0x4B, 0x01,
-0x80, 0x91, 0x4D, 0x01, 0x88, 0x23, 0x51, 0xF0, 0x80, 0x91, 0x4D, 0x01, 0x81, 0x50, 0x80, 0x93,
-0x4D, 0x01, 0x80, 0x91, 0x4D, 0x01, 0x88, 0x23, 0x09, 0xF4, 0x5D, 0x9A, 0x80, 0x91, 0x4E, 0x01,
-0x88, 0x23, 0x51, 0xF0, 0x80, 0x91, 0x4E, 0x01, 0x81, 0x50, 0x80, 0x93, 0x4E, 0x01, 0x80, 0x91,
-0x4E, 0x01, 0x88, 0x23, 0x09, 0xF4, 0x5C, 0x9A, 0x80, 0x91, 0x54, 0x01, 0x83, 0x30, 0x09, 0xF4,
-0xB2, 0xC1, 0x84, 0x30, 0x30, 0xF4, 0x81, 0x30, 0x71, 0xF0, 0x82, 0x30, 0x09, 0xF0, 0xE3, 0xC1,
-0x11, 0xC1, 0x85, 0x30, 0x09, 0xF4, 0xC5, 0xC1, 0x85, 0x30, 0x08, 0xF4, 0xBA, 0xC1, 0x86, 0x30,
-0x09, 0xF0, 0xD9, 0xC1, 0xCD, 0xC1, 0x5C, 0x98, 0x83, 0xE0, 0x80, 0x93, 0x4E, 0x01, 0x80, 0x91,
-0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x80, 0x91, 0x3A, 0x01, 0x88, 0x23, 0x29, 0xF0,
-0xB3, 0xDE, 0x5D, 0x9A, 0x5C, 0x9A, 0x10, 0x92, 0x3A, 0x01, 0x20, 0x91, 0x4B, 0x01, 0x30, 0x91,
-0x4C, 0x01, 0x21, 0x15, 0x31, 0x05, 0x29, 0xF4, 0x2A, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4,
-0xBA, 0xC1, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF8, 0xCF, 0x80, 0x91, 0xF1, 0x00, 0x80, 0x93,
-0x45, 0x01, 0x21, 0x50, 0x30, 0x40, 0x30, 0x93, 0x4C, 0x01, 0x20, 0x93, 0x4B, 0x01, 0xE6, 0xE4,
-0xF1, 0xE0, 0x0C, 0xC0, 0x80, 0x91, 0xF1, 0x00, 0x81, 0x93, 0x21, 0x50, 0x30, 0x40, 0x81, 0xE0,
-0xEB, 0x34, 0xF8, 0x07, 0x19, 0xF4, 0x31, 0x83, 0x20, 0x83, 0x08, 0xC0, 0x80, 0x91, 0xF2, 0x00,
-0x88, 0x23, 0x81, 0xF7, 0x30, 0x93, 0x4C, 0x01, 0x20, 0x93, 0x4B, 0x01, 0x7D, 0xDE, 0x80, 0x91,
-0x01, 0x01, 0x85, 0x30, 0x09, 0xF0, 0xBA, 0xC0, 0x80, 0x91, 0x4B, 0x01, 0x90, 0x91, 0x4C, 0x01,
-0x89, 0x2B, 0x21, 0xF4, 0x82, 0xE0, 0x80, 0x93, 0x01, 0x01, 0xB0, 0xC0, 0x8A, 0xE1, 0x40, 0xDE,
-0x80, 0x91, 0x3F, 0x01, 0x8F, 0x71, 0x3C, 0xDE, 0xC0, 0x91, 0x41, 0x01, 0xD0, 0x91, 0x42, 0x01,
-0x20, 0x91, 0x3F, 0x01, 0x30, 0x91, 0x40, 0x01, 0x21, 0x96, 0x8E, 0x01, 0x02, 0x1B, 0x13, 0x0B,
-0x21, 0x97, 0x80, 0x91, 0x46, 0x01, 0x88, 0x23, 0x09, 0xF0, 0x93, 0xC0, 0x18, 0x01, 0x36, 0x94,
-0x27, 0x94, 0xC9, 0x01, 0xA0, 0x91, 0x3E, 0x01, 0xB0, 0xE0, 0x9C, 0x01, 0xAD, 0x01, 0x62, 0xE0,
-0xE6, 0x2E, 0xF1, 0x2C, 0x01, 0x2D, 0x11, 0x2D, 0xE2, 0x0E, 0xF3, 0x1E, 0x04, 0x1F, 0x15, 0x1F,
-0x59, 0x01, 0x6A, 0x01, 0x90, 0xE0, 0x99, 0x24, 0x93, 0x94, 0xB5, 0xE0, 0xA3, 0xE0, 0x48, 0xC0,
-0x80, 0x91, 0xF2, 0x00, 0x88, 0x23, 0x71, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x7F, 0x80, 0x93,
-0xE8, 0x00, 0x04, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0x45, 0xC1, 0x80, 0x91, 0xE8, 0x00,
-0x82, 0xFF, 0xF8, 0xCF, 0x08, 0x94, 0x21, 0x08, 0x31, 0x08, 0x80, 0x91, 0xF1, 0x00, 0x68, 0x2F,
-0x80, 0x91, 0xF1, 0x00, 0x78, 0x2F, 0xF5, 0x01, 0x0B, 0x01, 0x90, 0x92, 0x57, 0x00, 0xE8, 0x95,
-0x11, 0x24, 0x9F, 0x5F, 0x90, 0x34, 0x19, 0xF0, 0x21, 0x14, 0x31, 0x04, 0xA1, 0xF4, 0xF9, 0x01,
-0xB0, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x21, 0x14, 0x31, 0x04,
-0x51, 0xF0, 0xF7, 0x01, 0xA0, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF,
-0xA8, 0x01, 0x97, 0x01, 0x90, 0xE0, 0x42, 0xE0, 0x44, 0x2E, 0x51, 0x2C, 0x61, 0x2C, 0x71, 0x2C,
-0xE4, 0x0C, 0xF5, 0x1C, 0x06, 0x1D, 0x17, 0x1D, 0xA4, 0x0C, 0xB5, 0x1C, 0xC6, 0x1C, 0xD7, 0x1C,
-0x21, 0x14, 0x31, 0x04, 0x09, 0xF0, 0xB4, 0xCF, 0xD0, 0x93, 0x40, 0x01, 0xC0, 0x93, 0x3F, 0x01,
-0x81, 0xE1, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x27, 0xC0, 0x80, 0x91, 0xF2, 0x00, 0x88, 0x23,
-0x71, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x04, 0xC0, 0x8E, 0xB3,
-0x88, 0x23, 0x09, 0xF4, 0xF0, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF8, 0xCF, 0x60, 0x91,
-0xF1, 0x00, 0x80, 0x91, 0x3F, 0x01, 0x90, 0x91, 0x40, 0x01, 0xA7, 0xD3, 0x80, 0x91, 0x3F, 0x01,
-0x90, 0x91, 0x40, 0x01, 0x01, 0x96, 0x90, 0x93, 0x40, 0x01, 0x80, 0x93, 0x3F, 0x01, 0x01, 0x50,
-0x10, 0x40, 0x01, 0x15, 0x11, 0x05, 0xC9, 0xF6, 0x80, 0xE1, 0x92, 0xDD, 0x80, 0x91, 0xE8, 0x00,
-0x8B, 0x7F, 0xC3, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x5D, 0x98,
-0x83, 0xE0, 0x80, 0x93, 0x4D, 0x01, 0x04, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0xC3, 0xC0,
-0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0xF8, 0xCF, 0x80, 0x91, 0x01, 0x01, 0x89, 0x30, 0x91, 0xF0,
-0x8A, 0x30, 0x69, 0xF4, 0x80, 0x91, 0x46, 0x01, 0x81, 0x30, 0x49, 0xF4, 0x80, 0x91, 0x3F, 0x01,
-0x90, 0x91, 0x40, 0x01, 0x80, 0x93, 0xF1, 0x00, 0x90, 0x93, 0xF1, 0x00, 0x9B, 0xC0, 0x80, 0x91,
-0x50, 0x01, 0x96, 0xC0, 0x60, 0x91, 0x41, 0x01, 0x70, 0x91, 0x42, 0x01, 0x20, 0x91, 0x3F, 0x01,
-0x30, 0x91, 0x40, 0x01, 0x6F, 0x5F, 0x7F, 0x4F, 0x7B, 0x01, 0xE2, 0x1A, 0xF3, 0x0A, 0x61, 0x50,
-0x70, 0x40, 0x80, 0x91, 0x46, 0x01, 0x88, 0x23, 0x89, 0xF5, 0x87, 0x01, 0x16, 0x95, 0x07, 0x95,
-0xC9, 0x01, 0xA0, 0x91, 0x3E, 0x01, 0xB0, 0xE0, 0x9C, 0x01, 0xAD, 0x01, 0x1F, 0xC0, 0x80, 0x91,
-0xF2, 0x00, 0x80, 0x32, 0x71, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00,
-0x04, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0x7E, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF,
-0xF8, 0xCF, 0xF9, 0x01, 0x85, 0x91, 0x94, 0x91, 0x80, 0x93, 0xF1, 0x00, 0x90, 0x93, 0xF1, 0x00,
-0x01, 0x50, 0x10, 0x40, 0x2E, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F, 0x5F, 0x4F, 0x01, 0x15, 0x11, 0x05,
-0xF1, 0xF6, 0x70, 0x93, 0x40, 0x01, 0x60, 0x93, 0x3F, 0x01, 0x29, 0xC0, 0x82, 0x30, 0x39, 0xF5,
-0x23, 0xC0, 0x80, 0x91, 0xF2, 0x00, 0x80, 0x32, 0x71, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x7F,
-0x80, 0x93, 0xE8, 0x00, 0x04, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0x54, 0xC0, 0x80, 0x91,
-0xE8, 0x00, 0x80, 0xFF, 0xF8, 0xCF, 0x00, 0x91, 0x3F, 0x01, 0x10, 0x91, 0x40, 0x01, 0xC8, 0x01,
-0x04, 0xD3, 0x80, 0x93, 0xF1, 0x00, 0x0F, 0x5F, 0x1F, 0x4F, 0x10, 0x93, 0x40, 0x01, 0x00, 0x93,
-0x3F, 0x01, 0x08, 0x94, 0xE1, 0x08, 0xF1, 0x08, 0xE1, 0x14, 0xF1, 0x04, 0xD1, 0xF6, 0x82, 0xE0,
-0x80, 0x93, 0x01, 0x01, 0x27, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00,
-0x80, 0x91, 0x3B, 0x01, 0x80, 0x93, 0xF1, 0x00, 0x10, 0x92, 0xF1, 0x00, 0x10, 0x92, 0xF1, 0x00,
-0x10, 0x92, 0xF1, 0x00, 0x80, 0x91, 0x01, 0x01, 0x80, 0x93, 0xF1, 0x00, 0x10, 0x92, 0xF1, 0x00,
-0x11, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x10, 0x92, 0x3B, 0x01,
-0x19, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x80, 0x91, 0x01, 0x01,
-0x80, 0x93, 0xF1, 0x00, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x0A, 0xC0,
-0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x5D, 0x9A, 0x5C, 0x9A, 0x82, 0xE0,
-0x80, 0x93, 0x01, 0x01, 0x87, 0xD0, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x0F, 0x91, 0xFF, 0x90,
-0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xBF, 0x90, 0xAF, 0x90, 0x9F, 0x90, 0x7F, 0x90, 0x6F, 0x90,
-0x5F, 0x90, 0x4F, 0x90, 0x3F, 0x90, 0x2F, 0x90, 0x08, 0x95, 0x2B, 0xD1, 0x81, 0xE0, 0x85, 0xBF,
-0x15, 0xBE, 0x08, 0x95, 0x84, 0xB7, 0x87, 0x7F, 0x84, 0xBF, 0x88, 0xE1, 0x0F, 0xB6, 0xF8, 0x94,
-0x80, 0x93, 0x60, 0x00, 0x10, 0x92, 0x60, 0x00, 0x0F, 0xBE, 0x81, 0xE0, 0x85, 0xBF, 0x82, 0xE0,
-0x85, 0xBF, 0x8A, 0xB1, 0x80, 0x63, 0x8A, 0xB9, 0x8B, 0xB1, 0x80, 0x63, 0x8B, 0xB9, 0x0C, 0xC1,
-0xE9, 0xDF, 0x78, 0x94, 0x01, 0xC0, 0x80, 0xD2, 0x80, 0x91, 0x00, 0x01, 0x88, 0x23, 0xD9, 0xF7,
-0x80, 0x91, 0x3A, 0x01, 0x88, 0x23, 0xB9, 0xF7, 0xD8, 0xDF, 0xE0, 0x91, 0x3C, 0x01, 0xF0, 0x91,
-0x3D, 0x01, 0x09, 0x95, 0xFA, 0x01, 0x92, 0x30, 0x71, 0xF0, 0x93, 0x30, 0x89, 0xF0, 0x91, 0x30,
-0x29, 0xF4, 0x88, 0xE0, 0x91, 0xE0, 0x22, 0xE1, 0x30, 0xE0, 0x19, 0xC0, 0x80, 0xE0, 0x90, 0xE0,
-0x20, 0xE0, 0x30, 0xE0, 0x14, 0xC0, 0x8A, 0xE1, 0x91, 0xE0, 0x2B, 0xE1, 0x30, 0xE0, 0x0F, 0xC0,
-0x88, 0x23, 0x39, 0xF4, 0x80, 0x91, 0x35, 0x01, 0x28, 0x2F, 0x30, 0xE0, 0x85, 0xE3, 0x91, 0xE0,
-0x06, 0xC0, 0x80, 0x91, 0x43, 0x01, 0x28, 0x2F, 0x30, 0xE0, 0x83, 0xE4, 0x91, 0xE0, 0x91, 0x83,
-0x80, 0x83, 0xC9, 0x01, 0x08, 0x95, 0x80, 0x91, 0xEB, 0x00, 0x81, 0x60, 0x80, 0x93, 0xEB, 0x00,
-0x10, 0x92, 0xED, 0x00, 0x60, 0x93, 0xEC, 0x00, 0x40, 0x93, 0xED, 0x00, 0x80, 0x91, 0xEE, 0x00,
-0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F, 0x08, 0x95, 0x10, 0x92, 0xF4, 0x00, 0x10, 0x92, 0xF0, 0x00,
-0x10, 0x92, 0xE8, 0x00, 0x10, 0x92, 0xED, 0x00, 0xEB, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0x8E, 0x7F,
-0x80, 0x83, 0x08, 0x95, 0x80, 0x91, 0x53, 0x01, 0x88, 0x23, 0x8C, 0xF4, 0x03, 0xC0, 0x8E, 0xB3,
-0x88, 0x23, 0xB1, 0xF0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF9, 0xCF, 0x80, 0x91, 0xE8, 0x00,
-0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x08, 0x95, 0x8E, 0xB3, 0x88, 0x23, 0x49, 0xF0, 0x80, 0x91,
-0xE8, 0x00, 0x80, 0xFF, 0xF9, 0xCF, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00,
-0x08, 0x95, 0x9C, 0x01, 0x40, 0x91, 0x59, 0x01, 0x50, 0x91, 0x5A, 0x01, 0x46, 0x17, 0x57, 0x07,
-0x18, 0xF4, 0xF9, 0x01, 0x20, 0xE0, 0x38, 0xC0, 0x61, 0x15, 0x71, 0x05, 0x11, 0xF0, 0xAB, 0x01,
-0xF8, 0xCF, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x40, 0xE0, 0x50, 0xE0,
-0xF0, 0xCF, 0x80, 0x91, 0xE8, 0x00, 0x83, 0xFF, 0x02, 0xC0, 0x81, 0xE0, 0x08, 0x95, 0x80, 0x91,
-0xE8, 0x00, 0x82, 0xFD, 0x2D, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x81, 0xF1, 0x8E, 0xB3, 0x85, 0x30,
-0x79, 0xF1, 0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0x17, 0xC0, 0x90, 0x91, 0xF2, 0x00, 0x06, 0xC0,
-0x81, 0x91, 0x80, 0x93, 0xF1, 0x00, 0x41, 0x50, 0x50, 0x40, 0x9F, 0x5F, 0x41, 0x15, 0x51, 0x05,
-0x11, 0xF0, 0x90, 0x32, 0xA8, 0xF3, 0x20, 0xE0, 0x90, 0x32, 0x09, 0xF4, 0x21, 0xE0, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x41, 0x15, 0x51, 0x05, 0x91, 0xF6, 0x22, 0x23,
-0x81, 0xF6, 0x06, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x49, 0xF0, 0x8E, 0xB3, 0x85, 0x30, 0x41, 0xF0,
-0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF6, 0xCF, 0x80, 0xE0, 0x08, 0x95, 0x82, 0xE0, 0x08, 0x95,
-0x83, 0xE0, 0x08, 0x95, 0x54, 0xD0, 0x56, 0xD0, 0x1E, 0xBA, 0x10, 0x92, 0x51, 0x01, 0x84, 0xE0,
-0x89, 0xBD, 0x89, 0xB5, 0x82, 0x60, 0x89, 0xBD, 0x09, 0xB4, 0x00, 0xFE, 0xFD, 0xCF, 0x80, 0x91,
-0xD8, 0x00, 0x98, 0x2F, 0x9F, 0x77, 0x90, 0x93, 0xD8, 0x00, 0x80, 0x68, 0x80, 0x93, 0xD8, 0x00,
-0x80, 0x91, 0x63, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0x63, 0x00, 0x80, 0x91, 0xD8, 0x00, 0x8F, 0x7D,
-0x80, 0x93, 0xD8, 0x00, 0x80, 0x91, 0xE0, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE0, 0x00, 0x80, 0x91,
-0xE1, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x81, 0x60, 0x80, 0x93,
-0xE2, 0x00, 0x80, 0x91, 0xE1, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0x80, 0x91, 0xE2, 0x00,
-0x88, 0x60, 0x80, 0x93, 0xE2, 0x00, 0x08, 0x95, 0xC5, 0xDF, 0x81, 0xE0, 0x80, 0x93, 0x52, 0x01,
-0x08, 0x95, 0xC0, 0xDF, 0xE0, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0x81, 0x60, 0x80, 0x83, 0xE8, 0xED,
-0xF0, 0xE0, 0x80, 0x81, 0x8F, 0x77, 0x80, 0x83, 0x0A, 0xD0, 0x0C, 0xD0, 0x19, 0xBC, 0xE3, 0xE6,
-0xF0, 0xE0, 0x80, 0x81, 0x81, 0x60, 0x80, 0x83, 0x10, 0x92, 0x52, 0x01, 0x08, 0x95, 0x10, 0x92,
-0xE2, 0x00, 0x08, 0x95, 0x10, 0x92, 0xE1, 0x00, 0x08, 0x95, 0x1F, 0x92, 0x0F, 0x92, 0x0F, 0xB6,
-0x0F, 0x92, 0x11, 0x24, 0x2F, 0x93, 0x3F, 0x93, 0x4F, 0x93, 0x5F, 0x93, 0x6F, 0x93, 0x7F, 0x93,
-0x8F, 0x93, 0x9F, 0x93, 0xAF, 0x93, 0xBF, 0x93, 0xEF, 0x93, 0xFF, 0x93, 0x80, 0x91, 0xE1, 0x00,
-0x80, 0xFF, 0x1B, 0xC0, 0x80, 0x91, 0xE2, 0x00, 0x80, 0xFF, 0x17, 0xC0, 0x80, 0x91, 0xE1, 0x00,
-0x8E, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE2, 0x00,
-0x80, 0x91, 0xE2, 0x00, 0x80, 0x61, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xD8, 0x00, 0x80, 0x62,
-0x80, 0x93, 0xD8, 0x00, 0x19, 0xBC, 0x1E, 0xBA, 0x26, 0xD1, 0x80, 0x91, 0xE1, 0x00, 0x84, 0xFF,
-0x29, 0xC0, 0x80, 0x91, 0xE2, 0x00, 0x84, 0xFF, 0x25, 0xC0, 0x84, 0xE0, 0x89, 0xBD, 0x89, 0xB5,
-0x82, 0x60, 0x89, 0xBD, 0x09, 0xB4, 0x00, 0xFE, 0xFD, 0xCF, 0x80, 0x91, 0xD8, 0x00, 0x8F, 0x7D,
-0x80, 0x93, 0xD8, 0x00, 0x80, 0x91, 0xE1, 0x00, 0x8F, 0x7E, 0x80, 0x93, 0xE1, 0x00, 0x80, 0x91,
-0xE2, 0x00, 0x8F, 0x7E, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x81, 0x60, 0x80, 0x93,
-0xE2, 0x00, 0x80, 0x91, 0x51, 0x01, 0x88, 0x23, 0x11, 0xF4, 0x81, 0xE0, 0x01, 0xC0, 0x84, 0xE0,
-0x8E, 0xBB, 0xF9, 0xD0, 0x80, 0x91, 0xE1, 0x00, 0x83, 0xFF, 0x22, 0xC0, 0x80, 0x91, 0xE2, 0x00,
-0x83, 0xFF, 0x1E, 0xC0, 0x80, 0x91, 0xE1, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0x82, 0xE0,
-0x8E, 0xBB, 0x10, 0x92, 0x51, 0x01, 0x80, 0x91, 0xE1, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE1, 0x00,
-0x80, 0x91, 0xE2, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x80, 0x61,
-0x80, 0x93, 0xE2, 0x00, 0xA1, 0xDE, 0x80, 0xE0, 0x60, 0xE0, 0x42, 0xE2, 0x8C, 0xDE, 0xD3, 0xD0,
-0x80, 0x91, 0xE1, 0x00, 0x82, 0xFF, 0x0A, 0xC0, 0x80, 0x91, 0xE2, 0x00, 0x82, 0xFF, 0x06, 0xC0,
-0x80, 0x91, 0xE1, 0x00, 0x8B, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0xC5, 0xD0, 0xFF, 0x91, 0xEF, 0x91,
-0xBF, 0x91, 0xAF, 0x91, 0x9F, 0x91, 0x8F, 0x91, 0x7F, 0x91, 0x6F, 0x91, 0x5F, 0x91, 0x4F, 0x91,
-0x3F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90, 0x18, 0x95, 0x1F, 0x93,
-0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0, 0xCD, 0xB7, 0xDE, 0xB7, 0xE3, 0xE5, 0xF1, 0xE0, 0x80, 0x91,
-0xF1, 0x00, 0x81, 0x93, 0x81, 0xE0, 0xEB, 0x35, 0xF8, 0x07, 0xC9, 0xF7, 0x90, 0x91, 0x53, 0x01,
-0x80, 0x91, 0x54, 0x01, 0x85, 0x30, 0x11, 0xF1, 0x86, 0x30, 0x40, 0xF4, 0x81, 0x30, 0xB9, 0xF0,
-0x81, 0x30, 0x70, 0xF0, 0x83, 0x30, 0x09, 0xF0, 0x81, 0xC0, 0x11, 0xC0, 0x88, 0x30, 0x09, 0xF4,
-0x53, 0xC0, 0x89, 0x30, 0x09, 0xF4, 0x62, 0xC0, 0x86, 0x30, 0x09, 0xF0, 0x77, 0xC0, 0x2D, 0xC0,
-0x90, 0x38, 0x09, 0xF4, 0x74, 0xC0, 0x92, 0x38, 0x09, 0xF0, 0x70, 0xC0, 0x70, 0xC0, 0x99, 0x23,
-0x09, 0xF4, 0x6D, 0xC0, 0x92, 0x30, 0x09, 0xF0, 0x69, 0xC0, 0x69, 0xC0, 0x99, 0x23, 0x09, 0xF0,
-0x65, 0xC0, 0x10, 0x91, 0x55, 0x01, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00,
-0x49, 0xDE, 0x04, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0x59, 0xC0, 0x80, 0x91, 0xE8, 0x00,
-0x80, 0xFF, 0xF8, 0xCF, 0x81, 0x2F, 0x8F, 0x77, 0x11, 0xF4, 0x92, 0xE0, 0x01, 0xC0, 0x93, 0xE0,
-0x9E, 0xBB, 0x80, 0x68, 0x80, 0x93, 0xE3, 0x00, 0x4A, 0xC0, 0x90, 0x58, 0x92, 0x30, 0x08, 0xF0,
-0x45, 0xC0, 0x80, 0x91, 0x55, 0x01, 0x90, 0x91, 0x56, 0x01, 0x60, 0x91, 0x57, 0x01, 0xAE, 0x01,
-0x4F, 0x5F, 0x5F, 0x4F, 0xDF, 0xDD, 0xBC, 0x01, 0x00, 0x97, 0xC9, 0xF1, 0x80, 0x91, 0xE8, 0x00,
-0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x89, 0x81, 0x9A, 0x81, 0x3B, 0xDE, 0x80, 0x91, 0xE8, 0x00,
-0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x2B, 0xC0, 0x90, 0x38, 0x41, 0xF5, 0x80, 0x91, 0xE8, 0x00,
-0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x80, 0x91, 0x51, 0x01, 0x80, 0x93, 0xF1, 0x00, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x05, 0xDE, 0x19, 0xC0, 0x99, 0x23, 0xB1, 0xF4,
-0x90, 0x91, 0x55, 0x01, 0x92, 0x30, 0x98, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93,
-0xE8, 0x00, 0x90, 0x93, 0x51, 0x01, 0xF6, 0xDD, 0x80, 0x91, 0x51, 0x01, 0x88, 0x23, 0x11, 0xF4,
-0x83, 0xE0, 0x01, 0xC0, 0x84, 0xE0, 0x8E, 0xBB, 0x16, 0xD0, 0x01, 0xC0, 0x40, 0xDB, 0x80, 0x91,
-0xE8, 0x00, 0x83, 0xFF, 0x0A, 0xC0, 0x80, 0x91, 0xEB, 0x00, 0x80, 0x62, 0x80, 0x93, 0xEB, 0x00,
-0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x0F, 0x90, 0x0F, 0x90, 0xCF, 0x91,
-0xDF, 0x91, 0x1F, 0x91, 0x08, 0x95, 0x08, 0x95, 0x8E, 0xB3, 0x88, 0x23, 0x29, 0xF0, 0x80, 0x91,
-0xE8, 0x00, 0x83, 0xFF, 0x01, 0xC0, 0x43, 0xCF, 0x08, 0x95, 0xF9, 0x99, 0xFE, 0xCF, 0x92, 0xBD,
-0x81, 0xBD, 0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5, 0x08, 0x95, 0x26, 0x2F, 0xF9, 0x99, 0xFE, 0xCF,
-0x1F, 0xBA, 0x92, 0xBD, 0x81, 0xBD, 0x20, 0xBD, 0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A,
-0x0F, 0xBE, 0x01, 0x96, 0x08, 0x95, 0xF8, 0x94, 0xFF, 0xCF, 0x01, 0x02, 0x1E, 0x94, 0x89, 0x20,
-0xDC, 0xFB, 0x12, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x20, 0xEB, 0x03, 0xEF, 0x2F, 0x00, 0x00,
-0x00, 0x01, 0x00, 0x01, 0x09, 0x02, 0x1B, 0x00, 0x01, 0x01, 0x00, 0x80, 0x32, 0x09, 0x04, 0x00,
-0x00, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x09, 0x21, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x04,
-0x03, 0x09, 0x04, 0x00,
-}; // end of Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex
-
+0x90, 0x91, 0x47, 0x01, 0x80, 0x93, 0x3F, 0x01, 0x90, 0x93, 0x40, 0x01, 0xC9, 0xC0, 0x09, 0x00,
+0x41, 0xC0, 0x09, 0x09, 0x42, 0x01, 0x08, 0x95, 0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0, 0xC1, 0x01,
+0x1C, 0xCD, 0xB7, 0xDE, 0xB7, 0x80, 0x91, 0x45, 0x01, 0x84, 0x30, 0x09, 0xF4, 0x5A, 0xC0, 0x85,
+0x30, 0x30, 0xF4, 0x81, 0x30, 0x59, 0xF0, 0x83, 0x30, 0x09, 0xF0, 0xD7, 0xC0, 0x1F, 0xC0, 0x0F,
+0x04, 0x09, 0xF4, 0xA0, 0xC0, 0x86, 0xC0, 0x0D, 0x02, 0xD0, 0xC0, 0xC3, 0xC0, 0x65, 0x09, 0x46,
+0x01, 0x82, 0x30, 0x08, 0xF0, 0xCA, 0xC0, 0xCD, 0xDF, 0xC1, 0x0B, 0x02, 0x88, 0x23, 0x61, 0xC0,
+0x95, 0xC0, 0x5D, 0x15, 0x91, 0x40, 0x01, 0x23, 0xE0, 0xFC, 0x01, 0x20, 0x93, 0x57, 0x00, 0xE8,
+0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x85, 0xE0, 0x08, 0xC2, 0x2F, 0x12, 0x88, 0x23, 0x11,
+0xF0, 0x82, 0x30, 0x29, 0xF4, 0xB4, 0xDF, 0x89, 0xE0, 0x80, 0x93, 0x01, 0x01, 0xAC, 0xC0, 0x81,
+0xC0, 0x4D, 0x1C, 0xA9, 0xC0, 0x20, 0xE0, 0x30, 0xE0, 0x40, 0xE0, 0x50, 0xE0, 0xF9, 0x01, 0x84,
+0x91, 0x8F, 0x3F, 0x81, 0xF0, 0xCA, 0x01, 0xAA, 0x27, 0xBB, 0x27, 0x80, 0x93, 0x3E, 0x01, 0x30,
+0xC0, 0xAB, 0x00, 0x20, 0xC0, 0xB3, 0x00, 0x8A, 0xC2, 0x2F, 0x00, 0x85, 0xC0, 0x05, 0x14, 0x3B,
+0x01, 0x91, 0xC0, 0x2F, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F, 0x5F, 0x4F, 0x20, 0x30, 0xF0, 0xE3, 0x3F,
+0x07, 0xF0, 0xE0, 0x4F, 0xC0, 0x03, 0x04, 0x5F, 0x07, 0x01, 0xF7, 0x84, 0xC2, 0x65, 0x04, 0x83,
+0x30, 0x51, 0xF5, 0x81, 0xC0, 0x29, 0x00, 0x3A, 0xC0, 0xF5, 0x00, 0x4B, 0xC0, 0x8F, 0x06, 0x4C,
+0x01, 0x89, 0x2B, 0x71, 0xF0, 0x80, 0xC0, 0xFD, 0xC1, 0x6D, 0x00, 0x72, 0xC0, 0x23, 0x00, 0x4A,
+0xC0, 0x15, 0x00, 0x49, 0xC0, 0xFD, 0x06, 0x3D, 0x01, 0x80, 0x93, 0x3C, 0x01, 0x69, 0xC0, 0x11,
+0x00, 0x47, 0xC2, 0xBF, 0x12, 0x2C, 0xE0, 0x88, 0xE1, 0x90, 0xE0, 0x0F, 0xB6, 0xF8, 0x94, 0xA8,
+0x95, 0x80, 0x93, 0x60, 0x00, 0x0F, 0xBE, 0x20, 0xC0, 0x05, 0x0C, 0x59, 0xC0, 0x10, 0x92, 0x00,
+0x01, 0x56, 0xC0, 0x88, 0x23, 0x09, 0xF0, 0x53, 0xC2, 0x2B, 0x0E, 0x8F, 0x3F, 0x09, 0xF0, 0x4E,
+0xC0, 0xE0, 0xE0, 0xF0, 0xE0, 0x93, 0xE0, 0x85, 0xE0, 0x90, 0xC8, 0xE9, 0x00, 0x80, 0xC8, 0x0B,
+0x0D, 0xE0, 0x58, 0xFF, 0x4F, 0x20, 0xE3, 0xE0, 0x30, 0xF2, 0x07, 0x71, 0xF7, 0x81, 0xE1, 0xC3,
+0x19, 0x18, 0x33, 0xC0, 0xDE, 0x01, 0x11, 0x96, 0xE5, 0xE0, 0xF1, 0xE0, 0x83, 0xE0, 0x01, 0x90,
+0x0D, 0x92, 0x81, 0x50, 0xE1, 0xF7, 0xDE, 0x01, 0x14, 0x96, 0xE2, 0xCA, 0x11, 0x00, 0x90, 0xC0,
+0x63, 0xC1, 0xC9, 0x10, 0x88, 0x23, 0x29, 0xF4, 0xFE, 0x01, 0xE9, 0x0F, 0xF1, 0x1D, 0x81, 0x81,
+0x07, 0xC0, 0x81, 0x30, 0xA1, 0xC0, 0x0D, 0x01, 0xBC, 0x97, 0xC1, 0x0F, 0x06, 0x80, 0x81, 0x80,
+0x93, 0x50, 0x01, 0x0C, 0xC4, 0xEF, 0x01, 0x41, 0xF4, 0xC3, 0xC1, 0x00, 0x21, 0xC0, 0x07, 0x00,
+0x48, 0xC0, 0xD3, 0x03, 0x3E, 0x01, 0x26, 0x96, 0xC1, 0xC5, 0x38, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD,
+0xBF, 0xCF, 0x91, 0xDF, 0x91, 0x08, 0x95, 0x2F, 0x92, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F,
+0x92, 0x7F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF,
+0x92, 0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0x80, 0x91, 0x59, 0x01, 0x90, 0x91, 0x5A,
+0x01, 0x90, 0x93, 0x4C, 0xC0, 0x43, 0x00, 0x4B, 0xC0, 0x81, 0x00, 0x4D, 0xC0, 0x53, 0x01, 0x51,
+0xF0, 0xC1, 0x07, 0x04, 0x81, 0x50, 0x80, 0x93, 0x4D, 0xC4, 0x11, 0x06, 0x09, 0xF4, 0x5D, 0x9A,
+0x80, 0x91, 0x4E, 0xC4, 0x1B, 0x00, 0x4E, 0xC2, 0x1B, 0x00, 0x4E, 0xC0, 0x1B, 0xC1, 0x11, 0x02,
+0x09, 0xF4, 0x5C, 0xC0, 0x1B, 0x00, 0x54, 0xC0, 0x93, 0x14, 0x09, 0xF4, 0xB2, 0xC1, 0x84, 0x30,
+0x30, 0xF4, 0x81, 0x30, 0x71, 0xF0, 0x82, 0x30, 0x09, 0xF0, 0xE3, 0xC1, 0x11, 0xC1, 0x85, 0xC0,
+0x15, 0x00, 0xC5, 0xC0, 0x05, 0x04, 0x08, 0xF4, 0xBA, 0xC1, 0x86, 0xC0, 0x13, 0x07, 0xD9, 0xC1,
+0xCD, 0xC1, 0x5C, 0x98, 0x83, 0xE0, 0xC3, 0x3F, 0x0A, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8,
+0x00, 0x80, 0x91, 0x3A, 0xC1, 0xF9, 0x1C, 0xF0, 0xB3, 0xDE, 0x5D, 0x9A, 0x5C, 0x9A, 0x10, 0x92,
+0x3A, 0x01, 0x20, 0x91, 0x4B, 0x01, 0x30, 0x91, 0x4C, 0x01, 0x21, 0x15, 0x31, 0x05, 0x29, 0xF4,
+0x2A, 0xC0, 0x8E, 0xB3, 0xC1, 0x69, 0x01, 0xBA, 0xC1, 0xC1, 0x33, 0x10, 0x82, 0xFF, 0xF8, 0xCF,
+0x80, 0x91, 0xF1, 0x00, 0x80, 0x93, 0x45, 0x01, 0x21, 0x50, 0x30, 0x40, 0x30, 0xC0, 0xBD, 0x00,
+0x20, 0xC0, 0xBD, 0x05, 0xE6, 0xE4, 0xF1, 0xE0, 0x0C, 0xC0, 0xC1, 0x19, 0x01, 0x81, 0x93, 0xC1,
+0x17, 0x0C, 0x81, 0xE0, 0xEB, 0x34, 0xF8, 0x07, 0x19, 0xF4, 0x31, 0x83, 0x20, 0x83, 0x08, 0xC0,
+0x17, 0x05, 0xF2, 0x00, 0x88, 0x23, 0x81, 0xF7, 0xC5, 0x2D, 0x05, 0x7D, 0xDE, 0x80, 0x91, 0x01,
+0x01, 0xC0, 0x9F, 0x01, 0xF0, 0xBA, 0xC0, 0x1B, 0x02, 0x4B, 0x01, 0x90, 0xC0, 0x6D, 0x04, 0x89,
+0x2B, 0x21, 0xF4, 0x82, 0xC0, 0x9B, 0x06, 0x01, 0x01, 0xB0, 0xC0, 0x8A, 0xE1, 0x40, 0xC0, 0x21,
+0x0C, 0x3F, 0x01, 0x8F, 0x71, 0x3C, 0xDE, 0xC0, 0x91, 0x41, 0x01, 0xD0, 0x91, 0x42, 0xC0, 0x95,
+0x00, 0x3F, 0xC0, 0x95, 0x0E, 0x40, 0x01, 0x21, 0x96, 0x8E, 0x01, 0x02, 0x1B, 0x13, 0x0B, 0x21,
+0x97, 0x80, 0x91, 0x46, 0xC0, 0xB9, 0x36, 0x09, 0xF0, 0x93, 0xC0, 0x18, 0x01, 0x36, 0x94, 0x27,
+0x94, 0xC9, 0x01, 0xA0, 0x91, 0x3E, 0x01, 0xB0, 0xE0, 0x9C, 0x01, 0xAD, 0x01, 0x62, 0xE0, 0xE6,
+0x2E, 0xF1, 0x2C, 0x01, 0x2D, 0x11, 0x2D, 0xE2, 0x0E, 0xF3, 0x1E, 0x04, 0x1F, 0x15, 0x1F, 0x59,
+0x01, 0x6A, 0x01, 0x90, 0xE0, 0x99, 0x24, 0x93, 0x94, 0xB5, 0xE0, 0xA3, 0xE0, 0x48, 0xC4, 0x93,
+0x01, 0x71, 0xF4, 0xC1, 0xD5, 0x06, 0x8B, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x04, 0xC4, 0xE9, 0x00,
+0x45, 0xC6, 0xE9, 0x05, 0x08, 0x94, 0x21, 0x08, 0x31, 0x08, 0xC1, 0xD5, 0x01, 0x68, 0x2F, 0xC1,
+0x05, 0x1D, 0x78, 0x2F, 0xF5, 0x01, 0x0B, 0x01, 0x90, 0x92, 0x57, 0x00, 0xE8, 0x95, 0x11, 0x24,
+0x9F, 0x5F, 0x90, 0x34, 0x19, 0xF0, 0x21, 0x14, 0x31, 0x04, 0xA1, 0xF4, 0xF9, 0x01, 0xB0, 0x93,
+0xC1, 0x15, 0x05, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xC1, 0x13, 0x04, 0x51, 0xF0, 0xF7, 0x01,
+0xA0, 0xC8, 0x13, 0x02, 0xA8, 0x01, 0x97, 0xC0, 0x7F, 0x19, 0x42, 0xE0, 0x44, 0x2E, 0x51, 0x2C,
+0x61, 0x2C, 0x71, 0x2C, 0xE4, 0x0C, 0xF5, 0x1C, 0x06, 0x1D, 0x17, 0x1D, 0xA4, 0x0C, 0xB5, 0x1C,
+0xC6, 0x1C, 0xD7, 0x1C, 0xC1, 0x33, 0x0E, 0x09, 0xF0, 0xB4, 0xCF, 0xD0, 0x93, 0x40, 0x01, 0xC0,
+0x93, 0x3F, 0x01, 0x81, 0xE1, 0x80, 0xC2, 0x3D, 0x00, 0x27, 0xD8, 0xA9, 0x00, 0xF0, 0xC0, 0x1B,
+0xC3, 0xA9, 0x00, 0x60, 0xC0, 0x9D, 0x09, 0x80, 0x91, 0x3F, 0x01, 0x90, 0x91, 0x40, 0x01, 0xA7,
+0xD3, 0xC5, 0x09, 0x02, 0x01, 0x96, 0x90, 0xC0, 0x4D, 0x00, 0x80, 0xC0, 0x4D, 0x0D, 0x01, 0x50,
+0x10, 0x40, 0x01, 0x15, 0x11, 0x05, 0xC9, 0xF6, 0x80, 0xE1, 0x92, 0xDD, 0xC3, 0x49, 0x00, 0xC3,
+0xC2, 0x3D, 0x00, 0x87, 0xC2, 0x51, 0x07, 0x5D, 0x98, 0x83, 0xE0, 0x80, 0x93, 0x4D, 0x01, 0xC5,
+0x59, 0xC3, 0x1B, 0x00, 0x80, 0xC0, 0x59, 0x0A, 0x80, 0x91, 0x01, 0x01, 0x89, 0x30, 0x91, 0xF0,
+0x8A, 0x30, 0x69, 0xC0, 0x81, 0x04, 0x46, 0x01, 0x81, 0x30, 0x49, 0xC0, 0x07, 0xC3, 0x5F, 0x04,
+0x80, 0x93, 0xF1, 0x00, 0x90, 0xC0, 0x03, 0x00, 0x9B, 0xC0, 0x2D, 0x0C, 0x50, 0x01, 0x96, 0xC0,
+0x60, 0x91, 0x41, 0x01, 0x70, 0x91, 0x42, 0x01, 0x20, 0xC0, 0x1F, 0x00, 0x30, 0xC0, 0x1F, 0x0D,
+0x6F, 0x5F, 0x7F, 0x4F, 0x7B, 0x01, 0xE2, 0x1A, 0xF3, 0x0A, 0x61, 0x50, 0x70, 0x40, 0xC1, 0x3D,
+0x16, 0x88, 0x23, 0x89, 0xF5, 0x87, 0x01, 0x16, 0x95, 0x07, 0x95, 0xC9, 0x01, 0xA0, 0x91, 0x3E,
+0x01, 0xB0, 0xE0, 0x9C, 0x01, 0xAD, 0x01, 0x1F, 0xC2, 0xE3, 0x01, 0x80, 0x32, 0xC3, 0xE3, 0x00,
+0x8E, 0xCA, 0xE3, 0x00, 0x7E, 0xC6, 0x89, 0x05, 0xF9, 0x01, 0x85, 0x91, 0x94, 0x91, 0xC5, 0x73,
+0xC1, 0xD1, 0x07, 0x2E, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F, 0x5F, 0x4F, 0xC1, 0xD9, 0x02, 0xF1, 0xF6,
+0x70, 0xC0, 0xEB, 0x00, 0x60, 0xC0, 0xEB, 0x06, 0x29, 0xC0, 0x82, 0x30, 0x39, 0xF5, 0x23, 0xD8,
+0x53, 0x00, 0x54, 0xC6, 0x53, 0x00, 0x00, 0xC0, 0xA9, 0x00, 0x10, 0xC0, 0xA9, 0x03, 0xC8, 0x01,
+0x04, 0xD3, 0xC1, 0x59, 0x04, 0x0F, 0x5F, 0x1F, 0x4F, 0x10, 0xC0, 0x47, 0x00, 0x00, 0xC0, 0x47,
+0x12, 0x08, 0x94, 0xE1, 0x08, 0xF1, 0x08, 0xE1, 0x14, 0xF1, 0x04, 0xD1, 0xF6, 0x82, 0xE0, 0x80,
+0x93, 0x01, 0x01, 0x27, 0xC2, 0x37, 0x00, 0x87, 0xC2, 0x4B, 0x02, 0x80, 0x91, 0x3B, 0xC2, 0xFF,
+0x01, 0x10, 0x92, 0xC7, 0x03, 0x02, 0x80, 0x91, 0x01, 0xC6, 0x13, 0x00, 0x11, 0xC8, 0x2B, 0x04,
+0x10, 0x92, 0x3B, 0x01, 0x19, 0xCA, 0x3B, 0xC3, 0x27, 0xC7, 0x99, 0x00, 0x0A, 0xC8, 0x1D, 0x03,
+0x5D, 0x9A, 0x5C, 0x9A, 0xC3, 0x6F, 0x3E, 0x87, 0xD0, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x0F,
+0x91, 0xFF, 0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xBF, 0x90, 0xAF, 0x90, 0x9F, 0x90, 0x7F,
+0x90, 0x6F, 0x90, 0x5F, 0x90, 0x4F, 0x90, 0x3F, 0x90, 0x2F, 0x90, 0x08, 0x95, 0x2B, 0xD1, 0x81,
+0xE0, 0x85, 0xBF, 0x15, 0xBE, 0x08, 0x95, 0x84, 0xB7, 0x87, 0x7F, 0x84, 0xBF, 0x88, 0xE1, 0x0F,
+0xB6, 0xF8, 0x94, 0x80, 0x93, 0x60, 0xC0, 0x77, 0x03, 0x60, 0x00, 0x0F, 0xBE, 0xC1, 0x1D, 0x00,
+0x82, 0xC0, 0x03, 0x06, 0x8A, 0xB1, 0x80, 0x63, 0x8A, 0xB9, 0x8B, 0xC0, 0x05, 0x16, 0x8B, 0xB9,
+0x0C, 0xC1, 0xE9, 0xDF, 0x78, 0x94, 0x01, 0xC0, 0x80, 0xD2, 0x80, 0x91, 0x00, 0x01, 0x88, 0x23,
+0xD9, 0xF7, 0x80, 0x91, 0x3A, 0xC0, 0x07, 0x23, 0xB9, 0xF7, 0xD8, 0xDF, 0xE0, 0x91, 0x3C, 0x01,
+0xF0, 0x91, 0x3D, 0x01, 0x09, 0x95, 0xFA, 0x01, 0x92, 0x30, 0x71, 0xF0, 0x93, 0x30, 0x89, 0xF0,
+0x91, 0x30, 0x29, 0xF4, 0x88, 0xE0, 0x91, 0xE0, 0x22, 0xE1, 0x30, 0xE0, 0xC0, 0xC9, 0x0D, 0xE0,
+0x90, 0xE0, 0x20, 0xE0, 0x30, 0xE0, 0x14, 0xC0, 0x8A, 0xE1, 0x91, 0xE0, 0x2B, 0xC0, 0x13, 0x12,
+0x0F, 0xC0, 0x88, 0x23, 0x39, 0xF4, 0x80, 0x91, 0x35, 0x01, 0x28, 0x2F, 0x30, 0xE0, 0x85, 0xE3,
+0x91, 0xE0, 0x06, 0xC0, 0xD1, 0x00, 0x43, 0xC2, 0x0D, 0x14, 0x83, 0xE4, 0x91, 0xE0, 0x91, 0x83,
+0x80, 0x83, 0xC9, 0x01, 0x08, 0x95, 0x80, 0x91, 0xEB, 0x00, 0x81, 0x60, 0x80, 0x93, 0xEB, 0xC0,
+0x9B, 0x18, 0xED, 0x00, 0x60, 0x93, 0xEC, 0x00, 0x40, 0x93, 0xED, 0x00, 0x80, 0x91, 0xEE, 0x00,
+0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F, 0x08, 0x95, 0x10, 0x92, 0xF4, 0xC0, 0x1B, 0x00, 0xF0, 0xC0,
+0x03, 0x00, 0xE8, 0xC2, 0x23, 0x09, 0xEB, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0x8E, 0x7F, 0x80, 0x83,
+0xC1, 0x3D, 0x00, 0x53, 0xC0, 0xA3, 0x11, 0x8C, 0xF4, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0xB1,
+0xF0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF9, 0xCF, 0xC1, 0x07, 0x07, 0x8B, 0x7F, 0x80, 0x93,
+0xE8, 0x00, 0x08, 0x95, 0xC1, 0x19, 0x00, 0x49, 0xC2, 0x19, 0x00, 0x80, 0xC4, 0x19, 0xC0, 0x3B,
+0xC2, 0x19, 0x1E, 0x9C, 0x01, 0x40, 0x91, 0x59, 0x01, 0x50, 0x91, 0x5A, 0x01, 0x46, 0x17, 0x57,
+0x07, 0x18, 0xF4, 0xF9, 0x01, 0x20, 0xE0, 0x38, 0xC0, 0x61, 0x15, 0x71, 0x05, 0x11, 0xF0, 0xAB,
+0x01, 0xF8, 0xC8, 0x2B, 0x04, 0x40, 0xE0, 0x50, 0xE0, 0xF0, 0xC2, 0x0F, 0x05, 0x83, 0xFF, 0x02,
+0xC0, 0x81, 0xE0, 0xC1, 0x79, 0xC0, 0x69, 0x01, 0xFD, 0x2D, 0xC2, 0x77, 0x07, 0x81, 0xF1, 0x8E,
+0xB3, 0x85, 0x30, 0x79, 0xF1, 0xC3, 0x63, 0x16, 0x17, 0xC0, 0x90, 0x91, 0xF2, 0x00, 0x06, 0xC0,
+0x81, 0x91, 0x80, 0x93, 0xF1, 0x00, 0x41, 0x50, 0x50, 0x40, 0x9F, 0x5F, 0x41, 0x15, 0x51, 0xC0,
+0x53, 0x0B, 0x90, 0x32, 0xA8, 0xF3, 0x20, 0xE0, 0x90, 0x32, 0x09, 0xF4, 0x21, 0xE0, 0xC7, 0x5B,
+0xC1, 0x1B, 0x06, 0x91, 0xF6, 0x22, 0x23, 0x81, 0xF6, 0x06, 0xC2, 0x4D, 0x01, 0x49, 0xF0, 0xC1,
+0x4D, 0x00, 0x41, 0xC4, 0xCB, 0x02, 0xF6, 0xCF, 0x80, 0xC0, 0x6D, 0x00, 0x82, 0xC0, 0x03, 0x00,
+0x83, 0xC0, 0x03, 0x18, 0x54, 0xD0, 0x56, 0xD0, 0x1E, 0xBA, 0x10, 0x92, 0x51, 0x01, 0x84, 0xE0,
+0x89, 0xBD, 0x89, 0xB5, 0x82, 0x60, 0x89, 0xBD, 0x09, 0xB4, 0x00, 0xFE, 0xFD, 0xC0, 0x9B, 0x0C,
+0xD8, 0x00, 0x98, 0x2F, 0x9F, 0x77, 0x90, 0x93, 0xD8, 0x00, 0x80, 0x68, 0x80, 0xC1, 0x05, 0x01,
+0x91, 0x63, 0xC2, 0x61, 0x00, 0x63, 0xC0, 0x09, 0x03, 0xD8, 0x00, 0x8F, 0x7D, 0xC3, 0x13, 0x00,
+0xE0, 0xC2, 0x13, 0x00, 0xE0, 0xC0, 0x09, 0x00, 0xE1, 0xC2, 0x09, 0x00, 0xE1, 0xC0, 0x09, 0x06,
+0xE2, 0x00, 0x81, 0x60, 0x80, 0x93, 0xE2, 0xC2, 0x13, 0x00, 0x87, 0xC6, 0x13, 0x00, 0x88, 0xC2,
+0x13, 0x13, 0x08, 0x95, 0xC5, 0xDF, 0x81, 0xE0, 0x80, 0x93, 0x52, 0x01, 0x08, 0x95, 0xC0, 0xDF,
+0xE0, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0xC0, 0x2D, 0x02, 0x83, 0xE8, 0xED, 0xC1, 0x09, 0x0B, 0x8F,
+0x77, 0x80, 0x83, 0x0A, 0xD0, 0x0C, 0xD0, 0x19, 0xBC, 0xE3, 0xE6, 0xC5, 0x19, 0x01, 0x10, 0x92,
+0xC1, 0x2B, 0x01, 0x10, 0x92, 0xC1, 0x3B, 0x02, 0x10, 0x92, 0xE1, 0xC0, 0x05, 0x21, 0x1F, 0x92,
+0x0F, 0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11, 0x24, 0x2F, 0x93, 0x3F, 0x93, 0x4F, 0x93, 0x5F, 0x93,
+0x6F, 0x93, 0x7F, 0x93, 0x8F, 0x93, 0x9F, 0x93, 0xAF, 0x93, 0xBF, 0x93, 0xEF, 0x93, 0xFF, 0x93,
+0xC1, 0x79, 0x03, 0x80, 0xFF, 0x1B, 0xC0, 0xC1, 0x77, 0x02, 0x80, 0xFF, 0x17, 0xC0, 0x07, 0xC9,
+0x9D, 0xC1, 0x09, 0xC1, 0x9D, 0xC0, 0x03, 0x00, 0x61, 0xC3, 0x09, 0xC0, 0xC9, 0x00, 0x62, 0xC1,
+0xCF, 0x05, 0x19, 0xBC, 0x1E, 0xBA, 0x26, 0xD1, 0xC1, 0x2D, 0x02, 0x84, 0xFF, 0x29, 0xC2, 0x3D,
+0x13, 0x84, 0xFF, 0x25, 0xC0, 0x84, 0xE0, 0x89, 0xBD, 0x89, 0xB5, 0x82, 0x60, 0x89, 0xBD, 0x09,
+0xB4, 0x00, 0xFE, 0xFD, 0xCF, 0xC9, 0xFF, 0x03, 0xE1, 0x00, 0x8F, 0x7E, 0xC5, 0x57, 0xC1, 0x09,
+0xC3, 0x57, 0xC5, 0xFF, 0x08, 0x51, 0x01, 0x88, 0x23, 0x11, 0xF4, 0x81, 0xE0, 0x01, 0xC0, 0x43,
+0x03, 0x8E, 0xBB, 0xF9, 0xD0, 0xC1, 0x2F, 0x02, 0x83, 0xFF, 0x22, 0xC2, 0x59, 0x02, 0x83, 0xFF,
+0x1E, 0xC2, 0x97, 0x00, 0x87, 0xC2, 0x97, 0x00, 0x82, 0xC0, 0x1F, 0x03, 0x10, 0x92, 0x51, 0x01,
+0xDB, 0xA9, 0x0A, 0xA1, 0xDE, 0x80, 0xE0, 0x60, 0xE0, 0x42, 0xE2, 0x8C, 0xDE, 0xD3, 0xC2, 0x4B,
+0x02, 0x82, 0xFF, 0x0A, 0xC2, 0x4B, 0x02, 0x82, 0xFF, 0x06, 0xC2, 0x4B, 0x00, 0x8B, 0xC2, 0x39,
+0x44, 0xC5, 0xD0, 0xFF, 0x91, 0xEF, 0x91, 0xBF, 0x91, 0xAF, 0x91, 0x9F, 0x91, 0x8F, 0x91, 0x7F,
+0x91, 0x6F, 0x91, 0x5F, 0x91, 0x4F, 0x91, 0x3F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F,
+0x90, 0x1F, 0x90, 0x18, 0x95, 0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0, 0xCD, 0xB7, 0xDE,
+0xB7, 0xE3, 0xE5, 0xF1, 0xE0, 0x80, 0x91, 0xF1, 0x00, 0x81, 0x93, 0x81, 0xE0, 0xEB, 0x35, 0xF8,
+0x07, 0xC9, 0xF7, 0x90, 0x91, 0x53, 0xC0, 0x89, 0x20, 0x54, 0x01, 0x85, 0x30, 0x11, 0xF1, 0x86,
+0x30, 0x40, 0xF4, 0x81, 0x30, 0xB9, 0xF0, 0x81, 0x30, 0x70, 0xF0, 0x83, 0x30, 0x09, 0xF0, 0x81,
+0xC0, 0x11, 0xC0, 0x88, 0x30, 0x09, 0xF4, 0x53, 0xC0, 0x89, 0xC0, 0x05, 0x02, 0x62, 0xC0, 0x86,
+0xC0, 0x13, 0x18, 0x77, 0xC0, 0x2D, 0xC0, 0x90, 0x38, 0x09, 0xF4, 0x74, 0xC0, 0x92, 0x38, 0x09,
+0xF0, 0x70, 0xC0, 0x70, 0xC0, 0x99, 0x23, 0x09, 0xF4, 0x6D, 0xC0, 0x92, 0xC0, 0x1B, 0x02, 0x69,
+0xC0, 0x69, 0xC1, 0x0D, 0x05, 0xF0, 0x65, 0xC0, 0x10, 0x91, 0x55, 0xC0, 0x55, 0x00, 0xE8, 0xC2,
+0xF1, 0x08, 0xE8, 0x00, 0x49, 0xDE, 0x04, 0xC0, 0x8E, 0xB3, 0x88, 0xC0, 0x27, 0x00, 0x59, 0xC0,
+0xBB, 0x22, 0xE8, 0x00, 0x80, 0xFF, 0xF8, 0xCF, 0x81, 0x2F, 0x8F, 0x77, 0x11, 0xF4, 0x92, 0xE0,
+0x01, 0xC0, 0x93, 0xE0, 0x9E, 0xBB, 0x80, 0x68, 0x80, 0x93, 0xE3, 0x00, 0x4A, 0xC0, 0x90, 0x58,
+0x92, 0x30, 0x08, 0xF0, 0x45, 0xC0, 0x25, 0x17, 0x55, 0x01, 0x90, 0x91, 0x56, 0x01, 0x60, 0x91,
+0x57, 0x01, 0xAE, 0x01, 0x4F, 0x5F, 0x5F, 0x4F, 0xDF, 0xDD, 0xBC, 0x01, 0x00, 0x97, 0xC9, 0xF1,
+0xC7, 0x55, 0x05, 0x89, 0x81, 0x9A, 0x81, 0x3B, 0xDE, 0xC1, 0x0F, 0x00, 0x8B, 0xC2, 0x0F, 0x00,
+0x2B, 0xC0, 0x97, 0x01, 0x41, 0xF5, 0xC7, 0x1F, 0x06, 0x80, 0x91, 0x51, 0x01, 0x80, 0x93, 0xF1,
+0xC0, 0x07, 0x02, 0xE8, 0x00, 0x8E, 0xC2, 0x11, 0x02, 0x05, 0xDE, 0x19, 0xC0, 0x9F, 0x02, 0xB1,
+0xF4, 0x90, 0xC0, 0x5D, 0x03, 0x92, 0x30, 0x98, 0xF4, 0xC7, 0x2B, 0x05, 0x90, 0x93, 0x51, 0x01,
+0xF6, 0xDD, 0xC1, 0x31, 0x04, 0x88, 0x23, 0x11, 0xF4, 0x83, 0xC0, 0x95, 0x09, 0x84, 0xE0, 0x8E,
+0xBB, 0x16, 0xD0, 0x01, 0xC0, 0x40, 0xDB, 0xC1, 0x25, 0x02, 0x83, 0xFF, 0x0A, 0xC0, 0x93, 0x05,
+0xEB, 0x00, 0x80, 0x62, 0x80, 0x93, 0xC0, 0x05, 0xC6, 0x37, 0x0D, 0x0F, 0x90, 0x0F, 0x90, 0xCF,
+0x91, 0xDF, 0x91, 0x1F, 0x91, 0x08, 0x95, 0x08, 0x95, 0xC1, 0xE3, 0x01, 0x29, 0xF0, 0xC3, 0x2F,
+0x17, 0x01, 0xC0, 0x43, 0xCF, 0x08, 0x95, 0xF9, 0x99, 0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD, 0xF8,
+0x9A, 0x99, 0x27, 0x80, 0xB5, 0x08, 0x95, 0x26, 0x2F, 0xC1, 0x11, 0x01, 0x1F, 0xBA, 0xC1, 0x13,
+0x27, 0x20, 0xBD, 0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A, 0x0F, 0xBE, 0x01, 0x96, 0x08,
+0x95, 0xF8, 0x94, 0xFF, 0xCF, 0x01, 0x02, 0x1E, 0x94, 0x89, 0x20, 0xDC, 0xFB, 0x12, 0x01, 0x10,
+0x01, 0x00, 0x00, 0x00, 0x20, 0xEB, 0x03, 0xEF, 0x2F, 0xC0, 0x07, 0x0D, 0x01, 0x00, 0x01, 0x09,
+0x02, 0x1B, 0x00, 0x01, 0x01, 0x00, 0x80, 0x32, 0x09, 0x04, 0xC0, 0x10, 0x06, 0xFE, 0x01, 0x02,
+0x00, 0x09, 0x21, 0x03, 0xC0, 0x09, 0x04, 0x0C, 0x00, 0x01, 0x04, 0x03, 0xC0, 0x13,
+};  // end of Arduino_COMBINED_dfu_usbserial_atmega16u2_Uno_Rev3_hex
@@ -47,474 +47,348 @@
 
 */
 
+// Packed by convertHexToByteArray: 5451 bytes, 7474 unpacked
+const unsigned int atmega2560_bootloader_hex_length = 7474;
 const byte atmega2560_bootloader_hex [] PROGMEM = {
-0x0D, 0x94, 0x89, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1, 0x0D, 0x94, 0xB2, 0xF1,
-0x0D, 0x94, 0xB2, 0xF1, 0x41, 0x54, 0x6D, 0x65, 0x67, 0x61, 0x32, 0x35, 0x36, 0x30, 0x00, 0x41,
-0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20,
-0x73, 0x74, 0x6B, 0x35, 0x30, 0x30, 0x56, 0x32, 0x20, 0x62, 0x79, 0x20, 0x4D, 0x4C, 0x53, 0x00,
-0x42, 0x6F, 0x6F, 0x74, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x00, 0x48, 0x75, 0x68, 0x3F,
-0x00, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x00,
-0x43, 0x50, 0x55, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x5F,
-0x5F, 0x41, 0x56, 0x52, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x5F, 0x5F, 0x3D, 0x20, 0x00, 0x41, 0x56,
-0x52, 0x20, 0x4C, 0x69, 0x62, 0x43, 0x20, 0x56, 0x65, 0x72, 0x3D, 0x20, 0x00, 0x47, 0x43, 0x43,
-0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x00, 0x43, 0x50, 0x55, 0x20,
-0x49, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x4C, 0x6F, 0x77, 0x20, 0x66,
-0x75, 0x73, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x48, 0x69, 0x67, 0x68, 0x20, 0x66,
-0x75, 0x73, 0x65, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x45, 0x78, 0x74, 0x20, 0x66, 0x75, 0x73,
-0x65, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x4C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 0x75, 0x73,
-0x65, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x00, 0x44, 0x65, 0x63, 0x20, 0x31, 0x35, 0x20, 0x32, 0x30,
-0x31, 0x33, 0x00, 0x31, 0x2E, 0x36, 0x2E, 0x37, 0x00, 0x34, 0x2E, 0x33, 0x2E, 0x33, 0x00, 0x56,
-0x23, 0x20, 0x20, 0x20, 0x41, 0x44, 0x44, 0x52, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x20, 0x63, 0x6F,
-0x64, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x20, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x72,
+0x06, 0x0D, 0x94, 0x89, 0xF1, 0x0D, 0x94, 0xB2, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xD4, 0x03,
+0x53, 0x41, 0x54, 0x6D, 0x65, 0x67, 0x61, 0x32, 0x35, 0x36, 0x30, 0x00, 0x41, 0x72, 0x64, 0x75,
+0x69, 0x6E, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x20, 0x73, 0x74, 0x6B,
+0x35, 0x30, 0x30, 0x56, 0x32, 0x20, 0x62, 0x79, 0x20, 0x4D, 0x4C, 0x53, 0x00, 0x42, 0x6F, 0x6F,
+0x74, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x00, 0x48, 0x75, 0x68, 0x3F, 0x00, 0x43, 0x6F,
+0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x00, 0x43, 0x50, 0x55,
+0x20, 0x54, 0x79, 0x70, 0x65, 0x80, 0x03, 0x20, 0xC0, 0x0E, 0x0B, 0x5F, 0x5F, 0x41, 0x56, 0x52,
+0x5F, 0x41, 0x52, 0x43, 0x48, 0x5F, 0x5F, 0xC0, 0x0E, 0xC0, 0x0C, 0x08, 0x20, 0x4C, 0x69, 0x62,
+0x43, 0x20, 0x56, 0x65, 0x72, 0xC0, 0x0E, 0x01, 0x47, 0x43, 0xC2, 0x09, 0x01, 0x73, 0x69, 0xC7,
+0x3B, 0x01, 0x49, 0x44, 0x80, 0x05, 0x20, 0xC0, 0x0E, 0x06, 0x4C, 0x6F, 0x77, 0x20, 0x66, 0x75,
+0x73, 0xC5, 0x4A, 0x03, 0x48, 0x69, 0x67, 0x68, 0xC5, 0x0F, 0xC0, 0x0E, 0x02, 0x45, 0x78, 0x74,
+0xC9, 0x1D, 0x03, 0x4C, 0x6F, 0x63, 0x6B, 0xC8, 0x1D, 0x19, 0x44, 0x65, 0x63, 0x20, 0x31, 0x35,
+0x20, 0x32, 0x30, 0x31, 0x33, 0x00, 0x31, 0x2E, 0x36, 0x2E, 0x37, 0x00, 0x34, 0x2E, 0x33, 0x2E,
+0x33, 0x00, 0x56, 0x23, 0xC0, 0x1F, 0x03, 0x41, 0x44, 0x44, 0x52, 0xC0, 0x06, 0x05, 0x6F, 0x70,
+0x20, 0x63, 0x6F, 0x64, 0xC2, 0x40, 0x08, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+0xC1, 0x89, 0x03, 0x61, 0x64, 0x64, 0x72, 0xC0, 0x12, 0x1A, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x72,
 0x75, 0x70, 0x74, 0x00, 0x6E, 0x6F, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x00, 0x72, 0x6A,
-0x6D, 0x70, 0x20, 0x20, 0x00, 0x6A, 0x6D, 0x70, 0x20, 0x00, 0x57, 0x68, 0x61, 0x74, 0x20, 0x70,
-0x6F, 0x72, 0x74, 0x3A, 0x00, 0x50, 0x6F, 0x72, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x75,
-0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x00, 0x4D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
-0x61, 0x20, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x20, 0x00, 0x57, 0x72, 0x69, 0x74, 0x74,
-0x69, 0x6E, 0x67, 0x20, 0x45, 0x45, 0x00, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x45,
-0x45, 0x00, 0x45, 0x45, 0x20, 0x65, 0x72, 0x72, 0x20, 0x63, 0x6E, 0x74, 0x3D, 0x00, 0x50, 0x4F,
-0x52, 0x54, 0x00, 0x30, 0x3D, 0x5A, 0x65, 0x72, 0x6F, 0x20, 0x61, 0x64, 0x64, 0x72, 0x00, 0x3F,
-0x3D, 0x43, 0x50, 0x55, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x40, 0x3D, 0x45, 0x45, 0x50,
-0x52, 0x4F, 0x4D, 0x20, 0x74, 0x65, 0x73, 0x74, 0x00, 0x42, 0x3D, 0x42, 0x6C, 0x69, 0x6E, 0x6B,
-0x20, 0x4C, 0x45, 0x44, 0x00, 0x45, 0x3D, 0x44, 0x75, 0x6D, 0x70, 0x20, 0x45, 0x45, 0x50, 0x52,
-0x4F, 0x4D, 0x00, 0x46, 0x3D, 0x44, 0x75, 0x6D, 0x70, 0x20, 0x46, 0x4C, 0x41, 0x53, 0x48, 0x00,
-0x48, 0x3D, 0x48, 0x65, 0x6C, 0x70, 0x00, 0x4C, 0x3D, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x49, 0x2F,
-0x4F, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x73, 0x00, 0x51, 0x3D, 0x51, 0x75, 0x69, 0x74, 0x00, 0x52,
-0x3D, 0x44, 0x75, 0x6D, 0x70, 0x20, 0x52, 0x41, 0x4D, 0x00, 0x56, 0x3D, 0x73, 0x68, 0x6F, 0x77,
-0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F,
-0x72, 0x73, 0x00, 0x59, 0x3D, 0x50, 0x6F, 0x72, 0x74, 0x20, 0x62, 0x6C, 0x69, 0x6E, 0x6B, 0x00,
-0x2A, 0x00, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD1, 0xE2, 0xDE, 0xBF, 0xCD, 0xBF, 0x01, 0xE0,
-0x0C, 0xBF, 0x12, 0xE0, 0xA0, 0xE0, 0xB2, 0xE0, 0xE2, 0xE3, 0xFD, 0xEF, 0x03, 0xE0, 0x0B, 0xBF,
-0x02, 0xC0, 0x07, 0x90, 0x0D, 0x92, 0xA0, 0x30, 0xB1, 0x07, 0xD9, 0xF7, 0x12, 0xE0, 0xA0, 0xE0,
-0xB2, 0xE0, 0x01, 0xC0, 0x1D, 0x92, 0xAE, 0x30, 0xB1, 0x07, 0xE1, 0xF7, 0x0F, 0x94, 0x60, 0xF3,
-0x0D, 0x94, 0x97, 0xFE, 0x01, 0xE2, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0x11, 0x24, 0x1F, 0xBE,
-0x0D, 0x94, 0x60, 0xF3, 0x0D, 0x94, 0x00, 0xF0, 0x20, 0xE0, 0x30, 0xE0, 0x40, 0xED, 0x57, 0xE0,
-0x05, 0xC0, 0xFA, 0x01, 0x31, 0x97, 0xF1, 0xF7, 0x2F, 0x5F, 0x3F, 0x4F, 0x28, 0x17, 0x39, 0x07,
-0xC0, 0xF3, 0x08, 0x95, 0x9C, 0x01, 0x26, 0x0F, 0x31, 0x1D, 0xC9, 0x01, 0xA0, 0xE0, 0xB0, 0xE0,
-0x2F, 0x5F, 0x3F, 0x4F, 0xAB, 0xBF, 0xFC, 0x01, 0x87, 0x91, 0x88, 0x23, 0x61, 0xF0, 0x80, 0x93,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64,
-0x80, 0x93, 0xC0, 0x00, 0xEA, 0xCF, 0x08, 0x95, 0x8D, 0xE0, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91,
-0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00,
-0x8A, 0xE0, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91,
-0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x08, 0x95, 0x0F, 0x94, 0xC2, 0xF1, 0x0F, 0x94,
-0xDC, 0xF1, 0x08, 0x95, 0xFC, 0x01, 0x90, 0x81, 0x99, 0x23, 0x59, 0xF0, 0x90, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0x31, 0x96, 0x99, 0x23, 0x79, 0xF7, 0x08, 0x95, 0x28, 0x2F, 0x98, 0x2F, 0x92, 0x95,
-0x9F, 0x70, 0x89, 0x2F, 0x80, 0x5D, 0x8A, 0x33, 0x08, 0xF0, 0x89, 0x5F, 0x80, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0x82, 0x2F, 0x8F, 0x70, 0x98, 0x2F, 0x90, 0x5D, 0x9A, 0x33, 0x08, 0xF0, 0x99, 0x5F,
-0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x08, 0x95, 0x9C, 0x01, 0xFB, 0x01, 0x85, 0x36, 0x91, 0x05,
-0x1C, 0xF4, 0x63, 0x30, 0x71, 0x05, 0x94, 0xF0, 0xC9, 0x01, 0x64, 0xE6, 0x70, 0xE0, 0x0F, 0x94,
-0x38, 0xFE, 0x60, 0x5D, 0x7F, 0x4F, 0x60, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF,
-0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x2B, 0x30, 0x31, 0x05,
-0x14, 0xF4, 0x32, 0x97, 0xB4, 0xF0, 0xC9, 0x01, 0x64, 0xE6, 0x70, 0xE0, 0x0F, 0x94, 0x38, 0xFE,
-0x6A, 0xE0, 0x70, 0xE0, 0x0F, 0x94, 0x38, 0xFE, 0x60, 0x5D, 0x7F, 0x4F, 0x60, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0xC9, 0x01, 0x6A, 0xE0, 0x70, 0xE0, 0x0F, 0x94, 0x38, 0xFE, 0xC0, 0x96, 0x80, 0x93,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64,
-0x80, 0x93, 0xC0, 0x00, 0x08, 0x95, 0x1F, 0x93, 0x18, 0x2F, 0x8E, 0xE6, 0x92, 0xEE, 0x60, 0xE0,
-0x0F, 0x94, 0xC2, 0xF1, 0x10, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF,
-0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x0F, 0x94, 0xDC, 0xF1, 0x1F, 0x91,
-0x08, 0x95, 0x2F, 0x92, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92,
-0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93,
-0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0xCD, 0xB7, 0xDE, 0xB7, 0x62, 0x97, 0x0F, 0xB6, 0xF8, 0x94,
-0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF, 0x38, 0x2E, 0x62, 0x2E, 0xCA, 0x01, 0xDB, 0x01, 0x5C, 0x01,
-0x6D, 0x01, 0x77, 0x24, 0x20, 0xE2, 0x22, 0x2E, 0x2E, 0x01, 0x08, 0x94, 0x41, 0x1C, 0x51, 0x1C,
-0x8B, 0xC0, 0x81, 0xE0, 0xA8, 0x16, 0x80, 0xE0, 0xB8, 0x06, 0x81, 0xE0, 0xC8, 0x06, 0x80, 0xE0,
-0xD8, 0x06, 0x28, 0xF0, 0xC6, 0x01, 0xAA, 0x27, 0xBB, 0x27, 0x0F, 0x94, 0x0D, 0xF2, 0xBB, 0x27,
-0xAD, 0x2D, 0x9C, 0x2D, 0x8B, 0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0x8A, 0x2D, 0x0F, 0x94, 0x0D, 0xF2,
-0x20, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x9D, 0xE2, 0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x20, 0x92,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64,
-0x80, 0x93, 0xC0, 0x00, 0x19, 0x82, 0x86, 0x01, 0x75, 0x01, 0x88, 0x24, 0x99, 0x24, 0xA1, 0xE0,
-0x3A, 0x16, 0x51, 0xF0, 0x3A, 0x16, 0x20, 0xF0, 0xB2, 0xE0, 0x3B, 0x16, 0x61, 0xF4, 0x09, 0xC0,
-0x0B, 0xBF, 0xF7, 0x01, 0x77, 0x90, 0x07, 0xC0, 0xC7, 0x01, 0x0F, 0x94, 0x81, 0xFE, 0x78, 0x2E,
-0x02, 0xC0, 0xF7, 0x01, 0x70, 0x80, 0x87, 0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0x20, 0x92, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0x87, 0x2D, 0x80, 0x52, 0xF4, 0x01, 0xEF, 0x70, 0xF0, 0x70, 0x8F, 0x35, 0x20, 0xF4,
-0xE4, 0x0D, 0xF5, 0x1D, 0x70, 0x82, 0x04, 0xC0, 0xE4, 0x0D, 0xF5, 0x1D, 0x8E, 0xE2, 0x80, 0x83,
-0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C,
-0x90, 0xE1, 0x89, 0x16, 0x91, 0x04, 0x09, 0xF0, 0xC2, 0xCF, 0x80, 0xE1, 0x90, 0xE0, 0xA0, 0xE0,
-0xB0, 0xE0, 0xA8, 0x0E, 0xB9, 0x1E, 0xCA, 0x1E, 0xDB, 0x1E, 0x19, 0x8A, 0xC2, 0x01, 0x0F, 0x94,
-0xFA, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x6A, 0x94, 0x66, 0x20, 0x09, 0xF0, 0x72, 0xCF, 0x62, 0x96,
-0x0F, 0xB6, 0xF8, 0x94, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF, 0xCF, 0x91, 0xDF, 0x91, 0x1F, 0x91,
-0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xBF, 0x90, 0xAF, 0x90, 0x9F, 0x90,
-0x8F, 0x90, 0x7F, 0x90, 0x6F, 0x90, 0x5F, 0x90, 0x4F, 0x90, 0x3F, 0x90, 0x2F, 0x90, 0x08, 0x95,
-0x2F, 0x92, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92,
-0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93,
-0xDF, 0x93, 0xCF, 0x93, 0xCD, 0xB7, 0xDE, 0xB7, 0xCD, 0x53, 0xD1, 0x40, 0x0F, 0xB6, 0xF8, 0x94,
-0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF, 0x01, 0xE2, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0x84, 0xB7,
-0xF8, 0x94, 0xA8, 0x95, 0x14, 0xBE, 0x90, 0x91, 0x60, 0x00, 0x98, 0x61, 0x90, 0x93, 0x60, 0x00,
-0x10, 0x92, 0x60, 0x00, 0x98, 0xE1, 0x0F, 0xB6, 0xF8, 0x94, 0x90, 0x93, 0x60, 0x00, 0x10, 0x92,
-0x60, 0x00, 0x0F, 0xBE, 0x78, 0x94, 0x83, 0xFF, 0x07, 0xC0, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00,
-0xE8, 0x95, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94, 0x27, 0x9A, 0x2F, 0x9A, 0x80, 0x91, 0xC0, 0x00,
-0x82, 0x60, 0x80, 0x93, 0xC0, 0x00, 0x80, 0xE1, 0x80, 0x93, 0xC4, 0x00, 0x88, 0xE1, 0x80, 0x93,
-0xC1, 0x00, 0x00, 0x00, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01, 0x44, 0xE0, 0xA4, 0x2E, 0xB1, 0x2C,
-0xCC, 0x24, 0xDD, 0x24, 0x24, 0xC0, 0xC5, 0x01, 0x01, 0x97, 0xF1, 0xF7, 0x08, 0x94, 0xE1, 0x1C,
-0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x21, 0xE2, 0xE2, 0x16, 0x2E, 0xE4, 0xF2, 0x06, 0x20, 0xE0,
-0x02, 0x07, 0x20, 0xE0, 0x12, 0x07, 0x18, 0xF0, 0x31, 0xE0, 0xC3, 0x2E, 0xD1, 0x2C, 0xC8, 0x01,
-0xB7, 0x01, 0x27, 0xEC, 0x3B, 0xE1, 0x40, 0xE0, 0x50, 0xE0, 0x0F, 0x94, 0x4B, 0xFE, 0x61, 0x15,
-0x71, 0x05, 0x81, 0x05, 0x91, 0x05, 0x19, 0xF4, 0x85, 0xB1, 0x80, 0x58, 0x85, 0xB9, 0x80, 0x91,
-0xC0, 0x00, 0x87, 0xFD, 0x03, 0xC0, 0xC1, 0x14, 0xD1, 0x04, 0xA9, 0xF2, 0xA6, 0x01, 0x4F, 0x5F,
-0x5F, 0x4F, 0xC2, 0x5E, 0xDE, 0x4F, 0x59, 0x83, 0x48, 0x83, 0xCE, 0x51, 0xD1, 0x40, 0xC2, 0x5E,
-0xDE, 0x4F, 0x88, 0x81, 0x99, 0x81, 0xCE, 0x51, 0xD1, 0x40, 0x01, 0x97, 0x11, 0xF0, 0x0D, 0x94,
-0x1A, 0xFE, 0xC0, 0x5D, 0xDE, 0x4F, 0x19, 0x82, 0x18, 0x82, 0xC0, 0x53, 0xD1, 0x40, 0x60, 0xE0,
-0xC1, 0x5D, 0xDE, 0x4F, 0x18, 0x82, 0xCF, 0x52, 0xD1, 0x40, 0x88, 0x24, 0x99, 0x24, 0xC3, 0x5D,
-0xDE, 0x4F, 0x19, 0x82, 0x18, 0x82, 0xCD, 0x52, 0xD1, 0x40, 0xC0, 0x5E, 0xDE, 0x4F, 0x18, 0x82,
-0x19, 0x82, 0x1A, 0x82, 0x1B, 0x82, 0xC0, 0x52, 0xD1, 0x40, 0xCE, 0x5C, 0xDE, 0x4F, 0x18, 0x82,
-0x19, 0x82, 0x1A, 0x82, 0x1B, 0x82, 0xC2, 0x53, 0xD1, 0x40, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01,
-0x0B, 0xBF, 0xF7, 0x01, 0x07, 0x91, 0x16, 0x91, 0xC4, 0x5C, 0xDE, 0x4F, 0x19, 0x83, 0x08, 0x83,
-0xCC, 0x53, 0xD1, 0x40, 0x0D, 0x94, 0x15, 0xFE, 0xC2, 0x5E, 0xDE, 0x4F, 0x28, 0x81, 0x39, 0x81,
-0xCE, 0x51, 0xD1, 0x40, 0x21, 0x30, 0x31, 0x05, 0x09, 0xF5, 0x20, 0x91, 0xC6, 0x00, 0xC2, 0x5E,
-0xDE, 0x4F, 0x19, 0x82, 0x18, 0x82, 0xCE, 0x51, 0xD1, 0x40, 0x22, 0xC0, 0x2F, 0x5F, 0x3F, 0x4F,
-0x4F, 0x4F, 0x5F, 0x4F, 0x21, 0x30, 0x82, 0xE1, 0x38, 0x07, 0x8A, 0xE7, 0x48, 0x07, 0x80, 0xE0,
-0x58, 0x07, 0x80, 0xF0, 0xC4, 0x5C, 0xDE, 0x4F, 0xE8, 0x81, 0xF9, 0x81, 0xCC, 0x53, 0xD1, 0x40,
-0xEF, 0x5F, 0xFF, 0x4F, 0x19, 0xF0, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94, 0x20, 0xE0, 0x30, 0xE0,
-0x40, 0xE0, 0x50, 0xE0, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xE0, 0xCF, 0x20, 0x91, 0xC6, 0x00,
-0xC3, 0x5D, 0xDE, 0x4F, 0x48, 0x81, 0x59, 0x81, 0xCD, 0x52, 0xD1, 0x40, 0x4F, 0x5F, 0x5F, 0x4F,
-0xC3, 0x5D, 0xDE, 0x4F, 0x59, 0x83, 0x48, 0x83, 0xCD, 0x52, 0xD1, 0x40, 0x21, 0x32, 0x09, 0xF0,
-0x63, 0xC6, 0x4A, 0x30, 0x51, 0x05, 0x08, 0xF0, 0x5F, 0xC6, 0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C,
-0x53, 0xE0, 0x85, 0x16, 0x91, 0x04, 0x09, 0xF0, 0x59, 0xC6, 0x00, 0xE0, 0x10, 0xE0, 0x18, 0xC0,
-0x81, 0xE2, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91,
-0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x2F, 0x5F, 0x3F, 0x4F, 0x29, 0x31, 0x31, 0x05,
-0x79, 0xF7, 0x0F, 0x94, 0xDC, 0xF1, 0x0F, 0x5F, 0x1F, 0x4F, 0x05, 0x30, 0x11, 0x05, 0x19, 0xF0,
-0x20, 0xE0, 0x30, 0xE0, 0xE5, 0xCF, 0x10, 0x92, 0x0A, 0x02, 0x10, 0x92, 0x0B, 0x02, 0x10, 0x92,
-0x0C, 0x02, 0x10, 0x92, 0x0D, 0x02, 0x10, 0x92, 0x06, 0x02, 0x10, 0x92, 0x07, 0x02, 0x10, 0x92,
-0x08, 0x02, 0x10, 0x92, 0x09, 0x02, 0x10, 0x92, 0x02, 0x02, 0x10, 0x92, 0x03, 0x02, 0x10, 0x92,
-0x04, 0x02, 0x10, 0x92, 0x05, 0x02, 0x8F, 0xEE, 0x90, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1,
-0x80, 0xE1, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF,
-0xFC, 0xCF, 0x90, 0x91, 0xC6, 0x00, 0x90, 0x36, 0x08, 0xF0, 0x9F, 0x75, 0x90, 0x32, 0xB8, 0xF0,
-0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xA0, 0xE2, 0xA0, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x98, 0x34,
-0x09, 0xF4, 0xD7, 0xC1, 0x99, 0x34, 0xB8, 0xF4, 0x92, 0x34, 0x09, 0xF4, 0x59, 0xC1, 0x93, 0x34,
-0x58, 0xF4, 0x90, 0x33, 0x19, 0xF1, 0x90, 0x33, 0x08, 0xF4, 0xE3, 0xC5, 0x9F, 0x33, 0xA1, 0xF1,
-0x90, 0x34, 0x09, 0xF0, 0xDE, 0xC5, 0xBD, 0xC0, 0x95, 0x34, 0x09, 0xF4, 0x70, 0xC1, 0x96, 0x34,
-0x09, 0xF0, 0xD7, 0xC5, 0x98, 0xC1, 0x92, 0x35, 0x09, 0xF4, 0x2B, 0xC2, 0x93, 0x35, 0x38, 0xF4,
-0x9C, 0x34, 0x09, 0xF4, 0xF5, 0xC1, 0x91, 0x35, 0x09, 0xF0, 0xCB, 0xC5, 0x18, 0xC2, 0x96, 0x35,
-0x09, 0xF4, 0x45, 0xC2, 0x99, 0x35, 0x09, 0xF0, 0xC4, 0xC5, 0x67, 0xC4, 0x83, 0xE7, 0x92, 0xEE,
-0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x10, 0x92, 0x06, 0x02, 0x10, 0x92, 0x07, 0x02, 0x10, 0x92,
-0x08, 0x02, 0x10, 0x92, 0x09, 0x02, 0x10, 0x92, 0x0A, 0x02, 0x10, 0x92, 0x0B, 0x02, 0x10, 0x92,
-0x0C, 0x02, 0x10, 0x92, 0x0D, 0x02, 0x13, 0xC1, 0x8F, 0xE7, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94,
-0xF5, 0xF1, 0x8F, 0xEE, 0x90, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x81, 0xE2, 0x91, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x87, 0xEB, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1,
-0x80, 0xE3, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x84, 0xEE, 0x90, 0xEE, 0x60, 0xE0,
-0x0F, 0x94, 0xF5, 0xF1, 0x8F, 0xE3, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x86, 0xE0,
-0x90, 0xE0, 0x61, 0xE0, 0x70, 0xE0, 0x0F, 0x94, 0x34, 0xF2, 0x0F, 0x94, 0xDC, 0xF1, 0x8D, 0xE5,
-0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x89, 0xEC, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94,
-0xF5, 0xF1, 0x8E, 0xE4, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x83, 0xEC, 0x91, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x8C, 0xE6, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1,
-0x8E, 0xE1, 0x0F, 0x94, 0x0D, 0xF2, 0x88, 0xE9, 0x0F, 0x94, 0x0D, 0xF2, 0x81, 0xE0, 0x0F, 0x94,
-0x0D, 0xF2, 0x0F, 0x94, 0xDC, 0xF1, 0x8B, 0xE7, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1,
-0x19, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x10, 0x93, 0x57, 0x00, 0xE4, 0x91, 0x8E, 0x2F, 0x0F, 0x94,
-0x0D, 0xF2, 0x0F, 0x94, 0xDC, 0xF1, 0x8A, 0xE8, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1,
-0xE3, 0xE0, 0xF0, 0xE0, 0x10, 0x93, 0x57, 0x00, 0xE4, 0x91, 0x8E, 0x2F, 0x0F, 0x94, 0x0D, 0xF2,
-0x0F, 0x94, 0xDC, 0xF1, 0x89, 0xE9, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xE2, 0xE0,
-0xF0, 0xE0, 0x10, 0x93, 0x57, 0x00, 0xE4, 0x91, 0x8E, 0x2F, 0x0F, 0x94, 0x0D, 0xF2, 0x0F, 0x94,
-0xDC, 0xF1, 0x88, 0xEA, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xE1, 0xE0, 0xF0, 0xE0,
-0x10, 0x93, 0x57, 0x00, 0x14, 0x91, 0x81, 0x2F, 0x0F, 0x94, 0x0D, 0xF2, 0x0F, 0x94, 0xDC, 0xF1,
-0x07, 0xCF, 0x8B, 0xE8, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x8B, 0xE4, 0x92, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x00, 0xE0, 0x10, 0xE0, 0x19, 0xC0,
-0xC8, 0x01, 0x6F, 0x2D, 0x0F, 0x94, 0x89, 0xFE, 0xFF, 0x20, 0x31, 0xF4, 0x89, 0xE4, 0x92, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x0B, 0xC0, 0xF0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x0F, 0x5F,
-0x1F, 0x4F, 0xC8, 0x01, 0x81, 0x51, 0x9F, 0x41, 0xA0, 0xE0, 0xB0, 0xE0, 0xAB, 0xBF, 0xFC, 0x01,
-0xF7, 0x90, 0xBA, 0xE2, 0xFB, 0x16, 0x21, 0xF0, 0xE2, 0xE0, 0x00, 0x30, 0x1E, 0x07, 0xC1, 0xF6,
-0x0F, 0x94, 0xDC, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x87, 0xE5, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94,
-0xF5, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0xCC, 0x24, 0xDD, 0x24, 0x00, 0xE0, 0x10, 0xE0, 0x1E, 0xC0,
-0xC8, 0x01, 0x0F, 0x94, 0x81, 0xFE, 0xF8, 0x2E, 0x88, 0x23, 0x31, 0xF4, 0x89, 0xE4, 0x92, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x0B, 0xC0, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xFE, 0x14,
-0x19, 0xF0, 0x08, 0x94, 0xC1, 0x1C, 0xD1, 0x1C, 0x0F, 0x5F, 0x1F, 0x4F, 0xC8, 0x01, 0x81, 0x51,
-0x9F, 0x41, 0xA0, 0xE0, 0xB0, 0xE0, 0xAB, 0xBF, 0xFC, 0x01, 0xE7, 0x90, 0xFA, 0xE2, 0xEF, 0x16,
-0x21, 0xF0, 0x22, 0xE0, 0x00, 0x30, 0x12, 0x07, 0x99, 0xF6, 0x0F, 0x94, 0xDC, 0xF1, 0x0F, 0x94,
-0xDC, 0xF1, 0x82, 0xE6, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xC6, 0x01, 0x61, 0xE0,
-0x70, 0xE0, 0x0F, 0x94, 0x34, 0xF2, 0x0F, 0x94, 0xDC, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x10, 0x92,
-0x02, 0x02, 0x10, 0x92, 0x03, 0x02, 0x10, 0x92, 0x04, 0x02, 0x10, 0x92, 0x05, 0x02, 0x78, 0xCE,
-0x89, 0xE9, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x27, 0x9A, 0x2F, 0x9A, 0x16, 0xC0,
-0x2F, 0x98, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96,
-0x84, 0x36, 0x91, 0x05, 0xC1, 0xF7, 0x2F, 0x9A, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0,
-0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x84, 0x36, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00,
-0x87, 0xFF, 0xE6, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xFC, 0xCF, 0x64, 0xC4, 0x85, 0xEA,
-0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x40, 0x91, 0x02, 0x02, 0x50, 0x91, 0x03, 0x02,
-0x60, 0x91, 0x04, 0x02, 0x70, 0x91, 0x05, 0x02, 0x81, 0xE0, 0x20, 0xE1, 0x0F, 0x94, 0x91, 0xF2,
-0x80, 0x91, 0x02, 0x02, 0x90, 0x91, 0x03, 0x02, 0xA0, 0x91, 0x04, 0x02, 0xB0, 0x91, 0x05, 0x02,
-0x80, 0x50, 0x9F, 0x4F, 0xAF, 0x4F, 0xBF, 0x4F, 0x80, 0x93, 0x02, 0x02, 0x90, 0x93, 0x03, 0x02,
-0xA0, 0x93, 0x04, 0x02, 0xB0, 0x93, 0x05, 0x02, 0x80, 0x50, 0x90, 0x41, 0xA0, 0x40, 0xB0, 0x40,
-0x08, 0xF4, 0x26, 0xCE, 0xA4, 0xCF, 0x83, 0xEB, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1,
-0x40, 0x91, 0x06, 0x02, 0x50, 0x91, 0x07, 0x02, 0x60, 0x91, 0x08, 0x02, 0x70, 0x91, 0x09, 0x02,
-0x80, 0xE0, 0x20, 0xE1, 0x0F, 0x94, 0x91, 0xF2, 0x80, 0x91, 0x06, 0x02, 0x90, 0x91, 0x07, 0x02,
-0xA0, 0x91, 0x08, 0x02, 0xB0, 0x91, 0x09, 0x02, 0x80, 0x50, 0x9F, 0x4F, 0xAF, 0x4F, 0xBF, 0x4F,
-0x80, 0x93, 0x06, 0x02, 0x90, 0x93, 0x07, 0x02, 0xA0, 0x93, 0x08, 0x02, 0xB0, 0x93, 0x09, 0x02,
-0xFF, 0xCD, 0x80, 0xEC, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x83, 0xE7, 0x92, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x8F, 0xE7, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1,
-0x8B, 0xE8, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x89, 0xE9, 0x92, 0xEE, 0x60, 0xE0,
-0x0F, 0x94, 0xF5, 0xF1, 0x85, 0xEA, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x83, 0xEB,
-0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x80, 0xEC, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94,
-0xF5, 0xF1, 0x87, 0xEC, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x88, 0xED, 0x92, 0xEE,
-0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x8F, 0xED, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1,
-0x8A, 0xEE, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x83, 0xE0, 0x93, 0xEE, 0xBD, 0xCD,
-0x87, 0xEC, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x81, 0xE4, 0x0F, 0x94, 0x7B, 0xF2,
-0x82, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x83, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x84, 0xE4, 0x0F, 0x94,
-0x7B, 0xF2, 0x85, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x86, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x87, 0xE4,
-0x0F, 0x94, 0x7B, 0xF2, 0x88, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x8A, 0xE4, 0x0F, 0x94, 0x7B, 0xF2,
-0x8B, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x8C, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x99, 0xCD, 0x88, 0xED,
-0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x77, 0x24, 0x73, 0x94, 0x88, 0x24, 0x99, 0x24,
-0x09, 0xC4, 0x8F, 0xED, 0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x40, 0x91, 0x0A, 0x02,
-0x50, 0x91, 0x0B, 0x02, 0x60, 0x91, 0x0C, 0x02, 0x70, 0x91, 0x0D, 0x02, 0x82, 0xE0, 0x20, 0xE1,
-0x0F, 0x94, 0x91, 0xF2, 0x80, 0x91, 0x0A, 0x02, 0x90, 0x91, 0x0B, 0x02, 0xA0, 0x91, 0x0C, 0x02,
-0xB0, 0x91, 0x0D, 0x02, 0x80, 0x50, 0x9F, 0x4F, 0xAF, 0x4F, 0xBF, 0x4F, 0x80, 0x93, 0x0A, 0x02,
-0x90, 0x93, 0x0B, 0x02, 0xA0, 0x93, 0x0C, 0x02, 0xB0, 0x93, 0x0D, 0x02, 0x69, 0xCD, 0x8A, 0xEE,
-0x92, 0xEE, 0x62, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x84, 0xEE, 0x90, 0xEE, 0x60, 0xE0, 0x0F, 0x94,
-0xF5, 0xF1, 0x8F, 0xEC, 0x91, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x66, 0x24, 0x77, 0x24,
+0x6D, 0x70, 0x20, 0x20, 0x00, 0xC1, 0x05, 0x0C, 0x00, 0x57, 0x68, 0x61, 0x74, 0x20, 0x70, 0x6F,
+0x72, 0x74, 0x3A, 0x00, 0x50, 0xC0, 0x05, 0x07, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x75, 0x70,
+0xC1, 0x11, 0x0F, 0x65, 0x64, 0x00, 0x4D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20,
+0x6C, 0x65, 0x74, 0xC0, 0x48, 0x00, 0x00, 0xC0, 0x30, 0x0E, 0x72, 0x69, 0x74, 0x74, 0x69, 0x6E,
+0x67, 0x20, 0x45, 0x45, 0x00, 0x52, 0x65, 0x61, 0x64, 0xC4, 0x0A, 0x02, 0x45, 0x45, 0x20, 0xC0,
+0x67, 0x10, 0x20, 0x63, 0x6E, 0x74, 0x3D, 0x00, 0x50, 0x4F, 0x52, 0x54, 0x00, 0x30, 0x3D, 0x5A,
+0x65, 0x72, 0x6F, 0xC2, 0x86, 0x2A, 0x00, 0x3F, 0x3D, 0x43, 0x50, 0x55, 0x20, 0x73, 0x74, 0x61,
+0x74, 0x73, 0x00, 0x40, 0x3D, 0x45, 0x45, 0x50, 0x52, 0x4F, 0x4D, 0x20, 0x74, 0x65, 0x73, 0x74,
+0x00, 0x42, 0x3D, 0x42, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x4C, 0x45, 0x44, 0x00, 0x45, 0x3D, 0x44,
+0x75, 0xC0, 0x92, 0xC3, 0x1E, 0x01, 0x00, 0x46, 0xC3, 0x0D, 0x10, 0x46, 0x4C, 0x41, 0x53, 0x48,
+0x00, 0x48, 0x3D, 0x48, 0x65, 0x6C, 0x70, 0x00, 0x4C, 0x3D, 0x4C, 0x69, 0xC0, 0x90, 0x03, 0x49,
+0x2F, 0x4F, 0x20, 0xC1, 0xAC, 0x09, 0x73, 0x00, 0x51, 0x3D, 0x51, 0x75, 0x69, 0x74, 0x00, 0x52,
+0xC3, 0x2B, 0x0B, 0x52, 0x41, 0x4D, 0x00, 0x56, 0x3D, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0xC5,
+0xF6, 0x01, 0x20, 0x56, 0xC2, 0xF3, 0x03, 0x73, 0x00, 0x59, 0x3D, 0xC2, 0xDF, 0x00, 0x62, 0xC1,
+0x6E, 0x2C, 0x00, 0x2A, 0x00, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD1, 0xE2, 0xDE, 0xBF, 0xCD,
+0xBF, 0x01, 0xE0, 0x0C, 0xBF, 0x12, 0xE0, 0xA0, 0xE0, 0xB2, 0xE0, 0xE2, 0xE3, 0xFD, 0xEF, 0x03,
+0xE0, 0x0B, 0xBF, 0x02, 0xC0, 0x07, 0x90, 0x0D, 0x92, 0xA0, 0x30, 0xB1, 0x07, 0xD9, 0xF7, 0xC3,
+0x19, 0x04, 0x01, 0xC0, 0x1D, 0x92, 0xAE, 0xC0, 0x0F, 0x11, 0xE1, 0xF7, 0x0F, 0x94, 0x60, 0xF3,
+0x0D, 0x94, 0x97, 0xFE, 0x01, 0xE2, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0xC1, 0x49, 0x00, 0x0D,
+0xC2, 0x13, 0x29, 0x00, 0xF0, 0x20, 0xE0, 0x30, 0xE0, 0x40, 0xED, 0x57, 0xE0, 0x05, 0xC0, 0xFA,
+0x01, 0x31, 0x97, 0xF1, 0xF7, 0x2F, 0x5F, 0x3F, 0x4F, 0x28, 0x17, 0x39, 0x07, 0xC0, 0xF3, 0x08,
+0x95, 0x9C, 0x01, 0x26, 0x0F, 0x31, 0x1D, 0xC9, 0x01, 0xA0, 0xE0, 0xB0, 0xE0, 0xC1, 0x17, 0x15,
+0xAB, 0xBF, 0xFC, 0x01, 0x87, 0x91, 0x88, 0x23, 0x61, 0xF0, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91,
+0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0xC1, 0x07, 0x0B, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xEA,
+0xCF, 0x08, 0x95, 0x8D, 0xE0, 0xD3, 0x1B, 0x00, 0x8A, 0xD4, 0x17, 0x14, 0x08, 0x95, 0x0F, 0x94,
+0xC2, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x08, 0x95, 0xFC, 0x01, 0x90, 0x81, 0x99, 0x23, 0x59, 0xF0,
+0x90, 0xD2, 0x29, 0x19, 0x31, 0x96, 0x99, 0x23, 0x79, 0xF7, 0x08, 0x95, 0x28, 0x2F, 0x98, 0x2F,
+0x92, 0x95, 0x9F, 0x70, 0x89, 0x2F, 0x80, 0x5D, 0x8A, 0x33, 0x08, 0xF0, 0x89, 0x5F, 0xD3, 0x59,
+0x08, 0x82, 0x2F, 0x8F, 0x70, 0x98, 0x2F, 0x90, 0x5D, 0x9A, 0xC0, 0x23, 0x01, 0x99, 0x5F, 0xD3,
+0x53, 0xC1, 0xE3, 0x1C, 0xFB, 0x01, 0x85, 0x36, 0x91, 0x05, 0x1C, 0xF4, 0x63, 0x30, 0x71, 0x05,
+0x94, 0xF0, 0xC9, 0x01, 0x64, 0xE6, 0x70, 0xE0, 0x0F, 0x94, 0x38, 0xFE, 0x60, 0x5D, 0x7F, 0x4F,
+0x60, 0xD2, 0x35, 0x08, 0x2B, 0x30, 0x31, 0x05, 0x14, 0xF4, 0x32, 0x97, 0xB4, 0xC8, 0x2D, 0x01,
+0x6A, 0xE0, 0xDD, 0x35, 0x01, 0xC9, 0x01, 0xC5, 0x23, 0x01, 0xC0, 0x96, 0xD3, 0xB1, 0x0A, 0x08,
+0x95, 0x1F, 0x93, 0x18, 0x2F, 0x8E, 0xE6, 0x92, 0xEE, 0x60, 0xC0, 0x27, 0x02, 0xC2, 0xF1, 0x10,
+0xD2, 0x25, 0x7B, 0x0F, 0x94, 0xDC, 0xF1, 0x1F, 0x91, 0x08, 0x95, 0x2F, 0x92, 0x3F, 0x92, 0x4F,
+0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF,
+0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0xCD,
+0xB7, 0xDE, 0xB7, 0x62, 0x97, 0x0F, 0xB6, 0xF8, 0x94, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF, 0x38,
+0x2E, 0x62, 0x2E, 0xCA, 0x01, 0xDB, 0x01, 0x5C, 0x01, 0x6D, 0x01, 0x77, 0x24, 0x20, 0xE2, 0x22,
+0x2E, 0x2E, 0x01, 0x08, 0x94, 0x41, 0x1C, 0x51, 0x1C, 0x8B, 0xC0, 0x81, 0xE0, 0xA8, 0x16, 0x80,
+0xE0, 0xB8, 0x06, 0x81, 0xE0, 0xC8, 0x06, 0x80, 0xE0, 0xD8, 0x06, 0x28, 0xF0, 0xC6, 0x01, 0xAA,
+0x27, 0xBB, 0x27, 0x0F, 0x94, 0x0D, 0xF2, 0xBB, 0x27, 0xAD, 0x2D, 0x9C, 0x2D, 0x8B, 0x2D, 0xC1,
+0x0B, 0x00, 0x8A, 0xC2, 0x05, 0x01, 0x20, 0x92, 0xD1, 0x9B, 0x02, 0x9D, 0xE2, 0x90, 0xD2, 0xB3,
+0xD3, 0x2D, 0x32, 0x19, 0x82, 0x86, 0x01, 0x75, 0x01, 0x88, 0x24, 0x99, 0x24, 0xA1, 0xE0, 0x3A,
+0x16, 0x51, 0xF0, 0x3A, 0x16, 0x20, 0xF0, 0xB2, 0xE0, 0x3B, 0x16, 0x61, 0xF4, 0x09, 0xC0, 0x0B,
+0xBF, 0xF7, 0x01, 0x77, 0x90, 0x07, 0xC0, 0xC7, 0x01, 0x0F, 0x94, 0x81, 0xFE, 0x78, 0x2E, 0x02,
+0xC0, 0xF7, 0x01, 0x70, 0x80, 0x87, 0xD8, 0x7B, 0x15, 0x87, 0x2D, 0x80, 0x52, 0xF4, 0x01, 0xEF,
+0x70, 0xF0, 0x70, 0x8F, 0x35, 0x20, 0xF4, 0xE4, 0x0D, 0xF5, 0x1D, 0x70, 0x82, 0x04, 0xC0, 0xC1,
+0x07, 0x30, 0x8E, 0xE2, 0x80, 0x83, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D,
+0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C, 0x90, 0xE1, 0x89, 0x16, 0x91, 0x04, 0x09, 0xF0, 0xC2, 0xCF,
+0x80, 0xE1, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0xA8, 0x0E, 0xB9, 0x1E, 0xCA, 0x1E, 0xDB, 0x1E,
+0x19, 0x8A, 0xC2, 0xC0, 0x73, 0x6B, 0xFA, 0xF1, 0x0F, 0x94, 0xDC, 0xF1, 0x6A, 0x94, 0x66, 0x20,
+0x09, 0xF0, 0x72, 0xCF, 0x62, 0x96, 0x0F, 0xB6, 0xF8, 0x94, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF,
+0xCF, 0x91, 0xDF, 0x91, 0x1F, 0x91, 0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90,
+0xBF, 0x90, 0xAF, 0x90, 0x9F, 0x90, 0x8F, 0x90, 0x7F, 0x90, 0x6F, 0x90, 0x5F, 0x90, 0x4F, 0x90,
+0x3F, 0x90, 0x2F, 0x90, 0x08, 0x95, 0x2F, 0x92, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92,
+0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92,
+0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0xCD, 0xB7, 0xDE, 0xB7, 0xCD, 0x53,
+0xD1, 0x40, 0xC7, 0x5B, 0x1B, 0x01, 0xE2, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0x84, 0xB7, 0xF8,
+0x94, 0xA8, 0x95, 0x14, 0xBE, 0x90, 0x91, 0x60, 0x00, 0x98, 0x61, 0x90, 0x93, 0x60, 0x00, 0x10,
+0x92, 0xC0, 0x09, 0x00, 0xE1, 0xC1, 0x29, 0xC5, 0x0D, 0x24, 0x0F, 0xBE, 0x78, 0x94, 0x83, 0xFF,
+0x07, 0xC0, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94,
+0x27, 0x9A, 0x2F, 0x9A, 0x80, 0x91, 0xC0, 0x00, 0x82, 0x60, 0x80, 0x93, 0xC0, 0x00, 0x80, 0xC0,
+0x1B, 0x02, 0xC4, 0x00, 0x88, 0xC0, 0x05, 0x5D, 0xC1, 0x00, 0x00, 0x00, 0xEE, 0x24, 0xFF, 0x24,
+0x87, 0x01, 0x44, 0xE0, 0xA4, 0x2E, 0xB1, 0x2C, 0xCC, 0x24, 0xDD, 0x24, 0x24, 0xC0, 0xC5, 0x01,
+0x01, 0x97, 0xF1, 0xF7, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x21, 0xE2,
+0xE2, 0x16, 0x2E, 0xE4, 0xF2, 0x06, 0x20, 0xE0, 0x02, 0x07, 0x20, 0xE0, 0x12, 0x07, 0x18, 0xF0,
+0x31, 0xE0, 0xC3, 0x2E, 0xD1, 0x2C, 0xC8, 0x01, 0xB7, 0x01, 0x27, 0xEC, 0x3B, 0xE1, 0x40, 0xE0,
+0x50, 0xE0, 0x0F, 0x94, 0x4B, 0xFE, 0x61, 0x15, 0x71, 0x05, 0x81, 0x05, 0x91, 0x05, 0x19, 0xF4,
+0x85, 0xB1, 0x80, 0x58, 0x85, 0xB9, 0xC1, 0x71, 0x1B, 0x87, 0xFD, 0x03, 0xC0, 0xC1, 0x14, 0xD1,
+0x04, 0xA9, 0xF2, 0xA6, 0x01, 0x4F, 0x5F, 0x5F, 0x4F, 0xC2, 0x5E, 0xDE, 0x4F, 0x59, 0x83, 0x48,
+0x83, 0xCE, 0x51, 0xD1, 0x40, 0xC1, 0x0B, 0x03, 0x88, 0x81, 0x99, 0x81, 0xC1, 0x0B, 0x16, 0x01,
+0x97, 0x11, 0xF0, 0x0D, 0x94, 0x1A, 0xFE, 0xC0, 0x5D, 0xDE, 0x4F, 0x19, 0x82, 0x18, 0x82, 0xC0,
+0x53, 0xD1, 0x40, 0x60, 0xE0, 0xC1, 0xC0, 0x0D, 0x0A, 0x18, 0x82, 0xCF, 0x52, 0xD1, 0x40, 0x88,
+0x24, 0x99, 0x24, 0xC3, 0xC4, 0x1B, 0x00, 0xCD, 0xC0, 0x0F, 0x00, 0xC0, 0xC0, 0x3B, 0x08, 0x18,
+0x82, 0x19, 0x82, 0x1A, 0x82, 0x1B, 0x82, 0xC0, 0xC0, 0x0F, 0x01, 0xCE, 0x5C, 0xC7, 0x0F, 0x00,
+0xC2, 0xC0, 0x3B, 0xC3, 0xD5, 0x08, 0x0B, 0xBF, 0xF7, 0x01, 0x07, 0x91, 0x16, 0x91, 0xC4, 0xC0,
+0x1D, 0x04, 0x19, 0x83, 0x08, 0x83, 0xCC, 0xC0, 0x19, 0x03, 0x0D, 0x94, 0x15, 0xFE, 0xC1, 0x79,
+0x02, 0x28, 0x81, 0x39, 0xC2, 0x79, 0x09, 0x21, 0x30, 0x31, 0x05, 0x09, 0xF5, 0x20, 0x91, 0xC6,
+0x00, 0xC1, 0x15, 0xC1, 0x5F, 0xC1, 0x15, 0x19, 0x22, 0xC0, 0x2F, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F,
+0x5F, 0x4F, 0x21, 0x30, 0x82, 0xE1, 0x38, 0x07, 0x8A, 0xE7, 0x48, 0x07, 0x80, 0xE0, 0x58, 0x07,
+0x80, 0xF0, 0xC1, 0x4B, 0x03, 0xE8, 0x81, 0xF9, 0x81, 0xC1, 0x4B, 0x13, 0xEF, 0x5F, 0xFF, 0x4F,
+0x19, 0xF0, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94, 0x20, 0xE0, 0x30, 0xE0, 0x40, 0xE0, 0x50, 0xE0,
+0xC2, 0xF5, 0x02, 0xFF, 0xE0, 0xCF, 0xC1, 0x51, 0xC1, 0xB1, 0x03, 0x48, 0x81, 0x59, 0x81, 0xC1,
+0xB1, 0xC1, 0xFD, 0xC1, 0x0F, 0xC1, 0xFD, 0xC1, 0x0F, 0x29, 0x21, 0x32, 0x09, 0xF0, 0x63, 0xC6,
+0x4A, 0x30, 0x51, 0x05, 0x08, 0xF0, 0x5F, 0xC6, 0x08, 0x94, 0x81, 0x1C, 0x91, 0x1C, 0x53, 0xE0,
+0x85, 0x16, 0x91, 0x04, 0x09, 0xF0, 0x59, 0xC6, 0x00, 0xE0, 0x10, 0xE0, 0x18, 0xC0, 0x81, 0xE2,
+0x80, 0x93, 0xC6, 0x00, 0xC1, 0x51, 0x03, 0x86, 0xFF, 0xFC, 0xCF, 0xC1, 0x07, 0x05, 0x80, 0x64,
+0x80, 0x93, 0xC0, 0x00, 0xC1, 0x9B, 0x13, 0x29, 0x31, 0x31, 0x05, 0x79, 0xF7, 0x0F, 0x94, 0xDC,
+0xF1, 0x0F, 0x5F, 0x1F, 0x4F, 0x05, 0x30, 0x11, 0x05, 0x19, 0xF0, 0xC1, 0x83, 0x08, 0xE5, 0xCF,
+0x10, 0x92, 0x0A, 0x02, 0x10, 0x92, 0x0B, 0xC0, 0x03, 0x00, 0x0C, 0xC0, 0x03, 0x00, 0x0D, 0xC0,
+0x03, 0x00, 0x06, 0xC0, 0x03, 0x00, 0x07, 0xC0, 0x03, 0x00, 0x08, 0xC0, 0x03, 0x00, 0x09, 0xC0,
+0x03, 0x00, 0x02, 0xC0, 0x03, 0x00, 0x03, 0xC0, 0x03, 0x00, 0x04, 0xC0, 0x03, 0x0E, 0x05, 0x02,
+0x8F, 0xEE, 0x90, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xF5, 0xF1, 0x80, 0xE1, 0x91, 0xC2, 0x09, 0x01,
+0xC2, 0xF1, 0xC3, 0xC5, 0x02, 0xFC, 0xCF, 0x90, 0xC0, 0xC5, 0x0A, 0x90, 0x36, 0x08, 0xF0, 0x9F,
+0x75, 0x90, 0x32, 0xB8, 0xF0, 0x90, 0xD2, 0x8D, 0x02, 0xA0, 0xE2, 0xA0, 0xD2, 0x17, 0x0A, 0x98,
+0x34, 0x09, 0xF4, 0xD7, 0xC1, 0x99, 0x34, 0xB8, 0xF4, 0x92, 0xC0, 0x09, 0x1C, 0x59, 0xC1, 0x93,
+0x34, 0x58, 0xF4, 0x90, 0x33, 0x19, 0xF1, 0x90, 0x33, 0x08, 0xF4, 0xE3, 0xC5, 0x9F, 0x33, 0xA1,
+0xF1, 0x90, 0x34, 0x09, 0xF0, 0xDE, 0xC5, 0xBD, 0xC0, 0x95, 0xC0, 0x1F, 0x02, 0x70, 0xC1, 0x96,
+0xC0, 0x0D, 0x0E, 0xD7, 0xC5, 0x98, 0xC1, 0x92, 0x35, 0x09, 0xF4, 0x2B, 0xC2, 0x93, 0x35, 0x38,
+0xF4, 0x9C, 0xC0, 0x17, 0x0A, 0xF5, 0xC1, 0x91, 0x35, 0x09, 0xF0, 0xCB, 0xC5, 0x18, 0xC2, 0x96,
+0xC0, 0x17, 0x02, 0x45, 0xC2, 0x99, 0xC0, 0x0D, 0x08, 0xC4, 0xC5, 0x67, 0xC4, 0x83, 0xE7, 0x92,
+0xEE, 0x62, 0xC2, 0xB5, 0xCF, 0xDF, 0xCB, 0xFF, 0x02, 0x13, 0xC1, 0x8F, 0xC6, 0x2B, 0xC7, 0xEB,
+0x01, 0x81, 0xE2, 0xC5, 0xEB, 0x01, 0x87, 0xEB, 0xC3, 0x09, 0xC0, 0xFF, 0x00, 0xE3, 0xC5, 0x13,
+0x00, 0x84, 0xC6, 0x27, 0x00, 0x8F, 0xC6, 0x13, 0x06, 0x86, 0xE0, 0x90, 0xE0, 0x61, 0xE0, 0x70,
+0xC0, 0x0B, 0x07, 0x34, 0xF2, 0x0F, 0x94, 0xDC, 0xF1, 0x8D, 0xE5, 0xC5, 0x19, 0x01, 0x89, 0xEC,
+0xC5, 0x41, 0x01, 0x8E, 0xE4, 0xC5, 0x13, 0x00, 0x83, 0xC6, 0x13, 0x01, 0x8C, 0xE6, 0xC5, 0x13,
+0x07, 0x8E, 0xE1, 0x0F, 0x94, 0x0D, 0xF2, 0x88, 0xE9, 0xC1, 0x05, 0x00, 0x81, 0xC0, 0x11, 0x00,
+0x0D, 0xC2, 0x47, 0x01, 0x8B, 0xE7, 0xC5, 0x1F, 0x0D, 0x19, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x10,
+0x93, 0x57, 0x00, 0xE4, 0x91, 0x8E, 0x2F, 0xC5, 0x1F, 0x01, 0x8A, 0xE8, 0xC5, 0x1F, 0x00, 0xE3,
+0xD0, 0x1D, 0x01, 0x89, 0xE9, 0xC5, 0x1D, 0x00, 0xE2, 0xD0, 0x1D, 0x01, 0x88, 0xEA, 0xC5, 0x1D,
+0x00, 0xE1, 0xC4, 0x1D, 0x02, 0x14, 0x91, 0x81, 0xC6, 0x1D, 0x06, 0x07, 0xCF, 0x8B, 0xE8, 0x92,
+0xEE, 0x62, 0xC2, 0xA5, 0x02, 0x8B, 0xE4, 0x92, 0xC4, 0xAF, 0xC1, 0x19, 0x12, 0x00, 0xE0, 0x10,
+0xE0, 0x19, 0xC0, 0xC8, 0x01, 0x6F, 0x2D, 0x0F, 0x94, 0x89, 0xFE, 0xFF, 0x20, 0x31, 0xF4, 0x89,
+0xC4, 0x1F, 0x0F, 0xC2, 0xF1, 0x0B, 0xC0, 0xF0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86,
+0xFF, 0xFC, 0xCF, 0xC1, 0x07, 0x27, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x0F, 0x5F, 0x1F, 0x4F,
+0xC8, 0x01, 0x81, 0x51, 0x9F, 0x41, 0xA0, 0xE0, 0xB0, 0xE0, 0xAB, 0xBF, 0xFC, 0x01, 0xF7, 0x90,
+0xBA, 0xE2, 0xFB, 0x16, 0x21, 0xF0, 0xE2, 0xE0, 0x00, 0x30, 0x1E, 0x07, 0xC1, 0xF6, 0xC1, 0x59,
+0xC1, 0x03, 0x01, 0x87, 0xE5, 0xC9, 0x6B, 0x03, 0xCC, 0x24, 0xDD, 0x24, 0xC1, 0x6F, 0x00, 0x1E,
+0xC0, 0x6F, 0x07, 0x0F, 0x94, 0x81, 0xFE, 0xF8, 0x2E, 0x88, 0x23, 0xCB, 0x6F, 0x01, 0x80, 0x93,
+0xD1, 0x6F, 0x09, 0xFE, 0x14, 0x19, 0xF0, 0x08, 0x94, 0xC1, 0x1C, 0xD1, 0x1C, 0xCF, 0x79, 0x04,
+0xE7, 0x90, 0xFA, 0xE2, 0xEF, 0xC0, 0x79, 0x00, 0x22, 0xC0, 0x79, 0x02, 0x12, 0x07, 0x99, 0xC6,
+0x79, 0x01, 0x82, 0xE6, 0xC5, 0x55, 0x04, 0xC6, 0x01, 0x61, 0xE0, 0x70, 0xC0, 0x09, 0x01, 0x34,
+0xF2, 0xC5, 0x1B, 0x06, 0x10, 0x92, 0x02, 0x02, 0x10, 0x92, 0x03, 0xC0, 0x03, 0x00, 0x04, 0xC0,
+0x03, 0x08, 0x05, 0x02, 0x78, 0xCE, 0x89, 0xE9, 0x92, 0xEE, 0x62, 0xC2, 0xA7, 0x1D, 0x27, 0x9A,
+0x2F, 0x9A, 0x16, 0xC0, 0x2F, 0x98, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97,
+0xF1, 0xF7, 0x01, 0x96, 0x84, 0x36, 0x91, 0x05, 0xC1, 0xF7, 0x2F, 0x9A, 0xD1, 0x15, 0xC1, 0xA7,
+0x02, 0x87, 0xFF, 0xE6, 0xC2, 0xAF, 0x00, 0x87, 0xC0, 0xB7, 0x03, 0x64, 0xC4, 0x85, 0xEA, 0xC5,
+0x4D, 0x18, 0x40, 0x91, 0x02, 0x02, 0x50, 0x91, 0x03, 0x02, 0x60, 0x91, 0x04, 0x02, 0x70, 0x91,
+0x05, 0x02, 0x81, 0xE0, 0x20, 0xE1, 0x0F, 0x94, 0x91, 0xF2, 0x80, 0xC0, 0x17, 0x00, 0x90, 0xC0,
+0x17, 0x00, 0xA0, 0xC0, 0x17, 0x00, 0xB0, 0xC0, 0x17, 0x09, 0x80, 0x50, 0x9F, 0x4F, 0xAF, 0x4F,
+0xBF, 0x4F, 0x80, 0x93, 0xC0, 0x17, 0x00, 0x93, 0xC0, 0x17, 0x00, 0x93, 0xC0, 0x17, 0x00, 0x93,
+0xC1, 0x17, 0x0D, 0x90, 0x41, 0xA0, 0x40, 0xB0, 0x40, 0x08, 0xF4, 0x26, 0xCE, 0xA4, 0xCF, 0x83,
+0xEB, 0xC7, 0x57, 0x00, 0x06, 0xC0, 0x57, 0x00, 0x07, 0xC0, 0x57, 0x00, 0x08, 0xC0, 0x57, 0x02,
+0x09, 0x02, 0x80, 0xC6, 0x57, 0x00, 0x06, 0xC0, 0x57, 0x00, 0x07, 0xC0, 0x57, 0x00, 0x08, 0xC0,
+0x57, 0xC0, 0x17, 0xC6, 0x57, 0xC0, 0x17, 0x00, 0x93, 0xC0, 0x17, 0x00, 0x93, 0xC0, 0x17, 0x06,
+0x93, 0x09, 0x02, 0xFF, 0xCD, 0x80, 0xEC, 0xC5, 0x4B, 0x04, 0x83, 0xE7, 0x92, 0xEE, 0x60, 0xC2,
+0x09, 0x00, 0x8F, 0xC6, 0x09, 0x01, 0x8B, 0xE8, 0xC5, 0x09, 0x01, 0x89, 0xE9, 0xC5, 0x09, 0xC1,
+0xD5, 0xC3, 0x09, 0xC1, 0x87, 0xC3, 0x09, 0xC1, 0x45, 0xC3, 0x09, 0x00, 0x87, 0xC6, 0x09, 0x01,
+0x88, 0xED, 0xC6, 0x4F, 0xC6, 0x09, 0x01, 0x8A, 0xEE, 0xC6, 0x3B, 0x04, 0xE0, 0x93, 0xEE, 0xBD,
+0xCD, 0xC1, 0x2D, 0xC3, 0x7D, 0x06, 0x81, 0xE4, 0x0F, 0x94, 0x7B, 0xF2, 0x82, 0xC2, 0x05, 0x00,
+0x83, 0xC2, 0x05, 0x00, 0x84, 0xC2, 0x05, 0x00, 0x85, 0xC2, 0x05, 0x00, 0x86, 0xC2, 0x05, 0x00,
+0x87, 0xC2, 0x05, 0x00, 0x88, 0xC2, 0x05, 0x00, 0x8A, 0xC2, 0x05, 0x00, 0x8B, 0xC2, 0x05, 0x00,
+0x8C, 0xC2, 0x05, 0x01, 0x99, 0xCD, 0xC1, 0x71, 0xC3, 0x4D, 0x09, 0x77, 0x24, 0x73, 0x94, 0x88,
+0x24, 0x99, 0x24, 0x09, 0xC4, 0xC1, 0x7B, 0xC3, 0x13, 0x18, 0x40, 0x91, 0x0A, 0x02, 0x50, 0x91,
+0x0B, 0x02, 0x60, 0x91, 0x0C, 0x02, 0x70, 0x91, 0x0D, 0x02, 0x82, 0xE0, 0x20, 0xE1, 0x0F, 0x94,
+0x91, 0xF2, 0x80, 0xC0, 0x17, 0x00, 0x90, 0xC0, 0x17, 0x00, 0xA0, 0xC0, 0x17, 0x00, 0xB0, 0xC0,
+0x17, 0x09, 0x80, 0x50, 0x9F, 0x4F, 0xAF, 0x4F, 0xBF, 0x4F, 0x80, 0x93, 0xC0, 0x17, 0x00, 0x93,
+0xC0, 0x17, 0x00, 0x93, 0xC0, 0x17, 0x04, 0x93, 0x0D, 0x02, 0x69, 0xCD, 0xC1, 0xBD, 0xC3, 0x4B,
+0x02, 0x84, 0xEE, 0x90, 0xC5, 0xDB, 0x01, 0xEC, 0x91, 0xC4, 0x09, 0x1E, 0x66, 0x24, 0x77, 0x24,
 0x43, 0x01, 0xCC, 0x5D, 0xDE, 0x4F, 0x19, 0x82, 0x18, 0x82, 0xC4, 0x52, 0xD1, 0x40, 0xD4, 0x01,
-0xC3, 0x01, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0xCA, 0x5D, 0xDE, 0x4F, 0x88, 0x83,
-0x99, 0x83, 0xAA, 0x83, 0xBB, 0x83, 0xC6, 0x52, 0xD1, 0x40, 0xCC, 0x5D, 0xDE, 0x4F, 0xA8, 0x81,
-0xB9, 0x81, 0xC4, 0x52, 0xD1, 0x40, 0x11, 0x96, 0xCC, 0x5D, 0xDE, 0x4F, 0xB9, 0x83, 0xA8, 0x83,
-0xC4, 0x52, 0xD1, 0x40, 0xCD, 0x01, 0x62, 0xE0, 0x70, 0xE0, 0x0F, 0x94, 0x34, 0xF2, 0xB0, 0xE2,
-0xB0, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xED, 0xE2, 0xE0, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xF0, 0xE2,
-0xF0, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xCA, 0x5D, 0xDE, 0x4F, 0xE8, 0x80, 0xF9, 0x80, 0x0A, 0x81,
-0x1B, 0x81, 0xC6, 0x52, 0xD1, 0x40, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F, 0x2D, 0x0F, 0x94,
-0x0D, 0xF2, 0xCA, 0x5D, 0xDE, 0x4F, 0x88, 0x81, 0xC6, 0x52, 0xD1, 0x40, 0x0F, 0x94, 0x0D, 0xF2,
-0xB0, 0xE2, 0xFB, 0x2E, 0xF0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF,
-0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x0D, 0xE3, 0x00, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0x10, 0xE2, 0x10, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF,
-0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x8B, 0xBE, 0xF3, 0x01, 0x27, 0x91,
-0xC6, 0x5D, 0xDE, 0x4F, 0x28, 0x83, 0xCA, 0x52, 0xD1, 0x40, 0xA2, 0x2E, 0xBB, 0x24, 0xCC, 0x24,
-0xDD, 0x24, 0x08, 0x94, 0x61, 0x1C, 0x71, 0x1C, 0x81, 0x1C, 0x91, 0x1C, 0x8B, 0xBE, 0xF3, 0x01,
-0x87, 0x91, 0x28, 0x2E, 0x33, 0x24, 0x44, 0x24, 0x55, 0x24, 0x08, 0x94, 0x61, 0x1C, 0x71, 0x1C,
-0x81, 0x1C, 0x91, 0x1C, 0x8B, 0xBE, 0xF3, 0x01, 0x37, 0x91, 0xC5, 0x5D, 0xDE, 0x4F, 0x38, 0x83,
-0xCB, 0x52, 0xD1, 0x40, 0x08, 0x94, 0x61, 0x1C, 0x71, 0x1C, 0x81, 0x1C, 0x91, 0x1C, 0x8B, 0xBE,
-0xF3, 0x01, 0x47, 0x91, 0xC4, 0x5D, 0xDE, 0x4F, 0x48, 0x83, 0xCC, 0x52, 0xD1, 0x40, 0xAD, 0xEF,
-0xEA, 0x2E, 0xAF, 0xEF, 0xFA, 0x2E, 0xAF, 0xEF, 0x0A, 0x2F, 0xAF, 0xEF, 0x1A, 0x2F, 0x6E, 0x0C,
-0x7F, 0x1C, 0x80, 0x1E, 0x91, 0x1E, 0x14, 0x2D, 0x03, 0x2D, 0xF2, 0x2C, 0xEE, 0x24, 0xEA, 0x0C,
-0xFB, 0x1C, 0x0C, 0x1D, 0x1D, 0x1D, 0x0F, 0x94, 0x0D, 0xF2, 0x20, 0xE2, 0x20, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0xC6, 0x5D, 0xDE, 0x4F, 0x88, 0x81, 0xCA, 0x52, 0xD1, 0x40, 0x0F, 0x94, 0x0D, 0xF2,
-0x30, 0xE2, 0x30, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91,
-0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xC4, 0x5D, 0xDE, 0x4F, 0x88, 0x81, 0xCC, 0x52,
-0xD1, 0x40, 0x0F, 0x94, 0x0D, 0xF2, 0x40, 0xE2, 0x40, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xC5, 0x5D,
-0xDE, 0x4F, 0x88, 0x81, 0xCB, 0x52, 0xD1, 0x40, 0x0F, 0x94, 0x0D, 0xF2, 0x50, 0xE2, 0x50, 0x93,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64,
-0x80, 0x93, 0xC0, 0x00, 0x8F, 0xEF, 0xE8, 0x16, 0x8F, 0xEF, 0xF8, 0x06, 0x80, 0xE0, 0x08, 0x07,
-0x80, 0xE0, 0x18, 0x07, 0x31, 0xF4, 0x84, 0xE0, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1,
-0xDF, 0xC0, 0xD8, 0x01, 0xC7, 0x01, 0x80, 0x70, 0x90, 0x7C, 0xA0, 0x70, 0xB0, 0x70, 0x80, 0x50,
-0x90, 0x4C, 0xA0, 0x40, 0xB0, 0x40, 0xD1, 0xF5, 0x2F, 0xEF, 0x3F, 0xE3, 0x40, 0xE0, 0x50, 0xE0,
-0xE2, 0x22, 0xF3, 0x22, 0x04, 0x23, 0x15, 0x23, 0xCA, 0x5D, 0xDE, 0x4F, 0xA8, 0x80, 0xB9, 0x80,
-0xCA, 0x80, 0xDB, 0x80, 0xC6, 0x52, 0xD1, 0x40, 0xAE, 0x0C, 0xBF, 0x1C, 0xC0, 0x1E, 0xD1, 0x1E,
-0xAA, 0x0C, 0xBB, 0x1C, 0xCC, 0x1C, 0xDD, 0x1C, 0x8E, 0xE0, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94,
-0xC2, 0xF1, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F, 0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0x8E, 0x2D,
-0x0F, 0x94, 0x0D, 0xF2, 0x30, 0xE2, 0x30, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF,
-0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x4E, 0xE3, 0x40, 0x93,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x87, 0xC0, 0x8E, 0xE0, 0x9E, 0xEF,
-0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x22, 0xF9, 0x22, 0x0A, 0x23, 0x1B, 0x23, 0x9C, 0xE0, 0xE9, 0x16,
-0x94, 0xE9, 0xF9, 0x06, 0x90, 0xE0, 0x09, 0x07, 0x90, 0xE0, 0x19, 0x07, 0x09, 0xF0, 0x88, 0xC0,
-0xC4, 0x5D, 0xDE, 0x4F, 0xA8, 0x81, 0xCC, 0x52, 0xD1, 0x40, 0xEA, 0x2E, 0xFF, 0x24, 0x00, 0xE0,
-0x10, 0xE0, 0x10, 0x2F, 0x0F, 0x2D, 0xFE, 0x2C, 0xEE, 0x24, 0xC5, 0x5D, 0xDE, 0x4F, 0xB8, 0x81,
-0xCB, 0x52, 0xD1, 0x40, 0xEB, 0x0E, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0xD6, 0x01, 0xC5, 0x01,
-0x81, 0x70, 0x90, 0x70, 0xA0, 0x70, 0xB0, 0x70, 0xDC, 0x01, 0x99, 0x27, 0x88, 0x27, 0xE8, 0x0E,
-0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0x20, 0xEF, 0x30, 0xE0, 0x40, 0xE0, 0x50, 0xE0, 0xA2, 0x22,
-0xB3, 0x22, 0xC4, 0x22, 0xD5, 0x22, 0x41, 0xE1, 0xAA, 0x0C, 0xBB, 0x1C, 0xCC, 0x1C, 0xDD, 0x1C,
-0x4A, 0x95, 0xD1, 0xF7, 0xEA, 0x0C, 0xFB, 0x1C, 0x0C, 0x1D, 0x1D, 0x1D, 0x81, 0xE0, 0x90, 0xE0,
-0xA0, 0xE0, 0xB0, 0xE0, 0x28, 0x22, 0x39, 0x22, 0x4A, 0x22, 0x5B, 0x22, 0x35, 0xE1, 0x22, 0x0C,
-0x33, 0x1C, 0x44, 0x1C, 0x55, 0x1C, 0x3A, 0x95, 0xD1, 0xF7, 0xE2, 0x0C, 0xF3, 0x1C, 0x04, 0x1D,
-0x15, 0x1D, 0x57, 0x01, 0x68, 0x01, 0xAA, 0x0C, 0xBB, 0x1C, 0xCC, 0x1C, 0xDD, 0x1C, 0x85, 0xE1,
-0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xC8, 0x01, 0xAA, 0x27, 0xBB, 0x27, 0x0F, 0x94,
-0x0D, 0xF2, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F, 0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0x8E, 0x2D,
-0x0F, 0x94, 0x0D, 0xF2, 0x90, 0xE2, 0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF,
-0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xAE, 0xE3, 0xA0, 0x93,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64,
-0x80, 0x93, 0xC0, 0x00, 0xC6, 0x01, 0xAA, 0x27, 0xBB, 0x27, 0x0F, 0x94, 0x0D, 0xF2, 0xBB, 0x27,
-0xAD, 0x2D, 0x9C, 0x2D, 0x8B, 0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0x8A, 0x2D, 0x0F, 0x94, 0x0D, 0xF2,
-0x0F, 0x94, 0xDC, 0xF1, 0xCC, 0x5D, 0xDE, 0x4F, 0xE8, 0x81, 0xF9, 0x81, 0xC4, 0x52, 0xD1, 0x40,
-0xF9, 0x97, 0x09, 0xF4, 0x4D, 0xCB, 0xF4, 0xE0, 0xEF, 0x2E, 0xF1, 0x2C, 0x01, 0x2D, 0x11, 0x2D,
-0x6E, 0x0C, 0x7F, 0x1C, 0x80, 0x1E, 0x91, 0x1E, 0xF2, 0xCD, 0x83, 0xE0, 0x93, 0xEE, 0x62, 0xE0,
-0x0F, 0x94, 0xF5, 0xF1, 0x8A, 0xE1, 0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0x80, 0x91,
-0xC0, 0x00, 0x87, 0xFF, 0xFC, 0xCF, 0x10, 0x91, 0xC6, 0x00, 0x1F, 0x75, 0x10, 0x93, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93,
-0xC0, 0x00, 0x0F, 0x94, 0xDC, 0xF1, 0x81, 0x2F, 0x81, 0x54, 0x8A, 0x31, 0x08, 0xF0, 0x36, 0xC1,
-0x16, 0x34, 0x09, 0xF4, 0x95, 0xC0, 0x17, 0x34, 0x90, 0xF4, 0x13, 0x34, 0x09, 0xF4, 0x4E, 0xC0,
-0x14, 0x34, 0x30, 0xF4, 0x11, 0x34, 0xF1, 0xF0, 0x12, 0x34, 0x09, 0xF0, 0x1D, 0xC1, 0x30, 0xC0,
-0x14, 0x34, 0x09, 0xF4, 0x59, 0xC0, 0x15, 0x34, 0x09, 0xF0, 0x16, 0xC1, 0x6B, 0xC0, 0x1A, 0x34,
-0x09, 0xF4, 0xC4, 0xC0, 0x1B, 0x34, 0x38, 0xF4, 0x17, 0x34, 0x09, 0xF4, 0x8F, 0xC0, 0x18, 0x34,
-0x09, 0xF0, 0x0A, 0xC1, 0xA1, 0xC0, 0x1B, 0x34, 0x09, 0xF4, 0xD2, 0xC0, 0x1C, 0x34, 0x09, 0xF0,
-0x03, 0xC1, 0xE8, 0xC0, 0x8F, 0xEF, 0x81, 0xB9, 0x0D, 0xC0, 0x82, 0xB1, 0x80, 0x95, 0x82, 0xB9,
-0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C,
-0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xEF, 0xCF, 0x12, 0xB8, 0xEF, 0xC0,
-0x8F, 0xEF, 0x84, 0xB9, 0x0D, 0xC0, 0x85, 0xB1, 0x80, 0x95, 0x85, 0xB9, 0x80, 0xE0, 0x90, 0xE0,
-0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7,
-0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xEF, 0xCF, 0x15, 0xB8, 0xD9, 0xC0, 0x8F, 0xEF, 0x87, 0xB9,
-0x0D, 0xC0, 0x88, 0xB1, 0x80, 0x95, 0x88, 0xB9, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0,
-0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00,
-0x87, 0xFF, 0xEF, 0xCF, 0x18, 0xB8, 0xC3, 0xC0, 0x8F, 0xEF, 0x8A, 0xB9, 0x0D, 0xC0, 0x8B, 0xB1,
-0x80, 0x95, 0x8B, 0xB9, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7,
-0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xEF, 0xCF,
-0x1B, 0xB8, 0xAD, 0xC0, 0x8F, 0xEF, 0x8D, 0xB9, 0x0D, 0xC0, 0x8E, 0xB1, 0x80, 0x95, 0x8E, 0xB9,
-0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C,
-0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xEF, 0xCF, 0x1E, 0xB8, 0x97, 0xC0,
-0x8F, 0xEF, 0x80, 0xBB, 0x0D, 0xC0, 0x81, 0xB3, 0x80, 0x95, 0x81, 0xBB, 0x80, 0xE0, 0x90, 0xE0,
-0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7,
-0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xEF, 0xCF, 0x11, 0xBA, 0x81, 0xC0, 0x8F, 0xEF, 0x83, 0xBB,
-0x0D, 0xC0, 0x84, 0xB3, 0x80, 0x95, 0x84, 0xBB, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0,
-0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00,
-0x87, 0xFF, 0xEF, 0xCF, 0x14, 0xBA, 0x6B, 0xC0, 0x8F, 0xEF, 0x80, 0x93, 0x01, 0x01, 0x0F, 0xC0,
-0x80, 0x91, 0x02, 0x01, 0x80, 0x95, 0x80, 0x93, 0x02, 0x01, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED,
-0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91,
-0xC0, 0x00, 0x87, 0xFF, 0xED, 0xCF, 0x10, 0x92, 0x02, 0x01, 0x51, 0xC0, 0x8F, 0xEF, 0x80, 0x93,
-0x04, 0x01, 0x0F, 0xC0, 0x80, 0x91, 0x05, 0x01, 0x80, 0x95, 0x80, 0x93, 0x05, 0x01, 0x80, 0xE0,
-0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05,
-0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xED, 0xCF, 0x10, 0x92, 0x05, 0x01, 0x37, 0xC0,
-0x8F, 0xEF, 0x80, 0x93, 0x07, 0x01, 0x0F, 0xC0, 0x80, 0x91, 0x08, 0x01, 0x80, 0x95, 0x80, 0x93,
-0x08, 0x01, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96,
-0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xED, 0xCF, 0x10, 0x92,
-0x08, 0x01, 0x1D, 0xC0, 0x8F, 0xEF, 0x80, 0x93, 0x0A, 0x01, 0x0F, 0xC0, 0x80, 0x91, 0x0B, 0x01,
-0x80, 0x95, 0x80, 0x93, 0x0B, 0x01, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0, 0x31, 0x97,
-0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF,
-0xED, 0xCF, 0x10, 0x92, 0x0B, 0x01, 0x03, 0xC0, 0x85, 0xE2, 0x92, 0xEE, 0xEE, 0xC9, 0x80, 0x91,
-0xC0, 0x00, 0x87, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC6, 0x00, 0xEA, 0xC9, 0x88, 0xE3, 0x92, 0xEE,
-0xE4, 0xC9, 0x8C, 0xE1, 0x91, 0xEE, 0xE1, 0xC9, 0x88, 0x24, 0x99, 0x24, 0x93, 0x30, 0x11, 0xF1,
-0x94, 0x30, 0x28, 0xF4, 0x91, 0x30, 0x89, 0xF0, 0x92, 0x30, 0xB8, 0xF4, 0x08, 0xC0, 0x95, 0x30,
-0x61, 0xF1, 0x95, 0x30, 0xF0, 0xF0, 0x96, 0x30, 0x09, 0xF0, 0x48, 0xC0, 0x43, 0xC0, 0x2B, 0x31,
-0x09, 0xF0, 0x42, 0xC9, 0x91, 0xE0, 0x6B, 0xE1, 0x3F, 0xC9, 0x62, 0x27, 0xC1, 0x5D, 0xDE, 0x4F,
-0x28, 0x83, 0xCF, 0x52, 0xD1, 0x40, 0x92, 0xE0, 0x37, 0xC9, 0xB2, 0x2F, 0xA0, 0xE0, 0x62, 0x27,
-0x93, 0xE0, 0x32, 0xC9, 0x82, 0x2F, 0x90, 0xE0, 0xA8, 0x2B, 0xB9, 0x2B, 0x62, 0x27, 0x94, 0xE0,
-0x2B, 0xC9, 0x2E, 0x30, 0x09, 0xF0, 0x39, 0xC3, 0x62, 0x27, 0x95, 0xE0, 0xC0, 0x5D, 0xDE, 0x4F,
-0x19, 0x82, 0x18, 0x82, 0xC0, 0x53, 0xD1, 0x40, 0x1F, 0xC9, 0xE1, 0xE0, 0xF0, 0xE0, 0xEC, 0x0F,
-0xFD, 0x1F, 0xC0, 0x5D, 0xDE, 0x4F, 0x08, 0x81, 0x19, 0x81, 0xC0, 0x53, 0xD1, 0x40, 0xE0, 0x0F,
-0xF1, 0x1F, 0x20, 0x83, 0x0F, 0x5F, 0x1F, 0x4F, 0xC0, 0x5D, 0xDE, 0x4F, 0x19, 0x83, 0x08, 0x83,
-0xC0, 0x53, 0xD1, 0x40, 0x62, 0x27, 0x0A, 0x17, 0x1B, 0x07, 0x09, 0xF0, 0x05, 0xC9, 0xD8, 0x01,
-0x96, 0xE0, 0x02, 0xC9, 0x26, 0x17, 0x09, 0xF0, 0x10, 0xC3, 0x03, 0xC0, 0x97, 0x30, 0x09, 0xF0,
-0xFB, 0xC8, 0x77, 0x24, 0x99, 0x81, 0x93, 0x31, 0x09, 0xF4, 0x12, 0xC1, 0x94, 0x31, 0xC8, 0xF4,
-0x96, 0x30, 0x09, 0xF4, 0xD8, 0xC0, 0x97, 0x30, 0x50, 0xF4, 0x92, 0x30, 0x09, 0xF4, 0x06, 0xC1,
-0x93, 0x30, 0x09, 0xF4, 0x6D, 0xC0, 0x91, 0x30, 0x09, 0xF0, 0x59, 0xC2, 0x53, 0xC0, 0x91, 0x31,
-0x09, 0xF4, 0x77, 0xC0, 0x92, 0x31, 0x08, 0xF0, 0xBB, 0xC0, 0x90, 0x31, 0x09, 0xF0, 0x4F, 0xC2,
-0xF5, 0xC0, 0x98, 0x31, 0x09, 0xF4, 0x87, 0xC0, 0x99, 0x31, 0x50, 0xF4, 0x95, 0x31, 0x09, 0xF4,
-0xEF, 0xC0, 0x95, 0x31, 0x08, 0xF4, 0xC6, 0xC1, 0x96, 0x31, 0x09, 0xF0, 0x40, 0xC2, 0xC2, 0xC1,
-0x9A, 0x31, 0x09, 0xF4, 0x6C, 0xC0, 0x9A, 0x31, 0x08, 0xF4, 0x91, 0xC0, 0x9B, 0x31, 0x09, 0xF4,
-0x5B, 0xC0, 0x9D, 0x31, 0x09, 0xF0, 0x33, 0xC2, 0x9D, 0x81, 0x90, 0x33, 0x59, 0xF4, 0x8F, 0x81,
-0x88, 0x23, 0x11, 0xF4, 0x9E, 0xE1, 0x1C, 0xC0, 0x81, 0x30, 0x11, 0xF0, 0x91, 0xE0, 0x18, 0xC0,
-0x98, 0xE9, 0x16, 0xC0, 0x89, 0x2F, 0x80, 0x75, 0x91, 0xF0, 0x90, 0x35, 0x39, 0xF4, 0xE0, 0xE0,
-0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x94, 0x91, 0x0A, 0xC0, 0x98, 0x35, 0x39, 0xF4,
-0xE3, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x94, 0x91, 0x01, 0xC0, 0x90, 0xE0,
-0x1A, 0x82, 0x1B, 0x82, 0x8D, 0x81, 0x8C, 0x83, 0x1D, 0x82, 0x9E, 0x83, 0x1F, 0x82, 0x27, 0xE0,
-0x30, 0xE0, 0x09, 0xC2, 0x1A, 0x82, 0x88, 0xE0, 0x8B, 0x83, 0x81, 0xE4, 0x8C, 0x83, 0x86, 0xE5,
-0x8D, 0x83, 0x82, 0xE5, 0x8E, 0x83, 0x89, 0xE4, 0x8F, 0x83, 0x83, 0xE5, 0x88, 0x87, 0x80, 0xE5,
-0x89, 0x87, 0x8F, 0xE5, 0x8A, 0x87, 0x82, 0xE3, 0x8B, 0x87, 0x2B, 0xE0, 0x30, 0xE0, 0xF3, 0xC1,
-0x8A, 0x81, 0x81, 0x39, 0x41, 0xF0, 0x82, 0x39, 0x41, 0xF0, 0x80, 0x39, 0x11, 0xF4, 0x8F, 0xE0,
-0x05, 0xC0, 0x80, 0xE0, 0x03, 0xC0, 0x82, 0xE0, 0x01, 0xC0, 0x8A, 0xE0, 0x1A, 0x82, 0x8B, 0x83,
-0x44, 0xC0, 0x77, 0x24, 0x73, 0x94, 0x82, 0xC0, 0x8D, 0x81, 0x88, 0x23, 0x11, 0xF4, 0x8E, 0xE1,
-0x2C, 0xC0, 0x81, 0x30, 0x11, 0xF0, 0x81, 0xE0, 0x28, 0xC0, 0x88, 0xE9, 0x26, 0xC0, 0x1A, 0x82,
-0xE1, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x8B, 0x83, 0x1C, 0x82,
-0x24, 0xE0, 0x30, 0xE0, 0xC8, 0xC1, 0x8B, 0x81, 0x80, 0x35, 0x89, 0xF4, 0x8C, 0x81, 0x88, 0x30,
-0x39, 0xF4, 0xE2, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x0D, 0xC0,
-0xE0, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x06, 0xC0, 0xE3, 0xE0,
-0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x1A, 0x82, 0xDF, 0xCF, 0x8D, 0x81,
-0x83, 0x6C, 0x99, 0xE0, 0xE1, 0xE0, 0xF0, 0xE0, 0x08, 0x2E, 0x90, 0x93, 0x57, 0x00, 0xE8, 0x95,
-0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x1A, 0x82, 0x1B, 0x82, 0x23, 0xE0, 0x30, 0xE0, 0x9B, 0xC1,
-0x80, 0xEC, 0x8A, 0x83, 0xCE, 0x5C, 0xDE, 0x4F, 0x18, 0x82, 0x19, 0x82, 0x1A, 0x82, 0x1B, 0x82,
-0xC2, 0x53, 0xD1, 0x40, 0x8E, 0xC1, 0x8A, 0x81, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0x58, 0x2F,
-0x44, 0x27, 0x33, 0x27, 0x22, 0x27, 0x8B, 0x81, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0xDC, 0x01,
-0x99, 0x27, 0x88, 0x27, 0x28, 0x2B, 0x39, 0x2B, 0x4A, 0x2B, 0x5B, 0x2B, 0x8D, 0x81, 0x90, 0xE0,
-0xA0, 0xE0, 0xB0, 0xE0, 0x28, 0x2B, 0x39, 0x2B, 0x4A, 0x2B, 0x5B, 0x2B, 0x8C, 0x81, 0x90, 0xE0,
-0xA0, 0xE0, 0xB0, 0xE0, 0xBA, 0x2F, 0xA9, 0x2F, 0x98, 0x2F, 0x88, 0x27, 0x28, 0x2B, 0x39, 0x2B,
-0x4A, 0x2B, 0x5B, 0x2B, 0x22, 0x0F, 0x33, 0x1F, 0x44, 0x1F, 0x55, 0x1F, 0xC0, 0x5E, 0xDE, 0x4F,
+0xC3, 0x01, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0xCA, 0xC0, 0x17, 0x08, 0x88, 0x83,
+0x99, 0x83, 0xAA, 0x83, 0xBB, 0x83, 0xC6, 0xC0, 0x1B, 0xC1, 0x27, 0x03, 0xA8, 0x81, 0xB9, 0x81,
+0xC1, 0x27, 0x01, 0x11, 0x96, 0xC1, 0x0D, 0x03, 0xB9, 0x83, 0xA8, 0x83, 0xC1, 0x0D, 0x04, 0xCD,
+0x01, 0x62, 0xE0, 0x70, 0xC0, 0x51, 0x0F, 0x34, 0xF2, 0xB0, 0xE2, 0xB0, 0x93, 0xC6, 0x00, 0x80,
+0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0xC1, 0x07, 0x08, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00,
+0xED, 0xE2, 0xE0, 0xD2, 0x17, 0x02, 0xF0, 0xE2, 0xF0, 0xD2, 0x17, 0xC1, 0x7B, 0x07, 0xE8, 0x80,
+0xF9, 0x80, 0x0A, 0x81, 0x1B, 0x81, 0xC1, 0x7B, 0x0B, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F,
+0x2D, 0x0F, 0x94, 0x0D, 0xF2, 0xC2, 0x97, 0xC2, 0x15, 0xC1, 0x0D, 0x05, 0xB0, 0xE2, 0xFB, 0x2E,
+0xF0, 0x92, 0xD1, 0x43, 0x02, 0x0D, 0xE3, 0x00, 0xD2, 0x5B, 0x02, 0x10, 0xE2, 0x10, 0xD2, 0x17,
+0x06, 0x8B, 0xBE, 0xF3, 0x01, 0x27, 0x91, 0xC6, 0xC0, 0x5D, 0x02, 0x28, 0x83, 0xCA, 0xC0, 0x5D,
+0x11, 0xA2, 0x2E, 0xBB, 0x24, 0xCC, 0x24, 0xDD, 0x24, 0x08, 0x94, 0x61, 0x1C, 0x71, 0x1C, 0x81,
+0x1C, 0x91, 0x1C, 0xC1, 0x21, 0x08, 0x87, 0x91, 0x28, 0x2E, 0x33, 0x24, 0x44, 0x24, 0x55, 0xCC,
+0x17, 0x02, 0x37, 0x91, 0xC5, 0xC0, 0x39, 0x02, 0x38, 0x83, 0xCB, 0xC0, 0x39, 0xCB, 0x19, 0x02,
+0x47, 0x91, 0xC4, 0xC0, 0x19, 0x02, 0x48, 0x83, 0xCC, 0xC0, 0x19, 0x06, 0xAD, 0xEF, 0xEA, 0x2E,
+0xAF, 0xEF, 0xFA, 0xC0, 0x03, 0x1D, 0x0A, 0x2F, 0xAF, 0xEF, 0x1A, 0x2F, 0x6E, 0x0C, 0x7F, 0x1C,
+0x80, 0x1E, 0x91, 0x1E, 0x14, 0x2D, 0x03, 0x2D, 0xF2, 0x2C, 0xEE, 0x24, 0xEA, 0x0C, 0xFB, 0x1C,
+0x0C, 0x1D, 0x1D, 0x1D, 0xC1, 0xD9, 0x02, 0x20, 0xE2, 0x20, 0xD2, 0xA7, 0xC1, 0xA1, 0x01, 0x88,
+0x81, 0xC1, 0xA1, 0xC1, 0x25, 0x02, 0x30, 0xE2, 0x30, 0xD2, 0x25, 0xC1, 0x73, 0x01, 0x88, 0x81,
+0xC1, 0x73, 0xC1, 0x25, 0x02, 0x40, 0xE2, 0x40, 0xD2, 0x25, 0xC1, 0xB3, 0x01, 0x88, 0x81, 0xC1,
+0xB3, 0xC1, 0x25, 0x02, 0x50, 0xE2, 0x50, 0xD2, 0x25, 0x44, 0x8F, 0xEF, 0xE8, 0x16, 0x8F, 0xEF,
+0xF8, 0x06, 0x80, 0xE0, 0x08, 0x07, 0x80, 0xE0, 0x18, 0x07, 0x31, 0xF4, 0x84, 0xE0, 0x92, 0xEE,
+0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xDF, 0xC0, 0xD8, 0x01, 0xC7, 0x01, 0x80, 0x70, 0x90, 0x7C,
+0xA0, 0x70, 0xB0, 0x70, 0x80, 0x50, 0x90, 0x4C, 0xA0, 0x40, 0xB0, 0x40, 0xD1, 0xF5, 0x2F, 0xEF,
+0x3F, 0xE3, 0x40, 0xE0, 0x50, 0xE0, 0xE2, 0x22, 0xF3, 0x22, 0x04, 0x23, 0x15, 0x23, 0xCA, 0xC0,
+0x69, 0x08, 0xA8, 0x80, 0xB9, 0x80, 0xCA, 0x80, 0xDB, 0x80, 0xC6, 0xC0, 0x6F, 0x10, 0xAE, 0x0C,
+0xBF, 0x1C, 0xC0, 0x1E, 0xD1, 0x1E, 0xAA, 0x0C, 0xBB, 0x1C, 0xCC, 0x1C, 0xDD, 0x1C, 0x8E, 0xC6,
+0x51, 0x07, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F, 0x2D, 0xC1, 0x91, 0x00, 0x8E, 0xC2, 0x05,
+0xD5, 0xE3, 0x01, 0x4E, 0xE3, 0xC9, 0xD5, 0x26, 0x87, 0xC0, 0x8E, 0xE0, 0x9E, 0xEF, 0xA0, 0xE0,
+0xB0, 0xE0, 0xE8, 0x22, 0xF9, 0x22, 0x0A, 0x23, 0x1B, 0x23, 0x9C, 0xE0, 0xE9, 0x16, 0x94, 0xE9,
+0xF9, 0x06, 0x90, 0xE0, 0x09, 0x07, 0x90, 0xE0, 0x19, 0x07, 0x09, 0xF0, 0x88, 0xC0, 0xC4, 0xC1,
+0x87, 0x01, 0x81, 0xCC, 0xC0, 0x81, 0x10, 0xEA, 0x2E, 0xFF, 0x24, 0x00, 0xE0, 0x10, 0xE0, 0x10,
+0x2F, 0x0F, 0x2D, 0xFE, 0x2C, 0xEE, 0x24, 0xC5, 0xC0, 0x19, 0x02, 0xB8, 0x81, 0xCB, 0xC0, 0x19,
+0x0F, 0xEB, 0x0E, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0xD6, 0x01, 0xC5, 0x01, 0x81, 0x70, 0x90,
+0x70, 0xC1, 0xD9, 0x11, 0xDC, 0x01, 0x99, 0x27, 0x88, 0x27, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F,
+0x1B, 0x1F, 0x20, 0xEF, 0x30, 0xE0, 0xC1, 0xDD, 0x09, 0xA2, 0x22, 0xB3, 0x22, 0xC4, 0x22, 0xD5,
+0x22, 0x41, 0xE1, 0xC5, 0xC7, 0x0F, 0x4A, 0x95, 0xD1, 0xF7, 0xEA, 0x0C, 0xFB, 0x1C, 0x0C, 0x1D,
+0x1D, 0x1D, 0x81, 0xE0, 0x90, 0xE0, 0xC1, 0x8F, 0x12, 0x28, 0x22, 0x39, 0x22, 0x4A, 0x22, 0x5B,
+0x22, 0x35, 0xE1, 0x22, 0x0C, 0x33, 0x1C, 0x44, 0x1C, 0x55, 0x1C, 0x3A, 0xC0, 0x25, 0x0B, 0xE2,
+0x0C, 0xF3, 0x1C, 0x04, 0x1D, 0x15, 0x1D, 0x57, 0x01, 0x68, 0x01, 0xC5, 0x3D, 0x0F, 0x85, 0xE1,
+0x92, 0xEE, 0x60, 0xE0, 0x0F, 0x94, 0xC2, 0xF1, 0xC8, 0x01, 0xAA, 0x27, 0xBB, 0x27, 0xC1, 0xFD,
+0x07, 0xBB, 0x27, 0xA1, 0x2F, 0x90, 0x2F, 0x8F, 0x2D, 0xC1, 0x0B, 0x00, 0x8E, 0xC2, 0x05, 0x02,
+0x90, 0xE2, 0x90, 0xC8, 0xF7, 0xC1, 0x07, 0x08, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xAE, 0xE3,
+0xA0, 0xD2, 0x17, 0x00, 0xC6, 0xC8, 0x4B, 0x04, 0xAD, 0x2D, 0x9C, 0x2D, 0x8B, 0xC2, 0x45, 0x00,
+0x8A, 0xC2, 0x05, 0x04, 0x0F, 0x94, 0xDC, 0xF1, 0xCC, 0xC0, 0xF9, 0x04, 0xE8, 0x81, 0xF9, 0x81,
+0xC4, 0xC0, 0xFB, 0x1E, 0xF9, 0x97, 0x09, 0xF4, 0x4D, 0xCB, 0xF4, 0xE0, 0xEF, 0x2E, 0xF1, 0x2C,
+0x01, 0x2D, 0x11, 0x2D, 0x6E, 0x0C, 0x7F, 0x1C, 0x80, 0x1E, 0x91, 0x1E, 0xF2, 0xCD, 0x83, 0xE0,
+0x93, 0xEE, 0x62, 0xC0, 0x9B, 0x02, 0xF5, 0xF1, 0x8A, 0xC6, 0xA5, 0xC1, 0x63, 0x00, 0x87, 0xC0,
+0x6B, 0x06, 0x10, 0x91, 0xC6, 0x00, 0x1F, 0x75, 0x10, 0xD2, 0x7D, 0xC1, 0x61, 0x14, 0x81, 0x2F,
+0x81, 0x54, 0x8A, 0x31, 0x08, 0xF0, 0x36, 0xC1, 0x16, 0x34, 0x09, 0xF4, 0x95, 0xC0, 0x17, 0x34,
+0x90, 0xF4, 0x13, 0xC0, 0x09, 0x10, 0x4E, 0xC0, 0x14, 0x34, 0x30, 0xF4, 0x11, 0x34, 0xF1, 0xF0,
+0x12, 0x34, 0x09, 0xF0, 0x1D, 0xC1, 0x30, 0xC0, 0x0F, 0x04, 0x09, 0xF4, 0x59, 0xC0, 0x15, 0xC0,
+0x0D, 0x04, 0x16, 0xC1, 0x6B, 0xC0, 0x1A, 0xC0, 0x0D, 0x06, 0xC4, 0xC0, 0x1B, 0x34, 0x38, 0xF4,
+0x17, 0xC0, 0x09, 0x02, 0x8F, 0xC0, 0x18, 0xC0, 0x17, 0x02, 0x0A, 0xC1, 0xA1, 0xC0, 0x11, 0x04,
+0x09, 0xF4, 0xD2, 0xC0, 0x1C, 0xC0, 0x0D, 0x23, 0x03, 0xC1, 0xE8, 0xC0, 0x8F, 0xEF, 0x81, 0xB9,
+0x0D, 0xC0, 0x82, 0xB1, 0x80, 0x95, 0x82, 0xB9, 0x80, 0xE0, 0x90, 0xE0, 0xE0, 0xED, 0xF7, 0xE0,
+0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x88, 0x3C, 0x91, 0x05, 0xC1, 0xF7, 0xC3, 0xA5, 0x04, 0xEF,
+0xCF, 0x12, 0xB8, 0xEF, 0xC0, 0x2B, 0x00, 0x84, 0xC0, 0x2B, 0x00, 0x85, 0xC0, 0x2B, 0x00, 0x85,
+0xDA, 0x2B, 0x02, 0x15, 0xB8, 0xD9, 0xC0, 0x2B, 0x00, 0x87, 0xC0, 0x2B, 0x00, 0x88, 0xC0, 0x2B,
+0x00, 0x88, 0xDA, 0x2B, 0x02, 0x18, 0xB8, 0xC3, 0xC0, 0x2B, 0x00, 0x8A, 0xC0, 0x2B, 0x00, 0x8B,
+0xC0, 0x2B, 0x00, 0x8B, 0xDA, 0x2B, 0x02, 0x1B, 0xB8, 0xAD, 0xC0, 0x2B, 0x00, 0x8D, 0xC0, 0x2B,
+0x00, 0x8E, 0xC0, 0x2B, 0x00, 0x8E, 0xDA, 0x2B, 0x02, 0x1E, 0xB8, 0x97, 0xC0, 0x2B, 0x09, 0x80,
+0xBB, 0x0D, 0xC0, 0x81, 0xB3, 0x80, 0x95, 0x81, 0xBB, 0xD9, 0x2B, 0x02, 0x11, 0xBA, 0x81, 0xC0,
+0x2B, 0x00, 0x83, 0xC0, 0x2B, 0x00, 0x84, 0xC0, 0x2B, 0x00, 0x84, 0xDA, 0x2B, 0x02, 0x14, 0xBA,
+0x6B, 0xC1, 0x57, 0x0C, 0x93, 0x01, 0x01, 0x0F, 0xC0, 0x80, 0x91, 0x02, 0x01, 0x80, 0x95, 0x80,
+0x93, 0xC0, 0x05, 0xD6, 0x31, 0x06, 0xED, 0xCF, 0x10, 0x92, 0x02, 0x01, 0x51, 0xC2, 0x33, 0x00,
+0x04, 0xC2, 0x33, 0x00, 0x05, 0xC2, 0x33, 0xC0, 0x05, 0xDA, 0x33, 0x02, 0x05, 0x01, 0x37, 0xC2,
+0x33, 0x00, 0x07, 0xC2, 0x33, 0x00, 0x08, 0xC2, 0x33, 0xC0, 0x05, 0xDA, 0x33, 0x02, 0x08, 0x01,
+0x1D, 0xC2, 0x33, 0x00, 0x0A, 0xC2, 0x33, 0x00, 0x0B, 0xC2, 0x33, 0xC0, 0x05, 0xDA, 0x33, 0x09,
+0x0B, 0x01, 0x03, 0xC0, 0x85, 0xE2, 0x92, 0xEE, 0xEE, 0xC9, 0xC3, 0x13, 0x6E, 0xFC, 0xCF, 0x80,
+0x91, 0xC6, 0x00, 0xEA, 0xC9, 0x88, 0xE3, 0x92, 0xEE, 0xE4, 0xC9, 0x8C, 0xE1, 0x91, 0xEE, 0xE1,
+0xC9, 0x88, 0x24, 0x99, 0x24, 0x93, 0x30, 0x11, 0xF1, 0x94, 0x30, 0x28, 0xF4, 0x91, 0x30, 0x89,
+0xF0, 0x92, 0x30, 0xB8, 0xF4, 0x08, 0xC0, 0x95, 0x30, 0x61, 0xF1, 0x95, 0x30, 0xF0, 0xF0, 0x96,
+0x30, 0x09, 0xF0, 0x48, 0xC0, 0x43, 0xC0, 0x2B, 0x31, 0x09, 0xF0, 0x42, 0xC9, 0x91, 0xE0, 0x6B,
+0xE1, 0x3F, 0xC9, 0x62, 0x27, 0xC1, 0x5D, 0xDE, 0x4F, 0x28, 0x83, 0xCF, 0x52, 0xD1, 0x40, 0x92,
+0xE0, 0x37, 0xC9, 0xB2, 0x2F, 0xA0, 0xE0, 0x62, 0x27, 0x93, 0xE0, 0x32, 0xC9, 0x82, 0x2F, 0x90,
+0xE0, 0xA8, 0x2B, 0xB9, 0x2B, 0x62, 0x27, 0x94, 0xE0, 0x2B, 0xC9, 0x2E, 0xC0, 0x3B, 0x06, 0x39,
+0xC3, 0x62, 0x27, 0x95, 0xE0, 0xC0, 0xC0, 0x2F, 0x11, 0x19, 0x82, 0x18, 0x82, 0xC0, 0x53, 0xD1,
+0x40, 0x1F, 0xC9, 0xE1, 0xE0, 0xF0, 0xE0, 0xEC, 0x0F, 0xFD, 0x1F, 0xC1, 0x15, 0x03, 0x08, 0x81,
+0x19, 0x81, 0xC1, 0x15, 0x09, 0xE0, 0x0F, 0xF1, 0x1F, 0x20, 0x83, 0x0F, 0x5F, 0x1F, 0x4F, 0xC2,
+0x2B, 0x02, 0x83, 0x08, 0x83, 0xC1, 0x15, 0x18, 0x62, 0x27, 0x0A, 0x17, 0x1B, 0x07, 0x09, 0xF0,
+0x05, 0xC9, 0xD8, 0x01, 0x96, 0xE0, 0x02, 0xC9, 0x26, 0x17, 0x09, 0xF0, 0x10, 0xC3, 0x03, 0xC0,
+0x97, 0xC0, 0x59, 0x0F, 0xFB, 0xC8, 0x77, 0x24, 0x99, 0x81, 0x93, 0x31, 0x09, 0xF4, 0x12, 0xC1,
+0x94, 0x31, 0xC8, 0xF4, 0xC0, 0xA9, 0x01, 0xF4, 0xD8, 0xC0, 0x19, 0x02, 0x50, 0xF4, 0x92, 0xC0,
+0x09, 0x02, 0x06, 0xC1, 0x93, 0xC0, 0x05, 0x02, 0x6D, 0xC0, 0x91, 0xC0, 0x29, 0x04, 0x59, 0xC2,
+0x53, 0xC0, 0x91, 0xC0, 0x27, 0x08, 0x77, 0xC0, 0x92, 0x31, 0x08, 0xF0, 0xBB, 0xC0, 0x90, 0xC0,
+0xCB, 0x04, 0x4F, 0xC2, 0xF5, 0xC0, 0x98, 0xC0, 0x13, 0x06, 0x87, 0xC0, 0x99, 0x31, 0x50, 0xF4,
+0x95, 0xC0, 0x09, 0x08, 0xEF, 0xC0, 0x95, 0x31, 0x08, 0xF4, 0xC6, 0xC1, 0x96, 0xC0, 0x1D, 0x04,
+0x40, 0xC2, 0xC2, 0xC1, 0x9A, 0xC0, 0x13, 0x02, 0x6C, 0xC0, 0x9A, 0xC0, 0x13, 0x02, 0x91, 0xC0,
+0x9B, 0xC0, 0x0B, 0x02, 0x5B, 0xC0, 0x9D, 0xC0, 0x19, 0x28, 0x33, 0xC2, 0x9D, 0x81, 0x90, 0x33,
+0x59, 0xF4, 0x8F, 0x81, 0x88, 0x23, 0x11, 0xF4, 0x9E, 0xE1, 0x1C, 0xC0, 0x81, 0x30, 0x11, 0xF0,
+0x91, 0xE0, 0x18, 0xC0, 0x98, 0xE9, 0x16, 0xC0, 0x89, 0x2F, 0x80, 0x75, 0x91, 0xF0, 0x90, 0x35,
+0x39, 0xF4, 0xE0, 0xC0, 0xE3, 0x0A, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x94, 0x91, 0x0A, 0xC0,
+0x98, 0xC0, 0x11, 0x00, 0xE3, 0xC8, 0x11, 0x3E, 0x01, 0xC0, 0x90, 0xE0, 0x1A, 0x82, 0x1B, 0x82,
+0x8D, 0x81, 0x8C, 0x83, 0x1D, 0x82, 0x9E, 0x83, 0x1F, 0x82, 0x27, 0xE0, 0x30, 0xE0, 0x09, 0xC2,
+0x1A, 0x82, 0x88, 0xE0, 0x8B, 0x83, 0x81, 0xE4, 0x8C, 0x83, 0x86, 0xE5, 0x8D, 0x83, 0x82, 0xE5,
+0x8E, 0x83, 0x89, 0xE4, 0x8F, 0x83, 0x83, 0xE5, 0x88, 0x87, 0x80, 0xE5, 0x89, 0x87, 0x8F, 0xE5,
+0x8A, 0x87, 0x82, 0xE3, 0x8B, 0x87, 0x2B, 0xC0, 0x2B, 0x08, 0xF3, 0xC1, 0x8A, 0x81, 0x81, 0x39,
+0x41, 0xF0, 0x82, 0xC0, 0x03, 0x10, 0x80, 0x39, 0x11, 0xF4, 0x8F, 0xE0, 0x05, 0xC0, 0x80, 0xE0,
+0x03, 0xC0, 0x82, 0xE0, 0x01, 0xC0, 0x8A, 0xC0, 0x5B, 0x0A, 0x8B, 0x83, 0x44, 0xC0, 0x77, 0x24,
+0x73, 0x94, 0x82, 0xC0, 0x8D, 0xC2, 0xA9, 0x02, 0x8E, 0xE1, 0x2C, 0xC2, 0xA9, 0x0A, 0x81, 0xE0,
+0x28, 0xC0, 0x88, 0xE9, 0x26, 0xC0, 0x1A, 0x82, 0xE1, 0xC6, 0x8F, 0x06, 0x84, 0x91, 0x8B, 0x83,
+0x1C, 0x82, 0x24, 0xC0, 0x55, 0x0E, 0xC8, 0xC1, 0x8B, 0x81, 0x80, 0x35, 0x89, 0xF4, 0x8C, 0x81,
+0x88, 0x30, 0x39, 0xF4, 0xE2, 0xC8, 0x21, 0x01, 0x0D, 0xC0, 0xC7, 0xD1, 0x03, 0x84, 0x91, 0x06,
+0xC0, 0xC7, 0xCD, 0x0B, 0x84, 0x91, 0x1A, 0x82, 0xDF, 0xCF, 0x8D, 0x81, 0x83, 0x6C, 0x99, 0xE0,
+0xC1, 0x53, 0x02, 0x08, 0x2E, 0x90, 0xC0, 0x15, 0x07, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD,
+0xCF, 0xC1, 0xE5, 0x00, 0x23, 0xC0, 0x59, 0x0D, 0x9B, 0xC1, 0x80, 0xEC, 0x8A, 0x83, 0xCE, 0x5C,
+0xDE, 0x4F, 0x18, 0x82, 0x19, 0x82, 0xC1, 0x15, 0x04, 0xC2, 0x53, 0xD1, 0x40, 0x8E, 0xC0, 0xC5,
+0x0E, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0x58, 0x2F, 0x44, 0x27, 0x33, 0x27, 0x22, 0x27, 0x8B,
+0xC4, 0x0F, 0x0E, 0xDC, 0x01, 0x99, 0x27, 0x88, 0x27, 0x28, 0x2B, 0x39, 0x2B, 0x4A, 0x2B, 0x5B,
+0x2B, 0x8D, 0xC4, 0x15, 0xC5, 0x0F, 0x00, 0x8C, 0xC4, 0x0F, 0x05, 0xBA, 0x2F, 0xA9, 0x2F, 0x98,
+0x2F, 0xC7, 0x27, 0x1E, 0x22, 0x0F, 0x33, 0x1F, 0x44, 0x1F, 0x55, 0x1F, 0xC0, 0x5E, 0xDE, 0x4F,
 0x28, 0x83, 0x39, 0x83, 0x4A, 0x83, 0x5B, 0x83, 0xC0, 0x52, 0xD1, 0x40, 0x1A, 0x82, 0x59, 0xC1,
-0x3A, 0x81, 0xC9, 0x5C, 0xDE, 0x4F, 0x38, 0x83, 0xC7, 0x53, 0xD1, 0x40, 0xCA, 0x5C, 0xDE, 0x4F,
-0x18, 0x82, 0xC6, 0x53, 0xD1, 0x40, 0x8B, 0x81, 0xC8, 0x2E, 0xDD, 0x24, 0xCA, 0x5C, 0xDE, 0x4F,
-0x48, 0x81, 0x59, 0x81, 0xC6, 0x53, 0xD1, 0x40, 0xC4, 0x2A, 0xD5, 0x2A, 0x93, 0x31, 0x09, 0xF0,
-0x82, 0xC0, 0xCE, 0x5C, 0xDE, 0x4F, 0x88, 0x81, 0x99, 0x81, 0xAA, 0x81, 0xBB, 0x81, 0xC2, 0x53,
-0xD1, 0x40, 0x80, 0x50, 0x90, 0x4C, 0xA3, 0x40, 0xB0, 0x40, 0x30, 0xF5, 0x83, 0xE0, 0xCE, 0x5C,
-0xDE, 0x4F, 0xE8, 0x80, 0xF9, 0x80, 0x0A, 0x81, 0x1B, 0x81, 0xC2, 0x53, 0xD1, 0x40, 0xF7, 0x01,
-0x00, 0x93, 0x5B, 0x00, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF,
-0xCE, 0x5C, 0xDE, 0x4F, 0x08, 0x81, 0x19, 0x81, 0x2A, 0x81, 0x3B, 0x81, 0xC2, 0x53, 0xD1, 0x40,
-0x00, 0x50, 0x1F, 0x4F, 0x2F, 0x4F, 0x3F, 0x4F, 0xCE, 0x5C, 0xDE, 0x4F, 0x08, 0x83, 0x19, 0x83,
-0x2A, 0x83, 0x3B, 0x83, 0xC2, 0x53, 0xD1, 0x40, 0xC0, 0x5E, 0xDE, 0x4F, 0x48, 0x81, 0x59, 0x81,
-0x6A, 0x81, 0x7B, 0x81, 0xC0, 0x52, 0xD1, 0x40, 0xDE, 0x01, 0x1B, 0x96, 0x31, 0xE0, 0x8C, 0x91,
-0x11, 0x96, 0x2C, 0x91, 0x11, 0x97, 0x12, 0x96, 0xC7, 0x5C, 0xDE, 0x4F, 0x28, 0x83, 0xC9, 0x53,
-0xD1, 0x40, 0xC8, 0x5C, 0xDE, 0x4F, 0x18, 0x82, 0xC8, 0x53, 0xD1, 0x40, 0x90, 0xE0, 0xC8, 0x5C,
-0xDE, 0x4F, 0xE8, 0x81, 0xF9, 0x81, 0xC8, 0x53, 0xD1, 0x40, 0x8E, 0x2B, 0x9F, 0x2B, 0x0C, 0x01,
-0xFA, 0x01, 0x60, 0x93, 0x5B, 0x00, 0x30, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x11, 0x24, 0x4E, 0x5F,
-0x5F, 0x4F, 0x6F, 0x4F, 0x7F, 0x4F, 0x0E, 0xEF, 0xE0, 0x2E, 0x0F, 0xEF, 0xF0, 0x2E, 0xCE, 0x0C,
-0xDF, 0x1C, 0xC1, 0x14, 0xD1, 0x04, 0x99, 0xF6, 0x85, 0xE0, 0xC0, 0x5E, 0xDE, 0x4F, 0x08, 0x81,
-0x19, 0x81, 0x2A, 0x81, 0x3B, 0x81, 0xC0, 0x52, 0xD1, 0x40, 0xF8, 0x01, 0x20, 0x93, 0x5B, 0x00,
-0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x81, 0xE1, 0x80, 0x93,
-0x57, 0x00, 0xE8, 0x95, 0x35, 0xC0, 0xC0, 0x5E, 0xDE, 0x4F, 0x88, 0x81, 0x99, 0x81, 0xAA, 0x81,
-0xBB, 0x81, 0xC0, 0x52, 0xD1, 0x40, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0x7C, 0x01,
-0x86, 0x01, 0xAB, 0xE0, 0xAA, 0x2E, 0xB1, 0x2C, 0xAC, 0x0E, 0xBD, 0x1E, 0x0B, 0xC0, 0xD5, 0x01,
-0x6D, 0x91, 0x5D, 0x01, 0xC7, 0x01, 0x0F, 0x94, 0x89, 0xFE, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C,
-0x01, 0x50, 0x10, 0x40, 0x01, 0x15, 0x11, 0x05, 0x91, 0xF7, 0xA6, 0x01, 0x60, 0xE0, 0x70, 0xE0,
-0x44, 0x0F, 0x55, 0x1F, 0x66, 0x1F, 0x77, 0x1F, 0xC0, 0x5E, 0xDE, 0x4F, 0xE8, 0x80, 0xF9, 0x80,
-0x0A, 0x81, 0x1B, 0x81, 0xC0, 0x52, 0xD1, 0x40, 0x4E, 0x0D, 0x5F, 0x1D, 0x60, 0x1F, 0x71, 0x1F,
-0x1A, 0x82, 0xC0, 0x5E, 0xDE, 0x4F, 0x48, 0x83, 0x59, 0x83, 0x6A, 0x83, 0x7B, 0x83, 0xC0, 0x52,
-0xD1, 0x40, 0x7F, 0xC0, 0xFA, 0x80, 0xC5, 0x5C, 0xDE, 0x4F, 0xF8, 0x82, 0xCB, 0x53, 0xD1, 0x40,
-0xC6, 0x5C, 0xDE, 0x4F, 0x18, 0x82, 0xCA, 0x53, 0xD1, 0x40, 0x8B, 0x81, 0xC8, 0x2E, 0xDD, 0x24,
-0xC6, 0x5C, 0xDE, 0x4F, 0x08, 0x81, 0x19, 0x81, 0xCA, 0x53, 0xD1, 0x40, 0xC0, 0x2A, 0xD1, 0x2A,
-0x1A, 0x82, 0x89, 0x81, 0xBE, 0x01, 0x6D, 0x5F, 0x7F, 0x4F, 0x84, 0x31, 0x21, 0xF5, 0x96, 0x01,
-0xC0, 0x5E, 0xDE, 0x4F, 0xE8, 0x80, 0xF9, 0x80, 0x0A, 0x81, 0x1B, 0x81, 0xC0, 0x52, 0xD1, 0x40,
-0x0B, 0xBF, 0xF7, 0x01, 0x87, 0x91, 0x96, 0x91, 0xDB, 0x01, 0x8C, 0x93, 0x11, 0x96, 0x9C, 0x93,
-0x6E, 0x5F, 0x7F, 0x4F, 0xD8, 0x01, 0xC7, 0x01, 0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0xC0, 0x5E,
-0xDE, 0x4F, 0x88, 0x83, 0x99, 0x83, 0xAA, 0x83, 0xBB, 0x83, 0xC0, 0x52, 0xD1, 0x40, 0x22, 0x50,
-0x30, 0x40, 0xF1, 0xF6, 0x36, 0xC0, 0xC0, 0x5E, 0xDE, 0x4F, 0x28, 0x81, 0x39, 0x81, 0x4A, 0x81,
-0x5B, 0x81, 0xC0, 0x52, 0xD1, 0x40, 0x08, 0x94, 0xC1, 0x08, 0xD1, 0x08, 0x76, 0x01, 0x00, 0xE0,
-0x10, 0xE0, 0x08, 0x94, 0xC1, 0x1C, 0xD1, 0x1C, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D,
-0x11, 0x1D, 0xE2, 0x0E, 0xF3, 0x1E, 0x04, 0x1F, 0x15, 0x1F, 0x21, 0xBD, 0xBB, 0x27, 0xA5, 0x2F,
-0x94, 0x2F, 0x83, 0x2F, 0x82, 0xBD, 0x2F, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F, 0x5F, 0x4F, 0xF8, 0x9A,
-0x80, 0xB5, 0xDB, 0x01, 0x8D, 0x93, 0xBD, 0x01, 0x2E, 0x15, 0x3F, 0x05, 0x40, 0x07, 0x51, 0x07,
-0x61, 0xF7, 0xC0, 0x5E, 0xDE, 0x4F, 0x28, 0x83, 0x39, 0x83, 0x4A, 0x83, 0x5B, 0x83, 0xC0, 0x52,
-0xD1, 0x40, 0x96, 0x01, 0x2D, 0x5F, 0x3F, 0x4F, 0xFB, 0x01, 0x10, 0x82, 0x04, 0xC0, 0x80, 0xEC,
-0x8A, 0x83, 0x22, 0xE0, 0x30, 0xE0, 0x8B, 0xE1, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xC1, 0x5D,
-0xDE, 0x4F, 0xF8, 0x81, 0xCF, 0x52, 0xD1, 0x40, 0xF0, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x43, 0x2F,
-0x30, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x92, 0x2F, 0x20, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x8E, 0xE0,
-0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xC0, 0x00,
-0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x65, 0xE1, 0xC1, 0x5D, 0xDE, 0x4F, 0xE8, 0x80, 0xCF, 0x52,
-0xD1, 0x40, 0x6E, 0x25, 0x69, 0x27, 0x64, 0x27, 0xFE, 0x01, 0x31, 0x96, 0x10, 0xC0, 0x90, 0x81,
-0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0x31, 0x96, 0x80, 0x91,
-0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x69, 0x27, 0x21, 0x50, 0x30, 0x40, 0x21, 0x15,
-0x31, 0x05, 0x69, 0xF7, 0x60, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF,
-0x80, 0x91, 0xC0, 0x00, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x85, 0xB1, 0x80, 0x58, 0x85, 0xB9,
-0x77, 0x20, 0x81, 0xF4, 0xC1, 0x5D, 0xDE, 0x4F, 0x08, 0x81, 0xCF, 0x52, 0xD1, 0x40, 0x0F, 0x5F,
-0xC1, 0x5D, 0xDE, 0x4F, 0x08, 0x83, 0xCF, 0x52, 0xD1, 0x40, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0,
-0x0D, 0x94, 0x24, 0xF4, 0x27, 0x98, 0x2F, 0x98, 0x80, 0xE0, 0x90, 0xE0, 0x20, 0xED, 0x37, 0xE0,
-0xF9, 0x01, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x84, 0x36, 0x91, 0x05, 0xC9, 0xF7, 0x00, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x8D, 0x7F, 0x80, 0x93, 0xC0, 0x00, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00,
-0xE8, 0x95, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94, 0xFF, 0xCF, 0x90, 0xE0, 0x0D, 0x94, 0x24, 0xF4,
-0x97, 0xFB, 0x09, 0x2E, 0x07, 0x26, 0x0A, 0xD0, 0x77, 0xFD, 0x04, 0xD0, 0x2E, 0xD0, 0x06, 0xD0,
-0x00, 0x20, 0x1A, 0xF4, 0x70, 0x95, 0x61, 0x95, 0x7F, 0x4F, 0x08, 0x95, 0xF6, 0xF7, 0x90, 0x95,
-0x81, 0x95, 0x9F, 0x4F, 0x08, 0x95, 0xA1, 0xE2, 0x1A, 0x2E, 0xAA, 0x1B, 0xBB, 0x1B, 0xFD, 0x01,
-0x0D, 0xC0, 0xAA, 0x1F, 0xBB, 0x1F, 0xEE, 0x1F, 0xFF, 0x1F, 0xA2, 0x17, 0xB3, 0x07, 0xE4, 0x07,
-0xF5, 0x07, 0x20, 0xF0, 0xA2, 0x1B, 0xB3, 0x0B, 0xE4, 0x0B, 0xF5, 0x0B, 0x66, 0x1F, 0x77, 0x1F,
-0x88, 0x1F, 0x99, 0x1F, 0x1A, 0x94, 0x69, 0xF7, 0x60, 0x95, 0x70, 0x95, 0x80, 0x95, 0x90, 0x95,
-0x9B, 0x01, 0xAC, 0x01, 0xBD, 0x01, 0xCF, 0x01, 0x08, 0x95, 0xAA, 0x1B, 0xBB, 0x1B, 0x51, 0xE1,
-0x07, 0xC0, 0xAA, 0x1F, 0xBB, 0x1F, 0xA6, 0x17, 0xB7, 0x07, 0x10, 0xF0, 0xA6, 0x1B, 0xB7, 0x0B,
-0x88, 0x1F, 0x99, 0x1F, 0x5A, 0x95, 0xA9, 0xF7, 0x80, 0x95, 0x90, 0x95, 0xBC, 0x01, 0xCD, 0x01,
-0x08, 0x95, 0xF9, 0x99, 0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD, 0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5,
-0x08, 0x95, 0x26, 0x2F, 0xF9, 0x99, 0xFE, 0xCF, 0x1F, 0xBA, 0x92, 0xBD, 0x81, 0xBD, 0x20, 0xBD,
-0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A, 0x0F, 0xBE, 0x01, 0x96, 0x08, 0x95, 0xF8, 0x94,
-0xFF, 0xCF,
-}; // end of atmega2560_bootloader_hex
-
+0x3A, 0x81, 0xC9, 0xC0, 0x7D, 0x02, 0x38, 0x83, 0xC7, 0xC0, 0x77, 0x00, 0xCA, 0xC2, 0x87, 0x00,
+0xC6, 0xC0, 0x09, 0x05, 0x8B, 0x81, 0xC8, 0x2E, 0xDD, 0x24, 0xC1, 0x0F, 0x03, 0x48, 0x81, 0x59,
+0x81, 0xC1, 0x11, 0x09, 0xC4, 0x2A, 0xD5, 0x2A, 0x93, 0x31, 0x09, 0xF0, 0x82, 0xC0, 0xC1, 0xAD,
+0x07, 0x88, 0x81, 0x99, 0x81, 0xAA, 0x81, 0xBB, 0x81, 0xC1, 0xAD, 0x0B, 0x80, 0x50, 0x90, 0x4C,
+0xA3, 0x40, 0xB0, 0x40, 0x30, 0xF5, 0x83, 0xE0, 0xC1, 0x1B, 0x06, 0xE8, 0x80, 0xF9, 0x80, 0x0A,
+0x81, 0x1B, 0xC2, 0x1B, 0x06, 0xF7, 0x01, 0x00, 0x93, 0x5B, 0x00, 0x80, 0xC8, 0xF9, 0xC1, 0x21,
+0x06, 0x08, 0x81, 0x19, 0x81, 0x2A, 0x81, 0x3B, 0xC2, 0x21, 0x07, 0x00, 0x50, 0x1F, 0x4F, 0x2F,
+0x4F, 0x3F, 0x4F, 0xC2, 0x17, 0x06, 0x83, 0x19, 0x83, 0x2A, 0x83, 0x3B, 0x83, 0xC1, 0x17, 0xC1,
+0xAB, 0xC1, 0x7B, 0x03, 0x6A, 0x81, 0x7B, 0x81, 0xC1, 0xAB, 0x10, 0xDE, 0x01, 0x1B, 0x96, 0x31,
+0xE0, 0x8C, 0x91, 0x11, 0x96, 0x2C, 0x91, 0x11, 0x97, 0x12, 0x96, 0xC7, 0xC0, 0x2F, 0x02, 0x28,
+0x83, 0xC9, 0xC0, 0x29, 0x00, 0xC8, 0xC2, 0xB5, 0x00, 0xC8, 0xC0, 0x09, 0x01, 0x90, 0xE0, 0xC1,
+0x0B, 0x03, 0xE8, 0x81, 0xF9, 0x81, 0xC1, 0x0D, 0x08, 0x8E, 0x2B, 0x9F, 0x2B, 0x0C, 0x01, 0xFA,
+0x01, 0x60, 0xC0, 0x81, 0x00, 0x30, 0xC2, 0x81, 0x1D, 0x11, 0x24, 0x4E, 0x5F, 0x5F, 0x4F, 0x6F,
+0x4F, 0x7F, 0x4F, 0x0E, 0xEF, 0xE0, 0x2E, 0x0F, 0xEF, 0xF0, 0x2E, 0xCE, 0x0C, 0xDF, 0x1C, 0xC1,
+0x14, 0xD1, 0x04, 0x99, 0xF6, 0x85, 0xE0, 0xC1, 0x71, 0xC5, 0x99, 0xC1, 0x71, 0x02, 0xF8, 0x01,
+0x20, 0xCC, 0xBB, 0x01, 0x81, 0xE1, 0xC3, 0x0D, 0x01, 0x35, 0xC0, 0xC1, 0x2B, 0x06, 0x88, 0x81,
+0x99, 0x81, 0xAA, 0x81, 0xBB, 0xC2, 0x2B, 0x41, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95,
+0x7C, 0x01, 0x86, 0x01, 0xAB, 0xE0, 0xAA, 0x2E, 0xB1, 0x2C, 0xAC, 0x0E, 0xBD, 0x1E, 0x0B, 0xC0,
+0xD5, 0x01, 0x6D, 0x91, 0x5D, 0x01, 0xC7, 0x01, 0x0F, 0x94, 0x89, 0xFE, 0x08, 0x94, 0xE1, 0x1C,
+0xF1, 0x1C, 0x01, 0x50, 0x10, 0x40, 0x01, 0x15, 0x11, 0x05, 0x91, 0xF7, 0xA6, 0x01, 0x60, 0xE0,
+0x70, 0xE0, 0x44, 0x0F, 0x55, 0x1F, 0x66, 0x1F, 0x77, 0x1F, 0xC1, 0x51, 0x06, 0xE8, 0x80, 0xF9,
+0x80, 0x0A, 0x81, 0x1B, 0xC2, 0x51, 0x09, 0x4E, 0x0D, 0x5F, 0x1D, 0x60, 0x1F, 0x71, 0x1F, 0x1A,
+0x82, 0xC1, 0x19, 0x07, 0x48, 0x83, 0x59, 0x83, 0x6A, 0x83, 0x7B, 0x83, 0xC1, 0x19, 0x04, 0x7F,
+0xC0, 0xFA, 0x80, 0xC5, 0xC0, 0xE7, 0x02, 0xF8, 0x82, 0xCB, 0xC0, 0xE5, 0x00, 0xC6, 0xC2, 0xFD,
+0x00, 0xCA, 0xC0, 0x09, 0x05, 0x8B, 0x81, 0xC8, 0x2E, 0xDD, 0x24, 0xC1, 0x0F, 0xC1, 0xC5, 0xC1,
+0x11, 0x13, 0xC0, 0x2A, 0xD1, 0x2A, 0x1A, 0x82, 0x89, 0x81, 0xBE, 0x01, 0x6D, 0x5F, 0x7F, 0x4F,
+0x84, 0x31, 0x21, 0xF5, 0x96, 0x01, 0xCD, 0x67, 0x10, 0x0B, 0xBF, 0xF7, 0x01, 0x87, 0x91, 0x96,
+0x91, 0xDB, 0x01, 0x8C, 0x93, 0x11, 0x96, 0x9C, 0x93, 0x6E, 0xC0, 0x29, 0x00, 0xD8, 0xC0, 0xB1,
+0x05, 0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0xC2, 0xE7, 0x05, 0x83, 0x99, 0x83, 0xAA, 0x83, 0xBB,
+0xC2, 0x7B, 0x06, 0x22, 0x50, 0x30, 0x40, 0xF1, 0xF6, 0x36, 0xC2, 0xFF, 0x06, 0x28, 0x81, 0x39,
+0x81, 0x4A, 0x81, 0x5B, 0xC2, 0x45, 0x0B, 0x08, 0x94, 0xC1, 0x08, 0xD1, 0x08, 0x76, 0x01, 0x00,
+0xE0, 0x10, 0xE0, 0xC0, 0x0B, 0x02, 0x1C, 0xD1, 0x1C, 0xC4, 0xED, 0x32, 0x1D, 0x11, 0x1D, 0xE2,
+0x0E, 0xF3, 0x1E, 0x04, 0x1F, 0x15, 0x1F, 0x21, 0xBD, 0xBB, 0x27, 0xA5, 0x2F, 0x94, 0x2F, 0x83,
+0x2F, 0x82, 0xBD, 0x2F, 0x5F, 0x3F, 0x4F, 0x4F, 0x4F, 0x5F, 0x4F, 0xF8, 0x9A, 0x80, 0xB5, 0xDB,
+0x01, 0x8D, 0x93, 0xBD, 0x01, 0x2E, 0x15, 0x3F, 0x05, 0x40, 0x07, 0x51, 0x07, 0x61, 0xF7, 0xC2,
+0x5B, 0x05, 0x83, 0x39, 0x83, 0x4A, 0x83, 0x5B, 0xC2, 0x73, 0x02, 0x96, 0x01, 0x2D, 0xC0, 0x2D,
+0x1B, 0xFB, 0x01, 0x10, 0x82, 0x04, 0xC0, 0x80, 0xEC, 0x8A, 0x83, 0x22, 0xE0, 0x30, 0xE0, 0x8B,
+0xE1, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF, 0xFC, 0xCF, 0xC1, 0x07, 0x0C,
+0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0xC1, 0x5D, 0xDE, 0x4F, 0xF8, 0x81, 0xCF, 0xC0, 0x35, 0x00,
+0xF0, 0xD2, 0x1F, 0x02, 0x43, 0x2F, 0x30, 0xD2, 0x17, 0x02, 0x92, 0x2F, 0x20, 0xD2, 0x17, 0x01,
+0x8E, 0xE0, 0xD3, 0x67, 0x01, 0x65, 0xE1, 0xC1, 0x69, 0x01, 0xE8, 0x80, 0xC1, 0x69, 0x0E, 0x6E,
+0x25, 0x69, 0x27, 0x64, 0x27, 0xFE, 0x01, 0x31, 0x96, 0x10, 0xC0, 0x90, 0x81, 0x90, 0xC8, 0x2F,
+0x01, 0x31, 0x96, 0xC7, 0x31, 0x0C, 0x69, 0x27, 0x21, 0x50, 0x30, 0x40, 0x21, 0x15, 0x31, 0x05,
+0x69, 0xF7, 0x60, 0xD2, 0x53, 0x09, 0x85, 0xB1, 0x80, 0x58, 0x85, 0xB9, 0x77, 0x20, 0x81, 0xF4,
+0xC1, 0x5B, 0x00, 0x08, 0xC2, 0xC5, 0x01, 0x0F, 0x5F, 0xC2, 0x0B, 0x00, 0x83, 0xC1, 0x0B, 0x24,
+0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0x0D, 0x94, 0x24, 0xF4, 0x27, 0x98, 0x2F, 0x98, 0x80, 0xE0,
+0x90, 0xE0, 0x20, 0xED, 0x37, 0xE0, 0xF9, 0x01, 0x31, 0x97, 0xF1, 0xF7, 0x01, 0x96, 0x84, 0x36,
+0x91, 0x05, 0xC9, 0xF7, 0x00, 0xC2, 0x57, 0x01, 0x8D, 0x7F, 0xC1, 0x4F, 0x10, 0x81, 0xE1, 0x80,
+0x93, 0x57, 0x00, 0xE8, 0x95, 0xEE, 0x27, 0xFF, 0x27, 0x09, 0x94, 0xFF, 0xCF, 0x90, 0xC2, 0x3B,
+0x22, 0x97, 0xFB, 0x09, 0x2E, 0x07, 0x26, 0x0A, 0xD0, 0x77, 0xFD, 0x04, 0xD0, 0x2E, 0xD0, 0x06,
+0xD0, 0x00, 0x20, 0x1A, 0xF4, 0x70, 0x95, 0x61, 0x95, 0x7F, 0x4F, 0x08, 0x95, 0xF6, 0xF7, 0x90,
+0x95, 0x81, 0x95, 0x9F, 0xC0, 0x09, 0x2F, 0xA1, 0xE2, 0x1A, 0x2E, 0xAA, 0x1B, 0xBB, 0x1B, 0xFD,
+0x01, 0x0D, 0xC0, 0xAA, 0x1F, 0xBB, 0x1F, 0xEE, 0x1F, 0xFF, 0x1F, 0xA2, 0x17, 0xB3, 0x07, 0xE4,
+0x07, 0xF5, 0x07, 0x20, 0xF0, 0xA2, 0x1B, 0xB3, 0x0B, 0xE4, 0x0B, 0xF5, 0x0B, 0x66, 0x1F, 0x77,
+0x1F, 0x88, 0x1F, 0x99, 0x1F, 0x1A, 0x94, 0xC0, 0xD3, 0x10, 0x95, 0x70, 0x95, 0x80, 0x95, 0x90,
+0x95, 0x9B, 0x01, 0xAC, 0x01, 0xBD, 0x01, 0xCF, 0x01, 0x08, 0x95, 0xC1, 0x3F, 0x02, 0x51, 0xE1,
+0x07, 0xC2, 0x3F, 0x09, 0xA6, 0x17, 0xB7, 0x07, 0x10, 0xF0, 0xA6, 0x1B, 0xB7, 0x0B, 0xC1, 0x2F,
+0x03, 0x5A, 0x95, 0xA9, 0xF7, 0xC1, 0x2B, 0x02, 0xBC, 0x01, 0xCD, 0xC0, 0x27, 0x11, 0xF9, 0x99,
+0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD, 0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5, 0x08, 0x95, 0x26, 0x2F,
+0xC1, 0x11, 0x01, 0x1F, 0xBA, 0xC1, 0x13, 0x10, 0x20, 0xBD, 0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A,
+0xF9, 0x9A, 0x0F, 0xBE, 0x01, 0x96, 0x08, 0x95, 0xF8, 0xC0, 0xC7,
+};  // end of atmega2560_bootloader_hex
@@ -1,384 +1,264 @@
 // Pinoccio Scout bootloader
 
-const byte atmega256rfr2_bootloader_hex[] PROGMEM = {
-  0x99, 0xc0, 0x00, 0x00, 0xbe, 0xc0, 0x00, 0x00, 0xbc, 0xc0, 0x00, 0x00,
-  0xba, 0xc0, 0x00, 0x00, 0xb8, 0xc0, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00,
-  0xb4, 0xc0, 0x00, 0x00, 0xb2, 0xc0, 0x00, 0x00, 0xb0, 0xc0, 0x00, 0x00,
-  0xae, 0xc0, 0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00,
-  0xa8, 0xc0, 0x00, 0x00, 0xa6, 0xc0, 0x00, 0x00, 0xa4, 0xc0, 0x00, 0x00,
-  0xa2, 0xc0, 0x00, 0x00, 0xa0, 0xc0, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00,
-  0x9c, 0xc0, 0x00, 0x00, 0x9a, 0xc0, 0x00, 0x00, 0x98, 0xc0, 0x00, 0x00,
-  0x96, 0xc0, 0x00, 0x00, 0x94, 0xc0, 0x00, 0x00, 0x92, 0xc0, 0x00, 0x00,
-  0x90, 0xc0, 0x00, 0x00, 0x8e, 0xc0, 0x00, 0x00, 0x8c, 0xc0, 0x00, 0x00,
-  0x8a, 0xc0, 0x00, 0x00, 0x88, 0xc0, 0x00, 0x00, 0x86, 0xc0, 0x00, 0x00,
-  0x84, 0xc0, 0x00, 0x00, 0x82, 0xc0, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x00,
-  0x7e, 0xc0, 0x00, 0x00, 0x7c, 0xc0, 0x00, 0x00, 0x7a, 0xc0, 0x00, 0x00,
-  0x78, 0xc0, 0x00, 0x00, 0x76, 0xc0, 0x00, 0x00, 0x74, 0xc0, 0x00, 0x00,
-  0x72, 0xc0, 0x00, 0x00, 0x97, 0xc0, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00,
-  0x6c, 0xc0, 0x00, 0x00, 0x6a, 0xc0, 0x00, 0x00, 0x68, 0xc0, 0x00, 0x00,
-  0x66, 0xc0, 0x00, 0x00, 0x64, 0xc0, 0x00, 0x00, 0x62, 0xc0, 0x00, 0x00,
-  0x60, 0xc0, 0x00, 0x00, 0x5e, 0xc0, 0x00, 0x00, 0x5c, 0xc0, 0x00, 0x00,
-  0x5a, 0xc0, 0x00, 0x00, 0x58, 0xc0, 0x00, 0x00, 0x56, 0xc0, 0x00, 0x00,
-  0x54, 0xc0, 0x00, 0x00, 0x52, 0xc0, 0x00, 0x00, 0x50, 0xc0, 0x00, 0x00,
-  0x4e, 0xc0, 0x00, 0x00, 0x4c, 0xc0, 0x00, 0x00, 0x4a, 0xc0, 0x00, 0x00,
-  0x48, 0xc0, 0x00, 0x00, 0x46, 0xc0, 0x00, 0x00, 0x44, 0xc0, 0x00, 0x00,
-  0x42, 0xc0, 0x00, 0x00, 0x40, 0xc0, 0x00, 0x00, 0x3e, 0xc0, 0x00, 0x00,
-  0x3c, 0xc0, 0x00, 0x00, 0x3a, 0xc0, 0x00, 0x00, 0x38, 0xc0, 0x00, 0x00,
-  0x36, 0xc0, 0x00, 0x00, 0x34, 0xc0, 0x00, 0x00, 0x32, 0xc0, 0x00, 0x00,
-  0x30, 0xc0, 0x00, 0x00, 0x2e, 0xc0, 0x00, 0x00, 0x2c, 0xc0, 0x00, 0x00,
-  0x2a, 0xc0, 0x00, 0x00, 0x28, 0xc0, 0x00, 0x00, 0x11, 0x24, 0x1f, 0xbe,
-  0xcf, 0xef, 0xd1, 0xe8, 0xde, 0xbf, 0xcd, 0xbf, 0x01, 0xe0, 0x0c, 0xbf,
-  0x12, 0xe0, 0xa0, 0xe0, 0xb2, 0xe0, 0xec, 0xe9, 0xf1, 0xef, 0x03, 0xe0,
-  0x0b, 0xbf, 0x02, 0xc0, 0x07, 0x90, 0x0d, 0x92, 0xac, 0x32, 0xb1, 0x07,
-  0xd9, 0xf7, 0x23, 0xe0, 0xac, 0xe2, 0xb2, 0xe0, 0x01, 0xc0, 0x1d, 0x92,
-  0xac, 0x3c, 0xb2, 0x07, 0xe1, 0xf7, 0x55, 0xd3, 0x0d, 0x94, 0xcc, 0xf8,
-  0x01, 0xe8, 0x0e, 0xbf, 0x0f, 0xef, 0x0d, 0xbf, 0x11, 0x24, 0x1f, 0xbe,
-  0x4c, 0xc3, 0x3e, 0xcf, 0x81, 0xe0, 0x85, 0xbf, 0x82, 0xe0, 0x85, 0xbf,
-  0x87, 0xb7, 0x80, 0x68, 0x87, 0xbf, 0x83, 0xb7, 0x81, 0x7f, 0x83, 0xbf,
-  0x83, 0xb7, 0x81, 0x60, 0x83, 0xbf, 0x78, 0x94, 0x88, 0x95, 0xf8, 0x94,
-  0x83, 0xb7, 0x8e, 0x7f, 0x83, 0xbf, 0x87, 0xb7, 0x8f, 0x77, 0x87, 0xbf,
-  0x81, 0xe0, 0x85, 0xbf, 0x15, 0xbe, 0x08, 0x95, 0x80, 0x93, 0xc6, 0x00,
-  0x80, 0x91, 0xc0, 0x00, 0x86, 0xff, 0xfc, 0xcf, 0x80, 0x91, 0xc0, 0x00,
-  0x80, 0x64, 0x80, 0x93, 0xc0, 0x00, 0x08, 0x95, 0x1f, 0x92, 0x0f, 0x92,
-  0x0f, 0xb6, 0x0f, 0x92, 0x11, 0x24, 0x0f, 0x90, 0x0f, 0xbe, 0x0f, 0x90,
-  0x1f, 0x90, 0x18, 0x95, 0x8f, 0x92, 0x9f, 0x92, 0xaf, 0x92, 0xbf, 0x92,
-  0xcf, 0x92, 0xdf, 0x92, 0xef, 0x92, 0xff, 0x92, 0x1f, 0x93, 0xcf, 0x93,
-  0xdf, 0x93, 0x23, 0xe0, 0xfb, 0x01, 0x80, 0x93, 0x5b, 0x00, 0x20, 0x93,
-  0x57, 0x00, 0xe8, 0x95, 0x07, 0xb6, 0x00, 0xfc, 0xfd, 0xcf, 0xe0, 0x91,
-  0x47, 0x02, 0x81, 0x2c, 0x91, 0x2c, 0x54, 0x01, 0x11, 0xe0, 0xe4, 0x01,
-  0xc9, 0x5b, 0xdd, 0x4f, 0x29, 0x81, 0x30, 0xe0, 0x32, 0x2f, 0x22, 0x27,
-  0x2e, 0x0f, 0x31, 0x1d, 0x75, 0x01, 0x64, 0x01, 0xc6, 0x0e, 0xd7, 0x1e,
-  0xe8, 0x1e, 0xf9, 0x1e, 0x09, 0x01, 0xf6, 0x01, 0xe0, 0x92, 0x5b, 0x00,
-  0x10, 0x93, 0x57, 0x00, 0xe8, 0x95, 0x11, 0x24, 0x2e, 0xef, 0x82, 0x16,
-  0x91, 0x04, 0xa1, 0x04, 0xb1, 0x04, 0x39, 0xf0, 0x22, 0xe0, 0x82, 0x0e,
-  0x91, 0x1c, 0xa1, 0x1c, 0xb1, 0x1c, 0xea, 0x81, 0xdc, 0xcf, 0x25, 0xe0,
-  0xfb, 0x01, 0x80, 0x93, 0x5b, 0x00, 0x20, 0x93, 0x57, 0x00, 0xe8, 0x95,
-  0x07, 0xb6, 0x00, 0xfc, 0xfd, 0xcf, 0xdf, 0x91, 0xcf, 0x91, 0x1f, 0x91,
-  0xff, 0x90, 0xef, 0x90, 0xdf, 0x90, 0xcf, 0x90, 0xbf, 0x90, 0xaf, 0x90,
-  0x9f, 0x90, 0x8f, 0x90, 0x08, 0x95, 0x8f, 0x92, 0x9f, 0x92, 0xaf, 0x92,
-  0xbf, 0x92, 0xcf, 0x92, 0xdf, 0x92, 0xef, 0x92, 0xff, 0x92, 0x0f, 0x93,
-  0x1f, 0x93, 0xcf, 0x93, 0xdf, 0x93, 0x94, 0xb1, 0x90, 0x67, 0x94, 0xb9,
-  0x95, 0xb1, 0x90, 0x67, 0x95, 0xb9, 0x2e, 0x98, 0xec, 0xe3, 0x8e, 0x2e,
-  0xe2, 0xe0, 0x9e, 0x2e, 0xf4, 0x01, 0x80, 0x83, 0xf2, 0xe3, 0xaf, 0x2e,
-  0xf2, 0xe0, 0xbf, 0x2e, 0xf5, 0x01, 0x71, 0x83, 0x60, 0x83, 0xc0, 0xe3,
-  0xd2, 0xe0, 0x59, 0x83, 0x48, 0x83, 0xe4, 0xe3, 0xf2, 0xe0, 0xc0, 0x82,
-  0xd1, 0x82, 0xe2, 0x82, 0xf3, 0x82, 0x04, 0x83, 0x15, 0x83, 0x26, 0x83,
-  0x37, 0x83, 0x80, 0xe0, 0xde, 0xd1, 0xe9, 0xe3, 0xf1, 0xe0, 0x80, 0x81,
-  0x8e, 0x7f, 0x80, 0x83, 0x80, 0x81, 0x8d, 0x7f, 0x80, 0x83, 0x80, 0x81,
-  0x81, 0x60, 0x80, 0x83, 0xee, 0xe4, 0xf1, 0xe0, 0x80, 0x81, 0x80, 0x93,
-  0x2c, 0x02, 0x10, 0x82, 0x63, 0xe0, 0x82, 0xe0, 0xcc, 0xd1, 0x60, 0xe2,
-  0x84, 0xe0, 0xc9, 0xd1, 0xf5, 0x01, 0x60, 0x81, 0xb1, 0x80, 0xe4, 0xe0,
-  0xf2, 0xe0, 0x60, 0x83, 0xb1, 0x82, 0x88, 0x81, 0x99, 0x81, 0x90, 0x93,
-  0x09, 0x02, 0x80, 0x93, 0x08, 0x02, 0x82, 0xe2, 0xba, 0xd1, 0x6b, 0x2d,
-  0x83, 0xe2, 0xb7, 0xd1, 0x68, 0x81, 0xd9, 0x80, 0x80, 0xe2, 0xb3, 0xd1,
-  0x6d, 0x2d, 0x81, 0xe2, 0xb0, 0xd1, 0xf4, 0x01, 0x60, 0x81, 0x88, 0xe0,
-  0xac, 0xd1, 0x68, 0x81, 0x8d, 0xe2, 0xa9, 0xd1, 0x66, 0xe1, 0x82, 0xe0,
-  0xa6, 0xd1, 0x68, 0xe0, 0x8f, 0xe0, 0xdf, 0x91, 0xcf, 0x91, 0x1f, 0x91,
-  0x0f, 0x91, 0xff, 0x90, 0xef, 0x90, 0xdf, 0x90, 0xcf, 0x90, 0xbf, 0x90,
-  0xaf, 0x90, 0x9f, 0x90, 0x8f, 0x90, 0x97, 0xc1, 0x8f, 0xe0, 0x9b, 0xd1,
-  0x83, 0xfb, 0x88, 0x27, 0x80, 0xf9, 0x08, 0x95, 0x8f, 0x92, 0x9f, 0x92,
-  0xaf, 0x92, 0xcf, 0x92, 0xdf, 0x92, 0xef, 0x92, 0xff, 0x92, 0x0f, 0x93,
-  0x1f, 0x93, 0xcf, 0x93, 0xdf, 0x93, 0xb0, 0xe1, 0xcb, 0x2e, 0xb7, 0xe2,
-  0xdb, 0x2e, 0xe1, 0x2c, 0xf1, 0x2c, 0xc0, 0xe0, 0xd1, 0xe0, 0x12, 0xe5,
-  0x81, 0x2e, 0x13, 0xe0, 0x91, 0x2e, 0x07, 0xe4, 0x12, 0xe0, 0xaa, 0x24,
-  0xaa, 0x94, 0x2e, 0x9a, 0xc1, 0x11, 0x1c, 0xc0, 0xdb, 0xdf, 0x81, 0x11,
-  0x15, 0xc0, 0xc1, 0x14, 0xd1, 0x04, 0xe1, 0x04, 0xf1, 0x04, 0x61, 0xf0,
-  0x8f, 0xe9, 0x9f, 0xe0, 0x01, 0x97, 0xf1, 0xf7, 0x00, 0xc0, 0x00, 0x00,
-  0x91, 0xe0, 0xc9, 0x1a, 0xd1, 0x08, 0xe1, 0x08, 0xf1, 0x08, 0xec, 0xcf,
-  0xcc, 0x24, 0xca, 0x94, 0xdc, 0x2c, 0x76, 0x01, 0xc3, 0xdf, 0x81, 0x11,
-  0x04, 0xc0, 0x48, 0xc1, 0xbf, 0xdf, 0x88, 0x23, 0xe9, 0xf3, 0x68, 0xe0,
-  0x8f, 0xe0, 0x51, 0xd1, 0x49, 0xec, 0x53, 0xe0, 0x6f, 0xe7, 0x87, 0xe4,
-  0x93, 0xe0, 0x7f, 0xd1, 0x2e, 0x98, 0x80, 0x91, 0x50, 0x03, 0x83, 0x32,
-  0x09, 0xf4, 0x22, 0xc1, 0xb0, 0xf4, 0x80, 0x32, 0x09, 0xf4, 0x8a, 0xc0,
-  0x18, 0xf4, 0x81, 0x30, 0xe9, 0xf0, 0x1f, 0xc1, 0x81, 0x32, 0x09, 0xf4,
-  0xf2, 0xc0, 0x82, 0x32, 0x09, 0xf0, 0x19, 0xc1, 0x10, 0x93, 0xcb, 0x03,
-  0x00, 0x93, 0xca, 0x03, 0x40, 0xe0, 0x51, 0xe0, 0x60, 0xe0, 0x70, 0xe0,
-  0x47, 0xc0, 0x85, 0x32, 0x09, 0xf4, 0x0a, 0xc1, 0x08, 0xf4, 0x3d, 0xc0,
-  0x86, 0x32, 0x09, 0xf4, 0x66, 0xc0, 0x87, 0x32, 0x09, 0xf0, 0x05, 0xc1,
-  0x0f, 0x94, 0x80, 0xfe, 0x80, 0x91, 0x40, 0x02, 0x81, 0x11, 0x0c, 0xc1,
-  0x80, 0x91, 0x4e, 0x03, 0x90, 0x91, 0x4f, 0x03, 0x90, 0x93, 0x07, 0x02,
-  0x80, 0x93, 0x06, 0x02, 0x80, 0x91, 0x03, 0x02, 0x8f, 0x5f, 0x80, 0x93,
-  0x03, 0x02, 0x80, 0x91, 0x2e, 0x02, 0x90, 0x91, 0x2f, 0x02, 0x90, 0x93,
-  0x0f, 0x02, 0x80, 0x93, 0x0e, 0x02, 0x69, 0xe1, 0x82, 0xe0, 0x05, 0xd1,
-  0x80, 0x91, 0x39, 0x01, 0x82, 0x60, 0x80, 0x93, 0x39, 0x01, 0x80, 0x91,
-  0x39, 0x01, 0x8d, 0x7f, 0x80, 0x93, 0x39, 0x01, 0x61, 0xe0, 0x72, 0xe0,
-  0x8a, 0xe2, 0x22, 0xd1, 0x8f, 0xe0, 0xfb, 0xd0, 0x86, 0xff, 0xfc, 0xcf,
-  0x60, 0xe4, 0x8f, 0xe0, 0xf0, 0xd0, 0x66, 0xe1, 0x82, 0xe0, 0xed, 0xd0,
-  0xdb, 0xc0, 0x80, 0x91, 0x51, 0x03, 0x80, 0x93, 0x00, 0x02, 0xd6, 0xc0,
-  0xe0, 0x91, 0xca, 0x03, 0xf0, 0x91, 0xcb, 0x03, 0xcf, 0x01, 0x01, 0x96,
-  0x90, 0x93, 0xcb, 0x03, 0x80, 0x93, 0xca, 0x03, 0xa0, 0x82, 0x41, 0x50,
-  0x51, 0x09, 0x61, 0x09, 0x71, 0x09, 0x41, 0x15, 0x51, 0x05, 0x61, 0x05,
-  0x71, 0x05, 0x61, 0xf7, 0x10, 0x92, 0x43, 0x02, 0x10, 0x92, 0x44, 0x02,
-  0x10, 0x92, 0x45, 0x02, 0x10, 0x92, 0x46, 0x02, 0x10, 0x92, 0x2f, 0x02,
-  0x10, 0x92, 0x2e, 0x02, 0x10, 0x92, 0x42, 0x02, 0x10, 0x92, 0x41, 0x02,
-  0x10, 0x92, 0x40, 0x02, 0xaf, 0xc0, 0x80, 0x91, 0x51, 0x03, 0x90, 0x91,
-  0x52, 0x03, 0xa0, 0x91, 0x53, 0x03, 0xb0, 0x91, 0x54, 0x03, 0x87, 0xc0,
-  0x80, 0x91, 0x51, 0x03, 0x80, 0x93, 0xc9, 0x03, 0x90, 0x92, 0xcb, 0x03,
-  0x80, 0x92, 0xca, 0x03, 0xe0, 0x91, 0xca, 0x03, 0xf0, 0x91, 0xcb, 0x03,
-  0x20, 0x81, 0x80, 0x91, 0x2e, 0x02, 0x90, 0x91, 0x2f, 0x02, 0x82, 0x27,
-  0x08, 0x2e, 0x82, 0x95, 0x80, 0x7f, 0x80, 0x25, 0x09, 0x2e, 0x98, 0x2f,
-  0x82, 0x95, 0x8f, 0x70, 0x08, 0x26, 0x86, 0x95, 0x98, 0x27, 0x89, 0x27,
-  0x88, 0x0f, 0x88, 0x0f, 0x88, 0x0f, 0x80, 0x25, 0x90, 0x93, 0x2f, 0x02,
-  0x80, 0x93, 0x2e, 0x02, 0x20, 0x91, 0x41, 0x02, 0x30, 0x91, 0x42, 0x02,
-  0xc9, 0x01, 0x01, 0x96, 0x90, 0x93, 0x42, 0x02, 0x80, 0x93, 0x41, 0x02,
-  0x40, 0x81, 0xf9, 0x01, 0xe9, 0x5b, 0xfd, 0x4f, 0x40, 0x83, 0x8f, 0x3f,
-  0x91, 0x05, 0x31, 0xf1, 0x28, 0xf1, 0x2e, 0x9a, 0x80, 0x91, 0x00, 0x02,
-  0x86, 0x34, 0x49, 0xf4, 0x60, 0x91, 0x43, 0x02, 0x70, 0x91, 0x44, 0x02,
-  0x80, 0x91, 0x45, 0x02, 0x90, 0x91, 0x46, 0x02, 0x0b, 0xde, 0x80, 0x91,
-  0x43, 0x02, 0x90, 0x91, 0x44, 0x02, 0xa0, 0x91, 0x45, 0x02, 0xb0, 0x91,
-  0x46, 0x02, 0x9f, 0x5f, 0xaf, 0x4f, 0xbf, 0x4f, 0x80, 0x93, 0x43, 0x02,
-  0x90, 0x93, 0x44, 0x02, 0xa0, 0x93, 0x45, 0x02, 0xb0, 0x93, 0x46, 0x02,
-  0x10, 0x92, 0x42, 0x02, 0x10, 0x92, 0x41, 0x02, 0x80, 0x91, 0xca, 0x03,
-  0x90, 0x91, 0xcb, 0x03, 0x01, 0x96, 0x90, 0x93, 0xcb, 0x03, 0x80, 0x93,
-  0xca, 0x03, 0x80, 0x91, 0xc9, 0x03, 0x81, 0x50, 0x80, 0x93, 0xc9, 0x03,
-  0x81, 0x11, 0x9a, 0xcf, 0x37, 0xc0, 0x80, 0x91, 0x00, 0x02, 0x86, 0x34,
-  0x49, 0xf4, 0x60, 0x91, 0x43, 0x02, 0x70, 0x91, 0x44, 0x02, 0x80, 0x91,
-  0x45, 0x02, 0x90, 0x91, 0x46, 0x02, 0xd6, 0xdd, 0x80, 0x91, 0x43, 0x02,
-  0x90, 0x91, 0x44, 0x02, 0xa0, 0x91, 0x45, 0x02, 0xb0, 0x91, 0x46, 0x02,
-  0x9f, 0x5f, 0xaf, 0x4f, 0xbf, 0x4f, 0x80, 0x93, 0x43, 0x02, 0x90, 0x93,
-  0x44, 0x02, 0xa0, 0x93, 0x45, 0x02, 0xb0, 0x93, 0x46, 0x02, 0x10, 0x92,
-  0x42, 0x02, 0x10, 0x92, 0x41, 0x02, 0x12, 0xc0, 0x2e, 0x9a, 0x12, 0xc0,
-  0xd0, 0x93, 0x40, 0x02, 0x0d, 0xc0, 0xc1, 0x11, 0x0b, 0xc0, 0xc1, 0x14,
-  0xd1, 0x04, 0xe1, 0x04, 0xf1, 0x04, 0x41, 0xf0, 0x81, 0xe0, 0xc8, 0x1a,
-  0xd1, 0x08, 0xe1, 0x08, 0xf1, 0x08, 0x9b, 0xce, 0xc1, 0xe0, 0x99, 0xce,
-  0x81, 0xe0, 0xdf, 0x91, 0xcf, 0x91, 0x1f, 0x91, 0x0f, 0x91, 0xff, 0x90,
-  0xef, 0x90, 0xdf, 0x90, 0xcf, 0x90, 0xaf, 0x90, 0x9f, 0x90, 0x8f, 0x90,
-  0x08, 0x95, 0x08, 0x95, 0x08, 0x95, 0xe8, 0x2f, 0xf0, 0xe0, 0xe0, 0x5c,
-  0xfe, 0x4f, 0x60, 0x83, 0x08, 0x95, 0xe8, 0x2f, 0xf0, 0xe0, 0xe0, 0x5c,
-  0xfe, 0x4f, 0x80, 0x81, 0x08, 0x95, 0xe8, 0x2f, 0xf0, 0xe0, 0xe0, 0x5c,
-  0xfe, 0x4f, 0x80, 0x81, 0x68, 0x23, 0x86, 0x2f, 0x90, 0xe0, 0x02, 0xc0,
-  0x95, 0x95, 0x87, 0x95, 0x4a, 0x95, 0xe2, 0xf7, 0x08, 0x95, 0xe8, 0x2f,
-  0xf0, 0xe0, 0xe0, 0x5c, 0xfe, 0x4f, 0x86, 0x2f, 0x80, 0x95, 0x90, 0x81,
-  0x89, 0x23, 0x04, 0x2e, 0x01, 0xc0, 0x22, 0x0f, 0x0a, 0x94, 0xea, 0xf7,
-  0x26, 0x23, 0x82, 0x2b, 0x80, 0x83, 0x08, 0x95, 0x87, 0xfd, 0x8f, 0xe7,
-  0x80, 0x93, 0x80, 0x01, 0x48, 0x2f, 0x50, 0xe0, 0x81, 0xe8, 0x91, 0xe0,
-  0x0d, 0xc5, 0xff, 0x92, 0x0f, 0x93, 0x1f, 0x93, 0xcf, 0x93, 0xdf, 0x93,
-  0x8a, 0x01, 0xf0, 0x90, 0x7b, 0x01, 0xf6, 0x16, 0x08, 0xf4, 0x6f, 0x2d,
-  0xc6, 0x2f, 0xd0, 0xe0, 0xae, 0x01, 0x60, 0xe8, 0x71, 0xe0, 0xfc, 0xd4,
-  0xc0, 0x58, 0xde, 0x4f, 0x88, 0x81, 0xf8, 0x01, 0x80, 0x83, 0x8f, 0x2d,
-  0xdf, 0x91, 0xcf, 0x91, 0x1f, 0x91, 0x0f, 0x91, 0xff, 0x90, 0x08, 0x95,
-  0xff, 0x92, 0x0f, 0x93, 0x1f, 0x93, 0xcf, 0x93, 0xdf, 0x93, 0x8c, 0x01,
-  0xf6, 0x2e, 0xea, 0x01, 0x20, 0x97, 0x49, 0xf0, 0x47, 0xe0, 0x60, 0xe8,
-  0x86, 0xe0, 0xad, 0xdf, 0x91, 0xe0, 0x81, 0x30, 0x09, 0xf0, 0x90, 0xe0,
-  0x98, 0x83, 0x40, 0xe0, 0x50, 0xe0, 0x6f, 0x2d, 0xc8, 0x01, 0xdf, 0x91,
-  0xcf, 0x91, 0x1f, 0x91, 0x0f, 0x91, 0xff, 0x90, 0xc6, 0xcf, 0xdf, 0x92,
-  0xef, 0x92, 0xff, 0x92, 0x0f, 0x93, 0x1f, 0x93, 0xcf, 0x93, 0xdf, 0x93,
-  0x8c, 0x01, 0xd6, 0x2e, 0x7a, 0x01, 0xe9, 0x01, 0x20, 0x97, 0x49, 0xf0,
-  0x47, 0xe0, 0x60, 0xe8, 0x86, 0xe0, 0x8d, 0xdf, 0x91, 0xe0, 0x81, 0x30,
-  0x09, 0xf0, 0x90, 0xe0, 0x98, 0x83, 0xa7, 0x01, 0x6d, 0x2d, 0xc8, 0x01,
-  0xdf, 0x91, 0xcf, 0x91, 0x1f, 0x91, 0x0f, 0x91, 0xff, 0x90, 0xef, 0x90,
-  0xdf, 0x90, 0xa5, 0xcf, 0x80, 0x91, 0x7b, 0x01, 0x08, 0x95, 0xfa, 0x01,
-  0x28, 0x2f, 0x30, 0xe0, 0xd9, 0x01, 0xa6, 0x0f, 0xb1, 0x1d, 0xa0, 0x38,
-  0xb1, 0x05, 0x14, 0xf0, 0x6f, 0xe7, 0x68, 0x1b, 0x46, 0x2f, 0x50, 0xe0,
-  0xbf, 0x01, 0xc9, 0x01, 0x80, 0x58, 0x9e, 0x4f, 0x9d, 0xc4, 0x78, 0x2f,
-  0xca, 0x01, 0x27, 0x2f, 0x30, 0xe0, 0xf9, 0x01, 0xe6, 0x0f, 0xf1, 0x1d,
-  0xe0, 0x38, 0xf1, 0x05, 0x14, 0xf0, 0x6f, 0xe7, 0x67, 0x1b, 0x46, 0x2f,
-  0x50, 0xe0, 0xb9, 0x01, 0x60, 0x58, 0x7e, 0x4f, 0x8b, 0xc4, 0xcf, 0x93,
-  0xdf, 0x93, 0xcd, 0xb7, 0xde, 0xb7, 0xcb, 0x52, 0xd1, 0x40, 0x0f, 0xb6,
-  0xf8, 0x94, 0xde, 0xbf, 0x0f, 0xbe, 0xcd, 0xbf, 0x01, 0xe8, 0x0e, 0xbf,
-  0x0f, 0xef, 0x0d, 0xbf, 0x84, 0xb7, 0x8e, 0xbb, 0xf3, 0x9b, 0x10, 0xc0,
-  0x8d, 0xeb, 0x9f, 0xe1, 0x7e, 0xd4, 0x81, 0x11, 0x0b, 0xc0, 0x6f, 0xef,
-  0x8d, 0xeb, 0x9f, 0xe1, 0x85, 0xd4, 0x21, 0xe0, 0xce, 0x5d, 0xde, 0x4f,
-  0x28, 0x83, 0xc2, 0x52, 0xd1, 0x40, 0x05, 0xc0, 0xce, 0x5d, 0xde, 0x4f,
-  0x18, 0x82, 0xc2, 0x52, 0xd1, 0x40, 0xf8, 0x94, 0xa8, 0x95, 0x14, 0xbe,
-  0x80, 0x91, 0x60, 0x00, 0x88, 0x61, 0x80, 0x93, 0x60, 0x00, 0x10, 0x92,
-  0x60, 0x00, 0x78, 0x94, 0x84, 0xb1, 0x80, 0x67, 0x84, 0xb9, 0x85, 0xb1,
-  0x80, 0x67, 0x85, 0xb9, 0x80, 0x91, 0x80, 0x00, 0x81, 0x68, 0x80, 0x93,
-  0x80, 0x00, 0x80, 0x91, 0x81, 0x00, 0x89, 0x60, 0x80, 0x93, 0x81, 0x00,
-  0x80, 0x91, 0x80, 0x00, 0x80, 0x62, 0x80, 0x93, 0x80, 0x00, 0x80, 0x91,
-  0xb0, 0x00, 0x83, 0x68, 0x80, 0x93, 0xb0, 0x00, 0x80, 0x91, 0xb1, 0x00,
-  0x81, 0x60, 0x80, 0x93, 0xb1, 0x00, 0x8f, 0xeb, 0x9f, 0xe1, 0x3f, 0xd4,
-  0x80, 0x93, 0xc7, 0x03, 0x80, 0xec, 0x9f, 0xe1, 0x3a, 0xd4, 0x80, 0x93,
-  0xc6, 0x03, 0x81, 0xec, 0x9f, 0xe1, 0x35, 0xd4, 0x80, 0x93, 0xc8, 0x03,
-  0x80, 0x91, 0xc7, 0x03, 0x81, 0x11, 0x0f, 0xc0, 0x80, 0x91, 0xc6, 0x03,
-  0x81, 0x11, 0x0b, 0xc0, 0x80, 0x91, 0xc8, 0x03, 0x81, 0x11, 0x07, 0xc0,
-  0x10, 0x92, 0xc7, 0x03, 0x8f, 0xef, 0x80, 0x93, 0xc6, 0x03, 0x10, 0x92,
-  0xc8, 0x03, 0x20, 0x91, 0xc7, 0x03, 0x8f, 0xef, 0x90, 0xe0, 0xac, 0x01,
-  0x42, 0x1b, 0x51, 0x09, 0x50, 0x93, 0x89, 0x00, 0x40, 0x93, 0x88, 0x00,
-  0x20, 0x91, 0xc6, 0x03, 0x82, 0x1b, 0x91, 0x09, 0x90, 0x93, 0x8b, 0x00,
-  0x80, 0x93, 0x8a, 0x00, 0x80, 0x91, 0xc8, 0x03, 0x80, 0x95, 0x80, 0x93,
-  0xb3, 0x00, 0x80, 0x91, 0xc0, 0x00, 0x82, 0x60, 0x80, 0x93, 0xc0, 0x00,
-  0x80, 0xe1, 0x80, 0x93, 0xc4, 0x00, 0x88, 0xe1, 0x80, 0x93, 0xc1, 0x00,
-  0x00, 0x00, 0x41, 0x2c, 0x51, 0x2c, 0x32, 0x01, 0xcd, 0x5d, 0xde, 0x4f,
-  0x18, 0x82, 0xc3, 0x52, 0xd1, 0x40, 0xcf, 0x5d, 0xde, 0x4f, 0x18, 0x82,
-  0xc1, 0x52, 0xd1, 0x40, 0xc2, 0x5e, 0xde, 0x4f, 0x18, 0x82, 0xce, 0x51,
-  0xd1, 0x40, 0x31, 0x2c, 0xc1, 0x5e, 0xde, 0x4f, 0x19, 0x82, 0x18, 0x82,
-  0xcf, 0x51, 0xd1, 0x40, 0x81, 0x2c, 0x91, 0x2c, 0x54, 0x01, 0xce, 0x5d,
-  0xde, 0x4f, 0x58, 0x81, 0xc2, 0x52, 0xd1, 0x40, 0x51, 0x11, 0x0c, 0xc0,
-  0x21, 0x2c, 0x00, 0xe0, 0x10, 0xe0, 0x41, 0x2c, 0x51, 0x2c, 0x32, 0x01,
-  0xcf, 0x5d, 0xde, 0x4f, 0x18, 0x82, 0xc1, 0x52, 0xd1, 0x40, 0x04, 0xc0,
-  0x22, 0x24, 0x23, 0x94, 0x02, 0xe0, 0x10, 0xe0, 0xee, 0x24, 0xea, 0x94,
-  0xf1, 0x2c, 0xdd, 0x24, 0xda, 0x94, 0x01, 0x15, 0x11, 0x05, 0x09, 0xf0,
-  0x58, 0xc0, 0x80, 0x91, 0xc0, 0x00, 0x87, 0xfd, 0x51, 0xc0, 0x01, 0x15,
-  0x11, 0x05, 0x09, 0xf0, 0x4d, 0xc0, 0x65, 0xe0, 0x6a, 0x95, 0xf1, 0xf7,
-  0x00, 0x00, 0x7f, 0xef, 0x47, 0x1a, 0x57, 0x0a, 0x67, 0x0a, 0x77, 0x0a,
-  0x81, 0xe1, 0x48, 0x16, 0x87, 0xe2, 0x58, 0x06, 0x61, 0x04, 0x71, 0x04,
-  0x20, 0xf0, 0x22, 0x24, 0x23, 0x94, 0x01, 0xe0, 0x10, 0xe0, 0xc3, 0x01,
-  0xb2, 0x01, 0x27, 0xec, 0x3b, 0xe1, 0x40, 0xe0, 0x50, 0xe0, 0x72, 0xd3,
-  0x67, 0x2b, 0x68, 0x2b, 0x69, 0x2b, 0xc9, 0xf6, 0x90, 0x91, 0x2d, 0x02,
-  0x81, 0xe0, 0x91, 0x11, 0x80, 0xe0, 0x80, 0x93, 0x2d, 0x02, 0x80, 0x91,
-  0x2d, 0x02, 0x88, 0x23, 0xc1, 0xf0, 0x80, 0x91, 0xc7, 0x03, 0xd7, 0x01,
-  0xa8, 0x1b, 0xb1, 0x09, 0xb0, 0x93, 0x89, 0x00, 0xa0, 0x93, 0x88, 0x00,
-  0x80, 0x91, 0xc6, 0x03, 0xf7, 0x01, 0xe8, 0x1b, 0xf1, 0x09, 0xf0, 0x93,
-  0x8b, 0x00, 0xe0, 0x93, 0x8a, 0x00, 0x80, 0x91, 0xc8, 0x03, 0x80, 0x95,
-  0x80, 0x93, 0xb3, 0x00, 0xb6, 0xcf, 0xf0, 0x92, 0x89, 0x00, 0xe0, 0x92,
-  0x88, 0x00, 0xf0, 0x92, 0x8b, 0x00, 0xe0, 0x92, 0x8a, 0x00, 0xd0, 0x92,
-  0xb3, 0x00, 0xab, 0xcf, 0x0f, 0x5f, 0x1f, 0x4f, 0xa4, 0xcf, 0x01, 0x30,
-  0x11, 0x05, 0x59, 0xf4, 0xcf, 0x5d, 0xde, 0x4f, 0xf8, 0x81, 0xc1, 0x52,
-  0xd1, 0x40, 0xf1, 0x11, 0x54, 0xc0, 0x22, 0x20, 0x09, 0xf4, 0x8b, 0xc0,
-  0x50, 0xc0, 0xce, 0x5d, 0xde, 0x4f, 0xf8, 0x80, 0xc2, 0x52, 0xd1, 0x40,
-  0xff, 0x20, 0x09, 0xf4, 0x48, 0xc0, 0x10, 0x92, 0x80, 0x00, 0x10, 0x92,
-  0x81, 0x00, 0x10, 0x92, 0xb0, 0x00, 0x10, 0x92, 0xb1, 0x00, 0x85, 0xb1,
-  0x80, 0x67, 0x85, 0xb9, 0x86, 0xef, 0x9f, 0xe1, 0x4c, 0xd3, 0xac, 0x01,
-  0x84, 0xef, 0x9f, 0xe1, 0xc6, 0x5d, 0xde, 0x4f, 0x48, 0x83, 0xca, 0x52,
-  0xd1, 0x40, 0xc5, 0x5d, 0xde, 0x4f, 0x58, 0x83, 0xcb, 0x52, 0xd1, 0x40,
-  0x3e, 0xd3, 0xbc, 0x01, 0x83, 0xef, 0x9f, 0xe1, 0xc8, 0x5d, 0xde, 0x4f,
-  0x68, 0x83, 0xc8, 0x52, 0xd1, 0x40, 0xc7, 0x5d, 0xde, 0x4f, 0x78, 0x83,
-  0xc9, 0x52, 0xd1, 0x40, 0x28, 0xd3, 0xc1, 0x2c, 0xd1, 0x2c, 0xe1, 0x2c,
-  0xf1, 0x2c, 0x00, 0xe0, 0x10, 0xe0, 0x20, 0xe0, 0x30, 0xe0, 0xc6, 0x5d,
-  0xde, 0x4f, 0x48, 0x81, 0xca, 0x52, 0xd1, 0x40, 0xc5, 0x5d, 0xde, 0x4f,
-  0x58, 0x81, 0xcb, 0x52, 0xd1, 0x40, 0xc8, 0x5d, 0xde, 0x4f, 0x68, 0x81,
-  0xc8, 0x52, 0xd1, 0x40, 0xc7, 0x5d, 0xde, 0x4f, 0x78, 0x81, 0xc9, 0x52,
-  0xd1, 0x40, 0xb1, 0xdb, 0x2f, 0xdc, 0x81, 0xe1, 0x80, 0x93, 0x57, 0x00,
-  0xe8, 0x95, 0x80, 0xe0, 0x90, 0xe0, 0xdc, 0x01, 0xab, 0xbf, 0xfc, 0x01,
-  0x87, 0x91, 0x96, 0x91, 0xcf, 0x5d, 0xde, 0x4f, 0x28, 0x81, 0xc1, 0x52,
-  0xd1, 0x40, 0x21, 0x11, 0x06, 0xc0, 0x22, 0x20, 0x09, 0xf4, 0x15, 0xcf,
-  0x01, 0x96, 0x09, 0xf4, 0x12, 0xcf, 0x84, 0xb1, 0x8f, 0x78, 0x84, 0xb9,
-  0x85, 0xb1, 0x8f, 0x78, 0x85, 0xb9, 0x10, 0x92, 0x80, 0x00, 0x10, 0x92,
-  0x81, 0x00, 0x10, 0x92, 0xb0, 0x00, 0x10, 0x92, 0xb1, 0x00, 0x00, 0x00,
-  0x80, 0x91, 0xc0, 0x00, 0x8d, 0x7f, 0x80, 0x93, 0xc0, 0x00, 0x10, 0x92,
-  0x80, 0x00, 0x10, 0x92, 0x81, 0x00, 0x10, 0x92, 0xb0, 0x00, 0x10, 0x92,
-  0xb1, 0x00, 0x85, 0xb1, 0x80, 0x67, 0x85, 0xb9, 0x0c, 0x94, 0x00, 0x00,
-  0xf0, 0xce, 0x40, 0xe0, 0x20, 0xe0, 0x30, 0xe0, 0x01, 0x30, 0x11, 0x05,
-  0x99, 0xf0, 0x81, 0xe0, 0x92, 0xe1, 0xaa, 0xe7, 0xb0, 0xe0, 0x50, 0x91,
-  0xc0, 0x00, 0x57, 0xfd, 0x0b, 0xc0, 0x01, 0x97, 0xa1, 0x09, 0xb1, 0x09,
-  0x00, 0x97, 0xa1, 0x05, 0xb1, 0x05, 0xa9, 0xf7, 0x22, 0x24, 0x23, 0x94,
-  0x50, 0xe0, 0x03, 0xc0, 0x50, 0x91, 0xc6, 0x00, 0x21, 0x2c, 0x43, 0x30,
-  0x91, 0xf1, 0x20, 0xf4, 0x41, 0x30, 0x01, 0xf1, 0x40, 0xf0, 0x26, 0xc0,
-  0x45, 0x30, 0xd9, 0xf1, 0x70, 0xf1, 0x46, 0x30, 0x09, 0xf4, 0x57, 0xc0,
-  0x59, 0xc0, 0x5b, 0x31, 0x09, 0xf4, 0x6a, 0xc2, 0xcd, 0x5d, 0xde, 0x4f,
-  0x88, 0x81, 0xc3, 0x52, 0xd1, 0x40, 0x8f, 0x5f, 0xcd, 0x5d, 0xde, 0x4f,
-  0xf8, 0x81, 0xc3, 0x52, 0xd1, 0x40, 0xcd, 0x5d, 0xde, 0x4f, 0x88, 0x83,
-  0xc3, 0x52, 0xd1, 0x40, 0xf6, 0x30, 0x08, 0xf0, 0x4a, 0xc0, 0x44, 0xc0,
-  0x35, 0x26, 0xc2, 0x5e, 0xde, 0x4f, 0x58, 0x83, 0xce, 0x51, 0xd1, 0x40,
-  0x42, 0xe0, 0x3c, 0xc0, 0x25, 0x2f, 0x30, 0xe0, 0x32, 0x2f, 0x22, 0x27,
-  0x35, 0x26, 0x43, 0xe0, 0x35, 0xc0, 0x25, 0x2b, 0x35, 0x26, 0x44, 0xe0,
-  0x31, 0xc0, 0x5e, 0x30, 0x09, 0xf0, 0x44, 0xc2, 0x35, 0x26, 0xc1, 0x5e,
-  0xde, 0x4f, 0x19, 0x82, 0x18, 0x82, 0xcf, 0x51, 0xd1, 0x40, 0x45, 0xe0,
-  0x25, 0xc0, 0xc1, 0x5e, 0xde, 0x4f, 0x88, 0x81, 0x99, 0x81, 0xcf, 0x51,
-  0xd1, 0x40, 0x01, 0x96, 0xe1, 0xe0, 0xf0, 0xe0, 0xec, 0x0f, 0xfd, 0x1f,
-  0xc1, 0x5e, 0xde, 0x4f, 0x68, 0x81, 0x79, 0x81, 0xcf, 0x51, 0xd1, 0x40,
-  0xe6, 0x0f, 0xf7, 0x1f, 0x50, 0x83, 0x35, 0x26, 0x82, 0x17, 0x93, 0x07,
-  0x09, 0xf4, 0x24, 0xc2, 0xc1, 0x5e, 0xde, 0x4f, 0x99, 0x83, 0x88, 0x83,
-  0xcf, 0x51, 0xd1, 0x40, 0x05, 0xc0, 0x53, 0x11, 0x19, 0xc2, 0x09, 0xc0,
-  0x47, 0x30, 0x39, 0xf0, 0x21, 0x10, 0x05, 0xc0, 0x00, 0xe0, 0x10, 0xe0,
-  0x79, 0xcf, 0x22, 0x24, 0x23, 0x94, 0x29, 0x81, 0x23, 0x31, 0x09, 0xf4,
-  0xc7, 0xc0, 0x60, 0xf5, 0x26, 0x30, 0x09, 0xf4, 0xb1, 0xc0, 0xf8, 0xf4,
-  0x22, 0x30, 0x09, 0xf4, 0x46, 0xc1, 0x23, 0x30, 0x09, 0xf4, 0x70, 0xc0,
-  0x21, 0x30, 0x09, 0xf0, 0x8e, 0xc1, 0x1a, 0x82, 0x88, 0xe0, 0x8b, 0x83,
-  0x81, 0xe4, 0x8c, 0x83, 0x86, 0xe5, 0x8d, 0x83, 0x82, 0xe5, 0x8e, 0x83,
-  0x89, 0xe4, 0x8f, 0x83, 0x83, 0xe5, 0x88, 0x87, 0x80, 0xe5, 0x89, 0x87,
-  0x8f, 0xe5, 0x8a, 0x87, 0x82, 0xe3, 0x8b, 0x87, 0x0b, 0xe0, 0x10, 0xe0,
-  0x7c, 0xc1, 0x21, 0x31, 0x09, 0xf4, 0x63, 0xc0, 0x08, 0xf0, 0x73, 0xc1,
-  0x20, 0x31, 0x09, 0xf4, 0x22, 0xc1, 0x6f, 0xc1, 0x28, 0x31, 0x09, 0xf4,
-  0x78, 0xc0, 0x48, 0xf4, 0x25, 0x31, 0x09, 0xf4, 0x93, 0xc0, 0x08, 0xf4,
-  0x1a, 0xc1, 0x26, 0x31, 0x09, 0xf4, 0x17, 0xc1, 0x62, 0xc1, 0x2b, 0x31,
-  0x09, 0xf4, 0x54, 0xc0, 0x2d, 0x31, 0x59, 0xf0, 0x2a, 0x31, 0x09, 0xf0,
-  0x5a, 0xc1, 0x1a, 0x82, 0x89, 0xe0, 0xe1, 0xe0, 0xf0, 0xe0, 0x80, 0x93,
-  0x57, 0x00, 0x84, 0x91, 0x59, 0xc0, 0x8d, 0x81, 0x80, 0x33, 0x39, 0xf4,
-  0x9f, 0x81, 0x99, 0x23, 0xe9, 0xf0, 0x91, 0x30, 0xe9, 0xf4, 0x98, 0xea,
-  0x1e, 0xc0, 0x98, 0x2f, 0x90, 0x75, 0xd1, 0xf0, 0x80, 0x35, 0x21, 0xf4,
-  0x99, 0xe0, 0xe0, 0xe0, 0xf0, 0xe0, 0x0c, 0xc0, 0x88, 0x35, 0x91, 0xf4,
-  0x9e, 0x81, 0x91, 0x11, 0x04, 0xc0, 0x99, 0xe0, 0xe1, 0xe0, 0xf0, 0xe0,
-  0x03, 0xc0, 0xe3, 0xe0, 0xf0, 0xe0, 0x99, 0xe0, 0x90, 0x93, 0x57, 0x00,
-  0x94, 0x91, 0x05, 0xc0, 0x9e, 0xe1, 0x03, 0xc0, 0x92, 0xe0, 0x01, 0xc0,
-  0x90, 0xe0, 0x1a, 0x82, 0x1b, 0x82, 0x8c, 0x83, 0x1d, 0x82, 0x9e, 0x83,
-  0x1f, 0x82, 0x07, 0xe0, 0x10, 0xe0, 0x25, 0xc1, 0xea, 0x81, 0xe0, 0x59,
-  0xe3, 0x30, 0x28, 0xf4, 0xf0, 0xe0, 0xe7, 0x5d, 0xfd, 0x4f, 0x80, 0x81,
-  0x01, 0xc0, 0x80, 0xe0, 0x1a, 0x82, 0x8b, 0x83, 0x03, 0xe0, 0x10, 0xe0,
-  0x16, 0xc1, 0xf1, 0xe0, 0xcf, 0x5d, 0xde, 0x4f, 0xf8, 0x83, 0xc1, 0x52,
-  0xd1, 0x40, 0xbd, 0xc0, 0x8d, 0x81, 0x88, 0x23, 0x21, 0xf0, 0x81, 0x30,
-  0x21, 0xf4, 0x88, 0xea, 0x0a, 0xc0, 0x8e, 0xe1, 0x08, 0xc0, 0x82, 0xe0,
-  0x06, 0xc0, 0x89, 0xe0, 0xe0, 0xe0, 0xf0, 0xe0, 0x80, 0x93, 0x57, 0x00,
-  0x84, 0x91, 0x1a, 0x82, 0x8b, 0x83, 0x1c, 0x82, 0x04, 0xe0, 0x10, 0xe0,
-  0xf8, 0xc0, 0x8b, 0x81, 0x80, 0x35, 0x31, 0xf4, 0x8c, 0x81, 0x88, 0x30,
-  0x71, 0xf7, 0xe2, 0xe0, 0xf0, 0xe0, 0x02, 0xc0, 0xe3, 0xe0, 0xf0, 0xe0,
-  0x89, 0xe0, 0xea, 0xcf, 0x8a, 0x81, 0x8b, 0x80, 0x91, 0x2c, 0xa1, 0x2c,
-  0xb1, 0x2c, 0x54, 0x01, 0x99, 0x24, 0x88, 0x24, 0xb8, 0x2a, 0x8d, 0x81,
-  0x88, 0x2a, 0x8c, 0x81, 0x98, 0x2a, 0x88, 0x0c, 0x99, 0x1c, 0xaa, 0x1c,
-  0xbb, 0x1c, 0x87, 0xc0, 0x0a, 0x81, 0x10, 0xe0, 0x10, 0x2f, 0x00, 0x27,
-  0x8b, 0x81, 0x08, 0x2b, 0x23, 0x31, 0x09, 0xf0, 0x4c, 0xc0, 0x00, 0xfd,
-  0xca, 0xc0, 0x81, 0x10, 0xc8, 0xc0, 0x01, 0x30, 0xf1, 0xe0, 0x1f, 0x07,
-  0x08, 0xf0, 0xc3, 0xc0, 0xd5, 0x01, 0xc4, 0x01, 0x80, 0x0f, 0x91, 0x1f,
-  0xa1, 0x1d, 0xb1, 0x1d, 0x81, 0x30, 0x90, 0x4e, 0xa3, 0x40, 0xb1, 0x05,
-  0x08, 0xf0, 0xb7, 0xc0, 0x83, 0xe0, 0xf4, 0x01, 0xa0, 0x92, 0x5b, 0x00,
-  0x80, 0x93, 0x57, 0x00, 0xe8, 0x95, 0x74, 0xd9, 0x2b, 0x85, 0xb5, 0x01,
-  0xa4, 0x01, 0xce, 0x01, 0x0b, 0x96, 0xdc, 0x01, 0x12, 0x96, 0xcd, 0x01,
-  0xfd, 0x01, 0x31, 0x97, 0xe0, 0x81, 0x30, 0xe0, 0x3e, 0x2b, 0xff, 0x24,
-  0xf3, 0x94, 0x09, 0x01, 0xfa, 0x01, 0x60, 0x93, 0x5b, 0x00, 0xf0, 0x92,
-  0x57, 0x00, 0xe8, 0x95, 0x11, 0x24, 0x4e, 0x5f, 0x5f, 0x4f, 0x6f, 0x4f,
-  0x7f, 0x4f, 0x02, 0x50, 0x11, 0x09, 0x01, 0x15, 0x11, 0x05, 0x11, 0xf0,
-  0x2c, 0x91, 0xe3, 0xcf, 0x85, 0xe0, 0xf4, 0x01, 0xa0, 0x92, 0x5b, 0x00,
-  0x80, 0x93, 0x57, 0x00, 0xe8, 0x95, 0x4a, 0xd9, 0x81, 0xe1, 0x80, 0x93,
-  0x57, 0x00, 0xe8, 0x95, 0x32, 0xc0, 0xa5, 0x01, 0x94, 0x01, 0x56, 0x95,
-  0x47, 0x95, 0x37, 0x95, 0x27, 0x95, 0xcc, 0x5d, 0xde, 0x4f, 0x28, 0x83,
-  0x39, 0x83, 0x4a, 0x83, 0x5b, 0x83, 0xc4, 0x52, 0xd1, 0x40, 0xae, 0x01,
-  0x45, 0x5f, 0x5f, 0x4f, 0x6a, 0x01, 0xe1, 0x2c, 0xf1, 0x2c, 0xe0, 0x16,
-  0xf1, 0x06, 0x81, 0xf0, 0xd6, 0x01, 0x6d, 0x91, 0x6d, 0x01, 0xcc, 0x5d,
-  0xde, 0x4f, 0x88, 0x81, 0x99, 0x81, 0xc4, 0x52, 0xd1, 0x40, 0x8e, 0x0d,
-  0x9f, 0x1d, 0x0e, 0xd1, 0xbf, 0xef, 0xeb, 0x1a, 0xfb, 0x0a, 0xed, 0xcf,
-  0xc7, 0x01, 0xa0, 0xe0, 0xb0, 0xe0, 0x88, 0x0f, 0x99, 0x1f, 0xaa, 0x1f,
-  0xbb, 0x1f, 0x88, 0x0e, 0x99, 0x1e, 0xaa, 0x1e, 0xbb, 0x1e, 0x1a, 0x82,
-  0x4e, 0xc0, 0x8a, 0x81, 0x90, 0xe0, 0x98, 0x2f, 0x88, 0x27, 0x3b, 0x81,
-  0x83, 0x2b, 0x8c, 0x01, 0x0d, 0x5f, 0x1f, 0x4f, 0x1a, 0x82, 0x24, 0x31,
-  0xa1, 0xf4, 0xde, 0x01, 0x13, 0x96, 0xab, 0xbe, 0xf4, 0x01, 0x27, 0x91,
-  0x36, 0x91, 0x2c, 0x93, 0x12, 0x96, 0xfd, 0x01, 0x31, 0x97, 0x30, 0x83,
-  0xe2, 0xe0, 0x8e, 0x0e, 0x91, 0x1c, 0xa1, 0x1c, 0xb1, 0x1c, 0x02, 0x97,
-  0x00, 0x97, 0x79, 0xf7, 0x2a, 0xc0, 0xfe, 0x01, 0x33, 0x96, 0x9c, 0x01,
-  0xb5, 0x01, 0xa4, 0x01, 0x41, 0xbd, 0xc5, 0x2e, 0xd6, 0x2e, 0xe7, 0x2e,
-  0xff, 0x24, 0xc2, 0xbc, 0x4f, 0x5f, 0x5f, 0x4f, 0x6f, 0x4f, 0x7f, 0x4f,
-  0xf8, 0x9a, 0xa0, 0xb5, 0xa1, 0x93, 0x21, 0x50, 0x31, 0x09, 0x21, 0x15,
-  0x31, 0x05, 0x71, 0xf7, 0xac, 0x01, 0x41, 0x50, 0x51, 0x09, 0x60, 0xe0,
-  0x70, 0xe0, 0x4f, 0x5f, 0x5f, 0x4f, 0x6f, 0x4f, 0x7f, 0x4f, 0x84, 0x0e,
-  0x95, 0x1e, 0xa6, 0x1e, 0xb7, 0x1e, 0xa3, 0xe0, 0xb0, 0xe0, 0xac, 0x0f,
-  0xbd, 0x1f, 0xa8, 0x0f, 0xb9, 0x1f, 0x1c, 0x92, 0x04, 0xc0, 0x80, 0xec,
-  0x8a, 0x83, 0x02, 0xe0, 0x10, 0xe0, 0x8b, 0xe1, 0xd9, 0xd8, 0xc2, 0x5e,
-  0xde, 0x4f, 0x88, 0x81, 0xce, 0x51, 0xd1, 0x40, 0xd3, 0xd8, 0x81, 0x2f,
-  0xd1, 0xd8, 0x80, 0x2f, 0xcf, 0xd8, 0x8e, 0xe0, 0xcd, 0xd8, 0x95, 0xe1,
-  0x39, 0x2e, 0xc2, 0x5e, 0xde, 0x4f, 0xf8, 0x81, 0xce, 0x51, 0xd1, 0x40,
-  0x3f, 0x26, 0x30, 0x26, 0x31, 0x26, 0x9e, 0x01, 0x2f, 0x5f, 0x3f, 0x4f,
-  0x79, 0x01, 0x02, 0x0f, 0x13, 0x1f, 0xe0, 0x16, 0xf1, 0x06, 0x39, 0xf0,
-  0xd7, 0x01, 0xdd, 0x90, 0x7d, 0x01, 0x8d, 0x2d, 0xb5, 0xd8, 0x3d, 0x24,
-  0xf6, 0xcf, 0x83, 0x2d, 0xb1, 0xd8, 0xc2, 0x5e, 0xde, 0x4f, 0xb8, 0x81,
-  0xce, 0x51, 0xd1, 0x40, 0xbf, 0x5f, 0xc2, 0x5e, 0xde, 0x4f, 0xb8, 0x83,
-  0xce, 0x51, 0xd1, 0x40, 0x90, 0x91, 0x2d, 0x02, 0x81, 0xe0, 0x91, 0x11,
-  0x80, 0xe0, 0x80, 0x93, 0x2d, 0x02, 0x80, 0x91, 0x2d, 0x02, 0x88, 0x23,
-  0xb9, 0xf0, 0x20, 0x91, 0xc7, 0x03, 0x8f, 0xef, 0x90, 0xe0, 0xfc, 0x01,
-  0xe2, 0x1b, 0xf1, 0x09, 0xf0, 0x93, 0x89, 0x00, 0xe0, 0x93, 0x88, 0x00,
-  0x20, 0x91, 0xc6, 0x03, 0x82, 0x1b, 0x91, 0x09, 0x90, 0x93, 0x8b, 0x00,
-  0x80, 0x93, 0x8a, 0x00, 0x80, 0x91, 0xc8, 0x03, 0x80, 0x95, 0x0b, 0xc0,
-  0x8f, 0xef, 0x90, 0xe0, 0x90, 0x93, 0x89, 0x00, 0x80, 0x93, 0x88, 0x00,
-  0x90, 0x93, 0x8b, 0x00, 0x80, 0x93, 0x8a, 0x00, 0x8f, 0xef, 0x80, 0x93,
-  0xb3, 0x00, 0x00, 0xe0, 0x10, 0xe0, 0xd4, 0xcc, 0x8b, 0xe1, 0x38, 0x2e,
-  0x41, 0xe0, 0xea, 0xcd, 0x40, 0xe0, 0xe8, 0xcd, 0xc1, 0x5e, 0xde, 0x4f,
-  0x39, 0x83, 0x28, 0x83, 0xcf, 0x51, 0xd1, 0x40, 0x46, 0xe0, 0xe0, 0xcd,
-  0xa1, 0xe2, 0x1a, 0x2e, 0xaa, 0x1b, 0xbb, 0x1b, 0xfd, 0x01, 0x0d, 0xc0,
-  0xaa, 0x1f, 0xbb, 0x1f, 0xee, 0x1f, 0xff, 0x1f, 0xa2, 0x17, 0xb3, 0x07,
-  0xe4, 0x07, 0xf5, 0x07, 0x20, 0xf0, 0xa2, 0x1b, 0xb3, 0x0b, 0xe4, 0x0b,
-  0xf5, 0x0b, 0x66, 0x1f, 0x77, 0x1f, 0x88, 0x1f, 0x99, 0x1f, 0x1a, 0x94,
-  0x69, 0xf7, 0x60, 0x95, 0x70, 0x95, 0x80, 0x95, 0x90, 0x95, 0x9b, 0x01,
-  0xac, 0x01, 0xbd, 0x01, 0xcf, 0x01, 0x08, 0x95, 0xfb, 0x01, 0xdc, 0x01,
-  0x02, 0xc0, 0x01, 0x90, 0x0d, 0x92, 0x41, 0x50, 0x50, 0x40, 0xd8, 0xf7,
-  0x08, 0x95, 0xf9, 0x99, 0xfe, 0xcf, 0x92, 0xbd, 0x81, 0xbd, 0xf8, 0x9a,
-  0x99, 0x27, 0x80, 0xb5, 0x08, 0x95, 0xa8, 0xe1, 0xb0, 0xe0, 0x42, 0xe0,
-  0x50, 0xe0, 0x10, 0xc0, 0x26, 0x2f, 0xf9, 0x99, 0xfe, 0xcf, 0x1f, 0xba,
-  0x92, 0xbd, 0x81, 0xbd, 0x20, 0xbd, 0x0f, 0xb6, 0xf8, 0x94, 0xfa, 0x9a,
-  0xf9, 0x9a, 0x0f, 0xbe, 0x01, 0x96, 0x08, 0x95, 0xdc, 0x01, 0xcb, 0x01,
-  0xfc, 0x01, 0xf9, 0x99, 0xfe, 0xcf, 0x06, 0xc0, 0xf2, 0xbd, 0xe1, 0xbd,
-  0xf8, 0x9a, 0x31, 0x96, 0x00, 0xb4, 0x0d, 0x92, 0x41, 0x50, 0x50, 0x40,
-  0xb8, 0xf7, 0x08, 0x95, 0xf8, 0x94, 0xff, 0xcf, 0x46, 0x41, 0x88, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x77, 0x69, 0x62, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x6e, 0x6f, 0x63, 0x63, 0x69, 0x6f,
-  0x00, 0x0f, 0x02, 0x0a
-};
+// Packed by convertHexToByteArray: 4116 bytes, 4552 unpacked
+const unsigned int atmega256rfr2_bootloader_hex_length = 4552;
+const byte atmega256rfr2_bootloader_hex [] PROGMEM = {
+0x04, 0x99, 0xC0, 0x00, 0x00, 0xBE, 0xC0, 0x03, 0x00, 0xBC, 0xC0, 0x03, 0x00, 0xBA, 0xC0, 0x03,
+0x00, 0xB8, 0xC0, 0x03, 0x00, 0xB6, 0xC0, 0x03, 0x00, 0xB4, 0xC0, 0x03, 0x00, 0xB2, 0xC0, 0x03,
+0x00, 0xB0, 0xC0, 0x03, 0x00, 0xAE, 0xC0, 0x03, 0x00, 0xAC, 0xC0, 0x03, 0x00, 0xAA, 0xC0, 0x03,
+0x00, 0xA8, 0xC0, 0x03, 0x00, 0xA6, 0xC0, 0x03, 0x00, 0xA4, 0xC0, 0x03, 0x00, 0xA2, 0xC0, 0x03,
+0x00, 0xA0, 0xC0, 0x03, 0x00, 0x9E, 0xC0, 0x03, 0x00, 0x9C, 0xC0, 0x03, 0x00, 0x9A, 0xC0, 0x03,
+0x00, 0x98, 0xC0, 0x03, 0x00, 0x96, 0xC0, 0x03, 0x00, 0x94, 0xC0, 0x03, 0x00, 0x92, 0xC0, 0x03,
+0x00, 0x90, 0xC0, 0x03, 0x00, 0x8E, 0xC0, 0x03, 0x00, 0x8C, 0xC0, 0x03, 0x00, 0x8A, 0xC0, 0x03,
+0x00, 0x88, 0xC0, 0x03, 0x00, 0x86, 0xC0, 0x03, 0x00, 0x84, 0xC0, 0x03, 0x00, 0x82, 0xC0, 0x03,
+0x00, 0x80, 0xC0, 0x03, 0x00, 0x7E, 0xC0, 0x03, 0x00, 0x7C, 0xC0, 0x03, 0x00, 0x7A, 0xC0, 0x03,
+0x00, 0x78, 0xC0, 0x03, 0x00, 0x76, 0xC0, 0x03, 0x00, 0x74, 0xC0, 0x03, 0x00, 0x72, 0xC0, 0x03,
+0x00, 0x97, 0xC0, 0x03, 0x00, 0x6E, 0xC0, 0x03, 0x00, 0x6C, 0xC0, 0x03, 0x00, 0x6A, 0xC0, 0x03,
+0x00, 0x68, 0xC0, 0x03, 0x00, 0x66, 0xC0, 0x03, 0x00, 0x64, 0xC0, 0x03, 0x00, 0x62, 0xC0, 0x03,
+0x00, 0x60, 0xC0, 0x03, 0x00, 0x5E, 0xC0, 0x03, 0x00, 0x5C, 0xC0, 0x03, 0x00, 0x5A, 0xC0, 0x03,
+0x00, 0x58, 0xC0, 0x03, 0x00, 0x56, 0xC0, 0x03, 0x00, 0x54, 0xC0, 0x03, 0x00, 0x52, 0xC0, 0x03,
+0x00, 0x50, 0xC0, 0x03, 0x00, 0x4E, 0xC0, 0x03, 0x00, 0x4C, 0xC0, 0x03, 0x00, 0x4A, 0xC0, 0x03,
+0x00, 0x48, 0xC0, 0x03, 0x00, 0x46, 0xC0, 0x03, 0x00, 0x44, 0xC0, 0x03, 0x00, 0x42, 0xC0, 0x03,
+0x00, 0x40, 0xC0, 0x03, 0x00, 0x3E, 0xC0, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0x3A, 0xC0, 0x03,
+0x00, 0x38, 0xC0, 0x03, 0x00, 0x36, 0xC0, 0x03, 0x00, 0x34, 0xC0, 0x03, 0x00, 0x32, 0xC0, 0x03,
+0x00, 0x30, 0xC0, 0x03, 0x00, 0x2E, 0xC0, 0x03, 0x00, 0x2C, 0xC0, 0x03, 0x00, 0x2A, 0xC0, 0x03,
+0x00, 0x28, 0xC0, 0x03, 0x47, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD1, 0xE8, 0xDE, 0xBF, 0xCD,
+0xBF, 0x01, 0xE0, 0x0C, 0xBF, 0x12, 0xE0, 0xA0, 0xE0, 0xB2, 0xE0, 0xEC, 0xE9, 0xF1, 0xEF, 0x03,
+0xE0, 0x0B, 0xBF, 0x02, 0xC0, 0x07, 0x90, 0x0D, 0x92, 0xAC, 0x32, 0xB1, 0x07, 0xD9, 0xF7, 0x23,
+0xE0, 0xAC, 0xE2, 0xB2, 0xE0, 0x01, 0xC0, 0x1D, 0x92, 0xAC, 0x3C, 0xB2, 0x07, 0xE1, 0xF7, 0x55,
+0xD3, 0x0D, 0x94, 0xCC, 0xF8, 0x01, 0xE8, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0xC1, 0x47, 0x08,
+0x4C, 0xC3, 0x3E, 0xCF, 0x81, 0xE0, 0x85, 0xBF, 0x82, 0xC0, 0x03, 0x0A, 0x87, 0xB7, 0x80, 0x68,
+0x87, 0xBF, 0x83, 0xB7, 0x81, 0x7F, 0x83, 0xC1, 0x05, 0x0B, 0x60, 0x83, 0xBF, 0x78, 0x94, 0x88,
+0x95, 0xF8, 0x94, 0x83, 0xB7, 0x8E, 0xC0, 0x11, 0x05, 0x87, 0xB7, 0x8F, 0x77, 0x87, 0xBF, 0xC1,
+0x2B, 0x0F, 0x15, 0xBE, 0x08, 0x95, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x86, 0xFF,
+0xFC, 0xCF, 0xC1, 0x07, 0x78, 0x80, 0x64, 0x80, 0x93, 0xC0, 0x00, 0x08, 0x95, 0x1F, 0x92, 0x0F,
+0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11, 0x24, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90, 0x18,
+0x95, 0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF,
+0x92, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0x23, 0xE0, 0xFB, 0x01, 0x80, 0x93, 0x5B, 0x00, 0x20,
+0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xE0, 0x91, 0x47, 0x02, 0x81,
+0x2C, 0x91, 0x2C, 0x54, 0x01, 0x11, 0xE0, 0xE4, 0x01, 0xC9, 0x5B, 0xDD, 0x4F, 0x29, 0x81, 0x30,
+0xE0, 0x32, 0x2F, 0x22, 0x27, 0x2E, 0x0F, 0x31, 0x1D, 0x75, 0x01, 0x64, 0x01, 0xC6, 0x0E, 0xD7,
+0x1E, 0xE8, 0x1E, 0xF9, 0x1E, 0x09, 0x01, 0xF6, 0x01, 0xE0, 0x92, 0x5B, 0x00, 0x10, 0xC2, 0x3D,
+0x1C, 0x11, 0x24, 0x2E, 0xEF, 0x82, 0x16, 0x91, 0x04, 0xA1, 0x04, 0xB1, 0x04, 0x39, 0xF0, 0x22,
+0xE0, 0x82, 0x0E, 0x91, 0x1C, 0xA1, 0x1C, 0xB1, 0x1C, 0xEA, 0x81, 0xDC, 0xCF, 0x25, 0xD0, 0x67,
+0x16, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xBF,
+0x90, 0xAF, 0x90, 0x9F, 0x90, 0x8F, 0x90, 0x08, 0xCE, 0xA9, 0x01, 0x0F, 0x93, 0xC3, 0xAB, 0x06,
+0x94, 0xB1, 0x90, 0x67, 0x94, 0xB9, 0x95, 0xC0, 0x05, 0x4A, 0x95, 0xB9, 0x2E, 0x98, 0xEC, 0xE3,
+0x8E, 0x2E, 0xE2, 0xE0, 0x9E, 0x2E, 0xF4, 0x01, 0x80, 0x83, 0xF2, 0xE3, 0xAF, 0x2E, 0xF2, 0xE0,
+0xBF, 0x2E, 0xF5, 0x01, 0x71, 0x83, 0x60, 0x83, 0xC0, 0xE3, 0xD2, 0xE0, 0x59, 0x83, 0x48, 0x83,
+0xE4, 0xE3, 0xF2, 0xE0, 0xC0, 0x82, 0xD1, 0x82, 0xE2, 0x82, 0xF3, 0x82, 0x04, 0x83, 0x15, 0x83,
+0x26, 0x83, 0x37, 0x83, 0x80, 0xE0, 0xDE, 0xD1, 0xE9, 0xE3, 0xF1, 0xE0, 0x80, 0x81, 0x8E, 0x7F,
+0x80, 0x83, 0x80, 0x81, 0x8D, 0xC2, 0x05, 0x05, 0x81, 0x60, 0x80, 0x83, 0xEE, 0xE4, 0xC1, 0x15,
+0x44, 0x80, 0x93, 0x2C, 0x02, 0x10, 0x82, 0x63, 0xE0, 0x82, 0xE0, 0xCC, 0xD1, 0x60, 0xE2, 0x84,
+0xE0, 0xC9, 0xD1, 0xF5, 0x01, 0x60, 0x81, 0xB1, 0x80, 0xE4, 0xE0, 0xF2, 0xE0, 0x60, 0x83, 0xB1,
+0x82, 0x88, 0x81, 0x99, 0x81, 0x90, 0x93, 0x09, 0x02, 0x80, 0x93, 0x08, 0x02, 0x82, 0xE2, 0xBA,
+0xD1, 0x6B, 0x2D, 0x83, 0xE2, 0xB7, 0xD1, 0x68, 0x81, 0xD9, 0x80, 0x80, 0xE2, 0xB3, 0xD1, 0x6D,
+0x2D, 0x81, 0xE2, 0xB0, 0xD1, 0xF4, 0xC0, 0x31, 0x02, 0x88, 0xE0, 0xAC, 0xC0, 0x15, 0x0D, 0x8D,
+0xE2, 0xA9, 0xD1, 0x66, 0xE1, 0x82, 0xE0, 0xA6, 0xD1, 0x68, 0xE0, 0x8F, 0xE0, 0xC3, 0xEF, 0x00,
+0x0F, 0xCE, 0xF1, 0x0B, 0x97, 0xC1, 0x8F, 0xE0, 0x9B, 0xD1, 0x83, 0xFB, 0x88, 0x27, 0x80, 0xF9,
+0xC5, 0xFD, 0xCD, 0xFB, 0x56, 0xB0, 0xE1, 0xCB, 0x2E, 0xB7, 0xE2, 0xDB, 0x2E, 0xE1, 0x2C, 0xF1,
+0x2C, 0xC0, 0xE0, 0xD1, 0xE0, 0x12, 0xE5, 0x81, 0x2E, 0x13, 0xE0, 0x91, 0x2E, 0x07, 0xE4, 0x12,
+0xE0, 0xAA, 0x24, 0xAA, 0x94, 0x2E, 0x9A, 0xC1, 0x11, 0x1C, 0xC0, 0xDB, 0xDF, 0x81, 0x11, 0x15,
+0xC0, 0xC1, 0x14, 0xD1, 0x04, 0xE1, 0x04, 0xF1, 0x04, 0x61, 0xF0, 0x8F, 0xE9, 0x9F, 0xE0, 0x01,
+0x97, 0xF1, 0xF7, 0x00, 0xC0, 0x00, 0x00, 0x91, 0xE0, 0xC9, 0x1A, 0xD1, 0x08, 0xE1, 0x08, 0xF1,
+0x08, 0xEC, 0xCF, 0xCC, 0x24, 0xCA, 0x94, 0xDC, 0x2C, 0x76, 0x01, 0xC3, 0xC0, 0x2F, 0x09, 0x04,
+0xC0, 0x48, 0xC1, 0xBF, 0xDF, 0x88, 0x23, 0xE9, 0xF3, 0xC1, 0xA3, 0x1C, 0x51, 0xD1, 0x49, 0xEC,
+0x53, 0xE0, 0x6F, 0xE7, 0x87, 0xE4, 0x93, 0xE0, 0x7F, 0xD1, 0x2E, 0x98, 0x80, 0x91, 0x50, 0x03,
+0x83, 0x32, 0x09, 0xF4, 0x22, 0xC1, 0xB0, 0xF4, 0x80, 0xC0, 0x07, 0x0A, 0x8A, 0xC0, 0x18, 0xF4,
+0x81, 0x30, 0xE9, 0xF0, 0x1F, 0xC1, 0x81, 0xC0, 0x0D, 0x1A, 0xF2, 0xC0, 0x82, 0x32, 0x09, 0xF0,
+0x19, 0xC1, 0x10, 0x93, 0xCB, 0x03, 0x00, 0x93, 0xCA, 0x03, 0x40, 0xE0, 0x51, 0xE0, 0x60, 0xE0,
+0x70, 0xE0, 0x47, 0xC0, 0x85, 0xC0, 0x1D, 0x06, 0x0A, 0xC1, 0x08, 0xF4, 0x3D, 0xC0, 0x86, 0xC0,
+0x09, 0x02, 0x66, 0xC0, 0x87, 0xC0, 0x27, 0x26, 0x05, 0xC1, 0x0F, 0x94, 0x80, 0xFE, 0x80, 0x91,
+0x40, 0x02, 0x81, 0x11, 0x0C, 0xC1, 0x80, 0x91, 0x4E, 0x03, 0x90, 0x91, 0x4F, 0x03, 0x90, 0x93,
+0x07, 0x02, 0x80, 0x93, 0x06, 0x02, 0x80, 0x91, 0x03, 0x02, 0x8F, 0x5F, 0x80, 0x93, 0x03, 0xC0,
+0x09, 0x08, 0x2E, 0x02, 0x90, 0x91, 0x2F, 0x02, 0x90, 0x93, 0x0F, 0xC0, 0x19, 0x11, 0x0E, 0x02,
+0x69, 0xE1, 0x82, 0xE0, 0x05, 0xD1, 0x80, 0x91, 0x39, 0x01, 0x82, 0x60, 0x80, 0x93, 0x39, 0x01,
+0xC1, 0x09, 0x01, 0x8D, 0x7F, 0xC1, 0x09, 0x16, 0x61, 0xE0, 0x72, 0xE0, 0x8A, 0xE2, 0x22, 0xD1,
+0x8F, 0xE0, 0xFB, 0xD0, 0x86, 0xFF, 0xFC, 0xCF, 0x60, 0xE4, 0x8F, 0xE0, 0xF0, 0xD0, 0x66, 0xC0,
+0x2F, 0x1A, 0xED, 0xD0, 0xDB, 0xC0, 0x80, 0x91, 0x51, 0x03, 0x80, 0x93, 0x00, 0x02, 0xD6, 0xC0,
+0xE0, 0x91, 0xCA, 0x03, 0xF0, 0x91, 0xCB, 0x03, 0xCF, 0x01, 0x01, 0x96, 0x90, 0xC0, 0xAB, 0x00,
+0x80, 0xC0, 0xAB, 0x1A, 0xA0, 0x82, 0x41, 0x50, 0x51, 0x09, 0x61, 0x09, 0x71, 0x09, 0x41, 0x15,
+0x51, 0x05, 0x61, 0x05, 0x71, 0x05, 0x61, 0xF7, 0x10, 0x92, 0x43, 0x02, 0x10, 0x92, 0x44, 0xC0,
+0x03, 0x00, 0x45, 0xC0, 0x03, 0x00, 0x46, 0xC0, 0x03, 0x00, 0x2F, 0xC0, 0x03, 0x00, 0x2E, 0xC0,
+0x03, 0x00, 0x42, 0xC0, 0x03, 0x00, 0x41, 0xC0, 0x03, 0x02, 0x40, 0x02, 0xAF, 0xC2, 0x57, 0x0C,
+0x90, 0x91, 0x52, 0x03, 0xA0, 0x91, 0x53, 0x03, 0xB0, 0x91, 0x54, 0x03, 0x87, 0xC4, 0x69, 0x03,
+0xC9, 0x03, 0x90, 0x92, 0xC0, 0x5B, 0x02, 0x92, 0xCA, 0x03, 0xC5, 0x6F, 0x01, 0x20, 0x81, 0xC5,
+0xCB, 0x1B, 0x82, 0x27, 0x08, 0x2E, 0x82, 0x95, 0x80, 0x7F, 0x80, 0x25, 0x09, 0x2E, 0x98, 0x2F,
+0x82, 0x95, 0x8F, 0x70, 0x08, 0x26, 0x86, 0x95, 0x98, 0x27, 0x89, 0x27, 0x88, 0x0F, 0xC1, 0x01,
+0x04, 0x80, 0x25, 0x90, 0x93, 0x2F, 0xC0, 0xED, 0x0A, 0x2E, 0x02, 0x20, 0x91, 0x41, 0x02, 0x30,
+0x91, 0x42, 0x02, 0xC9, 0xC2, 0xAB, 0x00, 0x42, 0xC0, 0x13, 0x28, 0x41, 0x02, 0x40, 0x81, 0xF9,
+0x01, 0xE9, 0x5B, 0xFD, 0x4F, 0x40, 0x83, 0x8F, 0x3F, 0x91, 0x05, 0x31, 0xF1, 0x28, 0xF1, 0x2E,
+0x9A, 0x80, 0x91, 0x00, 0x02, 0x86, 0x34, 0x49, 0xF4, 0x60, 0x91, 0x43, 0x02, 0x70, 0x91, 0x44,
+0x02, 0x80, 0x91, 0x45, 0xC0, 0x69, 0x04, 0x46, 0x02, 0x0B, 0xDE, 0x80, 0xC0, 0x11, 0x00, 0x90,
+0xC0, 0x11, 0x00, 0xA0, 0xC0, 0x11, 0x00, 0xB0, 0xC0, 0x11, 0x07, 0x9F, 0x5F, 0xAF, 0x4F, 0xBF,
+0x4F, 0x80, 0x93, 0xC0, 0x15, 0x00, 0x93, 0xC0, 0x15, 0x00, 0x93, 0xC0, 0x15, 0x00, 0x93, 0xC1,
+0xDB, 0xC3, 0xD3, 0x00, 0x80, 0xC0, 0xAB, 0x00, 0x90, 0xC0, 0xAB, 0xC1, 0x6D, 0xC0, 0xBD, 0x08,
+0x93, 0xCA, 0x03, 0x80, 0x91, 0xC9, 0x03, 0x81, 0x50, 0xC1, 0xCF, 0x04, 0x81, 0x11, 0x9A, 0xCF,
+0x37, 0xC0, 0xDD, 0xD3, 0x69, 0x01, 0xD6, 0xDD, 0xEB, 0x69, 0x43, 0x12, 0xC0, 0x2E, 0x9A, 0x12,
+0xC0, 0xD0, 0x93, 0x40, 0x02, 0x0D, 0xC0, 0xC1, 0x11, 0x0B, 0xC0, 0xC1, 0x14, 0xD1, 0x04, 0xE1,
+0x04, 0xF1, 0x04, 0x41, 0xF0, 0x81, 0xE0, 0xC8, 0x1A, 0xD1, 0x08, 0xE1, 0x08, 0xF1, 0x08, 0x9B,
+0xCE, 0xC1, 0xE0, 0x99, 0xCE, 0x81, 0xE0, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x0F, 0x91, 0xFF,
+0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xAF, 0x90, 0x9F, 0x90, 0x8F, 0x90, 0x08, 0x95, 0xC1,
+0x01, 0x09, 0xE8, 0x2F, 0xF0, 0xE0, 0xE0, 0x5C, 0xFE, 0x4F, 0x60, 0x83, 0xC7, 0x0B, 0x01, 0x80,
+0x81, 0xC9, 0x0B, 0x0F, 0x68, 0x23, 0x86, 0x2F, 0x90, 0xE0, 0x02, 0xC0, 0x95, 0x95, 0x87, 0x95,
+0x4A, 0x95, 0xE2, 0xF7, 0xC7, 0x1B, 0x16, 0x86, 0x2F, 0x80, 0x95, 0x90, 0x81, 0x89, 0x23, 0x04,
+0x2E, 0x01, 0xC0, 0x22, 0x0F, 0x0A, 0x94, 0xEA, 0xF7, 0x26, 0x23, 0x82, 0x2B, 0x80, 0xC0, 0x49,
+0x3F, 0x87, 0xFD, 0x8F, 0xE7, 0x80, 0x93, 0x80, 0x01, 0x48, 0x2F, 0x50, 0xE0, 0x81, 0xE8, 0x91,
+0xE0, 0x0D, 0xC5, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0x8A, 0x01, 0xF0,
+0x90, 0x7B, 0x01, 0xF6, 0x16, 0x08, 0xF4, 0x6F, 0x2D, 0xC6, 0x2F, 0xD0, 0xE0, 0xAE, 0x01, 0x60,
+0xE8, 0x71, 0xE0, 0xFC, 0xD4, 0xC0, 0x58, 0xDE, 0x4F, 0x88, 0x81, 0xF8, 0x01, 0x80, 0x83, 0x8F,
+0x2D, 0xC7, 0xB1, 0x01, 0x08, 0x95, 0xC7, 0x39, 0x23, 0x8C, 0x01, 0xF6, 0x2E, 0xEA, 0x01, 0x20,
+0x97, 0x49, 0xF0, 0x47, 0xE0, 0x60, 0xE8, 0x86, 0xE0, 0xAD, 0xDF, 0x91, 0xE0, 0x81, 0x30, 0x09,
+0xF0, 0x90, 0xE0, 0x98, 0x83, 0x40, 0xE0, 0x50, 0xE0, 0x6F, 0x2D, 0xC8, 0x01, 0xC7, 0x39, 0x05,
+0xC6, 0xCF, 0xDF, 0x92, 0xEF, 0x92, 0xC9, 0x3D, 0x04, 0xD6, 0x2E, 0x7A, 0x01, 0xE9, 0xC8, 0x3F,
+0x00, 0x8D, 0xC8, 0x3F, 0x02, 0xA7, 0x01, 0x6D, 0xCA, 0x3D, 0x22, 0xEF, 0x90, 0xDF, 0x90, 0xA5,
+0xCF, 0x80, 0x91, 0x7B, 0x01, 0x08, 0x95, 0xFA, 0x01, 0x28, 0x2F, 0x30, 0xE0, 0xD9, 0x01, 0xA6,
+0x0F, 0xB1, 0x1D, 0xA0, 0x38, 0xB1, 0x05, 0x14, 0xF0, 0x6F, 0xE7, 0x68, 0x1B, 0x46, 0xC0, 0xDB,
+0x0E, 0xBF, 0x01, 0xC9, 0x01, 0x80, 0x58, 0x9E, 0x4F, 0x9D, 0xC4, 0x78, 0x2F, 0xCA, 0x01, 0x27,
+0xC0, 0x25, 0x08, 0xF9, 0x01, 0xE6, 0x0F, 0xF1, 0x1D, 0xE0, 0x38, 0xF1, 0xC2, 0x25, 0x00, 0x67,
+0xC2, 0x25, 0x07, 0xB9, 0x01, 0x60, 0x58, 0x7E, 0x4F, 0x8B, 0xC4, 0xC1, 0x85, 0x2D, 0xCD, 0xB7,
+0xDE, 0xB7, 0xCB, 0x52, 0xD1, 0x40, 0x0F, 0xB6, 0xF8, 0x94, 0xDE, 0xBF, 0x0F, 0xBE, 0xCD, 0xBF,
+0x01, 0xE8, 0x0E, 0xBF, 0x0F, 0xEF, 0x0D, 0xBF, 0x84, 0xB7, 0x8E, 0xBB, 0xF3, 0x9B, 0x10, 0xC0,
+0x8D, 0xEB, 0x9F, 0xE1, 0x7E, 0xD4, 0x81, 0x11, 0x0B, 0xC0, 0x6F, 0xEF, 0xC1, 0x0B, 0x0A, 0x85,
+0xD4, 0x21, 0xE0, 0xCE, 0x5D, 0xDE, 0x4F, 0x28, 0x83, 0xC2, 0xC0, 0x37, 0x01, 0x05, 0xC0, 0xC1,
+0x0B, 0x01, 0x18, 0x82, 0xC1, 0x0B, 0x1C, 0xF8, 0x94, 0xA8, 0x95, 0x14, 0xBE, 0x80, 0x91, 0x60,
+0x00, 0x88, 0x61, 0x80, 0x93, 0x60, 0x00, 0x10, 0x92, 0x60, 0x00, 0x78, 0x94, 0x84, 0xB1, 0x80,
+0x67, 0x84, 0xB9, 0x85, 0xC0, 0x05, 0x14, 0x85, 0xB9, 0x80, 0x91, 0x80, 0x00, 0x81, 0x68, 0x80,
+0x93, 0x80, 0x00, 0x80, 0x91, 0x81, 0x00, 0x89, 0x60, 0x80, 0x93, 0x81, 0xC0, 0x09, 0xC0, 0x0D,
+0x00, 0x62, 0xC3, 0x13, 0x02, 0xB0, 0x00, 0x83, 0xC0, 0x1D, 0x00, 0xB0, 0xC0, 0x09, 0x02, 0xB1,
+0x00, 0x81, 0xC0, 0x1D, 0x02, 0xB1, 0x00, 0x8F, 0xC0, 0x71, 0x0A, 0x3F, 0xD4, 0x80, 0x93, 0xC7,
+0x03, 0x80, 0xEC, 0x9F, 0xE1, 0x3A, 0xC0, 0x09, 0x02, 0xC6, 0x03, 0x81, 0xC0, 0x09, 0x00, 0x35,
+0xC0, 0x09, 0x0B, 0xC8, 0x03, 0x80, 0x91, 0xC7, 0x03, 0x81, 0x11, 0x0F, 0xC0, 0x80, 0x91, 0xC0,
+0x15, 0xC0, 0xA1, 0x02, 0x80, 0x91, 0xC8, 0xC0, 0x07, 0x07, 0x07, 0xC0, 0x10, 0x92, 0xC7, 0x03,
+0x8F, 0xEF, 0xC1, 0x2B, 0x04, 0x10, 0x92, 0xC8, 0x03, 0x20, 0xC0, 0x25, 0x12, 0x8F, 0xEF, 0x90,
+0xE0, 0xAC, 0x01, 0x42, 0x1B, 0x51, 0x09, 0x50, 0x93, 0x89, 0x00, 0x40, 0x93, 0x88, 0x00, 0x20,
+0xC0, 0x33, 0x0A, 0x82, 0x1B, 0x91, 0x09, 0x90, 0x93, 0x8B, 0x00, 0x80, 0x93, 0x8A, 0xC0, 0x73,
+0xC0, 0x4F, 0x03, 0x95, 0x80, 0x93, 0xB3, 0xC0, 0x09, 0x02, 0xC0, 0x00, 0x82, 0xC0, 0x7D, 0x08,
+0xC0, 0x00, 0x80, 0xE1, 0x80, 0x93, 0xC4, 0x00, 0x88, 0xC0, 0x05, 0x0A, 0xC1, 0x00, 0x00, 0x00,
+0x41, 0x2C, 0x51, 0x2C, 0x32, 0x01, 0xCD, 0xC2, 0xEF, 0x00, 0xC3, 0xC0, 0xEF, 0x00, 0xCF, 0xC2,
+0x09, 0x00, 0xC1, 0xC0, 0x09, 0x01, 0xC2, 0x5E, 0xC1, 0x09, 0x06, 0xCE, 0x51, 0xD1, 0x40, 0x31,
+0x2C, 0xC1, 0xC0, 0x0B, 0x04, 0x19, 0x82, 0x18, 0x82, 0xCF, 0xC0, 0x0D, 0x06, 0x81, 0x2C, 0x91,
+0x2C, 0x54, 0x01, 0xCE, 0xC0, 0x27, 0x02, 0x58, 0x81, 0xC2, 0xC0, 0x27, 0x09, 0x51, 0x11, 0x0C,
+0xC0, 0x21, 0x2C, 0x00, 0xE0, 0x10, 0xE0, 0xC3, 0x4B, 0xC7, 0x41, 0x06, 0x04, 0xC0, 0x22, 0x24,
+0x23, 0x94, 0x02, 0xC0, 0x19, 0x10, 0xEE, 0x24, 0xEA, 0x94, 0xF1, 0x2C, 0xDD, 0x24, 0xDA, 0x94,
+0x01, 0x15, 0x11, 0x05, 0x09, 0xF0, 0x58, 0xC0, 0xD5, 0x05, 0xC0, 0x00, 0x87, 0xFD, 0x51, 0xC0,
+0xC3, 0x0F, 0x21, 0x4D, 0xC0, 0x65, 0xE0, 0x6A, 0x95, 0xF1, 0xF7, 0x00, 0x00, 0x7F, 0xEF, 0x47,
+0x1A, 0x57, 0x0A, 0x67, 0x0A, 0x77, 0x0A, 0x81, 0xE1, 0x48, 0x16, 0x87, 0xE2, 0x58, 0x06, 0x61,
+0x04, 0x71, 0x04, 0x20, 0xF0, 0xC1, 0x49, 0x00, 0x01, 0xC0, 0x49, 0x24, 0xC3, 0x01, 0xB2, 0x01,
+0x27, 0xEC, 0x3B, 0xE1, 0x40, 0xE0, 0x50, 0xE0, 0x72, 0xD3, 0x67, 0x2B, 0x68, 0x2B, 0x69, 0x2B,
+0xC9, 0xF6, 0x90, 0x91, 0x2D, 0x02, 0x81, 0xE0, 0x91, 0x11, 0x80, 0xE0, 0x80, 0x93, 0x2D, 0x02,
+0x80, 0xC0, 0x0D, 0x26, 0x88, 0x23, 0xC1, 0xF0, 0x80, 0x91, 0xC7, 0x03, 0xD7, 0x01, 0xA8, 0x1B,
+0xB1, 0x09, 0xB0, 0x93, 0x89, 0x00, 0xA0, 0x93, 0x88, 0x00, 0x80, 0x91, 0xC6, 0x03, 0xF7, 0x01,
+0xE8, 0x1B, 0xF1, 0x09, 0xF0, 0x93, 0x8B, 0x00, 0xE0, 0x93, 0x8A, 0xC0, 0x11, 0x13, 0xC8, 0x03,
+0x80, 0x95, 0x80, 0x93, 0xB3, 0x00, 0xB6, 0xCF, 0xF0, 0x92, 0x89, 0x00, 0xE0, 0x92, 0x88, 0x00,
+0xF0, 0x92, 0xC0, 0x1B, 0x14, 0x92, 0x8A, 0x00, 0xD0, 0x92, 0xB3, 0x00, 0xAB, 0xCF, 0x0F, 0x5F,
+0x1F, 0x4F, 0xA4, 0xCF, 0x01, 0x30, 0x11, 0x05, 0x59, 0xF4, 0xC1, 0xDB, 0x01, 0xF8, 0x81, 0xC1,
+0xDB, 0x0C, 0xF1, 0x11, 0x54, 0xC0, 0x22, 0x20, 0x09, 0xF4, 0x8B, 0xC0, 0x50, 0xC0, 0xCE, 0xC1,
+0x15, 0x01, 0x80, 0xC2, 0xC0, 0x15, 0x00, 0xFF, 0xC0, 0x11, 0x08, 0x48, 0xC0, 0x10, 0x92, 0x80,
+0x00, 0x10, 0x92, 0x81, 0xC0, 0x03, 0x00, 0xB0, 0xC0, 0x03, 0x10, 0xB1, 0x00, 0x85, 0xB1, 0x80,
+0x67, 0x85, 0xB9, 0x86, 0xEF, 0x9F, 0xE1, 0x4C, 0xD3, 0xAC, 0x01, 0x84, 0xC0, 0x07, 0x00, 0xC6,
+0xC0, 0x31, 0x02, 0x48, 0x83, 0xCA, 0xC0, 0x31, 0x00, 0xC5, 0xC0, 0x09, 0x02, 0x58, 0x83, 0xCB,
+0xC0, 0x09, 0x04, 0x3E, 0xD3, 0xBC, 0x01, 0x83, 0xC0, 0x1B, 0x00, 0xC8, 0xC0, 0x11, 0x02, 0x68,
+0x83, 0xC8, 0xC0, 0x11, 0x00, 0xC7, 0xC0, 0x09, 0x02, 0x78, 0x83, 0xC9, 0xC0, 0x09, 0x11, 0x28,
+0xD3, 0xC1, 0x2C, 0xD1, 0x2C, 0xE1, 0x2C, 0xF1, 0x2C, 0x00, 0xE0, 0x10, 0xE0, 0x20, 0xE0, 0x30,
+0xE0, 0xC2, 0x41, 0x00, 0x81, 0xC6, 0x41, 0x00, 0x81, 0xC1, 0x41, 0xC2, 0x39, 0x00, 0x81, 0xC6,
+0x39, 0x00, 0x81, 0xC1, 0x39, 0x19, 0xB1, 0xDB, 0x2F, 0xDC, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00,
+0xE8, 0x95, 0x80, 0xE0, 0x90, 0xE0, 0xDC, 0x01, 0xAB, 0xBF, 0xFC, 0x01, 0x87, 0x91, 0x96, 0x91,
+0xC1, 0xCB, 0x00, 0x28, 0xC2, 0xCB, 0x02, 0x21, 0x11, 0x06, 0xC2, 0xCB, 0x0E, 0x15, 0xCF, 0x01,
+0x96, 0x09, 0xF4, 0x12, 0xCF, 0x84, 0xB1, 0x8F, 0x78, 0x84, 0xB9, 0x85, 0xC0, 0x05, 0x01, 0x85,
+0xB9, 0xCD, 0xCB, 0x0A, 0x00, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x8D, 0x7F, 0x80, 0x93, 0xC0, 0xC0,
+0x0F, 0xD1, 0xE7, 0x06, 0x0C, 0x94, 0x00, 0x00, 0xF0, 0xCE, 0x40, 0xC2, 0xA5, 0x0E, 0x01, 0x30,
+0x11, 0x05, 0x99, 0xF0, 0x81, 0xE0, 0x92, 0xE1, 0xAA, 0xE7, 0xB0, 0xE0, 0x50, 0xC0, 0x39, 0x42,
+0x57, 0xFD, 0x0B, 0xC0, 0x01, 0x97, 0xA1, 0x09, 0xB1, 0x09, 0x00, 0x97, 0xA1, 0x05, 0xB1, 0x05,
+0xA9, 0xF7, 0x22, 0x24, 0x23, 0x94, 0x50, 0xE0, 0x03, 0xC0, 0x50, 0x91, 0xC6, 0x00, 0x21, 0x2C,
+0x43, 0x30, 0x91, 0xF1, 0x20, 0xF4, 0x41, 0x30, 0x01, 0xF1, 0x40, 0xF0, 0x26, 0xC0, 0x45, 0x30,
+0xD9, 0xF1, 0x70, 0xF1, 0x46, 0x30, 0x09, 0xF4, 0x57, 0xC0, 0x59, 0xC0, 0x5B, 0x31, 0x09, 0xF4,
+0x6A, 0xC2, 0xCD, 0xC0, 0xB7, 0x02, 0x88, 0x81, 0xC3, 0xC0, 0xB7, 0x01, 0x8F, 0x5F, 0xC1, 0x0B,
+0x00, 0xF8, 0xC2, 0x0B, 0xC2, 0x15, 0x00, 0x83, 0xC1, 0x09, 0x36, 0xF6, 0x30, 0x08, 0xF0, 0x4A,
+0xC0, 0x44, 0xC0, 0x35, 0x26, 0xC2, 0x5E, 0xDE, 0x4F, 0x58, 0x83, 0xCE, 0x51, 0xD1, 0x40, 0x42,
+0xE0, 0x3C, 0xC0, 0x25, 0x2F, 0x30, 0xE0, 0x32, 0x2F, 0x22, 0x27, 0x35, 0x26, 0x43, 0xE0, 0x35,
+0xC0, 0x25, 0x2B, 0x35, 0x26, 0x44, 0xE0, 0x31, 0xC0, 0x5E, 0x30, 0x09, 0xF0, 0x44, 0xC2, 0x35,
+0x26, 0xC1, 0xC0, 0x2B, 0x04, 0x19, 0x82, 0x18, 0x82, 0xCF, 0xC0, 0x2D, 0x03, 0x45, 0xE0, 0x25,
+0xC0, 0xC1, 0x0F, 0x03, 0x88, 0x81, 0x99, 0x81, 0xC1, 0x0F, 0x09, 0x01, 0x96, 0xE1, 0xE0, 0xF0,
+0xE0, 0xEC, 0x0F, 0xFD, 0x1F, 0xC1, 0x15, 0x02, 0x68, 0x81, 0x79, 0xC2, 0x15, 0x0F, 0xE6, 0x0F,
+0xF7, 0x1F, 0x50, 0x83, 0x35, 0x26, 0x82, 0x17, 0x93, 0x07, 0x09, 0xF4, 0x24, 0xC2, 0xC1, 0x1B,
+0x03, 0x99, 0x83, 0x88, 0x83, 0xC1, 0x1B, 0x15, 0x05, 0xC0, 0x53, 0x11, 0x19, 0xC2, 0x09, 0xC0,
+0x47, 0x30, 0x39, 0xF0, 0x21, 0x10, 0x05, 0xC0, 0x00, 0xE0, 0x10, 0xE0, 0x79, 0xCF, 0xC1, 0xE9,
+0x02, 0x29, 0x81, 0x23, 0xC0, 0xC5, 0x04, 0xC7, 0xC0, 0x60, 0xF5, 0x26, 0xC0, 0xD5, 0x04, 0xB1,
+0xC0, 0xF8, 0xF4, 0x22, 0xC0, 0x07, 0x02, 0x46, 0xC1, 0x23, 0xC0, 0x05, 0x02, 0x70, 0xC0, 0x21,
+0xC0, 0x8D, 0x28, 0x8E, 0xC1, 0x1A, 0x82, 0x88, 0xE0, 0x8B, 0x83, 0x81, 0xE4, 0x8C, 0x83, 0x86,
+0xE5, 0x8D, 0x83, 0x82, 0xE5, 0x8E, 0x83, 0x89, 0xE4, 0x8F, 0x83, 0x83, 0xE5, 0x88, 0x87, 0x80,
+0xE5, 0x89, 0x87, 0x8F, 0xE5, 0x8A, 0x87, 0x82, 0xE3, 0x8B, 0x87, 0x0B, 0xC0, 0x53, 0x02, 0x7C,
+0xC1, 0x21, 0xC0, 0x4D, 0x06, 0x63, 0xC0, 0x08, 0xF0, 0x73, 0xC1, 0x20, 0xC0, 0x09, 0x04, 0x22,
+0xC1, 0x6F, 0xC1, 0x28, 0xC0, 0x07, 0x04, 0x78, 0xC0, 0x48, 0xF4, 0x25, 0xC0, 0x07, 0x06, 0x93,
+0xC0, 0x08, 0xF4, 0x1A, 0xC1, 0x26, 0xC0, 0x09, 0x04, 0x17, 0xC1, 0x62, 0xC1, 0x2B, 0xC0, 0x07,
+0x0A, 0x54, 0xC0, 0x2D, 0x31, 0x59, 0xF0, 0x2A, 0x31, 0x09, 0xF0, 0x5A, 0xC0, 0x67, 0x01, 0x89,
+0xE0, 0xC1, 0xD9, 0x28, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x59, 0xC0, 0x8D, 0x81, 0x80, 0x33,
+0x39, 0xF4, 0x9F, 0x81, 0x99, 0x23, 0xE9, 0xF0, 0x91, 0x30, 0xE9, 0xF4, 0x98, 0xEA, 0x1E, 0xC0,
+0x98, 0x2F, 0x90, 0x75, 0xD1, 0xF0, 0x80, 0x35, 0x21, 0xF4, 0x99, 0xE0, 0xE0, 0xC0, 0x2B, 0x0C,
+0x0C, 0xC0, 0x88, 0x35, 0x91, 0xF4, 0x9E, 0x81, 0x91, 0x11, 0x04, 0xC0, 0x99, 0xC2, 0x3D, 0x02,
+0x03, 0xC0, 0xE3, 0xC0, 0x05, 0x02, 0x99, 0xE0, 0x90, 0xC0, 0x45, 0x1A, 0x94, 0x91, 0x05, 0xC0,
+0x9E, 0xE1, 0x03, 0xC0, 0x92, 0xE0, 0x01, 0xC0, 0x90, 0xE0, 0x1A, 0x82, 0x1B, 0x82, 0x8C, 0x83,
+0x1D, 0x82, 0x9E, 0x83, 0x1F, 0x82, 0x07, 0xC0, 0xAD, 0x14, 0x25, 0xC1, 0xEA, 0x81, 0xE0, 0x59,
+0xE3, 0x30, 0x28, 0xF4, 0xF0, 0xE0, 0xE7, 0x5D, 0xFD, 0x4F, 0x80, 0x81, 0x01, 0xC0, 0x80, 0xC0,
+0x25, 0x02, 0x8B, 0x83, 0x03, 0xC0, 0x1D, 0x0E, 0x16, 0xC1, 0xF1, 0xE0, 0xCF, 0x5D, 0xDE, 0x4F,
+0xF8, 0x83, 0xC1, 0x52, 0xD1, 0x40, 0xBD, 0xC0, 0x8D, 0x14, 0x88, 0x23, 0x21, 0xF0, 0x81, 0x30,
+0x21, 0xF4, 0x88, 0xEA, 0x0A, 0xC0, 0x8E, 0xE1, 0x08, 0xC0, 0x82, 0xE0, 0x06, 0xC0, 0x89, 0xC2,
+0x85, 0xC3, 0xB1, 0xC1, 0x39, 0x02, 0x1C, 0x82, 0x04, 0xC0, 0x3B, 0x0E, 0xF8, 0xC0, 0x8B, 0x81,
+0x80, 0x35, 0x31, 0xF4, 0x8C, 0x81, 0x88, 0x30, 0x71, 0xF7, 0xE2, 0xC0, 0x21, 0x00, 0x02, 0xC2,
+0x95, 0x15, 0x89, 0xE0, 0xEA, 0xCF, 0x8A, 0x81, 0x8B, 0x80, 0x91, 0x2C, 0xA1, 0x2C, 0xB1, 0x2C,
+0x54, 0x01, 0x99, 0x24, 0x88, 0x24, 0xB8, 0x2A, 0xC0, 0x59, 0x52, 0x2A, 0x8C, 0x81, 0x98, 0x2A,
+0x88, 0x0C, 0x99, 0x1C, 0xAA, 0x1C, 0xBB, 0x1C, 0x87, 0xC0, 0x0A, 0x81, 0x10, 0xE0, 0x10, 0x2F,
+0x00, 0x27, 0x8B, 0x81, 0x08, 0x2B, 0x23, 0x31, 0x09, 0xF0, 0x4C, 0xC0, 0x00, 0xFD, 0xCA, 0xC0,
+0x81, 0x10, 0xC8, 0xC0, 0x01, 0x30, 0xF1, 0xE0, 0x1F, 0x07, 0x08, 0xF0, 0xC3, 0xC0, 0xD5, 0x01,
+0xC4, 0x01, 0x80, 0x0F, 0x91, 0x1F, 0xA1, 0x1D, 0xB1, 0x1D, 0x81, 0x30, 0x90, 0x4E, 0xA3, 0x40,
+0xB1, 0x05, 0x08, 0xF0, 0xB7, 0xC0, 0x83, 0xE0, 0xF4, 0x01, 0xA0, 0x92, 0x5B, 0x00, 0xC1, 0x93,
+0x2B, 0xE8, 0x95, 0x74, 0xD9, 0x2B, 0x85, 0xB5, 0x01, 0xA4, 0x01, 0xCE, 0x01, 0x0B, 0x96, 0xDC,
+0x01, 0x12, 0x96, 0xCD, 0x01, 0xFD, 0x01, 0x31, 0x97, 0xE0, 0x81, 0x30, 0xE0, 0x3E, 0x2B, 0xFF,
+0x24, 0xF3, 0x94, 0x09, 0x01, 0xFA, 0x01, 0x60, 0x93, 0x5B, 0x00, 0xF0, 0x92, 0xC1, 0x2D, 0x18,
+0x11, 0x24, 0x4E, 0x5F, 0x5F, 0x4F, 0x6F, 0x4F, 0x7F, 0x4F, 0x02, 0x50, 0x11, 0x09, 0x01, 0x15,
+0x11, 0x05, 0x11, 0xF0, 0x2C, 0x91, 0xE3, 0xCF, 0x85, 0xCA, 0x53, 0x03, 0x4A, 0xD9, 0x81, 0xE1,
+0xC3, 0x09, 0x20, 0x32, 0xC0, 0xA5, 0x01, 0x94, 0x01, 0x56, 0x95, 0x47, 0x95, 0x37, 0x95, 0x27,
+0x95, 0xCC, 0x5D, 0xDE, 0x4F, 0x28, 0x83, 0x39, 0x83, 0x4A, 0x83, 0x5B, 0x83, 0xC4, 0x52, 0xD1,
+0x40, 0xAE, 0x01, 0x45, 0xC0, 0x4D, 0x11, 0x6A, 0x01, 0xE1, 0x2C, 0xF1, 0x2C, 0xE0, 0x16, 0xF1,
+0x06, 0x81, 0xF0, 0xD6, 0x01, 0x6D, 0x91, 0x6D, 0x01, 0xC1, 0x27, 0x03, 0x88, 0x81, 0x99, 0x81,
+0xC1, 0x23, 0x4F, 0x8E, 0x0D, 0x9F, 0x1D, 0x0E, 0xD1, 0xBF, 0xEF, 0xEB, 0x1A, 0xFB, 0x0A, 0xED,
+0xCF, 0xC7, 0x01, 0xA0, 0xE0, 0xB0, 0xE0, 0x88, 0x0F, 0x99, 0x1F, 0xAA, 0x1F, 0xBB, 0x1F, 0x88,
+0x0E, 0x99, 0x1E, 0xAA, 0x1E, 0xBB, 0x1E, 0x1A, 0x82, 0x4E, 0xC0, 0x8A, 0x81, 0x90, 0xE0, 0x98,
+0x2F, 0x88, 0x27, 0x3B, 0x81, 0x83, 0x2B, 0x8C, 0x01, 0x0D, 0x5F, 0x1F, 0x4F, 0x1A, 0x82, 0x24,
+0x31, 0xA1, 0xF4, 0xDE, 0x01, 0x13, 0x96, 0xAB, 0xBE, 0xF4, 0x01, 0x27, 0x91, 0x36, 0x91, 0x2C,
+0x93, 0x12, 0x96, 0xC1, 0xDD, 0x2A, 0x30, 0x83, 0xE2, 0xE0, 0x8E, 0x0E, 0x91, 0x1C, 0xA1, 0x1C,
+0xB1, 0x1C, 0x02, 0x97, 0x00, 0x97, 0x79, 0xF7, 0x2A, 0xC0, 0xFE, 0x01, 0x33, 0x96, 0x9C, 0x01,
+0xB5, 0x01, 0xA4, 0x01, 0x41, 0xBD, 0xC5, 0x2E, 0xD6, 0x2E, 0xE7, 0x2E, 0xFF, 0x24, 0xC2, 0xBC,
+0x4F, 0xC4, 0xED, 0x19, 0xF8, 0x9A, 0xA0, 0xB5, 0xA1, 0x93, 0x21, 0x50, 0x31, 0x09, 0x21, 0x15,
+0x31, 0x05, 0x71, 0xF7, 0xAC, 0x01, 0x41, 0x50, 0x51, 0x09, 0x60, 0xE0, 0x70, 0xE0, 0xC5, 0x21,
+0x08, 0x84, 0x0E, 0x95, 0x1E, 0xA6, 0x1E, 0xB7, 0x1E, 0xA3, 0xC0, 0x9F, 0x19, 0xAC, 0x0F, 0xBD,
+0x1F, 0xA8, 0x0F, 0xB9, 0x1F, 0x1C, 0x92, 0x04, 0xC0, 0x80, 0xEC, 0x8A, 0x83, 0x02, 0xE0, 0x10,
+0xE0, 0x8B, 0xE1, 0xD9, 0xD8, 0xC2, 0x5E, 0xC1, 0xD7, 0x15, 0xCE, 0x51, 0xD1, 0x40, 0xD3, 0xD8,
+0x81, 0x2F, 0xD1, 0xD8, 0x80, 0x2F, 0xCF, 0xD8, 0x8E, 0xE0, 0xCD, 0xD8, 0x95, 0xE1, 0x39, 0x2E,
+0xC1, 0x1B, 0x00, 0xF8, 0xC2, 0x1B, 0x28, 0x3F, 0x26, 0x30, 0x26, 0x31, 0x26, 0x9E, 0x01, 0x2F,
+0x5F, 0x3F, 0x4F, 0x79, 0x01, 0x02, 0x0F, 0x13, 0x1F, 0xE0, 0x16, 0xF1, 0x06, 0x39, 0xF0, 0xD7,
+0x01, 0xDD, 0x90, 0x7D, 0x01, 0x8D, 0x2D, 0xB5, 0xD8, 0x3D, 0x24, 0xF6, 0xCF, 0x83, 0x2D, 0xB1,
+0xC2, 0x4F, 0x00, 0xB8, 0xC2, 0x33, 0x01, 0xBF, 0x5F, 0xC2, 0x0B, 0x00, 0x83, 0xC1, 0x0B, 0x0E,
+0x90, 0x91, 0x2D, 0x02, 0x81, 0xE0, 0x91, 0x11, 0x80, 0xE0, 0x80, 0x93, 0x2D, 0x02, 0x80, 0xC0,
+0x0D, 0x31, 0x88, 0x23, 0xB9, 0xF0, 0x20, 0x91, 0xC7, 0x03, 0x8F, 0xEF, 0x90, 0xE0, 0xFC, 0x01,
+0xE2, 0x1B, 0xF1, 0x09, 0xF0, 0x93, 0x89, 0x00, 0xE0, 0x93, 0x88, 0x00, 0x20, 0x91, 0xC6, 0x03,
+0x82, 0x1B, 0x91, 0x09, 0x90, 0x93, 0x8B, 0x00, 0x80, 0x93, 0x8A, 0x00, 0x80, 0x91, 0xC8, 0x03,
+0x80, 0x95, 0x0B, 0xC0, 0xC1, 0x29, 0x00, 0x90, 0xC0, 0x23, 0x00, 0x80, 0xC0, 0x23, 0xC5, 0x1B,
+0x06, 0x8F, 0xEF, 0x80, 0x93, 0xB3, 0x00, 0x00, 0xC0, 0xCB, 0x0E, 0xD4, 0xCC, 0x8B, 0xE1, 0x38,
+0x2E, 0x41, 0xE0, 0xEA, 0xCD, 0x40, 0xE0, 0xE8, 0xCD, 0xC1, 0xC0, 0x79, 0x04, 0x39, 0x83, 0x28,
+0x83, 0xCF, 0xC0, 0x7B, 0x75, 0x46, 0xE0, 0xE0, 0xCD, 0xA1, 0xE2, 0x1A, 0x2E, 0xAA, 0x1B, 0xBB,
+0x1B, 0xFD, 0x01, 0x0D, 0xC0, 0xAA, 0x1F, 0xBB, 0x1F, 0xEE, 0x1F, 0xFF, 0x1F, 0xA2, 0x17, 0xB3,
+0x07, 0xE4, 0x07, 0xF5, 0x07, 0x20, 0xF0, 0xA2, 0x1B, 0xB3, 0x0B, 0xE4, 0x0B, 0xF5, 0x0B, 0x66,
+0x1F, 0x77, 0x1F, 0x88, 0x1F, 0x99, 0x1F, 0x1A, 0x94, 0x69, 0xF7, 0x60, 0x95, 0x70, 0x95, 0x80,
+0x95, 0x90, 0x95, 0x9B, 0x01, 0xAC, 0x01, 0xBD, 0x01, 0xCF, 0x01, 0x08, 0x95, 0xFB, 0x01, 0xDC,
+0x01, 0x02, 0xC0, 0x01, 0x90, 0x0D, 0x92, 0x41, 0x50, 0x50, 0x40, 0xD8, 0xF7, 0x08, 0x95, 0xF9,
+0x99, 0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD, 0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5, 0x08, 0x95, 0xA8,
+0xE1, 0xB0, 0xE0, 0x42, 0xE0, 0x50, 0xE0, 0x10, 0xC0, 0x26, 0x2F, 0xC1, 0x1B, 0x01, 0x1F, 0xBA,
+0xC1, 0x1D, 0x15, 0x20, 0xBD, 0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A, 0x0F, 0xBE, 0x01,
+0x96, 0x08, 0x95, 0xDC, 0x01, 0xCB, 0x01, 0xFC, 0x01, 0xC1, 0x1F, 0x04, 0x06, 0xC0, 0xF2, 0xBD,
+0xE1, 0xC0, 0x3D, 0x03, 0x31, 0x96, 0x00, 0xB4, 0xC3, 0x55, 0x00, 0xB8, 0xC0, 0x55, 0x06, 0xF8,
+0x94, 0xFF, 0xCF, 0x46, 0x41, 0x88, 0x80, 0x06, 0x00, 0x09, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00,
+0x77, 0x69, 0x62, 0x6F, 0x80, 0x0B, 0x00, 0x0B, 0x70, 0x69, 0x6E, 0x6F, 0x63, 0x63, 0x69, 0x6F,
+0x00, 0x0F, 0x02, 0x0A,
+};  // end of atmega256rfr2_bootloader_hex
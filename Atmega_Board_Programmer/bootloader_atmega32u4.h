@@ -7,260 +7,219 @@
 // Original file (with first 896 lines removed) MD5 sum = e37e88d805c22aa9286828caaec8cb3d
 // This file from Aduino IDE 1.6.9
 
+// Packed by convertHexToByteArray: 3382 bytes, 4058 unpacked
+const unsigned int leonardo_hex_length = 4058;
 const byte leonardo_hex [] PROGMEM = {
-0x55, 0xC0, 0x00, 0x00, 0x6E, 0xC0, 0x00, 0x00, 0x6C, 0xC0, 0x00, 0x00, 0x6A, 0xC0, 0x00, 0x00,
-0x68, 0xC0, 0x00, 0x00, 0x66, 0xC0, 0x00, 0x00, 0x64, 0xC0, 0x00, 0x00, 0x62, 0xC0, 0x00, 0x00,
-0x60, 0xC0, 0x00, 0x00, 0x5E, 0xC0, 0x00, 0x00, 0xF2, 0xC4, 0x00, 0x00, 0x5A, 0xC0, 0x00, 0x00,
-0x58, 0xC0, 0x00, 0x00, 0x56, 0xC0, 0x00, 0x00, 0x54, 0xC0, 0x00, 0x00, 0x52, 0xC0, 0x00, 0x00,
-0x50, 0xC0, 0x00, 0x00, 0x78, 0xC0, 0x00, 0x00, 0x4C, 0xC0, 0x00, 0x00, 0x4A, 0xC0, 0x00, 0x00,
-0x48, 0xC0, 0x00, 0x00, 0x46, 0xC0, 0x00, 0x00, 0x44, 0xC0, 0x00, 0x00, 0x42, 0xC0, 0x00, 0x00,
-0x40, 0xC0, 0x00, 0x00, 0x3E, 0xC0, 0x00, 0x00, 0x3C, 0xC0, 0x00, 0x00, 0x3A, 0xC0, 0x00, 0x00,
-0x38, 0xC0, 0x00, 0x00, 0x36, 0xC0, 0x00, 0x00, 0x34, 0xC0, 0x00, 0x00, 0x32, 0xC0, 0x00, 0x00,
-0x30, 0xC0, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x2C, 0xC0, 0x00, 0x00, 0x2A, 0xC0, 0x00, 0x00,
-0x28, 0xC0, 0x00, 0x00, 0x26, 0xC0, 0x00, 0x00, 0x24, 0xC0, 0x00, 0x00, 0x22, 0xC0, 0x00, 0x00,
-0x20, 0xC0, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x1C, 0xC0, 0x00, 0x00, 0x11, 0x24, 0x1F, 0xBE,
-0xCF, 0xEF, 0xDA, 0xE0, 0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xE2, 0xE3,
-0xFF, 0xE7, 0x02, 0xC0, 0x05, 0x90, 0x0D, 0x92, 0xA8, 0x3A, 0xB1, 0x07, 0xD9, 0xF7, 0x11, 0xE0,
-0xA8, 0xEA, 0xB1, 0xE0, 0x01, 0xC0, 0x1D, 0x92, 0xAE, 0x3B, 0xB1, 0x07, 0xE1, 0xF7, 0x8F, 0xD3,
-0x26, 0xC7, 0x8E, 0xCF, 0xF8, 0x94, 0x10, 0x92, 0x6F, 0x00, 0x10, 0x92, 0x81, 0x00, 0x10, 0x92,
-0x85, 0x00, 0x10, 0x92, 0x84, 0x00, 0x81, 0xE0, 0x85, 0xBF, 0x15, 0xBE, 0x47, 0x98, 0x5D, 0x9A,
-0x28, 0x9A, 0x0C, 0x94, 0x00, 0x00, 0x08, 0x95, 0x20, 0x91, 0xB2, 0x01, 0x30, 0x91, 0xB3, 0x01,
-0x2F, 0x5F, 0x3F, 0x4F, 0x30, 0x93, 0xB3, 0x01, 0x20, 0x93, 0xB2, 0x01, 0x93, 0x2F, 0x37, 0xFF,
-0x03, 0xC0, 0x8E, 0xEF, 0x83, 0x1B, 0x98, 0x2F, 0x99, 0x0F, 0x92, 0x17, 0x10, 0xF4, 0x47, 0x98,
-0x08, 0x95, 0x47, 0x9A, 0x08, 0x95, 0x1F, 0x92, 0x0F, 0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11, 0x24,
-0x2F, 0x93, 0x8F, 0x93, 0x9F, 0x93, 0xEF, 0x93, 0xFF, 0x93, 0x10, 0x92, 0x85, 0x00, 0x10, 0x92,
-0x84, 0x00, 0x80, 0x91, 0xA8, 0x01, 0x90, 0x91, 0xA9, 0x01, 0x00, 0x97, 0x41, 0xF0, 0x01, 0x97,
-0x90, 0x93, 0xA9, 0x01, 0x80, 0x93, 0xA8, 0x01, 0x89, 0x2B, 0x09, 0xF4, 0x5D, 0x9A, 0x80, 0x91,
-0xAA, 0x01, 0x90, 0x91, 0xAB, 0x01, 0x00, 0x97, 0x41, 0xF0, 0x01, 0x97, 0x90, 0x93, 0xAB, 0x01,
-0x80, 0x93, 0xAA, 0x01, 0x89, 0x2B, 0x09, 0xF4, 0x28, 0x9A, 0xE0, 0xE0, 0xF0, 0xE0, 0x85, 0x91,
-0x94, 0x91, 0x8F, 0x5F, 0x9F, 0x4F, 0x49, 0xF0, 0x80, 0x91, 0xAC, 0x01, 0x90, 0x91, 0xAD, 0x01,
-0x01, 0x96, 0x90, 0x93, 0xAD, 0x01, 0x80, 0x93, 0xAC, 0x01, 0xFF, 0x91, 0xEF, 0x91, 0x9F, 0x91,
-0x8F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90, 0x18, 0x95, 0x84, 0xE0,
-0x80, 0x93, 0xE9, 0x00, 0x0D, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00,
-0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x51, 0xF0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF9, 0xCF,
-0x80, 0x91, 0xE8, 0x00, 0x85, 0xFF, 0xEF, 0xCF, 0x80, 0x91, 0xF1, 0x00, 0x08, 0x95, 0x98, 0x2F,
-0x83, 0xE0, 0x80, 0x93, 0xE9, 0x00, 0x80, 0x91, 0xE8, 0x00, 0x85, 0xFD, 0x0D, 0xC0, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x69, 0xF0,
-0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0xF9, 0xCF, 0x90, 0x93, 0xF1, 0x00, 0x5D, 0x98, 0x84, 0xE6,
-0x90, 0xE0, 0x90, 0x93, 0xA9, 0x01, 0x80, 0x93, 0xA8, 0x01, 0x08, 0x95, 0x4F, 0x92, 0x5F, 0x92,
-0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92,
-0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0x84, 0xE0, 0x80, 0x93,
-0xE9, 0x00, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0x57, 0xC2, 0x28, 0x98, 0x84, 0xE6, 0x90, 0xE0,
-0x90, 0x93, 0xAB, 0x01, 0x80, 0x93, 0xAA, 0x01, 0xAA, 0xDF, 0x18, 0x2F, 0x85, 0x34, 0x81, 0xF4,
-0x8C, 0xE4, 0x9D, 0xE1, 0x90, 0x93, 0xAD, 0x01, 0x80, 0x93, 0xAC, 0x01, 0x07, 0xB6, 0x00, 0xFC,
-0xFD, 0xCF, 0xF9, 0x99, 0xFE, 0xCF, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x03, 0xC0,
-0x84, 0x35, 0x19, 0xF4, 0x94, 0xDF, 0x8D, 0xE0, 0x0D, 0xC2, 0x8C, 0x34, 0xE1, 0xF3, 0x80, 0x35,
-0xD1, 0xF3, 0x84, 0x37, 0x21, 0xF4, 0x84, 0xE4, 0xA2, 0xDF, 0x80, 0xE0, 0x03, 0xC2, 0x81, 0x36,
-0x11, 0xF4, 0x89, 0xE5, 0xFF, 0xC1, 0x81, 0x34, 0xB1, 0xF4, 0x81, 0xDF, 0x18, 0x2F, 0x7F, 0xDF,
-0x90, 0xE0, 0x88, 0x0F, 0x99, 0x1F, 0xAA, 0x27, 0x97, 0xFD, 0xA0, 0x95, 0xBA, 0x2F, 0x31, 0x2F,
-0x33, 0x0F, 0x20, 0xE0, 0x44, 0x27, 0x37, 0xFD, 0x40, 0x95, 0x54, 0x2F, 0x82, 0x2B, 0x93, 0x2B,
-0xA4, 0x2B, 0xB5, 0x2B, 0xB8, 0xC1, 0x80, 0x37, 0x11, 0xF4, 0x83, 0xE5, 0xE3, 0xC1, 0x83, 0x35,
-0x49, 0xF4, 0xC0, 0xE0, 0xD1, 0xE0, 0x89, 0x91, 0x7A, 0xDF, 0x21, 0xE0, 0xC7, 0x30, 0xD2, 0x07,
-0xD1, 0xF7, 0xD9, 0xC1, 0x86, 0x35, 0x21, 0xF4, 0x81, 0xE3, 0x71, 0xDF, 0x80, 0xE3, 0xD2, 0xC1,
-0x83, 0x37, 0x31, 0xF4, 0x87, 0xE8, 0x6B, 0xDF, 0x85, 0xE9, 0x69, 0xDF, 0x8E, 0xE1, 0xCA, 0xC1,
-0x85, 0x36, 0xB9, 0xF4, 0xE0, 0xE0, 0xF0, 0xE0, 0x93, 0xE0, 0x85, 0xE0, 0x90, 0x93, 0x57, 0x00,
-0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6,
-0x00, 0xFC, 0xFD, 0xCF, 0xE0, 0x58, 0xFF, 0x4F, 0xA0, 0xE7, 0xE0, 0x30, 0xFA, 0x07, 0x71, 0xF7,
-0xA2, 0xCF, 0x82, 0x37, 0x39, 0xF4, 0xE1, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93, 0x57, 0x00,
-0x84, 0x91, 0xA8, 0xC1, 0x86, 0x34, 0x39, 0xF4, 0xE0, 0xE0, 0xF0, 0xE0, 0x89, 0xE0, 0x80, 0x93,
-0x57, 0x00, 0x84, 0x91, 0x9F, 0xC1, 0x8E, 0x34, 0x39, 0xF4, 0xE3, 0xE0, 0xF0, 0xE0, 0x89, 0xE0,
-0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x96, 0xC1, 0x81, 0x35, 0x39, 0xF4, 0xE2, 0xE0, 0xF0, 0xE0,
-0x89, 0xE0, 0x80, 0x93, 0x57, 0x00, 0x84, 0x91, 0x8D, 0xC1, 0x82, 0x36, 0x31, 0xF4, 0x89, 0xE5,
-0x26, 0xDF, 0x80, 0xE0, 0x24, 0xDF, 0x80, 0xE8, 0x85, 0xC1, 0x82, 0x34, 0x19, 0xF0, 0x87, 0x36,
-0x09, 0xF0, 0xE5, 0xC0, 0x10, 0x92, 0xAD, 0x01, 0x10, 0x92, 0xAC, 0x01, 0x00, 0xDF, 0x08, 0x2F,
-0xFE, 0xDE, 0xF8, 0x2E, 0xFC, 0xDE, 0x68, 0x2E, 0x85, 0x54, 0x82, 0x30, 0x08, 0xF0, 0x71, 0xC1,
-0x90, 0x2F, 0x80, 0xE0, 0xCF, 0x2D, 0xD0, 0xE0, 0xC8, 0x2B, 0xD9, 0x2B, 0x10, 0x92, 0x6F, 0x00,
-0x17, 0x36, 0x09, 0xF0, 0x4B, 0xC0, 0x81, 0xE1, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0xDD, 0x24,
-0xCC, 0x24, 0xC3, 0x94, 0x3F, 0xC0, 0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91,
-0xB0, 0x01, 0x10, 0x91, 0xB1, 0x01, 0xB6, 0xE4, 0x6B, 0x16, 0xD9, 0xF4, 0xED, 0x2D, 0xF0, 0xE0,
-0xEE, 0x29, 0xFF, 0x29, 0xE4, 0x91, 0x8E, 0x2F, 0xEA, 0xDE, 0xDD, 0x20, 0x81, 0xF0, 0x82, 0xE0,
-0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0xE0, 0x92,
-0xAE, 0x01, 0xF0, 0x92, 0xAF, 0x01, 0x00, 0x93, 0xB0, 0x01, 0x10, 0x93, 0xB1, 0x01, 0xDC, 0x24,
-0x18, 0xC0, 0xD8, 0x01, 0xC7, 0x01, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0x59, 0xD5,
-0xCE, 0xDE, 0x82, 0xE0, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F,
-0x1B, 0x1F, 0xE0, 0x92, 0xAE, 0x01, 0xF0, 0x92, 0xAF, 0x01, 0x00, 0x93, 0xB0, 0x01, 0x10, 0x93,
-0xB1, 0x01, 0x21, 0x97, 0x20, 0x97, 0x09, 0xF0, 0xBE, 0xCF, 0x7D, 0xC0, 0x80, 0x90, 0xAE, 0x01,
-0x90, 0x90, 0xAF, 0x01, 0xA0, 0x90, 0xB0, 0x01, 0xB0, 0x90, 0xB1, 0x01, 0x96, 0xE4, 0x69, 0x16,
-0x09, 0xF0, 0x5D, 0xC0, 0x83, 0xE0, 0xF4, 0x01, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6,
-0x00, 0xFC, 0xFD, 0xCF, 0x54, 0xC0, 0xF6, 0xE4, 0x6F, 0x16, 0x61, 0xF5, 0x77, 0x20, 0x31, 0xF1,
-0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01, 0x10, 0x91, 0xB1, 0x01,
-0x7E, 0xDE, 0xD8, 0x2E, 0xCC, 0x24, 0x85, 0x2D, 0x90, 0xE0, 0x8C, 0x29, 0x9D, 0x29, 0xF7, 0x01,
-0x0C, 0x01, 0x40, 0x92, 0x57, 0x00, 0xE8, 0x95, 0x11, 0x24, 0x82, 0xE0, 0x90, 0xE0, 0xA0, 0xE0,
-0xB0, 0xE0, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0xE0, 0x92, 0xAE, 0x01, 0xF0, 0x92,
-0xAF, 0x01, 0x00, 0x93, 0xB0, 0x01, 0x10, 0x93, 0xB1, 0x01, 0x02, 0xC0, 0x60, 0xDE, 0x58, 0x2E,
-0x74, 0x24, 0x23, 0xC0, 0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01,
-0x10, 0x91, 0xB1, 0x01, 0x16, 0x95, 0x07, 0x95, 0xF7, 0x94, 0xE7, 0x94, 0x50, 0xDE, 0x68, 0x2F,
-0xC7, 0x01, 0xF7, 0xD4, 0x80, 0x91, 0xAE, 0x01, 0x90, 0x91, 0xAF, 0x01, 0xA0, 0x91, 0xB0, 0x01,
-0xB0, 0x91, 0xB1, 0x01, 0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0x80, 0x93, 0xAE, 0x01, 0x90, 0x93,
-0xAF, 0x01, 0xA0, 0x93, 0xB0, 0x01, 0xB0, 0x93, 0xB1, 0x01, 0x21, 0x97, 0x04, 0xC0, 0x55, 0x24,
-0x77, 0x24, 0x44, 0x24, 0x43, 0x94, 0x20, 0x97, 0x09, 0xF0, 0xA5, 0xCF, 0x96, 0xE4, 0x69, 0x16,
-0x41, 0xF4, 0x85, 0xE0, 0xF4, 0x01, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC,
-0xFD, 0xCF, 0x8D, 0xE0, 0x3C, 0xDE, 0x82, 0xE0, 0x80, 0x93, 0x6F, 0x00, 0x9C, 0xC0, 0x83, 0x34,
-0x71, 0xF4, 0x00, 0x91, 0xAE, 0x01, 0x10, 0x91, 0xAF, 0x01, 0x19, 0xDE, 0x90, 0xE0, 0x21, 0xE0,
-0xF8, 0x01, 0x0C, 0x01, 0x20, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x11, 0x24, 0x7C, 0xCE, 0x83, 0x36,
-0x19, 0xF5, 0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01, 0x10, 0x91,
-0xB1, 0x01, 0x05, 0xDE, 0xF7, 0x01, 0xE1, 0x60, 0x90, 0xE0, 0x21, 0xE0, 0x0C, 0x01, 0x20, 0x93,
-0x57, 0x00, 0xE8, 0x95, 0x11, 0x24, 0x82, 0xE0, 0x90, 0xE0, 0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x0E,
-0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0xE0, 0x92, 0xAE, 0x01, 0xF0, 0x92, 0xAF, 0x01, 0x00, 0x93,
-0xB0, 0x01, 0x10, 0x93, 0xB1, 0x01, 0x57, 0xCE, 0x8D, 0x36, 0x61, 0xF4, 0xE0, 0x91, 0xAE, 0x01,
-0xF0, 0x91, 0xAF, 0x01, 0x85, 0xE0, 0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x07, 0xB6, 0x00, 0xFC,
-0xFD, 0xCF, 0x49, 0xCE, 0x82, 0x35, 0x51, 0xF4, 0xE0, 0x91, 0xAE, 0x01, 0xF0, 0x91, 0xAF, 0x01,
-0x05, 0x91, 0x14, 0x91, 0x81, 0x2F, 0xEB, 0xDD, 0x80, 0x2F, 0x4C, 0xC0, 0x84, 0x34, 0x21, 0xF5,
-0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01, 0x10, 0x91, 0xB1, 0x01,
-0x16, 0x95, 0x07, 0x95, 0xF7, 0x94, 0xE7, 0x94, 0xC2, 0xDD, 0x68, 0x2F, 0xC7, 0x01, 0x69, 0xD4,
-0x80, 0x91, 0xAE, 0x01, 0x90, 0x91, 0xAF, 0x01, 0xA0, 0x91, 0xB0, 0x01, 0xB0, 0x91, 0xB1, 0x01,
-0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0x80, 0x93, 0xAE, 0x01, 0x90, 0x93, 0xAF, 0x01, 0xA0, 0x93,
-0xB0, 0x01, 0xB0, 0x93, 0xB1, 0x01, 0x17, 0xCE, 0x84, 0x36, 0x09, 0xF5, 0xE0, 0x90, 0xAE, 0x01,
-0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01, 0x10, 0x91, 0xB1, 0x01, 0xD8, 0x01, 0xC7, 0x01,
-0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0x3C, 0xD4, 0xB1, 0xDD, 0x82, 0xE0, 0x90, 0xE0,
-0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0xE0, 0x92, 0xAE, 0x01,
-0xF0, 0x92, 0xAF, 0x01, 0x00, 0x93, 0xB0, 0x01, 0x10, 0x93, 0xB1, 0x01, 0x04, 0xC0, 0x8B, 0x31,
-0x11, 0xF0, 0x8F, 0xE3, 0x9C, 0xDD, 0x83, 0xE0, 0x80, 0x93, 0xE9, 0x00, 0x90, 0x91, 0xE8, 0x00,
-0x80, 0x91, 0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x95, 0xFF, 0x04, 0xC0, 0x10, 0xC0,
-0x8E, 0xB3, 0x88, 0x23, 0xC9, 0xF0, 0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0xF9, 0xCF, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x61, 0xF0,
-0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0xF9, 0xCF, 0x84, 0xE0, 0x80, 0x93, 0xE9, 0x00, 0x80, 0x91,
-0xE8, 0x00, 0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x0F, 0x91,
+0x04, 0x55, 0xC0, 0x00, 0x00, 0x6E, 0xC0, 0x03, 0x00, 0x6C, 0xC0, 0x03, 0x00, 0x6A, 0xC0, 0x03,
+0x00, 0x68, 0xC0, 0x03, 0x00, 0x66, 0xC0, 0x03, 0x00, 0x64, 0xC0, 0x03, 0x00, 0x62, 0xC0, 0x03,
+0x00, 0x60, 0xC0, 0x03, 0x00, 0x5E, 0xC0, 0x03, 0x04, 0xF2, 0xC4, 0x00, 0x00, 0x5A, 0xC0, 0x07,
+0x00, 0x58, 0xC0, 0x03, 0x00, 0x56, 0xC0, 0x03, 0x00, 0x54, 0xC0, 0x03, 0x00, 0x52, 0xC0, 0x03,
+0x00, 0x50, 0xC0, 0x03, 0x00, 0x78, 0xC0, 0x03, 0x00, 0x4C, 0xC0, 0x03, 0x00, 0x4A, 0xC0, 0x03,
+0x00, 0x48, 0xC0, 0x03, 0x00, 0x46, 0xC0, 0x03, 0x00, 0x44, 0xC0, 0x03, 0x00, 0x42, 0xC0, 0x03,
+0x00, 0x40, 0xC0, 0x03, 0x00, 0x3E, 0xC0, 0x03, 0x00, 0x3C, 0xC0, 0x03, 0x00, 0x3A, 0xC0, 0x03,
+0x00, 0x38, 0xC0, 0x03, 0x00, 0x36, 0xC0, 0x03, 0x00, 0x34, 0xC0, 0x03, 0x00, 0x32, 0xC0, 0x03,
+0x00, 0x30, 0xC0, 0x03, 0x00, 0x2E, 0xC0, 0x03, 0x00, 0x2C, 0xC0, 0x03, 0x00, 0x2A, 0xC0, 0x03,
+0x00, 0x28, 0xC0, 0x03, 0x00, 0x26, 0xC0, 0x03, 0x00, 0x24, 0xC0, 0x03, 0x00, 0x22, 0xC0, 0x03,
+0x00, 0x20, 0xC0, 0x03, 0x00, 0x1E, 0xC0, 0x03, 0x00, 0x1C, 0xC0, 0x03, 0x40, 0x11, 0x24, 0x1F,
+0xBE, 0xCF, 0xEF, 0xDA, 0xE0, 0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xE2,
+0xE3, 0xFF, 0xE7, 0x02, 0xC0, 0x05, 0x90, 0x0D, 0x92, 0xA8, 0x3A, 0xB1, 0x07, 0xD9, 0xF7, 0x11,
+0xE0, 0xA8, 0xEA, 0xB1, 0xE0, 0x01, 0xC0, 0x1D, 0x92, 0xAE, 0x3B, 0xB1, 0x07, 0xE1, 0xF7, 0x8F,
+0xD3, 0x26, 0xC7, 0x8E, 0xCF, 0xF8, 0x94, 0x10, 0x92, 0x6F, 0x00, 0x10, 0x92, 0x81, 0xC0, 0x03,
+0x00, 0x85, 0xC0, 0x03, 0x55, 0x84, 0x00, 0x81, 0xE0, 0x85, 0xBF, 0x15, 0xBE, 0x47, 0x98, 0x5D,
+0x9A, 0x28, 0x9A, 0x0C, 0x94, 0x00, 0x00, 0x08, 0x95, 0x20, 0x91, 0xB2, 0x01, 0x30, 0x91, 0xB3,
+0x01, 0x2F, 0x5F, 0x3F, 0x4F, 0x30, 0x93, 0xB3, 0x01, 0x20, 0x93, 0xB2, 0x01, 0x93, 0x2F, 0x37,
+0xFF, 0x03, 0xC0, 0x8E, 0xEF, 0x83, 0x1B, 0x98, 0x2F, 0x99, 0x0F, 0x92, 0x17, 0x10, 0xF4, 0x47,
+0x98, 0x08, 0x95, 0x47, 0x9A, 0x08, 0x95, 0x1F, 0x92, 0x0F, 0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11,
+0x24, 0x2F, 0x93, 0x8F, 0x93, 0x9F, 0x93, 0xEF, 0x93, 0xFF, 0x93, 0xC5, 0x5B, 0x1E, 0x80, 0x91,
+0xA8, 0x01, 0x90, 0x91, 0xA9, 0x01, 0x00, 0x97, 0x41, 0xF0, 0x01, 0x97, 0x90, 0x93, 0xA9, 0x01,
+0x80, 0x93, 0xA8, 0x01, 0x89, 0x2B, 0x09, 0xF4, 0x5D, 0x9A, 0x80, 0x91, 0xAA, 0xC0, 0x1B, 0x00,
+0xAB, 0xC6, 0x1B, 0x00, 0xAB, 0xC0, 0x1B, 0x00, 0xAA, 0xC2, 0x1B, 0x12, 0x28, 0x9A, 0xE0, 0xE0,
+0xF0, 0xE0, 0x85, 0x91, 0x94, 0x91, 0x8F, 0x5F, 0x9F, 0x4F, 0x49, 0xF0, 0x80, 0x91, 0xAC, 0xC0,
+0x29, 0x06, 0xAD, 0x01, 0x01, 0x96, 0x90, 0x93, 0xAD, 0xC0, 0x25, 0x27, 0xAC, 0x01, 0xFF, 0x91,
+0xEF, 0x91, 0x9F, 0x91, 0x8F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90,
+0x18, 0x95, 0x84, 0xE0, 0x80, 0x93, 0xE9, 0x00, 0x0D, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77,
+0x80, 0x93, 0xE8, 0x00, 0xC0, 0xAF, 0x03, 0xB3, 0x88, 0x23, 0x51, 0xC0, 0x3F, 0x05, 0xE8, 0x00,
+0x82, 0xFF, 0xF9, 0xCF, 0xC1, 0x07, 0x02, 0x85, 0xFF, 0xEF, 0xC0, 0x07, 0x00, 0xF1, 0xC0, 0xE5,
+0x02, 0x98, 0x2F, 0x83, 0xC2, 0x31, 0xC2, 0x15, 0x00, 0xFD, 0xC3, 0x37, 0x00, 0x8E, 0xC8, 0x37,
+0x00, 0x69, 0xC2, 0x37, 0x00, 0x80, 0xC0, 0x37, 0x09, 0x90, 0x93, 0xF1, 0x00, 0x5D, 0x98, 0x84,
+0xE6, 0x90, 0xE0, 0xC5, 0xC1, 0x21, 0x08, 0x95, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92,
+0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92,
+0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0xC3, 0x8D, 0xC3, 0x79, 0x02, 0x57, 0xC2, 0x28,
+0xC4, 0x3D, 0xC3, 0xE3, 0x0B, 0xAA, 0xDF, 0x18, 0x2F, 0x85, 0x34, 0x81, 0xF4, 0x8C, 0xE4, 0x9D,
+0xE1, 0xC5, 0xD1, 0x3E, 0x07, 0xB6, 0x00, 0xFC, 0xFD, 0xCF, 0xF9, 0x99, 0xFE, 0xCF, 0x81, 0xE1,
+0x80, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x03, 0xC0, 0x84, 0x35, 0x19, 0xF4, 0x94, 0xDF, 0x8D, 0xE0,
+0x0D, 0xC2, 0x8C, 0x34, 0xE1, 0xF3, 0x80, 0x35, 0xD1, 0xF3, 0x84, 0x37, 0x21, 0xF4, 0x84, 0xE4,
+0xA2, 0xDF, 0x80, 0xE0, 0x03, 0xC2, 0x81, 0x36, 0x11, 0xF4, 0x89, 0xE5, 0xFF, 0xC1, 0x81, 0x34,
+0xB1, 0xF4, 0x81, 0xC0, 0x51, 0x6C, 0x7F, 0xDF, 0x90, 0xE0, 0x88, 0x0F, 0x99, 0x1F, 0xAA, 0x27,
+0x97, 0xFD, 0xA0, 0x95, 0xBA, 0x2F, 0x31, 0x2F, 0x33, 0x0F, 0x20, 0xE0, 0x44, 0x27, 0x37, 0xFD,
+0x40, 0x95, 0x54, 0x2F, 0x82, 0x2B, 0x93, 0x2B, 0xA4, 0x2B, 0xB5, 0x2B, 0xB8, 0xC1, 0x80, 0x37,
+0x11, 0xF4, 0x83, 0xE5, 0xE3, 0xC1, 0x83, 0x35, 0x49, 0xF4, 0xC0, 0xE0, 0xD1, 0xE0, 0x89, 0x91,
+0x7A, 0xDF, 0x21, 0xE0, 0xC7, 0x30, 0xD2, 0x07, 0xD1, 0xF7, 0xD9, 0xC1, 0x86, 0x35, 0x21, 0xF4,
+0x81, 0xE3, 0x71, 0xDF, 0x80, 0xE3, 0xD2, 0xC1, 0x83, 0x37, 0x31, 0xF4, 0x87, 0xE8, 0x6B, 0xDF,
+0x85, 0xE9, 0x69, 0xDF, 0x8E, 0xE1, 0xCA, 0xC1, 0x85, 0x36, 0xB9, 0xF4, 0xE0, 0xE0, 0xF0, 0xE0,
+0x93, 0xE0, 0x85, 0xC0, 0xCB, 0xC1, 0xA3, 0xC3, 0xB5, 0xC3, 0xAF, 0xC3, 0x0B, 0x12, 0xE0, 0x58,
+0xFF, 0x4F, 0xA0, 0xE7, 0xE0, 0x30, 0xFA, 0x07, 0x71, 0xF7, 0xA2, 0xCF, 0x82, 0x37, 0x39, 0xF4,
+0xE1, 0xC0, 0x31, 0x01, 0x89, 0xE0, 0xC1, 0x23, 0x06, 0x84, 0x91, 0xA8, 0xC1, 0x86, 0x34, 0x39,
+0xC2, 0x43, 0xC5, 0x11, 0x02, 0x9F, 0xC1, 0x8E, 0xC0, 0x11, 0x00, 0xE3, 0xC8, 0x11, 0x06, 0x96,
+0xC1, 0x81, 0x35, 0x39, 0xF4, 0xE2, 0xC8, 0x11, 0x04, 0x8D, 0xC1, 0x82, 0x36, 0x31, 0xC0, 0xEB,
+0x00, 0x26, 0xC0, 0xF7, 0x3C, 0x24, 0xDF, 0x80, 0xE8, 0x85, 0xC1, 0x82, 0x34, 0x19, 0xF0, 0x87,
+0x36, 0x09, 0xF0, 0xE5, 0xC0, 0x10, 0x92, 0xAD, 0x01, 0x10, 0x92, 0xAC, 0x01, 0x00, 0xDF, 0x08,
+0x2F, 0xFE, 0xDE, 0xF8, 0x2E, 0xFC, 0xDE, 0x68, 0x2E, 0x85, 0x54, 0x82, 0x30, 0x08, 0xF0, 0x71,
+0xC1, 0x90, 0x2F, 0x80, 0xE0, 0xCF, 0x2D, 0xD0, 0xE0, 0xC8, 0x2B, 0xD9, 0x2B, 0x10, 0x92, 0x6F,
+0x00, 0x17, 0xC0, 0x31, 0x03, 0x4B, 0xC0, 0x81, 0xE1, 0xC3, 0xAF, 0x41, 0xDD, 0x24, 0xCC, 0x24,
+0xC3, 0x94, 0x3F, 0xC0, 0xE0, 0x90, 0xAE, 0x01, 0xF0, 0x90, 0xAF, 0x01, 0x00, 0x91, 0xB0, 0x01,
+0x10, 0x91, 0xB1, 0x01, 0xB6, 0xE4, 0x6B, 0x16, 0xD9, 0xF4, 0xED, 0x2D, 0xF0, 0xE0, 0xEE, 0x29,
+0xFF, 0x29, 0xE4, 0x91, 0x8E, 0x2F, 0xEA, 0xDE, 0xDD, 0x20, 0x81, 0xF0, 0x82, 0xE0, 0x90, 0xE0,
+0xA0, 0xE0, 0xB0, 0xE0, 0xE8, 0x0E, 0xF9, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0xE0, 0x92, 0xC0, 0x37,
+0x00, 0x92, 0xC0, 0x37, 0x00, 0x93, 0xC0, 0x37, 0x16, 0x93, 0xB1, 0x01, 0xDC, 0x24, 0x18, 0xC0,
+0xD8, 0x01, 0xC7, 0x01, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0x59, 0xD5, 0xCE, 0xDE,
+0xDD, 0x33, 0x0A, 0x21, 0x97, 0x20, 0x97, 0x09, 0xF0, 0xBE, 0xCF, 0x7D, 0xC0, 0x80, 0xC0, 0x85,
+0x00, 0x90, 0xC0, 0x85, 0x13, 0xA0, 0x90, 0xB0, 0x01, 0xB0, 0x90, 0xB1, 0x01, 0x96, 0xE4, 0x69,
+0x16, 0x09, 0xF0, 0x5D, 0xC0, 0x83, 0xE0, 0xF4, 0x01, 0xC3, 0xAF, 0x11, 0x07, 0xB6, 0x00, 0xFC,
+0xFD, 0xCF, 0x54, 0xC0, 0xF6, 0xE4, 0x6F, 0x16, 0x61, 0xF5, 0x77, 0x20, 0x31, 0xF1, 0xCD, 0xB9,
+0x13, 0x7E, 0xDE, 0xD8, 0x2E, 0xCC, 0x24, 0x85, 0x2D, 0x90, 0xE0, 0x8C, 0x29, 0x9D, 0x29, 0xF7,
+0x01, 0x0C, 0x01, 0x40, 0x92, 0xC1, 0x39, 0x01, 0x11, 0x24, 0xDD, 0x87, 0x09, 0x02, 0xC0, 0x60,
+0xDE, 0x58, 0x2E, 0x74, 0x24, 0x23, 0xC0, 0xCD, 0x53, 0x11, 0x16, 0x95, 0x07, 0x95, 0xF7, 0x94,
+0xE7, 0x94, 0x50, 0xDE, 0x68, 0x2F, 0xC7, 0x01, 0xF7, 0xD4, 0x80, 0x91, 0xC0, 0xA7, 0x00, 0x91,
+0xC0, 0xA7, 0xC0, 0x1F, 0x00, 0xB0, 0xC0, 0x1F, 0x07, 0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0x80,
+0x93, 0xC0, 0x15, 0x00, 0x93, 0xC0, 0x15, 0xC0, 0x4F, 0x00, 0xB0, 0xC2, 0xD7, 0x09, 0x04, 0xC0,
+0x55, 0x24, 0x77, 0x24, 0x44, 0x24, 0x43, 0x94, 0xC1, 0xE1, 0x01, 0xA5, 0xCF, 0xC1, 0xCF, 0x02,
+0x41, 0xF4, 0x85, 0xCC, 0xCD, 0x10, 0x8D, 0xE0, 0x3C, 0xDE, 0x82, 0xE0, 0x80, 0x93, 0x6F, 0x00,
+0x9C, 0xC0, 0x83, 0x34, 0x71, 0xF4, 0x00, 0xC0, 0x5D, 0x00, 0x10, 0xC0, 0x5D, 0x06, 0x19, 0xDE,
+0x90, 0xE0, 0x21, 0xE0, 0xF8, 0xC0, 0xC1, 0x00, 0x20, 0xC2, 0x2D, 0x07, 0x11, 0x24, 0x7C, 0xCE,
+0x83, 0x36, 0x19, 0xF5, 0xCD, 0x9D, 0x05, 0x05, 0xDE, 0xF7, 0x01, 0xE1, 0x60, 0xC1, 0x2B, 0xC7,
+0x29, 0xDD, 0xEB, 0x06, 0x57, 0xCE, 0x8D, 0x36, 0x61, 0xF4, 0xE0, 0xC0, 0x69, 0x00, 0xF0, 0xC0,
+0x69, 0x00, 0x85, 0xC0, 0x7D, 0xC7, 0x8F, 0x04, 0x49, 0xCE, 0x82, 0x35, 0x51, 0xC6, 0x1B, 0x0E,
+0x05, 0x91, 0x14, 0x91, 0x81, 0x2F, 0xEB, 0xDD, 0x80, 0x2F, 0x4C, 0xC0, 0x84, 0x34, 0x21, 0xCE,
+0x7D, 0x10, 0x16, 0x95, 0x07, 0x95, 0xF7, 0x94, 0xE7, 0x94, 0xC2, 0xDD, 0x68, 0x2F, 0xC7, 0x01,
+0x69, 0xD4, 0x80, 0xC0, 0x37, 0x00, 0x90, 0xC0, 0x37, 0x00, 0xA0, 0xC0, 0x1F, 0x00, 0xB0, 0xC0,
+0x1F, 0x07, 0x02, 0x96, 0xA1, 0x1D, 0xB1, 0x1D, 0x80, 0x93, 0xC0, 0x15, 0x00, 0x93, 0xC0, 0x15,
+0xC0, 0x7F, 0x00, 0xB0, 0xC0, 0x7F, 0x04, 0x17, 0xCE, 0x84, 0x36, 0x09, 0xCE, 0x4B, 0x0F, 0xD8,
+0x01, 0xC7, 0x01, 0xB6, 0x95, 0xA7, 0x95, 0x97, 0x95, 0x87, 0x95, 0x3C, 0xD4, 0xB1, 0xDD, 0xDD,
+0xC5, 0x0A, 0x04, 0xC0, 0x8B, 0x31, 0x11, 0xF0, 0x8F, 0xE3, 0x9C, 0xDD, 0x83, 0xC0, 0xC1, 0x06,
+0xE9, 0x00, 0x90, 0x91, 0xE8, 0x00, 0x80, 0xC0, 0x03, 0x11, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00,
+0x95, 0xFF, 0x04, 0xC0, 0x10, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0xC9, 0xF0, 0xC1, 0x15, 0x03, 0x80,
+0xFF, 0xF9, 0xCF, 0xC7, 0x1D, 0x00, 0x03, 0xC2, 0x19, 0x00, 0x61, 0xC6, 0x19, 0x00, 0x84, 0xC2,
+0x41, 0xC1, 0x0D, 0x00, 0x8B, 0xC2, 0x1F, 0x3C, 0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x0F, 0x91,
 0xFF, 0x90, 0xEF, 0x90, 0xDF, 0x90, 0xCF, 0x90, 0xBF, 0x90, 0xAF, 0x90, 0x9F, 0x90, 0x8F, 0x90,
 0x7F, 0x90, 0x6F, 0x90, 0x5F, 0x90, 0x4F, 0x90, 0x08, 0x95, 0x90, 0x91, 0xB6, 0x01, 0x89, 0x2F,
 0x8F, 0x77, 0x81, 0x32, 0x49, 0xF5, 0x80, 0x91, 0xB7, 0x01, 0x80, 0x32, 0xA1, 0xF0, 0x81, 0x32,
-0x19, 0xF5, 0x91, 0x3A, 0x09, 0xF5, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00,
-0x8D, 0xE0, 0x91, 0xE0, 0x67, 0xE0, 0x70, 0xE0, 0x0B, 0xD2, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77,
-0x80, 0x93, 0xE8, 0x00, 0x08, 0x95, 0x91, 0x32, 0x79, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F,
-0x80, 0x93, 0xE8, 0x00, 0x8D, 0xE0, 0x91, 0xE0, 0x67, 0xE0, 0x70, 0xE0, 0x5D, 0xD2, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x08, 0x95, 0x82, 0xE0, 0x61, 0xEC, 0x42, 0xE0,
-0xB5, 0xD0, 0x83, 0xE0, 0x61, 0xE8, 0x42, 0xE1, 0xB1, 0xD0, 0x84, 0xE0, 0x60, 0xE8, 0x42, 0xE1,
-0xAD, 0xC0, 0x84, 0xB7, 0x87, 0x7F, 0x84, 0xBF, 0x88, 0xE1, 0x0F, 0xB6, 0xF8, 0x94, 0x80, 0x93,
-0x60, 0x00, 0x10, 0x92, 0x60, 0x00, 0x0F, 0xBE, 0x20, 0xE8, 0x80, 0xE0, 0x90, 0xE0, 0x0F, 0xB6,
-0xF8, 0x94, 0x20, 0x93, 0x61, 0x00, 0x80, 0x93, 0x61, 0x00, 0x0F, 0xBE, 0x81, 0xE0, 0x85, 0xBF,
-0x92, 0xE0, 0x95, 0xBF, 0x3F, 0x9A, 0x20, 0x9A, 0x55, 0x9A, 0xE1, 0xE6, 0xF0, 0xE0, 0x20, 0x83,
-0x10, 0x82, 0x47, 0x98, 0x5D, 0x9A, 0x28, 0x9A, 0x10, 0x92, 0x89, 0x00, 0x8A, 0xEF, 0x80, 0x93,
-0x88, 0x00, 0x90, 0x93, 0x6F, 0x00, 0x83, 0xE0, 0x80, 0x93, 0x81, 0x00, 0xF0, 0xC0, 0x40, 0x91,
-0x00, 0x08, 0x50, 0x91, 0x01, 0x08, 0x10, 0x92, 0x01, 0x08, 0x10, 0x92, 0x00, 0x08, 0x94, 0xB7,
-0x14, 0xBE, 0x88, 0xE1, 0x0F, 0xB6, 0xF8, 0x94, 0x80, 0x93, 0x60, 0x00, 0x10, 0x92, 0x60, 0x00,
-0x0F, 0xBE, 0x29, 0x2F, 0x30, 0xE0, 0xF9, 0x01, 0xE2, 0x70, 0xF0, 0x70, 0x91, 0xFD, 0x18, 0xC0,
-0x90, 0xFF, 0x05, 0xC0, 0x85, 0x91, 0x94, 0x91, 0x8F, 0x5F, 0x9F, 0x4F, 0x81, 0xF4, 0x23, 0xFF,
-0x0F, 0xC0, 0x80, 0x91, 0x09, 0x01, 0x90, 0x91, 0x0A, 0x01, 0x48, 0x17, 0x59, 0x07, 0x41, 0xF0,
-0xE0, 0xE0, 0xF0, 0xE0, 0x85, 0x91, 0x94, 0x91, 0x8F, 0x5F, 0x9F, 0x4F, 0x09, 0xF0, 0x42, 0xDC,
-0xA0, 0xDF, 0x78, 0x94, 0x10, 0x92, 0xAD, 0x01, 0x10, 0x92, 0xAC, 0x01, 0x0C, 0xC0, 0xDE, 0xDC,
-0x36, 0xD3, 0x80, 0x91, 0xAC, 0x01, 0x90, 0x91, 0xAD, 0x01, 0x81, 0x54, 0x9F, 0x41, 0x10, 0xF0,
-0x10, 0x92, 0x14, 0x01, 0x41, 0xDC, 0x80, 0x91, 0x14, 0x01, 0x88, 0x23, 0x81, 0xF7, 0x80, 0x91,
-0xE0, 0x00, 0x81, 0x60, 0x80, 0x93, 0xE0, 0x00, 0x25, 0xDC, 0x80, 0xE0, 0x90, 0xE0, 0x08, 0x95,
-0xFA, 0x01, 0x92, 0x30, 0x49, 0xF0, 0x93, 0x30, 0x61, 0xF0, 0x91, 0x30, 0xF9, 0xF4, 0x85, 0xE1,
-0x91, 0xE0, 0x22, 0xE1, 0x30, 0xE0, 0x1E, 0xC0, 0x87, 0xE2, 0x91, 0xE0, 0x2E, 0xE3, 0x30, 0xE0,
-0x19, 0xC0, 0x88, 0x23, 0x29, 0xF4, 0x85, 0xE6, 0x91, 0xE0, 0x24, 0xE0, 0x30, 0xE0, 0x12, 0xC0,
-0x81, 0x30, 0x29, 0xF4, 0x89, 0xE6, 0x91, 0xE0, 0x22, 0xE2, 0x30, 0xE0, 0x0B, 0xC0, 0x82, 0x30,
-0x29, 0xF4, 0x8D, 0xE8, 0x91, 0xE0, 0x28, 0xE1, 0x30, 0xE0, 0x04, 0xC0, 0x80, 0xE0, 0x90, 0xE0,
-0x20, 0xE0, 0x30, 0xE0, 0x91, 0x83, 0x80, 0x83, 0xC9, 0x01, 0x08, 0x95, 0x80, 0x93, 0xE9, 0x00,
-0x80, 0x91, 0xEB, 0x00, 0x81, 0x60, 0x80, 0x93, 0xEB, 0x00, 0x10, 0x92, 0xED, 0x00, 0x60, 0x93,
-0xEC, 0x00, 0x40, 0x93, 0xED, 0x00, 0x80, 0x91, 0xEE, 0x00, 0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F,
-0x08, 0x95, 0x80, 0x91, 0xB6, 0x01, 0x88, 0x23, 0x8C, 0xF4, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23,
-0xB1, 0xF0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF9, 0xCF, 0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77,
-0x80, 0x93, 0xE8, 0x00, 0x08, 0x95, 0x8E, 0xB3, 0x88, 0x23, 0x49, 0xF0, 0x80, 0x91, 0xE8, 0x00,
-0x80, 0xFF, 0xF9, 0xCF, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x08, 0x95,
-0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0x45, 0xD0, 0x4C, 0xD0, 0x08, 0xED, 0x10, 0xE0,
-0xF8, 0x01, 0x80, 0x81, 0x8F, 0x77, 0x80, 0x83, 0x80, 0x81, 0x80, 0x68, 0x80, 0x83, 0x80, 0x81,
-0x8F, 0x7D, 0x80, 0x83, 0x19, 0xBC, 0x1E, 0xBA, 0x10, 0x92, 0xB4, 0x01, 0x80, 0xEE, 0xE8, 0x2E,
-0xF1, 0x2C, 0xF7, 0x01, 0x80, 0x81, 0x8B, 0x7F, 0x80, 0x83, 0xF8, 0x01, 0x80, 0x81, 0x81, 0x60,
-0x80, 0x83, 0x80, 0xE0, 0x60, 0xE0, 0x42, 0xE0, 0xA9, 0xDF, 0xE1, 0xEE, 0xF0, 0xE0, 0x80, 0x81,
-0x8E, 0x7F, 0x80, 0x83, 0xE2, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0x81, 0x60, 0x80, 0x83, 0x80, 0x81,
-0x88, 0x60, 0x80, 0x83, 0xF7, 0x01, 0x80, 0x81, 0x8E, 0x7F, 0x80, 0x83, 0xF8, 0x01, 0x80, 0x81,
-0x80, 0x61, 0x80, 0x83, 0x1F, 0x91, 0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0x08, 0x95, 0xE7, 0xED,
-0xF0, 0xE0, 0x80, 0x81, 0x81, 0x60, 0x80, 0x83, 0x8A, 0xE4, 0x82, 0xBF, 0x81, 0xE0, 0x80, 0x93,
-0xB5, 0x01, 0xB6, 0xCF, 0xE8, 0xED, 0xF0, 0xE0, 0x80, 0x81, 0x8E, 0x7F, 0x80, 0x83, 0x10, 0x92,
-0xE2, 0x00, 0x08, 0x95, 0x10, 0x92, 0xDA, 0x00, 0x10, 0x92, 0xE1, 0x00, 0x08, 0x95, 0x1F, 0x92,
-0x0F, 0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11, 0x24, 0x2F, 0x93, 0x3F, 0x93, 0x4F, 0x93, 0x5F, 0x93,
-0x6F, 0x93, 0x7F, 0x93, 0x8F, 0x93, 0x9F, 0x93, 0xAF, 0x93, 0xBF, 0x93, 0xEF, 0x93, 0xFF, 0x93,
-0x80, 0x91, 0xDA, 0x00, 0x80, 0xFF, 0x1B, 0xC0, 0x80, 0x91, 0xD8, 0x00, 0x80, 0xFF, 0x17, 0xC0,
-0x80, 0x91, 0xDA, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xDA, 0x00, 0x80, 0x91, 0xD9, 0x00, 0x80, 0xFF,
-0x0B, 0xC0, 0x80, 0xE1, 0x89, 0xBD, 0x82, 0xE1, 0x89, 0xBD, 0x09, 0xB4, 0x00, 0xFE, 0xFD, 0xCF,
-0x81, 0xE0, 0x8E, 0xBB, 0x3B, 0xD2, 0x03, 0xC0, 0x19, 0xBC, 0x1E, 0xBA, 0x37, 0xD2, 0x80, 0x91,
-0xE1, 0x00, 0x80, 0xFF, 0x17, 0xC0, 0x80, 0x91, 0xE2, 0x00, 0x80, 0xFF, 0x13, 0xC0, 0x80, 0x91,
-0xE2, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x80, 0x61, 0x80, 0x93,
-0xE2, 0x00, 0x80, 0x91, 0xD8, 0x00, 0x80, 0x62, 0x80, 0x93, 0xD8, 0x00, 0x19, 0xBC, 0x85, 0xE0,
-0x8E, 0xBB, 0x1C, 0xD2, 0x80, 0x91, 0xE1, 0x00, 0x84, 0xFF, 0x2C, 0xC0, 0x80, 0x91, 0xE2, 0x00,
-0x84, 0xFF, 0x28, 0xC0, 0x80, 0xE1, 0x89, 0xBD, 0x82, 0xE1, 0x89, 0xBD, 0x09, 0xB4, 0x00, 0xFE,
-0xFD, 0xCF, 0x80, 0x91, 0xD8, 0x00, 0x8F, 0x7D, 0x80, 0x93, 0xD8, 0x00, 0x80, 0x91, 0xE1, 0x00,
-0x8F, 0x7E, 0x80, 0x93, 0xE1, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x8F, 0x7E, 0x80, 0x93, 0xE2, 0x00,
-0x80, 0x91, 0xE2, 0x00, 0x81, 0x60, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xB4, 0x01, 0x88, 0x23,
-0x31, 0xF4, 0x80, 0x91, 0xE3, 0x00, 0x87, 0xFD, 0x02, 0xC0, 0x81, 0xE0, 0x01, 0xC0, 0x84, 0xE0,
-0x8E, 0xBB, 0xEC, 0xD1, 0x80, 0x91, 0xE1, 0x00, 0x83, 0xFF, 0x21, 0xC0, 0x80, 0x91, 0xE2, 0x00,
-0x83, 0xFF, 0x1D, 0xC0, 0x80, 0x91, 0xE1, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE1, 0x00, 0x82, 0xE0,
-0x8E, 0xBB, 0x10, 0x92, 0xB4, 0x01, 0x80, 0x91, 0xE1, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE1, 0x00,
-0x80, 0x91, 0xE2, 0x00, 0x8E, 0x7F, 0x80, 0x93, 0xE2, 0x00, 0x80, 0x91, 0xE2, 0x00, 0x80, 0x61,
-0x80, 0x93, 0xE2, 0x00, 0x80, 0xE0, 0x60, 0xE0, 0x42, 0xE0, 0xD8, 0xDE, 0xC7, 0xD1, 0xFF, 0x91,
-0xEF, 0x91, 0xBF, 0x91, 0xAF, 0x91, 0x9F, 0x91, 0x8F, 0x91, 0x7F, 0x91, 0x6F, 0x91, 0x5F, 0x91,
-0x4F, 0x91, 0x3F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90, 0x18, 0x95,
-0x9C, 0x01, 0x40, 0x91, 0xBC, 0x01, 0x50, 0x91, 0xBD, 0x01, 0x46, 0x17, 0x57, 0x07, 0x18, 0xF4,
-0xF9, 0x01, 0x90, 0xE0, 0x44, 0xC0, 0x61, 0x15, 0x71, 0x05, 0x11, 0xF0, 0xAB, 0x01, 0xF8, 0xCF,
-0x80, 0x91, 0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x40, 0xE0, 0x50, 0xE0, 0xF0, 0xCF,
-0x8E, 0xB3, 0x88, 0x23, 0x09, 0xF4, 0x44, 0xC0, 0x85, 0x30, 0x09, 0xF4, 0x43, 0xC0, 0x80, 0x91,
-0xE8, 0x00, 0x83, 0xFF, 0x02, 0xC0, 0x81, 0xE0, 0x08, 0x95, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFD,
-0x31, 0xC0, 0x80, 0x91, 0xE8, 0x00, 0x80, 0xFF, 0x22, 0xC0, 0x80, 0x91, 0xF3, 0x00, 0x90, 0x91,
-0xF2, 0x00, 0x78, 0x2F, 0x60, 0xE0, 0x29, 0x2F, 0x30, 0xE0, 0x26, 0x2B, 0x37, 0x2B, 0x07, 0xC0,
-0x81, 0x91, 0x80, 0x93, 0xF1, 0x00, 0x41, 0x50, 0x50, 0x40, 0x2F, 0x5F, 0x3F, 0x4F, 0x41, 0x15,
-0x51, 0x05, 0x19, 0xF0, 0x28, 0x30, 0x31, 0x05, 0x98, 0xF3, 0x90, 0xE0, 0x28, 0x30, 0x31, 0x05,
-0x09, 0xF4, 0x91, 0xE0, 0x80, 0x91, 0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x41, 0x15,
-0x51, 0x05, 0x31, 0xF6, 0x99, 0x23, 0x21, 0xF6, 0x05, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x41, 0xF0,
-0x85, 0x30, 0x41, 0xF0, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF7, 0xCF, 0x80, 0xE0, 0x08, 0x95,
-0x82, 0xE0, 0x08, 0x95, 0x83, 0xE0, 0x08, 0x95, 0x9C, 0x01, 0x61, 0x15, 0x71, 0x05, 0x29, 0xF4,
-0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00, 0xF9, 0x01, 0x26, 0xC0, 0x8E, 0xB3,
-0x88, 0x23, 0x91, 0xF1, 0x85, 0x30, 0x91, 0xF1, 0x80, 0x91, 0xE8, 0x00, 0x83, 0xFF, 0x02, 0xC0,
-0x81, 0xE0, 0x08, 0x95, 0x80, 0x91, 0xE8, 0x00, 0x82, 0xFF, 0xF1, 0xCF, 0x06, 0xC0, 0x80, 0x91,
-0xF1, 0x00, 0x81, 0x93, 0x61, 0x50, 0x70, 0x40, 0x59, 0xF0, 0x20, 0x91, 0xF3, 0x00, 0x80, 0x91,
-0xF2, 0x00, 0x32, 0x2F, 0x20, 0xE0, 0x90, 0xE0, 0x82, 0x2B, 0x93, 0x2B, 0x89, 0x2B, 0x79, 0xF7,
-0x80, 0x91, 0xE8, 0x00, 0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x61, 0x15, 0x71, 0x05, 0xB9, 0xF6,
-0x05, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0x41, 0xF0, 0x85, 0x30, 0x41, 0xF0, 0x80, 0x91, 0xE8, 0x00,
-0x80, 0xFF, 0xF7, 0xCF, 0x80, 0xE0, 0x08, 0x95, 0x82, 0xE0, 0x08, 0x95, 0x83, 0xE0, 0x08, 0x95,
-0x0F, 0x93, 0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0, 0xCD, 0xB7, 0xDE, 0xB7, 0xE6, 0xEB,
-0xF1, 0xE0, 0x80, 0x91, 0xF1, 0x00, 0x81, 0x93, 0x81, 0xE0, 0xEE, 0x3B, 0xF8, 0x07, 0xC9, 0xF7,
-0x24, 0xDD, 0x80, 0x91, 0xE8, 0x00, 0x83, 0xFF, 0xE4, 0xC0, 0x80, 0x91, 0xB6, 0x01, 0x90, 0x91,
-0xB7, 0x01, 0x95, 0x30, 0x09, 0xF4, 0x6D, 0xC0, 0x96, 0x30, 0x40, 0xF4, 0x91, 0x30, 0x81, 0xF1,
-0x91, 0x30, 0x70, 0xF0, 0x93, 0x30, 0x09, 0xF0, 0xD4, 0xC0, 0x2A, 0xC0, 0x98, 0x30, 0x09, 0xF4,
-0xA3, 0xC0, 0x99, 0x30, 0x09, 0xF4, 0xB2, 0xC0, 0x96, 0x30, 0x09, 0xF0, 0xCA, 0xC0, 0x7C, 0xC0,
-0x80, 0x38, 0x09, 0xF4, 0xC6, 0xC0, 0x82, 0x38, 0x09, 0xF0, 0xC3, 0xC0, 0x80, 0x91, 0xBA, 0x01,
-0x87, 0x70, 0x80, 0x93, 0xE9, 0x00, 0x80, 0x91, 0xEB, 0x00, 0x10, 0x92, 0xE9, 0x00, 0x20, 0x91,
-0xE8, 0x00, 0x27, 0x7F, 0x20, 0x93, 0xE8, 0x00, 0x90, 0xE0, 0x25, 0xE0, 0x96, 0x95, 0x87, 0x95,
-0x2A, 0x95, 0xE1, 0xF7, 0x81, 0x70, 0x80, 0x93, 0xF1, 0x00, 0x10, 0x92, 0xF1, 0x00, 0x87, 0xC0,
-0x88, 0x23, 0x19, 0xF0, 0x82, 0x30, 0x09, 0xF0, 0xA4, 0xC0, 0x8F, 0x71, 0x82, 0x30, 0x09, 0xF0,
-0xA0, 0xC0, 0x80, 0x91, 0xB8, 0x01, 0x88, 0x23, 0x31, 0xF5, 0x20, 0x91, 0xBA, 0x01, 0x27, 0x70,
-0x09, 0xF4, 0x97, 0xC0, 0x20, 0x93, 0xE9, 0x00, 0x80, 0x91, 0xEB, 0x00, 0x80, 0xFF, 0x1B, 0xC0,
-0x93, 0x30, 0x21, 0xF4, 0x80, 0x91, 0xEB, 0x00, 0x80, 0x62, 0x13, 0xC0, 0x80, 0x91, 0xEB, 0x00,
-0x80, 0x61, 0x80, 0x93, 0xEB, 0x00, 0x81, 0xE0, 0x90, 0xE0, 0x02, 0xC0, 0x88, 0x0F, 0x99, 0x1F,
-0x2A, 0x95, 0xE2, 0xF7, 0x80, 0x93, 0xEA, 0x00, 0x10, 0x92, 0xEA, 0x00, 0x80, 0x91, 0xEB, 0x00,
-0x88, 0x60, 0x80, 0x93, 0xEB, 0x00, 0x10, 0x92, 0xE9, 0x00, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F,
-0x51, 0xC0, 0x88, 0x23, 0x09, 0xF0, 0x6D, 0xC0, 0x10, 0x91, 0xB8, 0x01, 0x1F, 0x77, 0x0F, 0xB7,
-0xF8, 0x94, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x9A, 0xDD, 0x80, 0x91,
-0xE8, 0x00, 0x80, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xE3, 0x00, 0x80, 0x78, 0x81, 0x2B, 0x80, 0x93,
-0xE3, 0x00, 0x80, 0x68, 0x80, 0x93, 0xE3, 0x00, 0x11, 0x23, 0x11, 0xF4, 0x82, 0xE0, 0x01, 0xC0,
-0x83, 0xE0, 0x8E, 0xBB, 0x0F, 0xBF, 0x4D, 0xC0, 0x80, 0x58, 0x82, 0x30, 0x08, 0xF0, 0x49, 0xC0,
-0x80, 0x91, 0xB8, 0x01, 0x90, 0x91, 0xB9, 0x01, 0x60, 0x91, 0xBA, 0x01, 0xAE, 0x01, 0x4F, 0x5F,
-0x5F, 0x4F, 0x36, 0xDD, 0xBC, 0x01, 0x00, 0x97, 0x09, 0xF4, 0x3B, 0xC0, 0x80, 0x91, 0xE8, 0x00,
-0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x89, 0x81, 0x9A, 0x81, 0x92, 0xDE, 0x80, 0x91, 0xE8, 0x00,
-0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x2D, 0xC0, 0x80, 0x38, 0x59, 0xF5, 0x80, 0x91, 0xE8, 0x00,
-0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x80, 0x91, 0xB4, 0x01, 0x80, 0x93, 0xF1, 0x00, 0x80, 0x91,
-0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x54, 0xDD, 0x1B, 0xC0, 0x88, 0x23, 0xC9, 0xF4,
-0x90, 0x91, 0xB8, 0x01, 0x92, 0x30, 0xA8, 0xF4, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93,
-0xE8, 0x00, 0x90, 0x93, 0xB4, 0x01, 0x45, 0xDD, 0x80, 0x91, 0xB4, 0x01, 0x88, 0x23, 0x31, 0xF4,
-0x80, 0x91, 0xE3, 0x00, 0x87, 0xFD, 0x02, 0xC0, 0x81, 0xE0, 0x01, 0xC0, 0x84, 0xE0, 0x8E, 0xBB,
-0x6C, 0xDC, 0x80, 0x91, 0xE8, 0x00, 0x83, 0xFF, 0x0A, 0xC0, 0x80, 0x91, 0xEB, 0x00, 0x80, 0x62,
-0x80, 0x93, 0xEB, 0x00, 0x80, 0x91, 0xE8, 0x00, 0x87, 0x7F, 0x80, 0x93, 0xE8, 0x00, 0x0F, 0x90,
-0x0F, 0x90, 0xCF, 0x91, 0xDF, 0x91, 0x1F, 0x91, 0x0F, 0x91, 0x08, 0x95, 0x08, 0x95, 0x1F, 0x93,
-0x8E, 0xB3, 0x88, 0x23, 0x61, 0xF0, 0x10, 0x91, 0xE9, 0x00, 0x10, 0x92, 0xE9, 0x00, 0x80, 0x91,
-0xE8, 0x00, 0x83, 0xFF, 0x01, 0xC0, 0xE4, 0xDE, 0x17, 0x70, 0x10, 0x93, 0xE9, 0x00, 0x1F, 0x91,
-0x08, 0x95, 0xF9, 0x99, 0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD, 0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5,
-0x08, 0x95, 0x26, 0x2F, 0xF9, 0x99, 0xFE, 0xCF, 0x1F, 0xBA, 0x92, 0xBD, 0x81, 0xBD, 0x20, 0xBD,
-0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A, 0x0F, 0xBE, 0x01, 0x96, 0x08, 0x95, 0xF8, 0x94,
-0xFF, 0xCF, 0x43, 0x41, 0x54, 0x45, 0x52, 0x49, 0x4E, 0x41, 0x00, 0x77, 0x77, 0x00, 0x08, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x12, 0x01, 0x10, 0x01, 0x02, 0x00, 0x00, 0x08, 0x41,
-0x23, 0x36, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x02, 0x3E, 0x00, 0x02, 0x01, 0x00,
-0x80, 0x32, 0x09, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x05, 0x24, 0x00, 0x10, 0x01,
-0x04, 0x24, 0x02, 0x04, 0x05, 0x24, 0x06, 0x00, 0x01, 0x07, 0x05, 0x82, 0x03, 0x08, 0x00, 0xFF,
-0x09, 0x04, 0x01, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x00, 0x07, 0x05, 0x04, 0x02, 0x10, 0x00, 0x01,
-0x07, 0x05, 0x83, 0x02, 0x10, 0x00, 0x01, 0x04, 0x03, 0x09, 0x04, 0x22, 0x03, 0x41, 0x00, 0x72,
-0x00, 0x64, 0x00, 0x75, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x65,
-0x00, 0x6F, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x72, 0x00, 0x64, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x18,
-0x03, 0x41, 0x00, 0x72, 0x00, 0x64, 0x00, 0x75, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x20,
-0x00, 0x4C, 0x00, 0x4C, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00,
-}; // end of leonardo_hex
-
+0x19, 0xF5, 0x91, 0x3A, 0x09, 0xC0, 0x0F, 0x03, 0xE8, 0x00, 0x87, 0x7F, 0xC1, 0x47, 0x09, 0x8D,
+0xE0, 0x91, 0xE0, 0x67, 0xE0, 0x70, 0xE0, 0x0B, 0xD2, 0xC7, 0x5B, 0x05, 0x08, 0x95, 0x91, 0x32,
+0x79, 0xF4, 0xCF, 0x23, 0x00, 0x5D, 0xC2, 0x23, 0xC3, 0x9F, 0x14, 0x08, 0x95, 0x82, 0xE0, 0x61,
+0xEC, 0x42, 0xE0, 0xB5, 0xD0, 0x83, 0xE0, 0x61, 0xE8, 0x42, 0xE1, 0xB1, 0xD0, 0x84, 0xE0, 0x60,
+0xC0, 0x07, 0x1D, 0xAD, 0xC0, 0x84, 0xB7, 0x87, 0x7F, 0x84, 0xBF, 0x88, 0xE1, 0x0F, 0xB6, 0xF8,
+0x94, 0x80, 0x93, 0x60, 0x00, 0x10, 0x92, 0x60, 0x00, 0x0F, 0xBE, 0x20, 0xE8, 0x80, 0xE0, 0x90,
+0xE0, 0xC1, 0x13, 0x04, 0x20, 0x93, 0x61, 0x00, 0x80, 0xC0, 0x03, 0x2C, 0x0F, 0xBE, 0x81, 0xE0,
+0x85, 0xBF, 0x92, 0xE0, 0x95, 0xBF, 0x3F, 0x9A, 0x20, 0x9A, 0x55, 0x9A, 0xE1, 0xE6, 0xF0, 0xE0,
+0x20, 0x83, 0x10, 0x82, 0x47, 0x98, 0x5D, 0x9A, 0x28, 0x9A, 0x10, 0x92, 0x89, 0x00, 0x8A, 0xEF,
+0x80, 0x93, 0x88, 0x00, 0x90, 0x93, 0x6F, 0x00, 0x83, 0xC0, 0xFD, 0x0D, 0x81, 0x00, 0xF0, 0xC0,
+0x40, 0x91, 0x00, 0x08, 0x50, 0x91, 0x01, 0x08, 0x10, 0x92, 0xC1, 0x03, 0x05, 0x00, 0x08, 0x94,
+0xB7, 0x14, 0xBE, 0xCD, 0x69, 0x31, 0x29, 0x2F, 0x30, 0xE0, 0xF9, 0x01, 0xE2, 0x70, 0xF0, 0x70,
+0x91, 0xFD, 0x18, 0xC0, 0x90, 0xFF, 0x05, 0xC0, 0x85, 0x91, 0x94, 0x91, 0x8F, 0x5F, 0x9F, 0x4F,
+0x81, 0xF4, 0x23, 0xFF, 0x0F, 0xC0, 0x80, 0x91, 0x09, 0x01, 0x90, 0x91, 0x0A, 0x01, 0x48, 0x17,
+0x59, 0x07, 0x41, 0xF0, 0xE0, 0xE0, 0xF0, 0xE0, 0xC5, 0x1F, 0x18, 0x09, 0xF0, 0x42, 0xDC, 0xA0,
+0xDF, 0x78, 0x94, 0x10, 0x92, 0xAD, 0x01, 0x10, 0x92, 0xAC, 0x01, 0x0C, 0xC0, 0xDE, 0xDC, 0x36,
+0xD3, 0x80, 0x91, 0xAC, 0xC0, 0x2F, 0x21, 0xAD, 0x01, 0x81, 0x54, 0x9F, 0x41, 0x10, 0xF0, 0x10,
+0x92, 0x14, 0x01, 0x41, 0xDC, 0x80, 0x91, 0x14, 0x01, 0x88, 0x23, 0x81, 0xF7, 0x80, 0x91, 0xE0,
+0x00, 0x81, 0x60, 0x80, 0x93, 0xE0, 0x00, 0x25, 0xDC, 0xC1, 0xDF, 0x36, 0x08, 0x95, 0xFA, 0x01,
+0x92, 0x30, 0x49, 0xF0, 0x93, 0x30, 0x61, 0xF0, 0x91, 0x30, 0xF9, 0xF4, 0x85, 0xE1, 0x91, 0xE0,
+0x22, 0xE1, 0x30, 0xE0, 0x1E, 0xC0, 0x87, 0xE2, 0x91, 0xE0, 0x2E, 0xE3, 0x30, 0xE0, 0x19, 0xC0,
+0x88, 0x23, 0x29, 0xF4, 0x85, 0xE6, 0x91, 0xE0, 0x24, 0xE0, 0x30, 0xE0, 0x12, 0xC0, 0x81, 0x30,
+0x29, 0xF4, 0x89, 0xC0, 0x0D, 0x06, 0x22, 0xE2, 0x30, 0xE0, 0x0B, 0xC0, 0x82, 0xC0, 0x0D, 0x04,
+0x8D, 0xE8, 0x91, 0xE0, 0x28, 0xC0, 0x33, 0x01, 0x04, 0xC0, 0xC1, 0x51, 0x00, 0x20, 0xC0, 0x25,
+0x0E, 0x91, 0x83, 0x80, 0x83, 0xC9, 0x01, 0x08, 0x95, 0x80, 0x93, 0xE9, 0x00, 0x80, 0x91, 0xEB,
+0xC2, 0x71, 0x00, 0xEB, 0xC0, 0xED, 0x08, 0xED, 0x00, 0x60, 0x93, 0xEC, 0x00, 0x40, 0x93, 0xED,
+0xC0, 0x15, 0x07, 0xEE, 0x00, 0x88, 0x1F, 0x88, 0x27, 0x88, 0x1F, 0xC0, 0x25, 0x01, 0x91, 0xB6,
+0xC0, 0x9B, 0x11, 0x8C, 0xF4, 0x03, 0xC0, 0x8E, 0xB3, 0x88, 0x23, 0xB1, 0xF0, 0x80, 0x91, 0xE8,
+0x00, 0x82, 0xFF, 0xF9, 0xCF, 0xC1, 0x07, 0x07, 0x8B, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x08, 0x95,
+0xC1, 0x19, 0x00, 0x49, 0xC2, 0x19, 0x00, 0x80, 0xC4, 0x19, 0x00, 0x8E, 0xC4, 0x19, 0x1B, 0xEF,
+0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0x45, 0xD0, 0x4C, 0xD0, 0x08, 0xED, 0x10, 0xE0, 0xF8,
+0x01, 0x80, 0x81, 0x8F, 0x77, 0x80, 0x83, 0x80, 0x81, 0x80, 0x68, 0xC1, 0x05, 0x12, 0x8F, 0x7D,
+0x80, 0x83, 0x19, 0xBC, 0x1E, 0xBA, 0x10, 0x92, 0xB4, 0x01, 0x80, 0xEE, 0xE8, 0x2E, 0xF1, 0x2C,
+0xF7, 0xC0, 0x21, 0x03, 0x8B, 0x7F, 0x80, 0x83, 0xC1, 0x29, 0xC0, 0x99, 0x0F, 0x83, 0x80, 0xE0,
+0x60, 0xE0, 0x42, 0xE0, 0xA9, 0xDF, 0xE1, 0xEE, 0xF0, 0xE0, 0x80, 0x81, 0x8E, 0xC0, 0x19, 0x00,
+0xE2, 0xC2, 0x09, 0xC2, 0x1B, 0x01, 0x81, 0x88, 0xC0, 0x05, 0xC1, 0x31, 0xC1, 0x17, 0xC1, 0x31,
+0x0F, 0x80, 0x61, 0x80, 0x83, 0x1F, 0x91, 0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0x08, 0x95, 0xE7,
+0xED, 0xC5, 0x29, 0x0C, 0x8A, 0xE4, 0x82, 0xBF, 0x81, 0xE0, 0x80, 0x93, 0xB5, 0x01, 0xB6, 0xCF,
+0xE8, 0xC2, 0x15, 0xC1, 0x31, 0x02, 0x10, 0x92, 0xE2, 0xC0, 0xA3, 0x02, 0x10, 0x92, 0xDA, 0xC0,
+0xFD, 0x00, 0xE1, 0xC0, 0x09, 0x24, 0x1F, 0x92, 0x0F, 0x92, 0x0F, 0xB6, 0x0F, 0x92, 0x11, 0x24,
+0x2F, 0x93, 0x3F, 0x93, 0x4F, 0x93, 0x5F, 0x93, 0x6F, 0x93, 0x7F, 0x93, 0x8F, 0x93, 0x9F, 0x93,
+0xAF, 0x93, 0xBF, 0x93, 0xEF, 0x93, 0xFF, 0x93, 0x80, 0x91, 0xDA, 0xC0, 0xE3, 0x04, 0x1B, 0xC0,
+0x80, 0x91, 0xD8, 0xC0, 0x07, 0x00, 0x17, 0xC0, 0x07, 0x01, 0xDA, 0x00, 0xC0, 0x49, 0x00, 0x93,
+0xC0, 0x15, 0x01, 0x91, 0xD9, 0xC0, 0x11, 0x06, 0x0B, 0xC0, 0x80, 0xE1, 0x89, 0xBD, 0x82, 0xC0,
+0x03, 0x0D, 0x09, 0xB4, 0x00, 0xFE, 0xFD, 0xCF, 0x81, 0xE0, 0x8E, 0xBB, 0x3B, 0xD2, 0x03, 0xC0,
+0xC1, 0xE3, 0x04, 0x37, 0xD2, 0x80, 0x91, 0xE1, 0xC4, 0x35, 0x00, 0xE2, 0xC0, 0x07, 0x00, 0x13,
+0xC2, 0x07, 0xC1, 0x3D, 0xC0, 0x0D, 0xC1, 0x11, 0x00, 0x61, 0xC3, 0x09, 0xC0, 0x59, 0x07, 0x62,
+0x80, 0x93, 0xD8, 0x00, 0x19, 0xBC, 0x85, 0xC0, 0x3D, 0x00, 0x1C, 0xC2, 0x35, 0x02, 0x84, 0xFF,
+0x2C, 0xC2, 0x2D, 0x02, 0x84, 0xFF, 0x28, 0xCC, 0x61, 0xC1, 0x2F, 0x01, 0x8F, 0x7D, 0xC1, 0x2F,
+0xC1, 0x27, 0x03, 0x8F, 0x7E, 0x80, 0x93, 0xC0, 0x63, 0xC0, 0x29, 0xC1, 0x09, 0xC3, 0x57, 0xC0,
+0xFF, 0xC2, 0x09, 0x12, 0xB4, 0x01, 0x88, 0x23, 0x31, 0xF4, 0x80, 0x91, 0xE3, 0x00, 0x87, 0xFD,
+0x02, 0xC0, 0x81, 0xE0, 0x01, 0xC0, 0x84, 0xC0, 0x5F, 0x01, 0xEC, 0xD1, 0xC1, 0x37, 0x02, 0x83,
+0xFF, 0x21, 0xC2, 0x5F, 0x02, 0x83, 0xFF, 0x1D, 0xC0, 0x07, 0x02, 0xE1, 0x00, 0x87, 0xC0, 0x95,
+0x02, 0xE1, 0x00, 0x82, 0xC0, 0x1F, 0x03, 0x10, 0x92, 0xB4, 0x01, 0xC1, 0x11, 0xC1, 0xA7, 0xC3,
+0x59, 0xCE, 0xB1, 0x49, 0xE0, 0x60, 0xE0, 0x42, 0xE0, 0xD8, 0xDE, 0xC7, 0xD1, 0xFF, 0x91, 0xEF,
+0x91, 0xBF, 0x91, 0xAF, 0x91, 0x9F, 0x91, 0x8F, 0x91, 0x7F, 0x91, 0x6F, 0x91, 0x5F, 0x91, 0x4F,
+0x91, 0x3F, 0x91, 0x2F, 0x91, 0x0F, 0x90, 0x0F, 0xBE, 0x0F, 0x90, 0x1F, 0x90, 0x18, 0x95, 0x9C,
+0x01, 0x40, 0x91, 0xBC, 0x01, 0x50, 0x91, 0xBD, 0x01, 0x46, 0x17, 0x57, 0x07, 0x18, 0xF4, 0xF9,
+0x01, 0x90, 0xE0, 0x44, 0xC0, 0x61, 0x15, 0x71, 0x05, 0x11, 0xF0, 0xAB, 0x01, 0xF8, 0xC0, 0xCD,
+0x1A, 0xE8, 0x00, 0x8E, 0x77, 0x80, 0x93, 0xE8, 0x00, 0x40, 0xE0, 0x50, 0xE0, 0xF0, 0xCF, 0x8E,
+0xB3, 0x88, 0x23, 0x09, 0xF4, 0x44, 0xC0, 0x85, 0x30, 0x09, 0xF4, 0x43, 0xC0, 0x99, 0x00, 0xE8,
+0xC0, 0xA1, 0xC1, 0xBB, 0x01, 0x08, 0x95, 0xC1, 0x0B, 0x02, 0x82, 0xFD, 0x31, 0xC2, 0x13, 0x02,
+0x80, 0xFF, 0x22, 0xC0, 0x07, 0x2F, 0xF3, 0x00, 0x90, 0x91, 0xF2, 0x00, 0x78, 0x2F, 0x60, 0xE0,
+0x29, 0x2F, 0x30, 0xE0, 0x26, 0x2B, 0x37, 0x2B, 0x07, 0xC0, 0x81, 0x91, 0x80, 0x93, 0xF1, 0x00,
+0x41, 0x50, 0x50, 0x40, 0x2F, 0x5F, 0x3F, 0x4F, 0x41, 0x15, 0x51, 0x05, 0x19, 0xF0, 0x28, 0x30,
+0x31, 0x05, 0x98, 0xF3, 0x90, 0xE0, 0xC1, 0x07, 0x03, 0x09, 0xF4, 0x91, 0xE0, 0xC7, 0x73, 0xC1,
+0x1F, 0x07, 0x31, 0xF6, 0x99, 0x23, 0x21, 0xF6, 0x05, 0xC0, 0xC1, 0x79, 0x05, 0x41, 0xF0, 0x85,
+0x30, 0x41, 0xF0, 0xC2, 0x69, 0x03, 0xFF, 0xF7, 0xCF, 0x80, 0xC0, 0x75, 0x00, 0x82, 0xC0, 0x03,
+0x00, 0x83, 0xC0, 0x03, 0x01, 0x9C, 0x01, 0xC1, 0xB3, 0x01, 0x29, 0xF4, 0xC1, 0x1B, 0x00, 0x8B,
+0xC2, 0x3B, 0x02, 0xF9, 0x01, 0x26, 0xC2, 0x33, 0x05, 0x91, 0xF1, 0x85, 0x30, 0x91, 0xF1, 0xCE,
+0xA9, 0x03, 0xFF, 0xF1, 0xCF, 0x06, 0xC0, 0xA3, 0x0A, 0xF1, 0x00, 0x81, 0x93, 0x61, 0x50, 0x70,
+0x40, 0x59, 0xF0, 0x20, 0xC0, 0xAF, 0x00, 0x80, 0xC0, 0xAF, 0x0D, 0x32, 0x2F, 0x20, 0xE0, 0x90,
+0xE0, 0x82, 0x2B, 0x93, 0x2B, 0x89, 0x2B, 0x79, 0xF7, 0xC7, 0x4F, 0xC1, 0x5F, 0x00, 0xB9, 0xCE,
+0x87, 0x00, 0x80, 0xCC, 0x87, 0x10, 0x0F, 0x93, 0x1F, 0x93, 0xDF, 0x93, 0xCF, 0x93, 0x00, 0xD0,
+0xCD, 0xB7, 0xDE, 0xB7, 0xE6, 0xEB, 0xF1, 0xC0, 0xCD, 0xC1, 0x63, 0x09, 0x81, 0xE0, 0xEE, 0x3B,
+0xF8, 0x07, 0xC9, 0xF7, 0x24, 0xDD, 0xC3, 0x89, 0x00, 0xE4, 0xC0, 0x7B, 0x20, 0xB6, 0x01, 0x90,
+0x91, 0xB7, 0x01, 0x95, 0x30, 0x09, 0xF4, 0x6D, 0xC0, 0x96, 0x30, 0x40, 0xF4, 0x91, 0x30, 0x81,
+0xF1, 0x91, 0x30, 0x70, 0xF0, 0x93, 0x30, 0x09, 0xF0, 0xD4, 0xC0, 0x2A, 0xC0, 0x98, 0xC0, 0x19,
+0x02, 0xA3, 0xC0, 0x99, 0xC0, 0x05, 0x00, 0xB2, 0xC0, 0x1F, 0x10, 0x09, 0xF0, 0xCA, 0xC0, 0x7C,
+0xC0, 0x80, 0x38, 0x09, 0xF4, 0xC6, 0xC0, 0x82, 0x38, 0x09, 0xF0, 0xC3, 0xC0, 0x41, 0x06, 0xBA,
+0x01, 0x87, 0x70, 0x80, 0x93, 0xE9, 0xC0, 0xB7, 0x06, 0xEB, 0x00, 0x10, 0x92, 0xE9, 0x00, 0x20,
+0xC0, 0x5B, 0x02, 0x27, 0x7F, 0x20, 0xC0, 0xAD, 0x0C, 0x90, 0xE0, 0x25, 0xE0, 0x96, 0x95, 0x87,
+0x95, 0x2A, 0x95, 0xE1, 0xF7, 0x81, 0xC0, 0x23, 0x00, 0xF1, 0xC0, 0x1F, 0x08, 0xF1, 0x00, 0x87,
+0xC0, 0x88, 0x23, 0x19, 0xF0, 0x82, 0xC0, 0x4B, 0x03, 0xA4, 0xC0, 0x8F, 0x71, 0xC1, 0x07, 0x00,
+0xA0, 0xC0, 0x45, 0x06, 0xB8, 0x01, 0x88, 0x23, 0x31, 0xF5, 0x20, 0xC0, 0x4D, 0x06, 0x27, 0x70,
+0x09, 0xF4, 0x97, 0xC0, 0x20, 0xC4, 0x51, 0x07, 0x80, 0xFF, 0x1B, 0xC0, 0x93, 0x30, 0x21, 0xF4,
+0xC2, 0x0B, 0x01, 0x62, 0x13, 0xC0, 0x29, 0xC0, 0x07, 0x15, 0x61, 0x80, 0x93, 0xEB, 0x00, 0x81,
+0xE0, 0x90, 0xE0, 0x02, 0xC0, 0x88, 0x0F, 0x99, 0x1F, 0x2A, 0x95, 0xE2, 0xF7, 0x80, 0x93, 0xEA,
+0xC0, 0x5D, 0x00, 0xEA, 0xC2, 0x33, 0x01, 0x88, 0x60, 0xC1, 0x1F, 0xC1, 0x8B, 0xC1, 0xE7, 0x02,
+0x87, 0x7F, 0x51, 0xC0, 0x71, 0x04, 0x09, 0xF0, 0x6D, 0xC0, 0x10, 0xC0, 0x65, 0x05, 0x1F, 0x77,
+0x0F, 0xB7, 0xF8, 0x94, 0xC3, 0x17, 0x00, 0x80, 0xC0, 0xA3, 0x01, 0x9A, 0xDD, 0xC1, 0x0B, 0x0D,
+0x80, 0xFF, 0xFC, 0xCF, 0x80, 0x91, 0xE3, 0x00, 0x80, 0x78, 0x81, 0x2B, 0x80, 0x93, 0xC0, 0x07,
+0x00, 0x68, 0xC1, 0x05, 0x16, 0x11, 0x23, 0x11, 0xF4, 0x82, 0xE0, 0x01, 0xC0, 0x83, 0xE0, 0x8E,
+0xBB, 0x0F, 0xBF, 0x4D, 0xC0, 0x80, 0x58, 0x82, 0x30, 0x08, 0xF0, 0x49, 0xC2, 0xAD, 0x04, 0x90,
+0x91, 0xB9, 0x01, 0x60, 0xC0, 0xAD, 0x0E, 0xAE, 0x01, 0x4F, 0x5F, 0x5F, 0x4F, 0x36, 0xDD, 0xBC,
+0x01, 0x00, 0x97, 0x09, 0xF4, 0x3B, 0xC0, 0x1B, 0xC5, 0x59, 0x05, 0x89, 0x81, 0x9A, 0x81, 0x92,
+0xDE, 0xC1, 0x0F, 0x01, 0x8B, 0x77, 0xC1, 0x0F, 0x05, 0x2D, 0xC0, 0x80, 0x38, 0x59, 0xF5, 0xC7,
+0x1F, 0x06, 0x80, 0x91, 0xB4, 0x01, 0x80, 0x93, 0xF1, 0xC2, 0xA3, 0x00, 0x8E, 0xC2, 0x21, 0x02,
+0x54, 0xDD, 0x1B, 0xC0, 0xA9, 0x02, 0xC9, 0xF4, 0x90, 0xC0, 0x5F, 0x02, 0x92, 0x30, 0xA8, 0xC0,
+0xF3, 0xC5, 0x2B, 0x04, 0x90, 0x93, 0xB4, 0x01, 0x45, 0xC0, 0xA9, 0x04, 0xB4, 0x01, 0x88, 0x23,
+0x31, 0xC0, 0x17, 0x06, 0xE3, 0x00, 0x87, 0xFD, 0x02, 0xC0, 0x81, 0xC0, 0x9B, 0x00, 0x84, 0xC0,
+0x9B, 0x01, 0x6C, 0xDC, 0xC1, 0x29, 0x02, 0x83, 0xFF, 0x0A, 0xC0, 0x7D, 0x03, 0xEB, 0x00, 0x80,
+0x62, 0xC1, 0xFD, 0xC7, 0x3B, 0x1E, 0x0F, 0x90, 0x0F, 0x90, 0xCF, 0x91, 0xDF, 0x91, 0x1F, 0x91,
+0x0F, 0x91, 0x08, 0x95, 0x08, 0x95, 0x1F, 0x93, 0x8E, 0xB3, 0x88, 0x23, 0x61, 0xF0, 0x10, 0x91,
+0xE9, 0x00, 0x10, 0x92, 0xE9, 0xC2, 0x29, 0x0C, 0x83, 0xFF, 0x01, 0xC0, 0xE4, 0xDE, 0x17, 0x70,
+0x10, 0x93, 0xE9, 0x00, 0x1F, 0xC0, 0x25, 0x11, 0xF9, 0x99, 0xFE, 0xCF, 0x92, 0xBD, 0x81, 0xBD,
+0xF8, 0x9A, 0x99, 0x27, 0x80, 0xB5, 0x08, 0x95, 0x26, 0x2F, 0xC1, 0x11, 0x01, 0x1F, 0xBA, 0xC1,
+0x13, 0x20, 0x20, 0xBD, 0x0F, 0xB6, 0xF8, 0x94, 0xFA, 0x9A, 0xF9, 0x9A, 0x0F, 0xBE, 0x01, 0x96,
+0x08, 0x95, 0xF8, 0x94, 0xFF, 0xCF, 0x43, 0x41, 0x54, 0x45, 0x52, 0x49, 0x4E, 0x41, 0x00, 0x77,
+0x77, 0x00, 0x08, 0x80, 0x05, 0x00, 0x06, 0x08, 0x01, 0x12, 0x01, 0x10, 0x01, 0x02, 0xC0, 0x08,
+0x0C, 0x41, 0x23, 0x36, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x09, 0x02, 0x3E, 0xC1, 0x07,
+0x07, 0x80, 0x32, 0x09, 0x04, 0x00, 0x00, 0x01, 0x02, 0xC0, 0x0A, 0x16, 0x05, 0x24, 0x00, 0x10,
+0x01, 0x04, 0x24, 0x02, 0x04, 0x05, 0x24, 0x06, 0x00, 0x01, 0x07, 0x05, 0x82, 0x03, 0x08, 0x00,
+0xFF, 0x09, 0x04, 0xC0, 0x2E, 0x00, 0x0A, 0xC0, 0x43, 0x04, 0x07, 0x05, 0x04, 0x02, 0x10, 0xC1,
+0x16, 0x00, 0x83, 0xC1, 0x06, 0x18, 0x04, 0x03, 0x09, 0x04, 0x22, 0x03, 0x41, 0x00, 0x72, 0x00,
+0x64, 0x00, 0x75, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x65, 0xC0,
+0x07, 0x02, 0x6E, 0x00, 0x61, 0xC2, 0x17, 0x00, 0x6F, 0xC0, 0x35, 0x00, 0x18, 0xD0, 0x23, 0x02,
+0x4C, 0x00, 0x43, 0x80, 0x03, 0x00,
+};  // end of leonardo_hex
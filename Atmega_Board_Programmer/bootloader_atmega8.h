@@ -2,69 +2,65 @@
 // Loader start: 1C00, length: 1024
 // MD5 sum = 98 6D CF BB 55 E1 22 1E E4 3C C2 07 B2 2B 46 AE 
 
+// Packed by convertHexToByteArray: 927 bytes, 1002 unpacked
+const unsigned int atmega8_hex_length = 1002;
 const byte atmega8_hex [] PROGMEM = {
-0x12, 0xC0, 0x2B, 0xC0, 0x2A, 0xC0, 0x29, 0xC0, 0x28, 0xC0, 0x27, 0xC0, 0x26, 0xC0, 0x25, 0xC0, 
-0x24, 0xC0, 0x23, 0xC0, 0x22, 0xC0, 0x21, 0xC0, 0x20, 0xC0, 0x1F, 0xC0, 0x1E, 0xC0, 0x1D, 0xC0, 
-0x1C, 0xC0, 0x1B, 0xC0, 0x1A, 0xC0, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xE5, 0xD4, 0xE0, 0xDE, 0xBF, 
-0xCD, 0xBF, 0x10, 0xE0, 0xA0, 0xE6, 0xB0, 0xE0, 0xE8, 0xEE, 0xFF, 0xE1, 0x02, 0xC0, 0x05, 0x90, 
-0x0D, 0x92, 0xA2, 0x36, 0xB1, 0x07, 0xD9, 0xF7, 0x11, 0xE0, 0xA2, 0xE6, 0xB0, 0xE0, 0x01, 0xC0, 
-0x1D, 0x92, 0xAA, 0x36, 0xB1, 0x07, 0xE1, 0xF7, 0x4F, 0xC0, 0xD2, 0xCF, 0xEF, 0x92, 0xFF, 0x92, 
-0x0F, 0x93, 0x1F, 0x93, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01, 0x13, 0xC0, 0x08, 0x94, 0xE1, 0x1C, 
-0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x81, 0xE0, 0xE8, 0x16, 0x82, 0xE1, 0xF8, 0x06, 0x8A, 0xE7, 
-0x08, 0x07, 0x80, 0xE0, 0x18, 0x07, 0x28, 0xF0, 0xE0, 0x91, 0x62, 0x00, 0xF0, 0x91, 0x63, 0x00, 
-0x09, 0x95, 0x5F, 0x9B, 0xEB, 0xCF, 0x8C, 0xB1, 0x99, 0x27, 0x87, 0xFD, 0x90, 0x95, 0x1F, 0x91, 
-0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0x08, 0x95, 0x5D, 0x9B, 0xFE, 0xCF, 0x8C, 0xB9, 0x08, 0x95, 
-0xD5, 0xDF, 0x80, 0x32, 0x21, 0xF4, 0x84, 0xE1, 0xF7, 0xDF, 0x80, 0xE1, 0xF5, 0xDF, 0x08, 0x95, 
-0x1F, 0x93, 0x18, 0x2F, 0xCB, 0xDF, 0x80, 0x32, 0x31, 0xF4, 0x84, 0xE1, 0xED, 0xDF, 0x81, 0x2F, 
-0xEB, 0xDF, 0x80, 0xE1, 0xE9, 0xDF, 0x1F, 0x91, 0x08, 0x95, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 
-0x18, 0x2F, 0xC0, 0xE0, 0xD0, 0xE0, 0x02, 0xC0, 0xB9, 0xDF, 0x21, 0x96, 0xC1, 0x17, 0xE0, 0xF3, 
-0xDF, 0x91, 0xCF, 0x91, 0x1F, 0x91, 0x08, 0x95, 0xCF, 0xE5, 0xD4, 0xE0, 0xDE, 0xBF, 0xCD, 0xBF, 
-0x00, 0x00, 0x10, 0xBC, 0x83, 0xE3, 0x89, 0xB9, 0x88, 0xE1, 0x8A, 0xB9, 0x86, 0xE8, 0x80, 0xBD, 
-0xBD, 0x9A, 0x10, 0x92, 0x68, 0x01, 0x30, 0xE2, 0xE0, 0xE0, 0xF0, 0xE0, 0x2F, 0xE0, 0x88, 0xB3, 
-0x83, 0x27, 0x88, 0xBB, 0xCF, 0x01, 0x01, 0x97, 0xF1, 0xF7, 0x21, 0x50, 0x27, 0xFF, 0xF7, 0xCF, 
-0x20, 0xE1, 0x20, 0x93, 0x68, 0x01, 0x92, 0xDF, 0x80, 0x33, 0x81, 0xF1, 0x81, 0x33, 0x99, 0xF4, 
-0x8D, 0xDF, 0x80, 0x32, 0xC1, 0xF7, 0x84, 0xE1, 0xAF, 0xDF, 0x81, 0xE4, 0xAD, 0xDF, 0x86, 0xE5, 
-0xAB, 0xDF, 0x82, 0xE5, 0xA9, 0xDF, 0x80, 0xE2, 0xA7, 0xDF, 0x89, 0xE4, 0xA5, 0xDF, 0x83, 0xE5, 
-0xA3, 0xDF, 0x80, 0xE5, 0xC7, 0xC0, 0x80, 0x34, 0x29, 0xF4, 0x78, 0xDF, 0x86, 0x38, 0xB0, 0xF0, 
-0x75, 0xDF, 0x14, 0xC0, 0x81, 0x34, 0x71, 0xF4, 0x71, 0xDF, 0x80, 0x38, 0x11, 0xF4, 0x82, 0xE0, 
-0x1D, 0xC1, 0x81, 0x38, 0x11, 0xF4, 0x81, 0xE0, 0x19, 0xC1, 0x82, 0x38, 0x09, 0xF0, 0x15, 0xC1, 
-0x82, 0xE1, 0x14, 0xC1, 0x82, 0x34, 0x21, 0xF4, 0x84, 0xE1, 0x9F, 0xDF, 0x89, 0xDF, 0xCB, 0xCF, 
-0x85, 0x34, 0x11, 0xF4, 0x85, 0xE0, 0xF9, 0xCF, 0x80, 0x35, 0xC1, 0xF3, 0x81, 0x35, 0xB1, 0xF3, 
-0x82, 0x35, 0xA1, 0xF3, 0x85, 0x35, 0x39, 0xF4, 0x51, 0xDF, 0x80, 0x93, 0x64, 0x00, 0x4E, 0xDF, 
-0x80, 0x93, 0x65, 0x00, 0xEB, 0xCF, 0x86, 0x35, 0x19, 0xF4, 0x84, 0xE0, 0x86, 0xDF, 0xF5, 0xC0, 
-0x84, 0x36, 0x09, 0xF0, 0x93, 0xC0, 0x42, 0xDF, 0x80, 0x93, 0x67, 0x01, 0x3F, 0xDF, 0x80, 0x93, 
-0x66, 0x01, 0x80, 0x91, 0x69, 0x01, 0x8E, 0x7F, 0x80, 0x93, 0x69, 0x01, 0x37, 0xDF, 0x85, 0x34, 
-0x29, 0xF4, 0x80, 0x91, 0x69, 0x01, 0x81, 0x60, 0x80, 0x93, 0x69, 0x01, 0xC0, 0xE0, 0xD0, 0xE0, 
-0x06, 0xE6, 0x10, 0xE0, 0x05, 0xC0, 0x2A, 0xDF, 0xF8, 0x01, 0x81, 0x93, 0x8F, 0x01, 0x21, 0x96, 
-0x80, 0x91, 0x66, 0x01, 0x90, 0x91, 0x67, 0x01, 0xC8, 0x17, 0xD9, 0x07, 0xA0, 0xF3, 0x1E, 0xDF, 
-0x80, 0x32, 0x09, 0xF0, 0x88, 0xCF, 0x80, 0x91, 0x69, 0x01, 0x80, 0xFF, 0x1F, 0xC0, 0x20, 0xE0, 
-0x30, 0xE0, 0xE6, 0xE6, 0xF0, 0xE0, 0x12, 0xC0, 0xA0, 0x91, 0x64, 0x00, 0xB0, 0x91, 0x65, 0x00, 
-0x81, 0x91, 0x08, 0x2E, 0xC5, 0xD0, 0x80, 0x91, 0x64, 0x00, 0x90, 0x91, 0x65, 0x00, 0x01, 0x96, 
-0x90, 0x93, 0x65, 0x00, 0x80, 0x93, 0x64, 0x00, 0x2F, 0x5F, 0x3F, 0x4F, 0x80, 0x91, 0x66, 0x01, 
-0x90, 0x91, 0x67, 0x01, 0x28, 0x17, 0x39, 0x07, 0x38, 0xF3, 0x43, 0xC0, 0xF8, 0x94, 0xE1, 0x99, 
-0xFE, 0xCF, 0x11, 0x27, 0xE0, 0x91, 0x64, 0x00, 0xF0, 0x91, 0x65, 0x00, 0xEE, 0x0F, 0xFF, 0x1F, 
-0xC6, 0xE6, 0xD0, 0xE0, 0x80, 0x91, 0x66, 0x01, 0x90, 0x91, 0x67, 0x01, 0x80, 0xFF, 0x01, 0xC0, 
-0x01, 0x96, 0x10, 0x30, 0x51, 0xF4, 0x22, 0xD0, 0x03, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 
-0x1D, 0xD0, 0x01, 0xE1, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x09, 0x90, 0x19, 0x90, 0x16, 0xD0, 
-0x01, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x13, 0x95, 0x10, 0x32, 0x58, 0xF0, 0x11, 0x27, 
-0x0D, 0xD0, 0x05, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x08, 0xD0, 0x01, 0xE1, 0x00, 0x93, 
-0x57, 0x00, 0xE8, 0x95, 0x32, 0x96, 0x02, 0x97, 0x39, 0xF0, 0xDB, 0xCF, 0x00, 0x91, 0x57, 0x00, 
-0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3, 0x08, 0x95, 0x10, 0x30, 0x11, 0xF0, 0x02, 0x96, 0xE7, 0xCF, 
-0x11, 0x24, 0x84, 0xE1, 0xD9, 0xDE, 0x80, 0xE1, 0xD7, 0xDE, 0x1D, 0xCF, 0x84, 0x37, 0x09, 0xF0, 
-0x4B, 0xC0, 0xAC, 0xDE, 0x80, 0x93, 0x67, 0x01, 0xA9, 0xDE, 0x80, 0x93, 0x66, 0x01, 0xA6, 0xDE, 
-0x90, 0x91, 0x69, 0x01, 0x85, 0x34, 0x21, 0xF4, 0x91, 0x60, 0x90, 0x93, 0x69, 0x01, 0x0D, 0xC0, 
-0x9E, 0x7F, 0x90, 0x93, 0x69, 0x01, 0x80, 0x91, 0x64, 0x00, 0x90, 0x91, 0x65, 0x00, 0x88, 0x0F, 
-0x99, 0x1F, 0x90, 0x93, 0x65, 0x00, 0x80, 0x93, 0x64, 0x00, 0x90, 0xDE, 0x80, 0x32, 0x09, 0xF0, 
-0xFA, 0xCE, 0x84, 0xE1, 0xB1, 0xDE, 0xC0, 0xE0, 0xD0, 0xE0, 0x1E, 0xC0, 0x80, 0x91, 0x69, 0x01, 
-0x80, 0xFF, 0x07, 0xC0, 0xA0, 0x91, 0x64, 0x00, 0xB0, 0x91, 0x65, 0x00, 0x31, 0xD0, 0x80, 0x2D, 
-0x08, 0xC0, 0x81, 0xFD, 0x07, 0xC0, 0xE0, 0x91, 0x64, 0x00, 0xF0, 0x91, 0x65, 0x00, 0xE4, 0x91, 
-0x8E, 0x2F, 0x9A, 0xDE, 0x80, 0x91, 0x64, 0x00, 0x90, 0x91, 0x65, 0x00, 0x01, 0x96, 0x90, 0x93, 
-0x65, 0x00, 0x80, 0x93, 0x64, 0x00, 0x21, 0x96, 0x80, 0x91, 0x66, 0x01, 0x90, 0x91, 0x67, 0x01, 
-0xC8, 0x17, 0xD9, 0x07, 0xD8, 0xF2, 0xAF, 0xCF, 0x85, 0x37, 0x61, 0xF4, 0x5F, 0xDE, 0x80, 0x32, 
-0x09, 0xF0, 0xC9, 0xCE, 0x84, 0xE1, 0x80, 0xDE, 0x8E, 0xE1, 0x7E, 0xDE, 0x83, 0xE9, 0x7C, 0xDE, 
-0x87, 0xE0, 0xA0, 0xCF, 0x86, 0x37, 0x09, 0xF0, 0xBE, 0xCE, 0x80, 0xE0, 0x81, 0xDE, 0xBB, 0xCE, 
-0xE1, 0x99, 0xFE, 0xCF, 0xBF, 0xBB, 0xAE, 0xBB, 0xE0, 0x9A, 0x11, 0x96, 0x0D, 0xB2, 0x08, 0x95, 
-0xE1, 0x99, 0xFE, 0xCF, 0xBF, 0xBB, 0xAE, 0xBB, 0x0D, 0xBA, 0x11, 0x96, 0x0F, 0xB6, 0xF8, 0x94, 
-0xE2, 0x9A, 0xE1, 0x9A, 0x0F, 0xBE, 0x08, 0x95, 0x80, 0x00
-}; // end of ATmegaBOOT_hex
-
+0x4A, 0x12, 0xC0, 0x2B, 0xC0, 0x2A, 0xC0, 0x29, 0xC0, 0x28, 0xC0, 0x27, 0xC0, 0x26, 0xC0, 0x25,
+0xC0, 0x24, 0xC0, 0x23, 0xC0, 0x22, 0xC0, 0x21, 0xC0, 0x20, 0xC0, 0x1F, 0xC0, 0x1E, 0xC0, 0x1D,
+0xC0, 0x1C, 0xC0, 0x1B, 0xC0, 0x1A, 0xC0, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xE5, 0xD4, 0xE0, 0xDE,
+0xBF, 0xCD, 0xBF, 0x10, 0xE0, 0xA0, 0xE6, 0xB0, 0xE0, 0xE8, 0xEE, 0xFF, 0xE1, 0x02, 0xC0, 0x05,
+0x90, 0x0D, 0x92, 0xA2, 0x36, 0xB1, 0x07, 0xD9, 0xF7, 0x11, 0xE0, 0xA2, 0xC0, 0x15, 0x04, 0x01,
+0xC0, 0x1D, 0x92, 0xAA, 0xC0, 0x0F, 0x6E, 0xE1, 0xF7, 0x4F, 0xC0, 0xD2, 0xCF, 0xEF, 0x92, 0xFF,
+0x92, 0x0F, 0x93, 0x1F, 0x93, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01, 0x13, 0xC0, 0x08, 0x94, 0xE1,
+0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x81, 0xE0, 0xE8, 0x16, 0x82, 0xE1, 0xF8, 0x06, 0x8A,
+0xE7, 0x08, 0x07, 0x80, 0xE0, 0x18, 0x07, 0x28, 0xF0, 0xE0, 0x91, 0x62, 0x00, 0xF0, 0x91, 0x63,
+0x00, 0x09, 0x95, 0x5F, 0x9B, 0xEB, 0xCF, 0x8C, 0xB1, 0x99, 0x27, 0x87, 0xFD, 0x90, 0x95, 0x1F,
+0x91, 0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0x08, 0x95, 0x5D, 0x9B, 0xFE, 0xCF, 0x8C, 0xB9, 0x08,
+0x95, 0xD5, 0xDF, 0x80, 0x32, 0x21, 0xF4, 0x84, 0xE1, 0xF7, 0xDF, 0x80, 0xE1, 0xF5, 0xDF, 0x08,
+0x95, 0x1F, 0x93, 0x18, 0x2F, 0xCB, 0xC0, 0x13, 0x00, 0x31, 0xC0, 0x13, 0x04, 0xED, 0xDF, 0x81,
+0x2F, 0xEB, 0xC0, 0x17, 0x03, 0xE9, 0xDF, 0x1F, 0x91, 0xC1, 0x19, 0x02, 0xCF, 0x93, 0xDF, 0xC0,
+0x1D, 0x11, 0xC0, 0xE0, 0xD0, 0xE0, 0x02, 0xC0, 0xB9, 0xDF, 0x21, 0x96, 0xC1, 0x17, 0xE0, 0xF3,
+0xDF, 0x91, 0xCF, 0x91, 0xC1, 0x1D, 0xC5, 0xCD, 0x40, 0x00, 0x00, 0x10, 0xBC, 0x83, 0xE3, 0x89,
+0xB9, 0x88, 0xE1, 0x8A, 0xB9, 0x86, 0xE8, 0x80, 0xBD, 0xBD, 0x9A, 0x10, 0x92, 0x68, 0x01, 0x30,
+0xE2, 0xE0, 0xE0, 0xF0, 0xE0, 0x2F, 0xE0, 0x88, 0xB3, 0x83, 0x27, 0x88, 0xBB, 0xCF, 0x01, 0x01,
+0x97, 0xF1, 0xF7, 0x21, 0x50, 0x27, 0xFF, 0xF7, 0xCF, 0x20, 0xE1, 0x20, 0x93, 0x68, 0x01, 0x92,
+0xDF, 0x80, 0x33, 0x81, 0xF1, 0x81, 0x33, 0x99, 0xF4, 0x8D, 0xC0, 0x7B, 0x3E, 0xC1, 0xF7, 0x84,
+0xE1, 0xAF, 0xDF, 0x81, 0xE4, 0xAD, 0xDF, 0x86, 0xE5, 0xAB, 0xDF, 0x82, 0xE5, 0xA9, 0xDF, 0x80,
+0xE2, 0xA7, 0xDF, 0x89, 0xE4, 0xA5, 0xDF, 0x83, 0xE5, 0xA3, 0xDF, 0x80, 0xE5, 0xC7, 0xC0, 0x80,
+0x34, 0x29, 0xF4, 0x78, 0xDF, 0x86, 0x38, 0xB0, 0xF0, 0x75, 0xDF, 0x14, 0xC0, 0x81, 0x34, 0x71,
+0xF4, 0x71, 0xDF, 0x80, 0x38, 0x11, 0xF4, 0x82, 0xE0, 0x1D, 0xC1, 0x81, 0xC0, 0x07, 0x0F, 0x81,
+0xE0, 0x19, 0xC1, 0x82, 0x38, 0x09, 0xF0, 0x15, 0xC1, 0x82, 0xE1, 0x14, 0xC1, 0x82, 0x34, 0xC1,
+0xE1, 0x24, 0x9F, 0xDF, 0x89, 0xDF, 0xCB, 0xCF, 0x85, 0x34, 0x11, 0xF4, 0x85, 0xE0, 0xF9, 0xCF,
+0x80, 0x35, 0xC1, 0xF3, 0x81, 0x35, 0xB1, 0xF3, 0x82, 0x35, 0xA1, 0xF3, 0x85, 0x35, 0x39, 0xF4,
+0x51, 0xDF, 0x80, 0x93, 0x64, 0x00, 0x4E, 0xC0, 0x05, 0x14, 0x65, 0x00, 0xEB, 0xCF, 0x86, 0x35,
+0x19, 0xF4, 0x84, 0xE0, 0x86, 0xDF, 0xF5, 0xC0, 0x84, 0x36, 0x09, 0xF0, 0x93, 0xC0, 0x42, 0xC0,
+0x17, 0x02, 0x67, 0x01, 0x3F, 0xC0, 0x05, 0x0E, 0x66, 0x01, 0x80, 0x91, 0x69, 0x01, 0x8E, 0x7F,
+0x80, 0x93, 0x69, 0x01, 0x37, 0xDF, 0x85, 0xC0, 0x87, 0xC1, 0x0F, 0x01, 0x81, 0x60, 0xC1, 0x0F,
+0x22, 0xC0, 0xE0, 0xD0, 0xE0, 0x06, 0xE6, 0x10, 0xE0, 0x05, 0xC0, 0x2A, 0xDF, 0xF8, 0x01, 0x81,
+0x93, 0x8F, 0x01, 0x21, 0x96, 0x80, 0x91, 0x66, 0x01, 0x90, 0x91, 0x67, 0x01, 0xC8, 0x17, 0xD9,
+0x07, 0xA0, 0xF3, 0x1E, 0xC0, 0xDD, 0x03, 0x09, 0xF0, 0x88, 0xCF, 0xC1, 0x33, 0x1C, 0x80, 0xFF,
+0x1F, 0xC0, 0x20, 0xE0, 0x30, 0xE0, 0xE6, 0xE6, 0xF0, 0xE0, 0x12, 0xC0, 0xA0, 0x91, 0x64, 0x00,
+0xB0, 0x91, 0x65, 0x00, 0x81, 0x91, 0x08, 0x2E, 0xC5, 0xD0, 0x80, 0xC0, 0x0D, 0x00, 0x90, 0xC0,
+0x0D, 0x02, 0x01, 0x96, 0x90, 0xC0, 0x8F, 0xC1, 0x99, 0x03, 0x2F, 0x5F, 0x3F, 0x4F, 0xC5, 0x4B,
+0x10, 0x28, 0x17, 0x39, 0x07, 0x38, 0xF3, 0x43, 0xC0, 0xF8, 0x94, 0xE1, 0x99, 0xFE, 0xCF, 0x11,
+0x27, 0xE0, 0xC0, 0x2D, 0x00, 0xF0, 0xC0, 0x2D, 0x07, 0xEE, 0x0F, 0xFF, 0x1F, 0xC6, 0xE6, 0xD0,
+0xE0, 0xC5, 0x27, 0x17, 0x80, 0xFF, 0x01, 0xC0, 0x01, 0x96, 0x10, 0x30, 0x51, 0xF4, 0x22, 0xD0,
+0x03, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x1D, 0xD0, 0x01, 0xE1, 0xC3, 0x09, 0x06, 0x09,
+0x90, 0x19, 0x90, 0x16, 0xD0, 0x01, 0xC4, 0x17, 0x0A, 0x13, 0x95, 0x10, 0x32, 0x58, 0xF0, 0x11,
+0x27, 0x0D, 0xD0, 0x05, 0xC4, 0x11, 0x00, 0x08, 0xC6, 0x29, 0x34, 0x32, 0x96, 0x02, 0x97, 0x39,
+0xF0, 0xDB, 0xCF, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3, 0x08, 0x95, 0x10,
+0x30, 0x11, 0xF0, 0x02, 0x96, 0xE7, 0xCF, 0x11, 0x24, 0x84, 0xE1, 0xD9, 0xDE, 0x80, 0xE1, 0xD7,
+0xDE, 0x1D, 0xCF, 0x84, 0x37, 0x09, 0xF0, 0x4B, 0xC0, 0xAC, 0xDE, 0x80, 0x93, 0x67, 0x01, 0xA9,
+0xC0, 0x05, 0x04, 0x66, 0x01, 0xA6, 0xDE, 0x90, 0xC0, 0xE9, 0x0D, 0x85, 0x34, 0x21, 0xF4, 0x91,
+0x60, 0x90, 0x93, 0x69, 0x01, 0x0D, 0xC0, 0x9E, 0x7F, 0xC1, 0x07, 0xC5, 0xDF, 0x03, 0x88, 0x0F,
+0x99, 0x1F, 0xC5, 0xE1, 0x12, 0x90, 0xDE, 0x80, 0x32, 0x09, 0xF0, 0xFA, 0xCE, 0x84, 0xE1, 0xB1,
+0xDE, 0xC0, 0xE0, 0xD0, 0xE0, 0x1E, 0xC0, 0x80, 0xC0, 0x3B, 0x04, 0x80, 0xFF, 0x07, 0xC0, 0xA0,
+0xC0, 0x2D, 0x00, 0xB0, 0xC0, 0x2D, 0x09, 0x31, 0xD0, 0x80, 0x2D, 0x08, 0xC0, 0x81, 0xFD, 0x07,
+0xC0, 0xC5, 0xF1, 0x05, 0xE4, 0x91, 0x8E, 0x2F, 0x9A, 0xDE, 0xC5, 0x4D, 0x01, 0x01, 0x96, 0xC5,
+0x4B, 0x16, 0x21, 0x96, 0x80, 0x91, 0x66, 0x01, 0x90, 0x91, 0x67, 0x01, 0xC8, 0x17, 0xD9, 0x07,
+0xD8, 0xF2, 0xAF, 0xCF, 0x85, 0x37, 0x61, 0xF4, 0x5F, 0xC2, 0x61, 0x00, 0xC9, 0xC0, 0x61, 0x0E,
+0x80, 0xDE, 0x8E, 0xE1, 0x7E, 0xDE, 0x83, 0xE9, 0x7C, 0xDE, 0x87, 0xE0, 0xA0, 0xCF, 0x86, 0xC0,
+0xB7, 0x17, 0xBE, 0xCE, 0x80, 0xE0, 0x81, 0xDE, 0xBB, 0xCE, 0xE1, 0x99, 0xFE, 0xCF, 0xBF, 0xBB,
+0xAE, 0xBB, 0xE0, 0x9A, 0x11, 0x96, 0x0D, 0xB2, 0x08, 0x95, 0xC5, 0x0F, 0x11, 0x0D, 0xBA, 0x11,
+0x96, 0x0F, 0xB6, 0xF8, 0x94, 0xE2, 0x9A, 0xE1, 0x9A, 0x0F, 0xBE, 0x08, 0x95, 0x80, 0x00,
+};  // end of atmega8_hex
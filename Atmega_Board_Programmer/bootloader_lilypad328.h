@@ -4,127 +4,93 @@
 // Original file MD5 sum = 654f86b6aff0ce8a50e161bfa497f787
 // This file from Aduino IDE 1.6.9
 
+// Packed by convertHexToByteArray: 1364 bytes, 1932 unpacked
+const unsigned int ATmegaBOOT_168_atmega328_pro_8MHz_hex_length = 1932;
 const byte ATmegaBOOT_168_atmega328_pro_8MHz_hex [] PROGMEM = {
-0x0C, 0x94, 0x34, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C,
-0x0C, 0x94, 0x51, 0x3C, 0x0C, 0x94, 0x51, 0x3C, 0x11, 0x24, 0x1F, 0xBE, 0xCF, 0xEF, 0xD8, 0xE0,
-0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xEA, 0xE8, 0xFF, 0xE7, 0x02, 0xC0,
-0x05, 0x90, 0x0D, 0x92, 0xA2, 0x30, 0xB1, 0x07, 0xD9, 0xF7, 0x12, 0xE0, 0xA2, 0xE0, 0xB1, 0xE0,
-0x01, 0xC0, 0x1D, 0x92, 0xAD, 0x30, 0xB1, 0x07, 0xE1, 0xF7, 0x0E, 0x94, 0x2D, 0x3D, 0x0C, 0x94,
-0xC3, 0x3F, 0x0C, 0x94, 0x00, 0x3C, 0x98, 0x2F, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-0x90, 0x5D, 0x8F, 0x70, 0x8A, 0x30, 0x7C, 0xF0, 0x28, 0x2F, 0x29, 0x5A, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0x90, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF,
-0x20, 0x93, 0xC6, 0x00, 0x08, 0x95, 0x28, 0x2F, 0x20, 0x5D, 0xF0, 0xCF, 0x98, 0x2F, 0x80, 0x91,
-0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x90, 0x93, 0xC6, 0x00, 0x08, 0x95, 0xEF, 0x92, 0xFF, 0x92,
-0x0F, 0x93, 0x1F, 0x93, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFD,
-0x17, 0xC0, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x81, 0xE2, 0xE8, 0x16,
-0x81, 0xEA, 0xF8, 0x06, 0x87, 0xE0, 0x08, 0x07, 0x80, 0xE0, 0x18, 0x07, 0x70, 0xF3, 0xE0, 0x91,
-0x04, 0x01, 0xF0, 0x91, 0x05, 0x01, 0x09, 0x95, 0x80, 0x91, 0xC0, 0x00, 0x87, 0xFF, 0xE9, 0xCF,
+0x06, 0x0C, 0x94, 0x34, 0x3C, 0x0C, 0x94, 0x51, 0xFF, 0x03, 0xDC, 0x03, 0x24, 0x11, 0x24, 0x1F,
+0xBE, 0xCF, 0xEF, 0xD8, 0xE0, 0xDE, 0xBF, 0xCD, 0xBF, 0x11, 0xE0, 0xA0, 0xE0, 0xB1, 0xE0, 0xEA,
+0xE8, 0xFF, 0xE7, 0x02, 0xC0, 0x05, 0x90, 0x0D, 0x92, 0xA2, 0x30, 0xB1, 0x07, 0xD9, 0xF7, 0x12,
+0xE0, 0xA2, 0xC0, 0x15, 0x04, 0x01, 0xC0, 0x1D, 0x92, 0xAD, 0xC0, 0x0F, 0x0F, 0xE1, 0xF7, 0x0E,
+0x94, 0x2D, 0x3D, 0x0C, 0x94, 0xC3, 0x3F, 0x0C, 0x94, 0x00, 0x3C, 0x98, 0x2F, 0x80, 0x07, 0x95,
+0x17, 0x90, 0x5D, 0x8F, 0x70, 0x8A, 0x30, 0x7C, 0xF0, 0x28, 0x2F, 0x29, 0x5A, 0x80, 0x91, 0xC0,
+0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x90, 0x93, 0xC6, 0x00, 0xC5, 0x0B, 0x00, 0x20, 0xC0, 0x0B, 0x09,
+0x08, 0x95, 0x28, 0x2F, 0x20, 0x5D, 0xF0, 0xCF, 0x98, 0x2F, 0xC9, 0x21, 0x0F, 0x08, 0x95, 0xEF,
+0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xEE, 0x24, 0xFF, 0x24, 0x87, 0x01, 0xC1, 0x1B, 0x29,
+0x87, 0xFD, 0x17, 0xC0, 0x08, 0x94, 0xE1, 0x1C, 0xF1, 0x1C, 0x01, 0x1D, 0x11, 0x1D, 0x81, 0xE2,
+0xE8, 0x16, 0x81, 0xEA, 0xF8, 0x06, 0x87, 0xE0, 0x08, 0x07, 0x80, 0xE0, 0x18, 0x07, 0x70, 0xF3,
+0xE0, 0x91, 0x04, 0x01, 0xF0, 0x91, 0x05, 0x01, 0x09, 0x95, 0xC2, 0x2D, 0x13, 0xFF, 0xE9, 0xCF,
 0x80, 0x91, 0xC6, 0x00, 0x1F, 0x91, 0x0F, 0x91, 0xFF, 0x90, 0xEF, 0x90, 0x08, 0x95, 0x0E, 0x94,
-0x76, 0x3C, 0x98, 0x2F, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x90, 0x93, 0xC6, 0x00,
-0x91, 0x36, 0x2C, 0xF4, 0x90, 0x33, 0x0C, 0xF0, 0x90, 0x53, 0x89, 0x2F, 0x08, 0x95, 0x97, 0x55,
-0x89, 0x2F, 0x08, 0x95, 0x1F, 0x93, 0x0E, 0x94, 0x9F, 0x3C, 0x18, 0x2F, 0x0E, 0x94, 0x9F, 0x3C,
-0x12, 0x95, 0x10, 0x7F, 0x81, 0x0F, 0x1F, 0x91, 0x08, 0x95, 0x1F, 0x93, 0x18, 0x2F, 0x88, 0x23,
-0x21, 0xF0, 0x0E, 0x94, 0x76, 0x3C, 0x11, 0x50, 0xE1, 0xF7, 0x1F, 0x91, 0x08, 0x95, 0x1F, 0x93,
-0x18, 0x2F, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x32, 0x49, 0xF0, 0x80, 0x91, 0x03, 0x01, 0x8F, 0x5F,
-0x80, 0x93, 0x03, 0x01, 0x85, 0x30, 0xC1, 0xF0, 0x1F, 0x91, 0x08, 0x95, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0x84, 0xE1, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF,
-0xFC, 0xCF, 0x10, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x80, 0xE1,
-0x80, 0x93, 0xC6, 0x00, 0x1F, 0x91, 0x08, 0x95, 0xE0, 0x91, 0x04, 0x01, 0xF0, 0x91, 0x05, 0x01,
-0x09, 0x95, 0x1F, 0x91, 0x08, 0x95, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x32, 0x41, 0xF0, 0x80, 0x91,
-0x03, 0x01, 0x8F, 0x5F, 0x80, 0x93, 0x03, 0x01, 0x85, 0x30, 0x81, 0xF0, 0x08, 0x95, 0x80, 0x91,
-0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x84, 0xE1, 0x80, 0x93, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0x80, 0xE1, 0x80, 0x93, 0xC6, 0x00, 0x08, 0x95, 0xE0, 0x91, 0x04, 0x01,
-0xF0, 0x91, 0x05, 0x01, 0x09, 0x95, 0x08, 0x95, 0x48, 0xEC, 0x50, 0xE0, 0x88, 0x23, 0xA1, 0xF0,
-0x2D, 0x9A, 0x28, 0xEE, 0x33, 0xE0, 0xFA, 0x01, 0x31, 0x97, 0xF1, 0xF7, 0x21, 0x50, 0x30, 0x40,
-0xD1, 0xF7, 0x2D, 0x98, 0x28, 0xEE, 0x33, 0xE0, 0xFA, 0x01, 0x31, 0x97, 0xF1, 0xF7, 0x21, 0x50,
-0x30, 0x40, 0xD1, 0xF7, 0x81, 0x50, 0x61, 0xF7, 0x08, 0x95, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92,
-0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92, 0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92,
-0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93, 0xCF, 0x93, 0xDF, 0x93, 0x00, 0x00, 0x82, 0xE0,
-0x80, 0x93, 0xC0, 0x00, 0x80, 0xE1, 0x80, 0x93, 0xC4, 0x00, 0x10, 0x92, 0xC5, 0x00, 0x88, 0xE1,
-0x80, 0x93, 0xC1, 0x00, 0x86, 0xE0, 0x80, 0x93, 0xC2, 0x00, 0x50, 0x98, 0x58, 0x9A, 0x25, 0x9A,
-0x81, 0xE0, 0x0E, 0x94, 0x14, 0x3D, 0x24, 0xE1, 0xF2, 0x2E, 0x9E, 0xE1, 0xE9, 0x2E, 0x85, 0xE9,
-0xD8, 0x2E, 0x0F, 0xE0, 0xC0, 0x2E, 0x10, 0xE1, 0xB1, 0x2E, 0xAA, 0x24, 0xA3, 0x94, 0xB1, 0xE4,
-0x9B, 0x2E, 0xA6, 0xE5, 0x8A, 0x2E, 0xF2, 0xE5, 0x7F, 0x2E, 0xE0, 0xE2, 0x6E, 0x2E, 0x79, 0xE4,
-0x57, 0x2E, 0x63, 0xE5, 0x46, 0x2E, 0x50, 0xE5, 0x35, 0x2E, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x33,
-0xB1, 0xF1, 0x81, 0x33, 0xB9, 0xF1, 0x80, 0x34, 0x09, 0xF4, 0x6F, 0xC0, 0x81, 0x34, 0x09, 0xF4,
-0x76, 0xC0, 0x82, 0x34, 0x09, 0xF4, 0x85, 0xC0, 0x85, 0x34, 0x09, 0xF4, 0x88, 0xC0, 0x80, 0x35,
-0x31, 0xF1, 0x82, 0x35, 0x21, 0xF1, 0x81, 0x35, 0x11, 0xF1, 0x85, 0x35, 0x09, 0xF4, 0x85, 0xC0,
-0x86, 0x35, 0x09, 0xF4, 0x8D, 0xC0, 0x84, 0x36, 0x09, 0xF4, 0x96, 0xC0, 0x84, 0x37, 0x09, 0xF4,
-0x03, 0xC1, 0x85, 0x37, 0x09, 0xF4, 0x72, 0xC1, 0x86, 0x37, 0x09, 0xF4, 0x66, 0xC0, 0x80, 0x91,
-0x03, 0x01, 0x8F, 0x5F, 0x80, 0x93, 0x03, 0x01, 0x85, 0x30, 0x79, 0xF6, 0xE0, 0x91, 0x04, 0x01,
-0xF0, 0x91, 0x05, 0x01, 0x09, 0x95, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x33, 0x51, 0xF6, 0x0E, 0x94,
-0xF3, 0x3C, 0xC3, 0xCF, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x32, 0x49, 0xF7, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0xF0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF,
-0x90, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x80, 0x92, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x70, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0x60, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF,
-0x50, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x40, 0x92, 0xC6, 0x00,
-0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x30, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xFC, 0xCF, 0xB0, 0x92, 0xC6, 0x00, 0x88, 0xCF, 0x0E, 0x94, 0x76, 0x3C, 0x86, 0x38,
-0x08, 0xF4, 0xBD, 0xCF, 0x0E, 0x94, 0x76, 0x3C, 0x0E, 0x94, 0xF3, 0x3C, 0x7E, 0xCF, 0x0E, 0x94,
-0x76, 0x3C, 0x80, 0x38, 0x09, 0xF4, 0x9C, 0xC0, 0x81, 0x38, 0x09, 0xF4, 0x0B, 0xC1, 0x82, 0x38,
-0x09, 0xF4, 0x30, 0xC1, 0x88, 0x39, 0x09, 0xF4, 0x8F, 0xC0, 0x80, 0xE0, 0x0E, 0x94, 0xC7, 0x3C,
-0x6C, 0xCF, 0x84, 0xE1, 0x0E, 0x94, 0xBD, 0x3C, 0x0E, 0x94, 0xF3, 0x3C, 0x66, 0xCF, 0x85, 0xE0,
-0x0E, 0x94, 0xBD, 0x3C, 0x0E, 0x94, 0xF3, 0x3C, 0x60, 0xCF, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93,
-0x06, 0x01, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93, 0x07, 0x01, 0x0E, 0x94, 0xF3, 0x3C, 0x55, 0xCF,
-0x0E, 0x94, 0x76, 0x3C, 0x80, 0x33, 0x09, 0xF4, 0x11, 0xC1, 0x83, 0xE0, 0x0E, 0x94, 0xBD, 0x3C,
-0x80, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0x49, 0xCF, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93, 0x09, 0x02,
-0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93, 0x08, 0x02, 0x80, 0x91, 0x0C, 0x02, 0x8E, 0x7F, 0x80, 0x93,
-0x0C, 0x02, 0x0E, 0x94, 0x76, 0x3C, 0x85, 0x34, 0x09, 0xF4, 0x09, 0xC1, 0x80, 0x91, 0x08, 0x02,
-0x90, 0x91, 0x09, 0x02, 0x89, 0x2B, 0x89, 0xF0, 0x00, 0xE0, 0x10, 0xE0, 0x0E, 0x94, 0x76, 0x3C,
-0xF8, 0x01, 0xE8, 0x5F, 0xFE, 0x4F, 0x80, 0x83, 0x0F, 0x5F, 0x1F, 0x4F, 0x80, 0x91, 0x08, 0x02,
-0x90, 0x91, 0x09, 0x02, 0x08, 0x17, 0x19, 0x07, 0x88, 0xF3, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x32,
-0x09, 0xF0, 0x45, 0xCF, 0x80, 0x91, 0x0C, 0x02, 0x80, 0xFF, 0xF5, 0xC0, 0x60, 0x91, 0x06, 0x01,
-0x70, 0x91, 0x07, 0x01, 0x66, 0x0F, 0x77, 0x1F, 0x70, 0x93, 0x07, 0x01, 0x60, 0x93, 0x06, 0x01,
-0xA0, 0x91, 0x08, 0x02, 0xB0, 0x91, 0x09, 0x02, 0x10, 0x97, 0xC9, 0xF0, 0xE8, 0xE0, 0xF1, 0xE0,
-0x9B, 0x01, 0xAD, 0x01, 0x4E, 0x0F, 0x5F, 0x1F, 0xF9, 0x99, 0xFE, 0xCF, 0x32, 0xBD, 0x21, 0xBD,
-0x81, 0x91, 0x80, 0xBD, 0xFA, 0x9A, 0xF9, 0x9A, 0x2F, 0x5F, 0x3F, 0x4F, 0xE4, 0x17, 0xF5, 0x07,
-0x99, 0xF7, 0x6A, 0x0F, 0x7B, 0x1F, 0x70, 0x93, 0x07, 0x01, 0x60, 0x93, 0x06, 0x01, 0x80, 0x91,
-0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xF0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF,
-0xFC, 0xCF, 0xB0, 0x92, 0xC6, 0x00, 0xE1, 0xCE, 0x83, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0xDD, 0xCE,
-0x82, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0xD9, 0xCE, 0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93, 0x09, 0x02,
-0x0E, 0x94, 0x76, 0x3C, 0x80, 0x93, 0x08, 0x02, 0x80, 0x91, 0x06, 0x01, 0x90, 0x91, 0x07, 0x01,
-0x88, 0x0F, 0x99, 0x1F, 0x90, 0x93, 0x07, 0x01, 0x80, 0x93, 0x06, 0x01, 0x0E, 0x94, 0x76, 0x3C,
-0x85, 0x34, 0x09, 0xF4, 0x9A, 0xC0, 0x80, 0x91, 0x0C, 0x02, 0x8E, 0x7F, 0x80, 0x93, 0x0C, 0x02,
-0x0E, 0x94, 0x76, 0x3C, 0x80, 0x32, 0x09, 0xF0, 0xB8, 0xCE, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF,
-0xFC, 0xCF, 0xF0, 0x92, 0xC6, 0x00, 0xA0, 0x91, 0x08, 0x02, 0xB0, 0x91, 0x09, 0x02, 0x10, 0x97,
-0xC1, 0xF1, 0x80, 0x91, 0x0C, 0x02, 0x08, 0x2F, 0x01, 0x70, 0x18, 0x2F, 0x16, 0x95, 0x11, 0x70,
-0xE0, 0x91, 0x06, 0x01, 0xF0, 0x91, 0x07, 0x01, 0xAF, 0x01, 0x4F, 0x5F, 0x5F, 0x4F, 0xBA, 0x01,
-0x20, 0xE0, 0x30, 0xE0, 0x00, 0x23, 0xB1, 0xF4, 0x11, 0x23, 0x39, 0xF4, 0x94, 0x91, 0x80, 0x91,
-0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0x90, 0x93, 0xC6, 0x00, 0x2F, 0x5F, 0x3F, 0x4F, 0xCB, 0x01,
-0x01, 0x96, 0xFA, 0x01, 0x2A, 0x17, 0x3B, 0x07, 0x80, 0xF4, 0xBC, 0x01, 0x4F, 0x5F, 0x5F, 0x4F,
-0x00, 0x23, 0x51, 0xF3, 0xF9, 0x99, 0xFE, 0xCF, 0xF2, 0xBD, 0xE1, 0xBD, 0xF8, 0x9A, 0x90, 0xB5,
-0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xE6, 0xCF, 0x70, 0x93, 0x07, 0x01, 0x60, 0x93,
-0x06, 0x01, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFD, 0xE5, 0xCE, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF,
-0xF8, 0xCF, 0xE0, 0xCE, 0x81, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0x67, 0xCE, 0x0E, 0x94, 0x76, 0x3C,
-0x80, 0x32, 0x09, 0xF0, 0x8C, 0xCE, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xF0, 0x92,
-0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xE0, 0x92, 0xC6, 0x00, 0x80, 0x91,
-0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xD0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF,
-0xFC, 0xCF, 0xC0, 0x92, 0xC6, 0x00, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xFC, 0xCF, 0xB0, 0x92,
-0xC6, 0x00, 0x43, 0xCE, 0x80, 0xE1, 0x0E, 0x94, 0xC7, 0x3C, 0x3F, 0xCE, 0x0E, 0x94, 0x76, 0x3C,
-0x0E, 0x94, 0x76, 0x3C, 0x18, 0x2F, 0x0E, 0x94, 0x76, 0x3C, 0x11, 0x23, 0x09, 0xF4, 0x83, 0xC0,
-0x11, 0x30, 0x09, 0xF4, 0x84, 0xC0, 0x8F, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0x2E, 0xCE, 0x80, 0x91,
-0x0C, 0x02, 0x81, 0x60, 0x80, 0x93, 0x0C, 0x02, 0xF1, 0xCE, 0x80, 0x91, 0x0C, 0x02, 0x81, 0x60,
-0x80, 0x93, 0x0C, 0x02, 0x65, 0xCF, 0x80, 0x91, 0x07, 0x01, 0x88, 0x23, 0x88, 0x0F, 0x88, 0x0B,
-0x8A, 0x21, 0x80, 0x93, 0x0B, 0x02, 0x80, 0x91, 0x06, 0x01, 0x90, 0x91, 0x07, 0x01, 0x88, 0x0F,
-0x99, 0x1F, 0x90, 0x93, 0x07, 0x01, 0x80, 0x93, 0x06, 0x01, 0x80, 0x91, 0x08, 0x02, 0x80, 0xFF,
-0x09, 0xC0, 0x80, 0x91, 0x08, 0x02, 0x90, 0x91, 0x09, 0x02, 0x01, 0x96, 0x90, 0x93, 0x09, 0x02,
-0x80, 0x93, 0x08, 0x02, 0xF8, 0x94, 0xF9, 0x99, 0xFE, 0xCF, 0x11, 0x27, 0xE0, 0x91, 0x06, 0x01,
-0xF0, 0x91, 0x07, 0x01, 0xC8, 0xE0, 0xD1, 0xE0, 0x80, 0x91, 0x08, 0x02, 0x90, 0x91, 0x09, 0x02,
-0x10, 0x30, 0x91, 0xF4, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3, 0x03, 0xE0,
-0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3,
-0x01, 0xE1, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x09, 0x90, 0x19, 0x90, 0x00, 0x91, 0x57, 0x00,
-0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3, 0x01, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x13, 0x95,
-0x10, 0x34, 0x98, 0xF0, 0x11, 0x27, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3,
-0x05, 0xE0, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30,
-0xD9, 0xF3, 0x01, 0xE1, 0x00, 0x93, 0x57, 0x00, 0xE8, 0x95, 0x32, 0x96, 0x02, 0x97, 0x09, 0xF0,
-0xC7, 0xCF, 0x10, 0x30, 0x11, 0xF0, 0x02, 0x96, 0xE5, 0xCF, 0x11, 0x24, 0x80, 0x91, 0xC0, 0x00,
-0x85, 0xFF, 0xC5, 0xCE, 0xC8, 0xCE, 0x8E, 0xE1, 0x0E, 0x94, 0xC7, 0x3C, 0xAE, 0xCD, 0x85, 0xE9,
-0x0E, 0x94, 0xC7, 0x3C, 0xAA, 0xCD, 0xF8, 0x94, 0xFF, 0xCF, 0x80, 0x00,
-}; // end of ATmegaBOOT_168_atmega328_pro_8MHz_hex
-
+0x76, 0xC0, 0x9B, 0xC9, 0x65, 0x0F, 0x91, 0x36, 0x2C, 0xF4, 0x90, 0x33, 0x0C, 0xF0, 0x90, 0x53,
+0x89, 0x2F, 0x08, 0x95, 0x97, 0x55, 0xC1, 0x05, 0x07, 0x1F, 0x93, 0x0E, 0x94, 0x9F, 0x3C, 0x18,
+0x2F, 0xC1, 0x05, 0x07, 0x12, 0x95, 0x10, 0x7F, 0x81, 0x0F, 0x1F, 0x91, 0xC1, 0x15, 0x05, 0x18,
+0x2F, 0x88, 0x23, 0x21, 0xF0, 0xC1, 0x43, 0x03, 0x11, 0x50, 0xE1, 0xF7, 0xC5, 0x13, 0xC1, 0x0F,
+0x11, 0x80, 0x32, 0x49, 0xF0, 0x80, 0x91, 0x03, 0x01, 0x8F, 0x5F, 0x80, 0x93, 0x03, 0x01, 0x85,
+0x30, 0xC1, 0xF0, 0xC1, 0x1D, 0xC5, 0x67, 0x02, 0x84, 0xE1, 0x80, 0xC8, 0xF1, 0x00, 0x10, 0xC8,
+0x0B, 0x00, 0x80, 0xC2, 0x19, 0xC1, 0x2B, 0xC7, 0xB9, 0xC1, 0x0D, 0xC3, 0x53, 0x00, 0x41, 0xCA,
+0x53, 0x01, 0x81, 0xF0, 0xD5, 0x51, 0xC3, 0x45, 0xC9, 0x43, 0x1D, 0x08, 0x95, 0x48, 0xEC, 0x50,
+0xE0, 0x88, 0x23, 0xA1, 0xF0, 0x2D, 0x9A, 0x28, 0xEE, 0x33, 0xE0, 0xFA, 0x01, 0x31, 0x97, 0xF1,
+0xF7, 0x21, 0x50, 0x30, 0x40, 0xD1, 0xF7, 0x2D, 0x98, 0xCD, 0x11, 0x2F, 0x81, 0x50, 0x61, 0xF7,
+0x08, 0x95, 0x3F, 0x92, 0x4F, 0x92, 0x5F, 0x92, 0x6F, 0x92, 0x7F, 0x92, 0x8F, 0x92, 0x9F, 0x92,
+0xAF, 0x92, 0xBF, 0x92, 0xCF, 0x92, 0xDF, 0x92, 0xEF, 0x92, 0xFF, 0x92, 0x0F, 0x93, 0x1F, 0x93,
+0xCF, 0x93, 0xDF, 0x93, 0x00, 0x00, 0x82, 0xE0, 0x80, 0x93, 0xC0, 0x00, 0xC1, 0x6F, 0x06, 0xC4,
+0x00, 0x10, 0x92, 0xC5, 0x00, 0x88, 0xC0, 0x09, 0x02, 0xC1, 0x00, 0x86, 0xC0, 0x15, 0x41, 0xC2,
+0x00, 0x50, 0x98, 0x58, 0x9A, 0x25, 0x9A, 0x81, 0xE0, 0x0E, 0x94, 0x14, 0x3D, 0x24, 0xE1, 0xF2,
+0x2E, 0x9E, 0xE1, 0xE9, 0x2E, 0x85, 0xE9, 0xD8, 0x2E, 0x0F, 0xE0, 0xC0, 0x2E, 0x10, 0xE1, 0xB1,
+0x2E, 0xAA, 0x24, 0xA3, 0x94, 0xB1, 0xE4, 0x9B, 0x2E, 0xA6, 0xE5, 0x8A, 0x2E, 0xF2, 0xE5, 0x7F,
+0x2E, 0xE0, 0xE2, 0x6E, 0x2E, 0x79, 0xE4, 0x57, 0x2E, 0x63, 0xE5, 0x46, 0x2E, 0x50, 0xE5, 0x35,
+0x2E, 0xC2, 0xF3, 0x0D, 0x33, 0xB1, 0xF1, 0x81, 0x33, 0xB9, 0xF1, 0x80, 0x34, 0x09, 0xF4, 0x6F,
+0xC0, 0x81, 0xC0, 0x05, 0x02, 0x76, 0xC0, 0x82, 0xC0, 0x05, 0x02, 0x85, 0xC0, 0x85, 0xC0, 0x05,
+0x0F, 0x88, 0xC0, 0x80, 0x35, 0x31, 0xF1, 0x82, 0x35, 0x21, 0xF1, 0x81, 0x35, 0x11, 0xF1, 0x85,
+0x35, 0xC1, 0x17, 0x00, 0x86, 0xC0, 0x05, 0x0E, 0x8D, 0xC0, 0x84, 0x36, 0x09, 0xF4, 0x96, 0xC0,
+0x84, 0x37, 0x09, 0xF4, 0x03, 0xC1, 0x85, 0xC0, 0x05, 0x02, 0x72, 0xC1, 0x86, 0xC0, 0x05, 0x19,
+0x66, 0xC0, 0x80, 0x91, 0x03, 0x01, 0x8F, 0x5F, 0x80, 0x93, 0x03, 0x01, 0x85, 0x30, 0x79, 0xF6,
+0xE0, 0x91, 0x04, 0x01, 0xF0, 0x91, 0x05, 0x01, 0x09, 0x95, 0xC3, 0x6B, 0x07, 0x51, 0xF6, 0x0E,
+0x94, 0xF3, 0x3C, 0xC3, 0xCF, 0xC2, 0x0D, 0x0E, 0x32, 0x49, 0xF7, 0x80, 0x91, 0xC0, 0x00, 0x85,
+0xFF, 0xFC, 0xCF, 0xF0, 0x92, 0xC6, 0x00, 0xC5, 0x0B, 0x00, 0x90, 0xC8, 0x0B, 0x00, 0x80, 0xC8,
+0x0B, 0x00, 0x70, 0xC8, 0x0B, 0x00, 0x60, 0xC8, 0x0B, 0x00, 0x50, 0xC8, 0x0B, 0x00, 0x40, 0xC8,
+0x0B, 0x00, 0x30, 0xC8, 0x0B, 0x00, 0xB0, 0xC0, 0x0B, 0x00, 0x88, 0xC2, 0x75, 0x04, 0x86, 0x38,
+0x08, 0xF4, 0xBD, 0xC2, 0x09, 0xC1, 0x89, 0x00, 0x7E, 0xC3, 0x89, 0x05, 0x38, 0x09, 0xF4, 0x9C,
+0xC0, 0x81, 0xC0, 0x05, 0x02, 0x0B, 0xC1, 0x82, 0xC0, 0x05, 0x14, 0x30, 0xC1, 0x88, 0x39, 0x09,
+0xF4, 0x8F, 0xC0, 0x80, 0xE0, 0x0E, 0x94, 0xC7, 0x3C, 0x6C, 0xCF, 0x84, 0xE1, 0x0E, 0x94, 0xBD,
+0xC2, 0x2F, 0x02, 0x66, 0xCF, 0x85, 0xC0, 0x13, 0xC3, 0x0B, 0x00, 0x60, 0xC3, 0x3B, 0x02, 0x93,
+0x06, 0x01, 0xC3, 0x07, 0x00, 0x07, 0xC0, 0x07, 0x02, 0xF3, 0x3C, 0x55, 0xC3, 0x15, 0x05, 0x33,
+0x09, 0xF4, 0x11, 0xC1, 0x83, 0xC2, 0x2B, 0xC3, 0x45, 0x00, 0x49, 0xC4, 0x2D, 0x01, 0x09, 0x02,
+0xC3, 0x07, 0x0A, 0x08, 0x02, 0x80, 0x91, 0x0C, 0x02, 0x8E, 0x7F, 0x80, 0x93, 0x0C, 0xC2, 0x11,
+0x14, 0x85, 0x34, 0x09, 0xF4, 0x09, 0xC1, 0x80, 0x91, 0x08, 0x02, 0x90, 0x91, 0x09, 0x02, 0x89,
+0x2B, 0x89, 0xF0, 0x00, 0xE0, 0x10, 0xC0, 0x39, 0x0D, 0x76, 0x3C, 0xF8, 0x01, 0xE8, 0x5F, 0xFE,
+0x4F, 0x80, 0x83, 0x0F, 0x5F, 0x1F, 0x4F, 0xC5, 0x1F, 0x05, 0x08, 0x17, 0x19, 0x07, 0x88, 0xF3,
+0xC2, 0x49, 0x04, 0x32, 0x09, 0xF0, 0x45, 0xCF, 0xC1, 0x4B, 0x10, 0x80, 0xFF, 0xF5, 0xC0, 0x60,
+0x91, 0x06, 0x01, 0x70, 0x91, 0x07, 0x01, 0x66, 0x0F, 0x77, 0x1F, 0x70, 0xC0, 0x91, 0x00, 0x60,
+0xC0, 0x9D, 0x00, 0xA0, 0xC0, 0x33, 0x00, 0xB0, 0xC0, 0x33, 0x0C, 0x10, 0x97, 0xC9, 0xF0, 0xE8,
+0xE0, 0xF1, 0xE0, 0x9B, 0x01, 0xAD, 0x01, 0x4E, 0xC0, 0x4C, 0x1C, 0xF9, 0x99, 0xFE, 0xCF, 0x32,
+0xBD, 0x21, 0xBD, 0x81, 0x91, 0x80, 0xBD, 0xFA, 0x9A, 0xF9, 0x9A, 0x2F, 0x5F, 0x3F, 0x4F, 0xE4,
+0x17, 0xF5, 0x07, 0x99, 0xF7, 0x6A, 0x0F, 0x7B, 0xC6, 0x3D, 0x0B, 0x80, 0x91, 0xC0, 0x00, 0x85,
+0xFF, 0xFC, 0xCF, 0xF0, 0x92, 0xC6, 0x00, 0xC5, 0x0B, 0x00, 0xB0, 0xC0, 0x0B, 0x01, 0xE1, 0xCE,
+0xC1, 0xDD, 0x04, 0xC7, 0x3C, 0xDD, 0xCE, 0x82, 0xC2, 0x07, 0x01, 0xD9, 0xCE, 0xCF, 0xDF, 0x02,
+0x06, 0x01, 0x90, 0xC0, 0x8B, 0x04, 0x88, 0x0F, 0x99, 0x1F, 0x90, 0xC0, 0x4D, 0x00, 0x80, 0xC0,
+0x4D, 0xC5, 0xE9, 0x01, 0x9A, 0xC0, 0xCB, 0xFD, 0xC1, 0xC5, 0x01, 0xB8, 0xCE, 0xC9, 0x6B, 0xC7,
+0xB5, 0x01, 0xC1, 0xF1, 0xC1, 0x2B, 0x0A, 0x08, 0x2F, 0x01, 0x70, 0x18, 0x2F, 0x16, 0x95, 0x11,
+0x70, 0xE0, 0xC0, 0x57, 0x00, 0xF0, 0xC0, 0x57, 0x15, 0xAF, 0x01, 0x4F, 0x5F, 0x5F, 0x4F, 0xBA,
+0x01, 0x20, 0xE0, 0x30, 0xE0, 0x00, 0x23, 0xB1, 0xF4, 0x11, 0x23, 0x39, 0xF4, 0x94, 0x91, 0xC5,
+0x43, 0x03, 0x90, 0x93, 0xC6, 0x00, 0xC1, 0xD1, 0x0C, 0xCB, 0x01, 0x01, 0x96, 0xFA, 0x01, 0x2A,
+0x17, 0x3B, 0x07, 0x80, 0xF4, 0xBC, 0xC2, 0x31, 0x03, 0x00, 0x23, 0x51, 0xF3, 0xC1, 0xFB, 0x07,
+0xF2, 0xBD, 0xE1, 0xBD, 0xF8, 0x9A, 0x90, 0xB5, 0xC5, 0x31, 0x01, 0xE6, 0xCF, 0xCA, 0xF3, 0x01,
+0xFD, 0xE5, 0xC4, 0x8F, 0x04, 0xF8, 0xCF, 0xE0, 0xCE, 0x81, 0xC2, 0xE3, 0x00, 0x67, 0xC3, 0xE3,
+0xC0, 0xAB, 0x00, 0x8C, 0xCA, 0xAB, 0xC5, 0x0B, 0x00, 0xE0, 0xC8, 0x0B, 0x00, 0xD0, 0xC8, 0x0B,
+0x00, 0xC0, 0xC8, 0x0B, 0x00, 0xB0, 0xC0, 0x0B, 0x03, 0x43, 0xCE, 0x80, 0xE1, 0xC1, 0x4F, 0x00,
+0x3F, 0xC2, 0x4F, 0xC1, 0x03, 0x01, 0x18, 0x2F, 0xC1, 0x05, 0x0C, 0x11, 0x23, 0x09, 0xF4, 0x83,
+0xC0, 0x11, 0x30, 0x09, 0xF4, 0x84, 0xC0, 0x8F, 0xC2, 0x71, 0x00, 0x2E, 0xC0, 0x67, 0x08, 0x0C,
+0x02, 0x81, 0x60, 0x80, 0x93, 0x0C, 0x02, 0xF1, 0xC8, 0x0B, 0x16, 0x65, 0xCF, 0x80, 0x91, 0x07,
+0x01, 0x88, 0x23, 0x88, 0x0F, 0x88, 0x0B, 0x8A, 0x21, 0x80, 0x93, 0x0B, 0x02, 0x80, 0x91, 0x06,
+0x01, 0x90, 0xC1, 0x13, 0x03, 0x0F, 0x99, 0x1F, 0x90, 0xC0, 0xC7, 0x00, 0x80, 0xC2, 0xC7, 0x05,
+0x08, 0x02, 0x80, 0xFF, 0x09, 0xC0, 0xC1, 0x07, 0x16, 0x90, 0x91, 0x09, 0x02, 0x01, 0x96, 0x90,
+0x93, 0x09, 0x02, 0x80, 0x93, 0x08, 0x02, 0xF8, 0x94, 0xF9, 0x99, 0xFE, 0xCF, 0x11, 0x27, 0xE0,
+0xC0, 0x35, 0x00, 0xF0, 0xC0, 0x35, 0x03, 0xC8, 0xE0, 0xD1, 0xE0, 0xC5, 0x25, 0x15, 0x10, 0x30,
+0x91, 0xF4, 0x00, 0x91, 0x57, 0x00, 0x01, 0x70, 0x01, 0x30, 0xD9, 0xF3, 0x03, 0xE0, 0x00, 0x93,
+0x57, 0x00, 0xE8, 0x95, 0xC7, 0x11, 0x01, 0x01, 0xE1, 0xC3, 0x11, 0x03, 0x09, 0x90, 0x19, 0x90,
+0xC8, 0x15, 0xC4, 0x27, 0x07, 0x13, 0x95, 0x10, 0x34, 0x98, 0xF0, 0x11, 0x27, 0xC7, 0x19, 0x00,
+0x05, 0xD6, 0x41, 0x1D, 0x32, 0x96, 0x02, 0x97, 0x09, 0xF0, 0xC7, 0xCF, 0x10, 0x30, 0x11, 0xF0,
+0x02, 0x96, 0xE5, 0xCF, 0x11, 0x24, 0x80, 0x91, 0xC0, 0x00, 0x85, 0xFF, 0xC5, 0xCE, 0xC8, 0xCE,
+0x8E, 0xE1, 0xC1, 0xFF, 0x03, 0xAE, 0xCD, 0x85, 0xE9, 0xC1, 0x07, 0x07, 0xAA, 0xCD, 0xF8, 0x94,
+0xFF, 0xCF, 0x80, 0x00,
+};  // end of ATmegaBOOT_168_atmega328_pro_8MHz_hex
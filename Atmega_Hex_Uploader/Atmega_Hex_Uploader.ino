@@ -1,7 +1,7 @@
 // Atmega hex file uploader (from SD card)
 // Author: Nick Gammon
 // Date: 22nd May 2012
-// Version: 1.37     // NB update 'Version' variable below!
+// Version: 1.55     // NB update 'Version' variable below!
 
 // Version 1.1: Some code cleanups as suggested on the Arduino forum.
 // Version 1.2: Cleared temporary flash area to 0xFF before doing each page
@@ -45,25 +45,54 @@
 // Version 1.35: Got rid of compiler warnings in IDE 1.6.7
 // Version 1.36: Got rid of warning from cppcheck regarding scope of allFF variable
 // Version 1.37: Fixed bug re verifying combined sketch/bootloader on Atmega2560
+// Version 1.38: Added reading, writing and verifying EEPROM (.EEP files), using EEPROM page writes
+// Version 1.39: Added optional verify-first mode: flash already matching the file is not rewritten
+// Version 1.40: Pages which are not in one piece in the .HEX file are assembled and committed once
+// Version 1.41: Allowed a list of files (eg. APP.HEX+BOOT.HEX) to be written in one pass
+// Version 1.42: Added writing of .ELF files, including their EEPROM, fuse and lock byte contents
+// Version 1.43: Faster entry to ICSP programming mode (pulse SCK to regain sync, back off only on failure)
+// Version 1.44: Target kept in programming mode between commands (released after being idle, or by the X command)
+// Version 1.45: Added job files (eg. JOB.TXT) to do flash, EEPROM, fuses and lock byte in one go
+// Version 1.46: Fuses written through a shared plan: only changed ones, lock byte last, read back once
+// Version 1.47: Signature table generated from devices.txt, found with an indexed lookup
+// Version 1.48: Added optional upload from a PC over the serial port (U command), with page-sized frames
+// Version 1.49: Added optional STK500 version 2 server mode, so avrdude can drive the programmer
+// Version 1.50: Added optional batch mode (B command), for scripts: one command per line, answered with OK or ERR
+// Version 1.51: Added programming through the target's serial bootloader (Optiboot), for updating just the application
+// Version 1.52: Fixed the .signature check in .ELF files, avr-libc stores the bytes last one first
+// Version 1.53: STK500 version 2 server fails chip erase, fuse, lock and EEPROM commands when programming through the bootloader
+// Version 1.54: After X (release target), Enter is accepted as a carriage-return only
+// Version 1.55: Serial upload only answers a page sent again once it is written
 
 
 const bool allowTargetToRun = true;  // if true, programming lines are freed when not programming
+const bool verifyBeforeWriting = false;  // if true, flash is compared first and only written if different
 
 #define ALLOW_MODIFY_FUSES true   // make false if this sketch doesn't fit into memory
 #define ALLOW_FILE_SAVING true    // make false if this sketch doesn't fit into memory
 #define SAFETY_CHECKS true        // check for disabling SPIEN, or enabling RSTDISBL
+#define BATCH_MODE false          // make true to allow commands from a script (see Batch_Mode.ino)
+#define START_IN_BATCH_MODE false // make true to go straight into batch mode, with no banner or menu
 
 #define USE_ETHERNET_SHIELD false  // Use the Arduino Ethernet Shield for the SD card
 
 // make true if you have spare pins for the SD card interface
 #define SD_CARD_ACTIVE true
 
+// make true to allow uploading from a PC over the serial port (see Serial_Upload.ino)
+#define SERIAL_UPLOAD false
+
+// make true to be driven by avrdude (-c stk500v2) instead of the menu (see Stk500v2_Server.ino)
+#define STK500V2_SERVER false
+
 // make true to use the high-voltage parallel wiring
 #define HIGH_VOLTAGE_PARALLEL false
 // make true to use the high-voltage serial wiring
 #define HIGH_VOLTAGE_SERIAL false
 // make true to use ICSP programming
 #define ICSP_PROGRAMMING true
+// make true to program through the target's serial bootloader (see Bootloader_Utils.ino)
+#define BOOTLOADER_PROGRAMMING false
 
 // make true to use bit-banged SPI for programming
 #define USE_BIT_BANGED_SPI true
@@ -76,14 +105,34 @@ const bool allowTargetToRun = true;  // if true, programming lines are freed whe
   #error Cannot use ICSP and high-voltage programming at the same time
 #endif
 
-#if !(HIGH_VOLTAGE_PARALLEL || HIGH_VOLTAGE_SERIAL || ICSP_PROGRAMMING)
-  #error Choose a programming mode: HIGH_VOLTAGE_PARALLEL, HIGH_VOLTAGE_SERIAL or ICSP_PROGRAMMING
+#if BOOTLOADER_PROGRAMMING && (HIGH_VOLTAGE_PARALLEL || HIGH_VOLTAGE_SERIAL || ICSP_PROGRAMMING)
+  #error Cannot use the bootloader and another programming mode at the same time
+#endif
+
+#if !(HIGH_VOLTAGE_PARALLEL || HIGH_VOLTAGE_SERIAL || ICSP_PROGRAMMING || BOOTLOADER_PROGRAMMING)
+  #error Choose a programming mode: HIGH_VOLTAGE_PARALLEL, HIGH_VOLTAGE_SERIAL, ICSP_PROGRAMMING or BOOTLOADER_PROGRAMMING
+#endif
+
+#if BOOTLOADER_PROGRAMMING && ALLOW_MODIFY_FUSES
+  #error Fuses cannot be changed through the bootloader, make ALLOW_MODIFY_FUSES false
 #endif
 
 #if !USE_BIT_BANGED_SPI && SD_CARD_ACTIVE
   #error If you are using an SD card you need to use bit-banged SPI for the programmer
 #endif
 
+#if SERIAL_UPLOAD && USE_BIT_BANGED_SPI && ICSP_PROGRAMMING
+  #error Serial upload needs hardware SPI (bit-banged SPI has interrupts off for too long at high baud rates)
+#endif
+
+#if START_IN_BATCH_MODE && !BATCH_MODE
+  #error Make BATCH_MODE true to start in batch mode
+#endif
+
+#if STK500V2_SERVER && SERIAL_UPLOAD
+  #error The STK500 version 2 server replaces the menu, so serial upload cannot be used with it
+#endif
+
 
 /*
 
@@ -123,10 +172,11 @@ const bool allowTargetToRun = true;  // if true, programming lines are freed whe
 #include <SdFat.h>
 
 #include <avr/eeprom.h>
+#include <util/crc16.h>
 
 // #include <memdebug.h>
 
-const char Version [] = "1.37";
+const char Version [] = "1.55";
 
 const unsigned int ENTER_PROGRAMMING_ATTEMPTS = 50;
 
@@ -245,6 +295,7 @@ const byte CLOCKOUT = 9;
   #endif
 
   const int MAX_FILENAME = 13;
+  const int MAX_FILE_LIST = 40;   // eg. APP.HEX+BOOT.HEX
   void * LAST_FILENAME_LOCATION_IN_EEPROM = 0;
 
   // file system object
@@ -256,6 +307,10 @@ enum {
     checkFile,
     verifyFlash,
     writeToFlash,
+    verifyEEPROM,
+    writeToEEPROM,
+    compareFlash,   // like verifyFlash, but quietly stops at the first difference
+    writeFragmentedPage,  // write only the page in assemblyPage
 };
 
 
@@ -358,8 +413,12 @@ bool hexConv (const char * (& pStr), byte & b)
   }  // end of hexConv
 
 
-void verifyData (const unsigned long addr, const byte * pData, const int length)
+void verifyData (const unsigned long addr, const byte * pData, const int length, const byte action)
   {
+  // already found a difference? no point in reading any more
+  if (action == compareFlash && errors)
+    return;
+
   // check each byte
   for (int i = 0; i < length; i++)
     {
@@ -370,10 +429,13 @@ void verifyData (const unsigned long addr, const byte * pData, const int length)
     // now this is the current page
     oldPage = thisPage;
 
-    byte found = readFlash (addr + i);
+    byte found = (action == verifyEEPROM) ? readEEPROM (addr + i) : readFlash (addr + i);
     byte expected = pData [i];
     if (found != expected)
       {
+      errors++;
+      if (action == compareFlash)
+        return;
       if (errors <= 100)
         {
         Serial.print (F("Verification error at address "));
@@ -383,7 +445,6 @@ void verifyData (const unsigned long addr, const byte * pData, const int length)
         Serial.print (F(" Expected: "));
         showHex (expected, true);
         }  // end of haven't shown 100 errors yet
-      errors++;
       }  // end if error
     }  // end of for
 
@@ -391,6 +452,7 @@ void verifyData (const unsigned long addr, const byte * pData, const int length)
 
 unsigned long lowestAddress;
 unsigned long highestAddress;
+unsigned long bootStartAddress;  // lowest address of the highest file (in a list of files)
 unsigned long bytesWritten;
 
 void getSignature ()
@@ -406,27 +468,31 @@ void getSignature ()
 
   Serial.println ();
 
-  for (unsigned int j = 0; j < NUMITEMS (signatures); j++)
+  foundSig = findSignature (sig);
+  if (foundSig != -1)
     {
-    memcpy_P (&currentSignature, &signatures [j], sizeof currentSignature);
-
-    if (memcmp (sig, currentSignature.sig, sizeof sig) == 0)
-      {
-      foundSig = j;
-      Serial.print (F("Processor = "));
-      Serial.println (currentSignature.desc);
-      Serial.print (F("Flash memory size = "));
-      Serial.print (currentSignature.flashSize, DEC);
-      Serial.println (F(" bytes."));
-      return;
-      }  // end of signature found
-    }  // end of for each signature
+    memcpy_P (&currentSignature, &signatures [foundSig], sizeof currentSignature);
+    Serial.print (F("Processor = "));
+    Serial.println (currentSignature.desc);
+    Serial.print (F("Flash memory size = "));
+    Serial.print (currentSignature.flashSize, DEC);
+    Serial.println (F(" bytes."));
+    Serial.print (F("EEPROM size = "));
+    Serial.print (currentSignature.eepromSize, DEC);
+    Serial.println (F(" bytes."));
+    return;
+    }  // end of signature found
 
   Serial.println (F("Unrecogized signature."));
   }  // end of getSignature
 
 void getFuseBytes ()
   {
+#if BOOTLOADER_PROGRAMMING
+  Serial.println (F("Fuses cannot be read through the bootloader."));
+  return;
+#endif // BOOTLOADER_PROGRAMMING
+
   fuses [lowFuse]   = readFuse (lowFuse);
   fuses [highFuse]  = readFuse (highFuse);
   fuses [extFuse]   = readFuse (extFuse);
@@ -445,19 +511,9 @@ void getFuseBytes ()
   showHex (fuses [calibrationByte], true);
   }  // end of getFuseBytes
 
-void showFuseName (const byte which)
-  {
-  switch (which)
-    {
-    case lowFuse:         Serial.print (F("low"));      break;
-    case highFuse:        Serial.print (F("high"));     break;
-    case extFuse:         Serial.print (F("extended")); break;
-    case lockByte:        Serial.print (F("lock"));     break;
-    case calibrationByte: Serial.print (F("clock"));    break;
-    }  // end of switch
-  }  // end of showFuseName
-
-bool updateFuses (const bool writeIt)
+// work out the bootloader fuse from where the flash file(s) start, and add it to the plan
+//  returns true if error, false if OK
+bool planBootFuse (fusePlanType & plan)
   {
   unsigned long addr;
   unsigned int  len;
@@ -474,24 +530,27 @@ bool updateFuses (const bool writeIt)
   addr = currentSignature.flashSize;
   len = currentSignature.baseBootSize;
 
-  if (lowestAddress == 0)
+  byte newFuse = fuses [fusenumber];
+
+  // for a list of files this is where the bootloader file starts
+  if (bootStartAddress == 0)
     {
     Serial.println (F("No bootloader."));
 
     // don't use bootloader
-    fuses [fusenumber] |= 1;
+    newFuse |= 1;
     }
   else
     {
     byte newval = 0xFF;
 
-    if (lowestAddress == (addr - len))
+    if (bootStartAddress == (addr - len))
       newval = 3;
-    else if (lowestAddress == (addr - len * 2))
+    else if (bootStartAddress == (addr - len * 2))
       newval = 2;
-    else if (lowestAddress == (addr - len * 4))
+    else if (bootStartAddress == (addr - len * 4))
       newval = 1;
-    else if (lowestAddress == (addr - len * 8))
+    else if (bootStartAddress == (addr - len * 8))
       newval = 0;
     else
       {
@@ -502,38 +561,127 @@ bool updateFuses (const bool writeIt)
     if (newval != 0xFF)
       {
       newval <<= 1;
-      fuses [fusenumber] &= ~0x07;   // also program (clear) "boot into bootloader" bit
-      fuses [fusenumber] |= newval;
+      newFuse &= ~0x07;   // also program (clear) "boot into bootloader" bit
+      newFuse |= newval;
       }  // if valid
 
     }  // if not address 0
 
-  if (writeIt)
-    {
-    Serial.print (F("Setting "));
-    writeFuse (fuses [fusenumber], fusenumber);
-    }
-  else
-    Serial.print (F("Suggest making "));
+  plan.fuses [fusenumber] = newFuse;
+  plan.mask |= bit (fusenumber);
+  return false;
+  }  // end of planBootFuse
 
-  showFuseName (fusenumber);
-  Serial.print (F(" fuse = "));
-  showHex (fuses [fusenumber], true);
+bool updateFuses (const bool writeIt)
+  {
+  fusePlanType plan;
+  plan.mask = 0;
+
+  if (planBootFuse (plan))
+    return true;
+
+  // no bootloader fuse?
+  if (plan.mask == 0)
+    return false;
 
   if (writeIt)
-    Serial.println (F("Done."));
+    return writeFusePlan (plan);
 
+  byte fusenumber = currentSignature.fuseWithBootloaderSize;
+  Serial.print (F("Suggest making "));
+  showFuseName (fusenumber);
+  Serial.print (F(" fuse = "));
+  showHex (plan.fuses [fusenumber], true);
   return false;
   }  // end of updateFuses
 
+/*
+Programming session.
+
+Once the target is in programming mode we keep it there (held in reset) between
+commands, so we don't have to reset it, and find out its signature and fuses
+again, for every command. Before each command a quick read of the signature
+confirms that it is still the same chip. If allowTargetToRun is true the target
+is let go (so it runs) after SESSION_IDLE_TIMEOUT, or when asked (the X command).
+*/
+
+const unsigned long SESSION_IDLE_TIMEOUT = 30000;  // mS
+
+bool sessionActive;              // target is in programming mode, and signature/fuses are known
+unsigned long sessionLastUsed;   // when it was last used (millis)
+bool batchMode;                  // commands are coming from a script, see Batch_Mode.ino
+
+// make sure we are in programming mode, and know what the target is
+//  returns true if OK, false if not
+bool beginSession ()
+  {
+  if (sessionActive)
+    {
+    byte sig [3];
+    readSignature (sig);
+    if (memcmp (sig, currentSignature.sig, sizeof sig) == 0)
+      {
+      sessionLastUsed = millis ();
+      return true;
+      }
+    Serial.println (F("Target has changed, starting again."));
+    sessionActive = false;
+    }  // end of already active
+
+  if (!startProgramming ())
+    return false;
+
+  getSignature ();
+  getFuseBytes ();
+
+  // don't have signature? don't proceed
+  if (foundSig == -1)
+    {
+    stopProgramming ();
+    return false;
+    }  // end of no signature
+
+  sessionActive = true;
+  sessionLastUsed = millis ();
+  return true;
+  }  // end of beginSession
+
+// let the target go, it will have to be checked again next time
+void endSession ()
+  {
+  stopProgramming ();
+  sessionActive = false;
+  }  // end of endSession
+
+// let the target run if we haven't used it for a while
+void checkSessionTimeout ()
+  {
+  if (allowTargetToRun && sessionActive && millis () - sessionLastUsed >= SESSION_IDLE_TIMEOUT)
+    {
+    endSession ();
+    if (!batchMode)
+      Serial.println (F("Target released (idle)."));
+    }
+  }  // end of checkSessionTimeout
+
 //------------------------------------------------------------------------------
 //      SETUP
 //------------------------------------------------------------------------------
 void setup ()
   {
+#if STK500V2_SERVER
+  // avrdude is at the other end, so no banner
+  stk500v2Begin ();
+  initPins ();
+  return;
+#endif // STK500V2_SERVER
+
   Serial.begin(115200);
   while (!Serial) ;  // for Leonardo, Micro etc.
 
+#if START_IN_BATCH_MODE
+  batchMode = true;  // a script is at the other end, so no banner
+#else
   Serial.println ();
   Serial.println ();
   Serial.println (F("Atmega hex file uploader."));
@@ -541,6 +689,7 @@ void setup ()
   Serial.print   (F("Version "));
   Serial.println (Version);
   Serial.println (F("Compiled on " __DATE__ " at " __TIME__ " with Arduino IDE " xstr(ARDUINO) "."));
+#endif // START_IN_BATCH_MODE
 
   initPins ();
 
@@ -548,6 +697,10 @@ void setup ()
   initFile ();
 #endif // SD_CARD_ACTIVE
 
+#if START_IN_BATCH_MODE
+  startBatchMode ();
+#endif // START_IN_BATCH_MODE
+
 }  // end of setup
 
 bool getYesNo ()
@@ -569,7 +722,7 @@ void eraseFlashContents ()
     }
 
   // ensure back in programming mode
-  if (!startProgramming ())
+  if (!beginSession ())
     return;
 
   Serial.println (F("Erasing chip ..."));
@@ -578,6 +731,28 @@ void eraseFlashContents ()
 
   }  // end of eraseFlashContents
 
+// returns true (and says why) if this fuse value is not allowed
+bool unsafeFuse (const byte fusenumber, const byte newValue)
+  {
+#if SAFETY_CHECKS
+  if (fusenumber == highFuse && (newValue & 0xC0) != 0xC0)
+    {
+    if (!serialIsBinary)
+      Serial.println (F("Activating RSTDISBL/DWEN/OCDEN/JTAGEN not permitted."));
+    return true;
+    }  // end safety check
+
+  if (fusenumber == highFuse && (newValue & 0x20) != 0)
+    {
+    if (!serialIsBinary)
+      Serial.println (F("Disabling SPIEN not permitted."));
+    return true;
+    }  // end safety check
+#endif // SAFETY_CHECKS
+
+  return false;
+  }  // end of unsafeFuse
+
 #if ALLOW_MODIFY_FUSES
 void modifyFuses ()
   {
@@ -640,19 +815,8 @@ void modifyFuses ()
     return;
     }  // end if no change to fuse
 
-#if SAFETY_CHECKS
-  if (fusenumber == highFuse && (newValue & 0xC0) != 0xC0)
-    {
-    Serial.println (F("Activating RSTDISBL/DWEN/OCDEN/JTAGEN not permitted."));
-    return;
-    }  // end safety check
-
-  if (fusenumber == highFuse && (newValue & 0x20) != 0)
-    {
-    Serial.println (F("Disabling SPIEN not permitted."));
+  if (unsafeFuse (fusenumber, newValue))
     return;
-    }  // end safety check
-#endif // SAFETY_CHECKS
 
   // get confirmation
   Serial.println (F("WARNING: Fuse changes may make the processor unresponsive."));
@@ -672,7 +836,7 @@ void modifyFuses ()
     }  // if cancelled
 
   // ensure back in programming mode
-  if (!startProgramming ())
+  if (!beginSession ())
     return;
 
   // tell them what we are doing
@@ -680,12 +844,12 @@ void modifyFuses ()
   showFuseName (fusenumber);
   Serial.println (F(" fuse ..."));
 
-  // change it
-  writeFuse (newValue, fusenumber);
-
-  // confirm and show new value
-  Serial.println (F("Fuse written."));
-  getFuseBytes ();
+  // change it (and read it back)
+  fusePlanType plan;
+  plan.fuses [fusenumber] = newValue;
+  plan.mask = bit (fusenumber);
+  if (!writeFusePlan (plan))
+    Serial.println (F("Fuse written."));
 
   }  // end of modifyFuses
 #endif
@@ -695,33 +859,39 @@ void modifyFuses ()
 //------------------------------------------------------------------------------
 void loop ()
 {
-  Serial.println ();
-  Serial.println (F("--------- Starting ---------"));
-  Serial.println ();
+#if STK500V2_SERVER
+  stk500v2Server ();
+  return;
+#endif // STK500V2_SERVER
 
-  if (!startProgramming ())
+#if BATCH_MODE
+  if (batchMode)
     {
-    Serial.println (F("Halted."));
-    stopProgramming ();
-    while  (true)
-      {}
-    }  // end of could not enter programming mode
-
-  getSignature ();
-  getFuseBytes ();
+    batchCommand ();
+    return;
+    }
+#endif // BATCH_MODE
 
-  // don't have signature? don't proceed
-  if (foundSig == -1)
+  // find out about the target, unless we still have it in programming mode
+  if (!sessionActive)
     {
-    Serial.println (F("Halted."));
-    stopProgramming ();
-    while  (true)
-      {}
-    }  // end of no signature
+    Serial.println ();
+    Serial.println (F("--------- Starting ---------"));
+    Serial.println ();
+
+    if (!beginSession ())
+      {
+      Serial.println (F("Halted."));
+      while  (true)
+        {}
+      }  // end of could not enter programming mode
+    }  // end of no session
 
  // ask for verify or write
   Serial.println (F("Actions:"));
+#if !BOOTLOADER_PROGRAMMING
   Serial.println (F(" [E] erase flash"));
+#endif
 #if ALLOW_MODIFY_FUSES
   Serial.println (F(" [F] modify fuses"));
 #endif
@@ -731,12 +901,19 @@ void loop ()
     {
     Serial.println (F(" [L] list directory"));
 #if ALLOW_FILE_SAVING
-    Serial.println (F(" [R] read from flash (save to disk)"));
+    Serial.println (F(" [R] read from flash/EEPROM (save to .HEX/.EEP file)"));
 #endif
-    Serial.println (F(" [V] verify flash (compare to disk)"));
-    Serial.println (F(" [W] write to flash (read from disk)"));
+    Serial.println (F(" [V] verify flash/EEPROM (compare to .HEX/.EEP file)"));
+    Serial.println (F(" [W] write to flash/EEPROM (read from .HEX/.EEP/.ELF file)"));
     }  // end of if SD card detected
 #endif // SD_CARD_ACTIVE
+#if SERIAL_UPLOAD
+  Serial.println (F(" [U] upload to flash from the PC (serialUpload)"));
+#endif // SERIAL_UPLOAD
+#if BATCH_MODE
+  Serial.println (F(" [B] batch mode (commands from a script)"));
+#endif // BATCH_MODE
+  Serial.println (F(" [X] release target (let it run)"));
 
   Serial.println (F("Enter action:"));
 
@@ -744,26 +921,38 @@ void loop ()
   while (Serial.available ())
     Serial.read ();
 
-  // turn off programming outputs if required
-  if (allowTargetToRun)
-    stopProgramming ();
-
-  char command;
-  do
+  // wait for a command, letting the target go if it isn't used for a while
+  char command = 0;
+  while (!isalpha (command))
     {
-    command = toupper (Serial.read ());
-    } while (!isalpha (command));
+    if (Serial.available ())
+      command = toupper (Serial.read ());
+    else
+      checkSessionTimeout ();
+    }  // end of waiting for a command
 
   Serial.println (command);  // echo their input
 
-  // re-start programming mode if required
-  if (allowTargetToRun)
-    if (!startProgramming ())
-      {
-      Serial.println (F("Halted."));
-      while  (true)
-        {}
-      } // end of could not enter programming mode
+  // let the target go
+  if (command == 'X')
+    {
+    endSession ();
+    Serial.println (F("Target released. Press Enter to start again ..."));
+    // Enter may be sent as CR, LF or both (the rest is discarded when the menu is shown)
+    int c;
+    do
+      c = Serial.read ();
+    while (c != '\n' && c != '\r');
+    return;
+    }  // end of releasing the target
+
+  // make sure we still have the same target in programming mode
+  if (!beginSession ())
+    {
+    Serial.println (F("Halted."));
+    while  (true)
+      {}
+    } // end of could not enter programming mode
 
   switch (command)
     {
@@ -784,9 +973,23 @@ void loop ()
         break;
 #endif // SD_CARD_ACTIVE
 
+#if SERIAL_UPLOAD
+    case 'U':
+      serialUpload ();
+      break;
+#endif // SERIAL_UPLOAD
+
+#if BATCH_MODE
+    case 'B':
+      startBatchMode ();
+      break;
+#endif // BATCH_MODE
+
+#if !BOOTLOADER_PROGRAMMING
     case 'E':
       eraseFlashContents ();
       break;
+#endif
 #if ALLOW_MODIFY_FUSES
     case 'F':
       modifyFuses ();
@@ -804,5 +1007,6 @@ void loop ()
       break;
     }  // end of switch on command
 
+  sessionLastUsed = millis ();
 }  // end of loop
 
@@ -0,0 +1,282 @@
+// Batch_Mode.ino
+//
+// Commands from a script, one per line, instead of the menu
+//
+// Author: Nick Gammon
+
+#if BATCH_MODE
+
+/*
+
+After the B command (or from the start, if START_IN_BATCH_MODE is true) there is no menu,
+and nothing is asked for (there are no 'YES' confirmations). Each line is one command, and
+the last line of the reply to it is one of:
+
+  OK <mS> [results]
+  ERR <mS> <reason>
+
+where mS is how long the command took. Any lines before that (eg. progress, or the details
+of a verification error) are for information. Entering batch mode is answered with "OK 0 BATCH".
+
+Commands (not case-sensitive, blank lines and lines starting with # are ignored):
+
+  SIG?                     signature and processor, eg. OK 31 1E950F ATmega328P
+  FUSE?                    fuses, eg. OK 2 L=FF H=DE E=FD LOCK=FF CAL=9A
+  FUSE <L|H|E|LOCK> <hex>  change a fuse or the lock byte, eg. FUSE H DE
+  ERASE                    erase the chip
+  W <file>                 write and verify a .HEX/.ELF/.EEP file, list of them (A.HEX+B.HEX), or job (.TXT)
+  V <file>                 verify against a file, list or job
+  R <file>                 save the flash (.HEX) or EEPROM (.EEP) to a file, replacing it if it is there
+  EEP W <file>             write and verify a .EEP file (as W, but only an EEPROM file will do)
+  EEP V <file>             verify against a .EEP file
+  RELEASE                  let the target run (the next command puts it back into programming mode)
+  MENU                     back to the menu
+
+Wait for the OK or ERR before sending the next command, as the serial input buffer is small.
+
+*/
+
+const byte MAX_BATCH_LINE = 60;
+
+unsigned long batchStartTime;   // when the command arrived (millis)
+char batchResults [40];         // results of a command, for its OK line
+
+// get a command line from the script: unlike getline nothing waiting is thrown away, it
+//  is not echoed, and spaces are kept (forced to upper case)
+//  returns true if it was too long
+bool getBatchLine (char * buf, const size_t bufsize)
+  {
+  size_t i = 0;
+  bool tooLong = false;
+
+  while (true)
+    {
+    // let the target go if the script leaves it for a while
+    if (!Serial.available ())
+      {
+      checkSessionTimeout ();
+      continue;
+      }
+
+    const int c = Serial.read ();
+    if (c == '\n')  // newline terminates
+      break;
+    if (c == '\r')
+      continue;
+
+    if (i < bufsize - 1)
+      buf [i++] = toupper (c);
+    else
+      tooLong = true;
+    }  // end of while
+
+  buf [i] = 0;  // terminator
+  return tooLong;
+  }  // end of getBatchLine
+
+// the last line of the reply to a command
+void batchReply (const __FlashStringHelper * error)
+  {
+  Serial.print (error ? F("ERR ") : F("OK "));
+  Serial.print (millis () - batchStartTime);
+  if (error)
+    {
+    Serial.print (' ');
+    Serial.print (error);
+    }
+  else if (batchResults [0])
+    {
+    Serial.print (' ');
+    Serial.print (batchResults);
+    }
+  Serial.println ();
+  }  // end of batchReply
+
+// the B command (or from setup)
+void startBatchMode ()
+  {
+  batchMode = true;
+  batchStartTime = millis ();
+  strcpy (batchResults, "BATCH");
+  batchReply (NULL);
+  }  // end of startBatchMode
+
+#if ALLOW_MODIFY_FUSES
+// FUSE <L|H|E|LOCK> <hex>
+//  returns NULL if OK, otherwise why not
+const __FlashStringHelper * batchFuse (const char * which, const char * value)
+  {
+  byte fusenumber;
+
+  if (which == NULL)
+    return F("expected: FUSE <L|H|E|LOCK> <hex>");
+  else if (strcmp (which, "L") == 0 || strcmp (which, "LOW") == 0)
+    fusenumber = lowFuse;
+  else if (strcmp (which, "H") == 0 || strcmp (which, "HIGH") == 0)
+    fusenumber = highFuse;
+  else if (strcmp (which, "E") == 0 || strcmp (which, "EXT") == 0)
+    fusenumber = extFuse;
+  else if (strcmp (which, "LOCK") == 0)
+    fusenumber = lockByte;
+  else
+    return F("unknown fuse name");
+
+  byte newValue;
+  if (value == NULL || strlen (value) != 2 || hexConv (value, newValue))
+    return F("expected two hex digits");
+
+  if (unsafeFuse (fusenumber, newValue))
+    return F("fuse value not permitted");
+
+  fusePlanType plan;
+  plan.fuses [fusenumber] = newValue;
+  plan.mask = bit (fusenumber);
+  if (writeFusePlan (plan))
+    return F("fuse did not read back as written");
+
+  return NULL;
+  }  // end of batchFuse
+#endif // ALLOW_MODIFY_FUSES
+
+#if SD_CARD_ACTIVE
+// W, V, R, EEP W and EEP V
+//  returns NULL if OK, otherwise why not
+const __FlashStringHelper * batchFile (const char action, const char * fName, const bool eepromOnly)
+  {
+  if (!haveSDcard)
+    return F("no SD card");
+
+  if (fName == NULL || setFileName (fName))
+    return F("file name missing or too long");
+
+  if (eepromOnly && !isEEPROMFile (fName))
+    return F("not an .EEP file");
+
+  switch (action)
+    {
+    case 'W':
+      if (checkInputFile ())
+        return F("file cannot be used");
+      if (writeInputFile ())
+        return F("write failed");
+      break;
+
+    case 'V':
+      if (checkInputFile ())
+        return F("file cannot be used");
+      if (verifyInputFile ())
+        return F("verify failed");
+      break;
+
+#if ALLOW_FILE_SAVING
+    case 'R':
+      if (saveToFile ())
+        return F("save failed");
+      break;
+#endif // ALLOW_FILE_SAVING
+
+    default:
+      return F("unknown command");
+    }  // end of switch on action
+
+  return NULL;
+  }  // end of batchFile
+#endif // SD_CARD_ACTIVE
+
+// carry out one command (the words in it are in "words")
+//  returns NULL if OK (results, if any, in batchResults), otherwise why not
+const __FlashStringHelper * doBatchCommand (char * words [], const byte count)
+  {
+  const char * command = words [0];
+
+  if (strcmp (command, "MENU") == 0)
+    {
+    batchMode = false;
+    return NULL;
+    }
+
+  if (strcmp (command, "RELEASE") == 0)
+    {
+    if (sessionActive)
+      endSession ();
+    return NULL;
+    }
+
+  // everything else needs the target (this shows its details if it is new)
+  if (!beginSession ())
+    return F("cannot enter programming mode, or unknown signature");
+
+  if (strcmp (command, "SIG?") == 0)
+    {
+    snprintf (batchResults, sizeof batchResults, "%02X%02X%02X %s",
+              currentSignature.sig [0], currentSignature.sig [1], currentSignature.sig [2],
+              currentSignature.desc);
+    return NULL;
+    }
+
+  if (strcmp (command, "FUSE?") == 0)
+    {
+#if BOOTLOADER_PROGRAMMING
+    return F("fuses cannot be read through the bootloader");
+#endif // BOOTLOADER_PROGRAMMING
+    getFuseBytes ();
+    snprintf (batchResults, sizeof batchResults, "L=%02X H=%02X E=%02X LOCK=%02X CAL=%02X",
+              fuses [lowFuse], fuses [highFuse], fuses [extFuse], fuses [lockByte], fuses [calibrationByte]);
+    return NULL;
+    }
+
+#if ALLOW_MODIFY_FUSES
+  if (strcmp (command, "FUSE") == 0)
+    return batchFuse (words [1], words [2]);
+#endif // ALLOW_MODIFY_FUSES
+
+  if (strcmp (command, "ERASE") == 0)
+    {
+#if BOOTLOADER_PROGRAMMING
+    return F("the bootloader cannot erase the chip");
+#endif // BOOTLOADER_PROGRAMMING
+    eraseMemory ();
+    return NULL;
+    }
+
+#if SD_CARD_ACTIVE
+  if (strcmp (command, "EEP") == 0 && count > 1 && strlen (words [1]) == 1 && strchr ("WV", words [1] [0]))
+    return batchFile (words [1] [0], words [2], true);
+
+  if (strlen (command) == 1 && strchr ("WVR", command [0]))
+    return batchFile (command [0], words [1], false);
+#endif // SD_CARD_ACTIVE
+
+  return F("unknown command");
+  }  // end of doBatchCommand
+
+// wait for the next command from the script, and do it (called from loop)
+void batchCommand ()
+  {
+  char line [MAX_BATCH_LINE];
+  const bool tooLong = getBatchLine (line, sizeof line);
+
+  batchStartTime = millis ();
+  batchResults [0] = 0;
+
+  // split into words (any not there are NULL)
+  char * words [4] = { NULL, NULL, NULL, NULL };
+  byte count = 0;
+  for (char * pWord = strtok (line, " \t"); pWord && count < NUMITEMS (words); pWord = strtok (NULL, " \t"))
+    words [count++] = pWord;
+
+  // nothing to do?
+  if (count == 0 || words [0] [0] == '#')
+    return;
+
+  if (tooLong)
+    batchReply (F("line too long"));
+  else if (count == NUMITEMS (words))
+    batchReply (F("too many words"));
+  else
+    batchReply (doBatchCommand (words, count));
+
+  sessionLastUsed = millis ();
+  }  // end of batchCommand
+
+#endif // BATCH_MODE
@@ -0,0 +1,343 @@
+// Bootloader_Utils.ino
+//
+// Functions needed for programming through the target's own serial bootloader
+// (eg. Optiboot on a Uno, Nano or Pro Mini), using STK500 version 1 commands
+//
+// Author: Nick Gammon
+
+#if BOOTLOADER_PROGRAMMING
+
+/*
+
+Connect the target board like this:
+
+  TX1 (D18 on a Mega2560, D1 on a Leonardo)  --> RX (D0) on target
+  RX1 (D19 on a Mega2560, D0 on a Leonardo)  <-- TX (D1) on target
+  D5                                         --> /RESET on target (directly, or through 100 nF like DTR)
+
+  Gnd (and +5V if the target is not powered) as well.
+
+Only the application can be changed this way: the bootloader cannot read or change
+the fuses, or erase the whole chip (each page is erased as it is written), and it won't
+be written over itself if the lock bits protect it.
+
+Optiboot starts the application if it hears nothing for a second, so if it has been
+quiet for a while the target is reset again (and we get in step with it) before the
+next command.
+
+*/
+
+#if !defined (HAVE_HWSERIAL1)
+  #error Programming through the bootloader needs a second hardware serial port (Serial1), eg. on a Mega2560 or Leonardo
+#endif
+
+// the target's serial port is connected to this one
+#define BOOTLOADER_SERIAL Serial1
+
+const unsigned long BOOTLOADER_BAUD_RATE = 115200;    // Optiboot (the older ATmegaBOOT uses 57600)
+const unsigned long BOOTLOADER_REPLY_TIMEOUT = 200;   // mS, writing a page takes about 5 mS
+const unsigned long BOOTLOADER_IDLE_TIME = 500;       // mS, reset the target again if it has been quiet this long
+const byte BOOTLOADER_SYNC_ATTEMPTS = 10;             // Optiboot flashes its LED for a while before it listens
+const unsigned int BOOTLOADER_MAX_PAGE = 256;
+
+// STK500 version 1 (see Atmel application note AVR061)
+enum {
+    STK_OK              = 0x10,
+    STK_INSYNC          = 0x14,
+    CRC_EOP             = 0x20,
+
+    STK_GET_SYNC        = 0x30,
+    STK_ENTER_PROGMODE  = 0x50,
+    STK_LEAVE_PROGMODE  = 0x51,
+    STK_LOAD_ADDRESS    = 0x55,
+    STK_UNIVERSAL       = 0x56,
+    STK_PROG_PAGE       = 0x64,
+    STK_READ_PAGE       = 0x74,
+    STK_READ_SIGN       = 0x75,
+
+    STK_MEMORY_FLASH    = 'F',
+
+    loadExtendedAddressByte = 0x4D,   // sent with STK_UNIVERSAL, for flash above 128K
+
+};  // end of enum
+
+byte bootloaderPageBuffer [BOOTLOADER_MAX_PAGE];    // page being put together by writeFlash
+byte bootloaderReadBuffer [BOOTLOADER_MAX_PAGE];    // last page read, for readFlash
+unsigned long bootloaderReadAddress = NO_PAGE;      // where that came from
+unsigned long bootloaderLastUsed;                   // when the bootloader last answered (millis)
+bool bootloaderInStep;                              // false if it stopped answering, or we left programming mode
+
+// wait for a byte from the bootloader
+//  returns -1 if none in time
+int bootloaderRead ()
+  {
+  const unsigned long start = millis ();
+  while (!BOOTLOADER_SERIAL.available ())
+    {
+    if (millis () - start >= BOOTLOADER_REPLY_TIMEOUT)
+      return -1;
+    if (whileBusy)
+      whileBusy ();
+    }  // end of while nothing there
+
+  return BOOTLOADER_SERIAL.read ();
+  }  // end of bootloaderRead
+
+// send a command (followed by data, if any, then CRC_EOP) and expect STK_INSYNC,
+//  replyLength bytes into reply, then STK_OK
+//  returns true if error, false if OK
+bool bootloaderCommand (const byte * command, const byte length, const byte * data, const unsigned int dataLength,
+                        byte * reply, const unsigned int replyLength)
+  {
+  // throw away anything left over (eg. a late answer to an earlier GET_SYNC)
+  while (BOOTLOADER_SERIAL.available ())
+    BOOTLOADER_SERIAL.read ();
+
+  BOOTLOADER_SERIAL.write (command, length);
+  if (dataLength)
+    BOOTLOADER_SERIAL.write (data, dataLength);
+  BOOTLOADER_SERIAL.write ((byte) CRC_EOP);
+
+  if (bootloaderRead () != STK_INSYNC)
+    return true;
+
+  for (unsigned int i = 0; i < replyLength; i++)
+    {
+    const int c = bootloaderRead ();
+    if (c < 0)
+      return true;
+    reply [i] = c;
+    }  // end of for each byte of the reply
+
+  if (bootloaderRead () != STK_OK)
+    return true;
+
+  bootloaderLastUsed = millis ();
+  return false;
+  }  // end of bootloaderCommand
+
+// reset the target, so the bootloader runs, then get in step with it
+//  returns true if error, false if OK
+bool bootloaderReset ()
+  {
+  pinMode (RESET, OUTPUT);
+  digitalWrite (RESET, LOW);
+  delay (1);
+  pinMode (RESET, INPUT);   // the target has its own pull-up
+
+  lastAddressMSB = 0;   // the reset cleared it
+  bootloaderReadAddress = NO_PAGE;
+
+  const byte getSync [1] = { STK_GET_SYNC };
+  const byte enterProgramming [1] = { STK_ENTER_PROGMODE };
+  for (byte i = 0; i < BOOTLOADER_SYNC_ATTEMPTS; i++)
+    if (!bootloaderCommand (getSync, sizeof getSync, NULL, 0, NULL, 0))
+      {
+      bootloaderInStep = !bootloaderCommand (enterProgramming, sizeof enterProgramming, NULL, 0, NULL, 0);
+      return !bootloaderInStep;
+      }
+
+  bootloaderInStep = false;
+  return true;
+  }  // end of bootloaderReset
+
+// before each attempt at a command: reset the target again if the bootloader has
+//  been quiet for too long (or the first attempt failed)
+//  returns true if error, false if OK
+bool bootloaderWake (const byte attempt)
+  {
+  if (attempt == 0 && bootloaderInStep && millis () - bootloaderLastUsed < BOOTLOADER_IDLE_TIME)
+    return false;
+  return bootloaderReset ();
+  }  // end of bootloaderWake
+
+// called when a command failed, even after resetting the target
+void bootloaderNotResponding ()
+  {
+  bootloaderInStep = false;
+  if (!serialIsBinary)
+    Serial.println (F("Bootloader not responding."));
+  }  // end of bootloaderNotResponding
+
+// tell the bootloader where the next page is (a byte address)
+//  returns true if error, false if OK
+bool bootloaderLoadAddress (unsigned long addr)
+  {
+  addr >>= 1;  // turn into word address
+
+  // above 128K the rest of the address is sent as avrdude does it
+  byte MSB = (addr >> 16) & 0xFF;
+  if (MSB != lastAddressMSB)
+    {
+    const byte extended [5] = { STK_UNIVERSAL, loadExtendedAddressByte, 0, MSB, 0 };
+    byte result;
+    if (bootloaderCommand (extended, sizeof extended, NULL, 0, &result, 1))
+      return true;
+    lastAddressMSB = MSB;
+    }  // end if different MSB
+
+  const byte loadAddress [3] = { STK_LOAD_ADDRESS, lowByte (addr), highByte (addr) };
+  return bootloaderCommand (loadAddress, sizeof loadAddress, NULL, 0, NULL, 0);
+  }  // end of bootloaderLoadAddress
+
+// write a page of flash from buffer (the bootloader erases it first), or read one into it
+//  returns true if error, false if OK
+bool bootloaderPageCommand (const bool writeIt, const unsigned long addr, byte * buffer, const unsigned int length)
+  {
+  // once it has stopped answering, don't wait for it again for every page
+  if (!bootloaderInStep)
+    return true;
+
+  const byte command [4] = { (byte) (writeIt ? STK_PROG_PAGE : STK_READ_PAGE),
+                             highByte (length), lowByte (length), STK_MEMORY_FLASH };
+
+  for (byte attempt = 0; attempt < 2; attempt++)
+    {
+    if (bootloaderWake (attempt) || bootloaderLoadAddress (addr))
+      continue;
+    if (writeIt && !bootloaderCommand (command, sizeof command, buffer, length, NULL, 0))
+      return false;
+    if (!writeIt && !bootloaderCommand (command, sizeof command, NULL, 0, buffer, length))
+      return false;
+    }  // end of for each attempt
+
+  bootloaderNotResponding ();
+  return true;
+  }  // end of bootloaderPageCommand
+
+// read a byte from flash memory (a page at a time from the bootloader)
+byte readFlash (unsigned long addr)
+  {
+  const unsigned long page = addr & ~((unsigned long) currentSignature.pageSize - 1);
+  if (page != bootloaderReadAddress)
+    {
+    if (bootloaderPageCommand (false, page, bootloaderReadBuffer, currentSignature.pageSize))
+      return 0xFF;
+    bootloaderReadAddress = page;
+    }  // end of a different page
+
+  return bootloaderReadBuffer [addr - page];
+  } // end of readFlash
+
+// write a byte to the flash memory buffer (ready for committing)
+void writeFlash (unsigned long addr, const byte data)
+  {
+  bootloaderPageBuffer [addr & (currentSignature.pageSize - 1)] = data;
+  } // end of writeFlash
+
+// the bootloader is only used for flash (see readHexFile and saveToFile)
+byte readEEPROM (unsigned long addr)
+  {
+  return 0xFF;
+  } // end of readEEPROM
+
+void writeEEPROM (unsigned long addr, const byte data)
+  {
+  } // end of writeEEPROM
+
+void commitEEPROMPage (unsigned long addr)
+  {
+  }  // end of commitEEPROMPage
+
+// fuses can't be read through the bootloader (Optiboot answers 0 to any STK_UNIVERSAL)
+byte readFuse (const byte which)
+  {
+  return 0;
+  }  // end of readFuse
+
+void readSignature (byte sig [3])
+  {
+  const byte readSign [1] = { STK_READ_SIGN };
+
+  for (byte attempt = 0; attempt < 2; attempt++)
+    if (!bootloaderWake (attempt) && !bootloaderCommand (readSign, sizeof readSign, NULL, 0, sig, 3))
+      return;
+
+  bootloaderNotResponding ();
+  memset (sig, 0xFF, 3);
+  }  // end of readSignature
+
+// commit page to flash memory
+void commitPage (unsigned long addr, bool showMessage, bool clearAfter)
+  {
+
+  if (showMessage)
+    {
+    Serial.print (F("Committing page starting at 0x"));
+    Serial.println (addr, HEX);
+    }
+  else
+    showProgress ();
+
+  addr &= ~((unsigned long) currentSignature.pageSize - 1);
+  bootloaderPageCommand (true, addr, bootloaderPageBuffer, currentSignature.pageSize);
+  bootloaderReadAddress = NO_PAGE;  // in case it was this one
+
+  if (clearAfter)
+    clearPage();  // clear ready for next page full
+  }  // end of commitPage
+
+// nothing to do: the bootloader erases each page as it writes it, and it can't erase
+//  the whole chip (that would erase the bootloader too)
+void eraseMemory ()
+  {
+  }  // end of eraseMemory
+
+// fuses can't be changed through the bootloader
+void writeFuse (const byte newValue, const byte whichFuse)
+  {
+  }  // end of writeFuse
+
+// reset the target into its bootloader
+//  returns true if managed to enter programming mode
+bool startProgramming ()
+  {
+
+  if (!serialIsBinary)
+    Serial.print (F("Attempting to enter programming mode through the bootloader ..."));
+
+  const unsigned long startTime = millis ();
+
+  if (bootloaderReset ())
+    {
+    if (!serialIsBinary)
+      {
+      Serial.println ();
+      Serial.println (F("No answer from the bootloader. Double-check wiring and baud rate!"));
+      }
+    return false;
+    }  // end of no answer
+
+  if (!serialIsBinary)
+    {
+    Serial.println ();
+    Serial.print (F("Entered programming mode OK ("));
+    Serial.print (millis () - startTime);
+    Serial.println (F(" mS)."));
+    }
+  return true;
+  }  // end of startProgramming
+
+void stopProgramming ()
+  {
+  // the bootloader starts the application when told we are done (unless it already has)
+  const byte leaveProgramming [1] = { STK_LEAVE_PROGMODE };
+  if (bootloaderInStep && millis () - bootloaderLastUsed < BOOTLOADER_IDLE_TIME)
+    bootloaderCommand (leaveProgramming, sizeof leaveProgramming, NULL, 0, NULL, 0);
+  bootloaderInStep = false;  // it has to be reset to talk to it again
+
+  pinMode (RESET, INPUT);
+
+  if (!serialIsBinary)
+    Serial.println (F("Programming mode off."));
+
+  } // end of stopProgramming
+
+// called from setup()
+void initPins ()
+  {
+  BOOTLOADER_SERIAL.begin (BOOTLOADER_BAUD_RATE);
+  pinMode (RESET, INPUT);
+  }  // end of initPins
+
+#endif // BOOTLOADER_PROGRAMMING
@@ -1,7 +1,7 @@
 // File_Utils.ino
 //
 // Functions related to the SD card (if present) including listing the directory,
-// and reading an interpreting a .HEX file.
+// and reading an interpreting a .HEX file (or a .EEP file for the EEPROM, or an .ELF file).
 //
 // Author: Nick Gammon
 
@@ -57,7 +57,191 @@ Line format:
 
 */
 
-char name[MAX_FILENAME] = { 0 };  // current file name
+char name[MAX_FILE_LIST] = { 0 };  // current file name (or list of them)
+
+// returns true if the file name ends in the wanted suffix (eg. ".HEX")
+bool hasSuffix (const char * fName, const char * suffix)
+  {
+  int len = strlen (fName);
+  int suffixLen = strlen (suffix);
+  return len > suffixLen && strcmp (&fName [len - suffixLen], suffix) == 0;
+  }  // end of hasSuffix
+
+// .EEP files (as made by avr-objcopy) are Intel Hex files for the EEPROM
+bool isEEPROMFile (const char * fName)
+  {
+  return hasSuffix (fName, ".EEP");
+  }  // end of isEEPROMFile
+
+/*
+Page assembly.
+
+The target only has a single page buffer, so if the records in a file leave a page
+and later come back to it (eg. a sketch and bootloader combined by hand) that page
+would be committed twice, without an erase in between. The check pass notes which
+pages are like that, the write pass skips them, and then each of them is assembled
+from a further pass through the file, and committed once.
+*/
+
+const unsigned int MAX_PAGES = 1024;          // 256 Kb of flash in 256 byte pages
+const byte MAX_FRAGMENTED_PAGES = 16;
+
+byte pagesSeen [MAX_PAGES / 8];               // one bit per page, set in the check pass
+unsigned int fragmentedPages [MAX_FRAGMENTED_PAGES];   // page numbers
+byte fragmentedPageCount;
+unsigned long lastRecordPage;                 // page of the previous byte in the file
+unsigned long assemblyPage;                   // page being written by writeFragmentedPage
+
+/*
+Lists of files.
+
+A list of files (eg. APP.HEX+BOOT.HEX) is processed as if it was one file, so a
+sketch and a bootloader can be written in the one erase/write/verify pass. The
+address range of each file is remembered, so that the check pass can make sure
+that later files don't write over earlier ones, and so that updateFuses can find
+where the bootloader (the file at the highest address) starts.
+*/
+
+const byte MAX_HEX_FILES = 4;
+
+byte hexFileCount;                            // files done so far in this list
+unsigned long hexFileLowest [MAX_HEX_FILES];
+unsigned long hexFileHighest [MAX_HEX_FILES];
+
+// returns true if this data overlaps a file earlier in the list
+bool overlapsEarlierFile (const unsigned long addr, const int length)
+  {
+  for (byte i = 0; i < hexFileCount; i++)
+    {
+    if (addr <= hexFileHighest [i] && (addr + length - 1) >= hexFileLowest [i])
+      {
+      Serial.println ();
+      Serial.print (F("Data at 0x"));
+      Serial.print (addr, HEX);
+      Serial.print (F(" overlaps file "));
+      Serial.print (i + 1);
+      Serial.println (F(" in the list."));
+      return true;
+      }
+    }  // end of for each earlier file
+
+  return false;
+  }  // end of overlapsEarlierFile
+
+// returns true if this page is one which has to be assembled separately
+bool isFragmentedPage (const unsigned long page)
+  {
+  for (byte i = 0; i < fragmentedPageCount; i++)
+    if (fragmentedPages [i] == page / pagesize)
+      return true;
+  return false;
+  }  // end of isFragmentedPage
+
+// note which pages the data falls in, and which of those we come back to
+//  returns true if there are too many pages like that to handle
+bool notePages (const unsigned long addr, const int length)
+  {
+  for (int i = 0; i < length; i++)
+    {
+    unsigned long thisPage = (addr + i) & pagemask;
+    if (thisPage == lastRecordPage)
+      continue;
+    lastRecordPage = thisPage;
+
+    unsigned long pageNumber = thisPage / pagesize;
+    if (pageNumber >= MAX_PAGES)
+      continue;  // won't fit into flash anyway, chooseInputFile will reject it
+
+    if ((pagesSeen [pageNumber / 8] & bit (pageNumber % 8)) == 0)
+      {
+      pagesSeen [pageNumber / 8] |= bit (pageNumber % 8);
+      continue;
+      }
+
+    // been here before
+    if (isFragmentedPage (thisPage))
+      continue;
+
+    if (fragmentedPageCount >= MAX_FRAGMENTED_PAGES)
+      {
+      Serial.println ();
+      Serial.println (F("Too many out-of-order pages in file."));
+      return true;
+      }
+    fragmentedPages [fragmentedPageCount++] = pageNumber;
+    }  // end of for
+
+  return false;
+  }  // end of notePages
+
+// write the bytes which are wanted for this pass:
+//  writeToFlash: everything except the fragmented pages
+//  writeFragmentedPage: only the bytes in assemblyPage
+void assembleData (const unsigned long addr, const byte * pData, const int length, const byte action)
+  {
+  int start = 0;
+
+  // write each run of wanted bytes
+  for (int i = 0; i <= length; i++)
+    {
+    bool wanted = false;
+    if (i < length)
+      {
+      unsigned long thisPage = (addr + i) & pagemask;
+      if (action == writeFragmentedPage)
+        wanted = thisPage == assemblyPage;
+      else
+        wanted = !isFragmentedPage (thisPage);
+      }
+
+    if (!wanted)
+      {
+      if (i > start)
+        writeData (addr + start, &pData [start], i - start);
+      start = i + 1;
+      }
+    }  // end of for
+
+  }  // end of assembleData
+
+// handle some data from the file (a data record, or part of an ELF segment)
+//  returns true if error, false if OK
+bool processData (const unsigned long addr, const byte * pData, const int len, const byte action)
+  {
+  lowestAddress  = min (lowestAddress, addr);
+  highestAddress = max (highestAddress, addr + len - 1);
+  bytesWritten += len;
+
+  if (action == checkFile && overlapsEarlierFile (addr, len))
+    return true;
+  hexFileLowest  [hexFileCount] = min (hexFileLowest [hexFileCount], addr);
+  hexFileHighest [hexFileCount] = max (hexFileHighest [hexFileCount], addr + len - 1);
+
+  switch (action)
+    {
+    case checkFile:  // note the pages used, other checks are done anyway
+      if (notePages (addr, len))
+        return true;
+      break;
+
+    case verifyFlash:
+    case verifyEEPROM:
+    case compareFlash:
+      verifyData (addr, pData, len, action);
+      break;
+
+    case writeToFlash:
+    case writeFragmentedPage:
+      assembleData (addr, pData, len, action);
+      break;
+
+    case writeToEEPROM:
+      writeEEPROMData (addr, pData, len);
+      break;
+    } // end of switch on action
+
+  return false;
+  }  // end of processData
 
 bool processLine (const char * pLine, const byte action)
   {
@@ -141,23 +325,8 @@ bool processLine (const char * pLine, const byte action)
     {
     // stuff to be written to memory
     case hexDataRecord:
-      lowestAddress  = min (lowestAddress, addr + extendedAddress);
-      highestAddress = max (lowestAddress, addr + extendedAddress + len - 1);
-      bytesWritten += len;
-
-      switch (action)
-        {
-        case checkFile:  // nothing much to do, we do the checks anyway
-          break;
-
-        case verifyFlash:
-          verifyData (addr + extendedAddress, &hexBuffer [4], len);
-          break;
-
-        case writeToFlash:
-          writeData (addr + extendedAddress, &hexBuffer [4], len);
-          break;
-        } // end of switch on action
+      if (processData (addr + extendedAddress, &hexBuffer [4], len, action))
+        return true;
       break;
 
     // end of data
@@ -186,7 +355,9 @@ bool processLine (const char * pLine, const byte action)
   } // end of processLine
 
 //------------------------------------------------------------------------------
-bool readHexFile (const char * fName, const byte action)
+// read one file from a list, processing each line
+//  returns true if error, false if OK
+bool processHexFile (const char * fName, const byte action)
   {
   const int maxLine = 80;
   char buffer[maxLine];
@@ -194,15 +365,6 @@ bool readHexFile (const char * fName, const byte action)
   int lineNumber = 0;
   gotEndOfFile = false;
   extendedAddress = 0;
-  errors = 0;
-  lowestAddress = 0xFFFFFFFF;
-  highestAddress = 0;
-  bytesWritten = 0;
-  progressBarCount = 0;
-
-  pagesize = currentSignature.pageSize;
-  pagemask = ~(pagesize - 1);
-  oldPage = NO_PAGE;
 
   Serial.print (F("Processing file: "));
   Serial.println (fName);
@@ -214,10 +376,284 @@ bool readHexFile (const char * fName, const byte action)
     return true;
     }
 
+  while (sdin.getline (buffer, maxLine))
+    {
+    lineNumber++;
+    int count = sdin.gcount();
+    if (sdin.fail())
+      {
+      Serial.print (F("Line "));
+      Serial.println (lineNumber);
+      Serial.print (F(" too long."));
+      return true;
+      }  // end of fail (line too long?)
+
+    // ignore empty lines
+    if (count > 1)
+      {
+      if (processLine (buffer, action))
+        {
+        Serial.print (F("Error in line "));
+        Serial.println (lineNumber);
+        return true;  // error
+        }
+      }
+
+    // one difference is all we need to know about
+    if (action == compareFlash && errors)
+      return false;
+    }    // end of while each line
+
+  if (!gotEndOfFile)
+    {
+    Serial.println (F("Did not get 'end of file' record."));
+    return true;
+    }
+
+  return false;
+  }  // end of processHexFile
+
+/*
+ELF files.
+
+avr-gcc puts everything for a program into its .ELF file. The program headers give
+the physical address of each loadable segment, which for the AVR is:
+
+  0x000000 - flash (.text, and the initial values for .data)
+  0x810000 - EEPROM (.eeprom)
+  0x820000 - fuses (.fuse: low, high and extended, in that order)
+  0x830000 - lock byte (.lock)
+  0x840000 - signature (.signature: three bytes, last one first, as avr-libc puts them)
+
+The segments are read straight from the file, in binary, into the same code
+that handles the data records in a .HEX file.
+*/
+
+const unsigned long ELF_EEPROM_ADDRESS    = 0x810000;
+const unsigned long ELF_FUSE_ADDRESS      = 0x820000;
+const unsigned long ELF_LOCK_ADDRESS      = 0x830000;
+const unsigned long ELF_SIGNATURE_ADDRESS = 0x840000;
+
+const uint16_t ELF_MACHINE_AVR = 83;
+const uint32_t ELF_SEGMENT_LOAD = 1;
+
+// program header (same layout as in the file, the AVR is little-endian too)
+typedef struct {
+  uint32_t type;
+  uint32_t offset;      // where the segment is in the file
+  uint32_t vaddr;
+  uint32_t paddr;       // where it is to be loaded (see above)
+  uint32_t filesz;      // how much of it is in the file
+  uint32_t memsz;
+  uint32_t flags;
+  uint32_t align;
+} elfProgramHeader;
+
+fusePlanType filePlan;      // fuses and lock byte found in the file (or job)
+unsigned long elfEEPROMSize;  // how much EEPROM the file uses (0 = none)
+
+bool isElfFile (const char * fName)
+  {
+  return hasSuffix (fName, ".ELF");
+  }  // end of isElfFile
+
+// read one ELF file, loading the segments wanted for this action
+//  returns true if error, false if OK
+bool processElfFile (const char * fName, const byte action)
+  {
+  SdFile elfFile;
+  byte elfHeader [52];
+
+  Serial.print (F("Processing file: "));
+  Serial.println (fName);
+
+  // check for open error
+  if (!elfFile.open (fName, O_READ))
+    {
+    Serial.println (F("Could not open file."));
+    return true;
+    }
+
+  // check it is 32-bit, little-endian, for the AVR
+  if (elfFile.read (elfHeader, sizeof elfHeader) != sizeof elfHeader
+      || memcmp (elfHeader, "\x7F" "ELF", 4) != 0
+      || elfHeader [4] != 1
+      || elfHeader [5] != 1
+      || elfHeader [18] != ELF_MACHINE_AVR)
+    {
+    Serial.println (F("Not an AVR .ELF file."));
+    return true;
+    }
+
+  uint32_t headerOffset;
+  uint16_t headerSize;
+  uint16_t headerCount;
+  memcpy (&headerOffset, &elfHeader [28], sizeof headerOffset);
+  memcpy (&headerSize,   &elfHeader [42], sizeof headerSize);
+  memcpy (&headerCount,  &elfHeader [44], sizeof headerCount);
+
+  const bool eeprom = action == verifyEEPROM || action == writeToEEPROM;
+
+  for (uint16_t i = 0; i < headerCount; i++)
+    {
+    elfProgramHeader header;
+    if (!elfFile.seekSet (headerOffset + (uint32_t) i * headerSize)
+        || elfFile.read (&header, sizeof header) != sizeof header)
+      {
+      Serial.println (F("Could not read program header."));
+      return true;
+      }
+
+    if (header.type != ELF_SEGMENT_LOAD || header.filesz == 0)
+      continue;
+
+    if (!elfFile.seekSet (header.offset))
+      {
+      Serial.println (F("Could not find segment."));
+      return true;
+      }
+
+    unsigned long addr = header.paddr;
+    unsigned long remaining = header.filesz;
+
+    // signature, fuses and lock byte are only read in the check pass
+    if (addr >= ELF_FUSE_ADDRESS)
+      {
+      if (action != checkFile)
+        continue;
+
+      byte buf [3];
+      int len = min (remaining, sizeof buf);
+      if (elfFile.read (buf, len) != len)
+        {
+        Serial.println (F("Could not read segment."));
+        return true;
+        }
+
+      if (addr >= ELF_SIGNATURE_ADDRESS)
+        {
+        // avr-libc stores it as { SIGNATURE_2, SIGNATURE_1, SIGNATURE_0 }
+        if (len == 3 && (buf [0] != currentSignature.sig [2]
+                      || buf [1] != currentSignature.sig [1]
+                      || buf [2] != currentSignature.sig [0]))
+          {
+          Serial.println (F("File is for a different processor."));
+          return true;
+          }
+        }
+      else if (addr >= ELF_LOCK_ADDRESS)
+        {
+        filePlan.fuses [lockByte] = buf [0];
+        filePlan.mask |= bit (lockByte);
+        }
+      else
+        {
+        for (byte j = 0; j < len; j++)
+          {
+          filePlan.fuses [lowFuse + j] = buf [j];
+          filePlan.mask |= bit (lowFuse + j);
+          }
+        }  // end of fuses
+      continue;
+      }  // end of signature, fuses and lock byte
+
+    if (addr >= ELF_EEPROM_ADDRESS)
+      {
+      addr -= ELF_EEPROM_ADDRESS;
+      elfEEPROMSize = max (elfEEPROMSize, addr + remaining);
+      if (!eeprom)
+        continue;
+      }
+    else if (eeprom)
+      continue;
+
+    // stream the segment through, a few bytes at a time
+    while (remaining)
+      {
+      byte buf [16];
+      int len = min (remaining, sizeof buf);
+      if (elfFile.read (buf, len) != len)
+        {
+        Serial.println (F("Could not read segment."));
+        return true;
+        }
+
+      if (processData (addr, buf, len, action))
+        return true;
+
+      // one difference is all we need to know about
+      if (action == compareFlash && errors)
+        return false;
+
+      addr += len;
+      remaining -= len;
+      }  // end of while bytes left in segment
+
+    }  // end of for each program header
+
+  return false;
+  }  // end of processElfFile
+
+// write the fuses and lock byte from an .ELF file or a job (if any), and the
+//  bootloader fuse worked out from the flash file (unless they gave it)
+//  returns true if error, false if OK
+bool applyFuses (const bool fixBootFuse)
+  {
+#if BOOTLOADER_PROGRAMMING
+  if (filePlan.mask)
+    Serial.println (F("Fuses and lock byte left alone (they cannot be changed through the bootloader)."));
+  return false;
+#endif // BOOTLOADER_PROGRAMMING
+
+  fusePlanType plan = filePlan;
+
+  // don't write anything which would stop us programming the chip again
+  for (byte i = lowFuse; i <= lockByte; i++)
+    if ((plan.mask & bit (i)) && unsafeFuse (i, plan.fuses [i]))
+      plan.mask &= ~bit (i);
+
+  byte fusenumber = currentSignature.fuseWithBootloaderSize;
+  if (fixBootFuse && fusenumber != NO_FUSE && (filePlan.mask & bit (fusenumber)) == 0)
+    if (planBootFuse (plan))
+      return true;
+
+  return writeFusePlan (plan);
+  }  // end of applyFuses
+
+//------------------------------------------------------------------------------
+// read a file, or a list of them separated by "+", eg. APP.HEX+BOOT.HEX
+//  returns true if error, false if OK
+bool readHexFile (const char * fName, const byte action)
+  {
+  const bool eeprom = action == verifyEEPROM || action == writeToEEPROM;
+
+  errors = 0;
+  lowestAddress = 0xFFFFFFFF;
+  highestAddress = 0;
+  bytesWritten = 0;
+  progressBarCount = 0;
+  hexFileCount = 0;
+
+  // the bootloader fuse depends on the flash, so EEPROM passes leave this alone
+  if (!eeprom)
+    bootStartAddress = 0;
+
+  if (eeprom)
+    pagesize = max (currentSignature.eepromPageSize, 1);
+  else
+    pagesize = currentSignature.pageSize;
+  pagemask = ~(pagesize - 1);
+  oldPage = NO_PAGE;
+
   switch (action)
     {
     case checkFile:
       Serial.println (F("Checking file ..."));
+      memset (pagesSeen, 0, sizeof pagesSeen);
+      fragmentedPageCount = 0;
+      lastRecordPage = NO_PAGE;
+      filePlan.mask = 0;
+      elfEEPROMSize = 0;
       break;
 
     case verifyFlash:
@@ -225,80 +661,435 @@ bool readHexFile (const char * fName, const byte action)
       break;
 
     case writeToFlash:
+#if !BOOTLOADER_PROGRAMMING   // the bootloader erases each page as it writes it
       Serial.println (F("Erasing chip ..."));
       eraseMemory ();
+#endif // !BOOTLOADER_PROGRAMMING
       Serial.println (F("Writing flash ..."));
       break;
+
+    case verifyEEPROM:
+      Serial.println (F("Verifying EEPROM ..."));
+      break;
+
+    case writeToEEPROM:
+      Serial.println (F("Writing EEPROM ..."));
+      break;
+
+    case compareFlash:
+      Serial.println (F("Comparing flash to file ..."));
+      break;
+
+    case writeFragmentedPage:
+      break;
     } // end of switch
 
+  // do each file in the list
+  while (true)
+    {
+    char thisFile [MAX_FILENAME];
+    const char * pEnd = strchr (fName, '+');
+    size_t len = pEnd ? (size_t) (pEnd - fName) : strlen (fName);
+
+    if (len == 0 || len >= sizeof thisFile)
+      {
+      Serial.println (F("Invalid file name in list."));
+      return true;
+      }
+
+    if (hexFileCount >= MAX_HEX_FILES)
+      {
+      Serial.print (F("Too many files in list, maximum is "));
+      Serial.println (MAX_HEX_FILES);
+      return true;
+      }
+
+    memcpy (thisFile, fName, len);
+    thisFile [len] = 0;
+
+    hexFileLowest  [hexFileCount] = 0xFFFFFFFF;
+    hexFileHighest [hexFileCount] = 0;
+
+    if (isElfFile (thisFile))
+      {
+      // its EEPROM and fuses would be mixed up with the other files
+      if (pEnd || hexFileCount)
+        {
+        Serial.println (F("An .ELF file cannot be part of a list."));
+        return true;
+        }
+      if (processElfFile (thisFile, action))
+        return true;
+      }
+    else if (processHexFile (thisFile, action))
+      return true;
+
+    // the bootloader is the file which starts highest up
+    if (!eeprom && hexFileLowest [hexFileCount] != 0xFFFFFFFF)
+      bootStartAddress = max (bootStartAddress, hexFileLowest [hexFileCount]);
+    hexFileCount++;
+
+    // one difference is all we need to know about
+    if ((action == compareFlash && errors) || pEnd == NULL)
+      break;
+    fName = pEnd + 1;
+    }  // end of for each file
+
+  if (action == compareFlash && errors)
+    {
+    Serial.println ();   // finish line of dots
+    Serial.println (F("Flash differs from file."));
+    return false;
+    }
+
+  switch (action)
+    {
+    case writeToFlash:
+      // commit final page
+      if (oldPage != NO_PAGE)
+        commitPage (oldPage);
+      Serial.println ();   // finish line of dots
+      Serial.println (F("Written."));
+      break;
+
+    case writeFragmentedPage:
+      // everything in the file for this page is now in the page buffer
+      commitPage (assemblyPage, true);
+      break;
+
+    case writeToEEPROM:
+      // commit final page
+      if (oldPage != NO_PAGE)
+        commitEEPROMPage (oldPage);
+      Serial.println ();   // finish line of dots
+      Serial.println (F("Written."));
+      break;
+
+    case verifyFlash:
+    case verifyEEPROM:
+       Serial.println ();   // finish line of dots
+       if (errors == 0)
+          Serial.println (F("No errors found."));
+        else
+          {
+          Serial.print (errors, DEC);
+          Serial.println (F(" verification error(s)."));
+          if (errors > 100)
+            Serial.println (F("First 100 shown."));
+          }  // end if
+       break;
+
+    case compareFlash:
+      Serial.println ();   // finish line of dots
+      Serial.println (F("Flash matches file."));
+      break;
+
+    case checkFile:
+      Serial.println ();   // finish line of dots
+      Serial.print (F("Lowest address  = 0x"));
+      Serial.println (lowestAddress, HEX);
+      Serial.print (F("Highest address = 0x"));
+      Serial.println (highestAddress, HEX);
+      Serial.print (F("Bytes to write  = "));
+      Serial.println (bytesWritten, DEC);
+      if (hexFileCount > 1)
+        {
+        Serial.print (F("Bootloader at  = 0x"));
+        Serial.println (bootStartAddress, HEX);
+        }
+      if (fragmentedPageCount)
+        {
+        Serial.print (F("Out-of-order pages = "));
+        Serial.println (fragmentedPageCount, DEC);
+        }
+      break;
+
+    }  // end of switch
+
+  return false;
+}  // end of readHexFile
+
+
+/*
+Job files.
+
+A job file (any name ending in .TXT, eg. JOB.TXT) lists everything needed to program
+a board, so it can all be done in one go, in the right order. For example:
+
+  # production job for the widget board
+  signature = 1E 95 0F
+  flash     = APP.HEX+BOOT.HEX
+  eeprom    = SETTINGS.EEP
+  lfuse     = FF
+  hfuse     = DE
+  efuse     = FD
+  lock      = CF
+
+Everything is optional (except that there has to be something to do). The flash is
+erased and written, then the EEPROM, then both are verified. After that the fuses
+are written, with the lock byte last so it can't get in the way of the verify, and
+read back. If the job has no fuse for the bootloader size, it is worked out from the
+flash file, as usual.
+*/
+
+typedef struct {
+  char flash [MAX_FILE_LIST];   // file (or list of them) for the flash
+  char eeprom [MAX_FILENAME];   // .EEP file for the EEPROM
+  byte sig [3];                 // signature of the chip it is for
+  bool haveSig;
+  fusePlanType plan;            // fuses and lock byte
+} jobType;
+
+jobType job;
+
+bool isJobFile (const char * fName)
+  {
+  return hasSuffix (fName, ".TXT");
+  }  // end of isJobFile
+
+// convert "count" bytes of hex (eg. "1E950F") with nothing left over
+//  returns true if error, false if OK
+bool jobHex (const char * pValue, byte * pData, const byte count)
+  {
+  for (byte i = 0; i < count; i++)
+    if (hexConv (pValue, pData [i]))
+      return true;
+
+  if (*pValue)
+    {
+    Serial.println (F("Too many hex digits."));
+    return true;
+    }
+
+  return false;
+  }  // end of jobHex
+
+// copy a file name from a job, if it fits
+//  returns true if error, false if OK
+bool jobFileName (char * dest, const char * pValue, const size_t size)
+  {
+  if (strlen (pValue) >= size)
+    {
+    Serial.println (F("File name too long."));
+    return true;
+    }
+  strcpy (dest, pValue);
+  return false;
+  }  // end of jobFileName
+
+// one line of a job file (with spaces and comments removed, forced to upper case)
+//  returns true if error, false if OK
+bool processJobLine (char * pLine)
+  {
+  char * pValue = strchr (pLine, '=');
+  if (pValue == NULL)
+    {
+    Serial.println (F("Expected: name = value"));
+    return true;
+    }
+  *pValue++ = 0;
+
+  if (strcmp (pLine, "FLASH") == 0)
+    {
+    if (isEEPROMFile (pValue))
+      {
+      Serial.println (F("Use 'eeprom' for a .EEP file."));
+      return true;
+      }
+    return jobFileName (job.flash, pValue, sizeof job.flash);
+    }  // end of flash
+
+  if (strcmp (pLine, "EEPROM") == 0)
+    {
+    if (!isEEPROMFile (pValue))
+      {
+      Serial.println (F("EEPROM file name must end in .EEP"));
+      return true;
+      }
+    return jobFileName (job.eeprom, pValue, sizeof job.eeprom);
+    }  // end of EEPROM
+
+  if (strcmp (pLine, "SIGNATURE") == 0)
+    {
+    job.haveSig = true;
+    return jobHex (pValue, job.sig, sizeof job.sig);
+    }  // end of signature
+
+  byte fusenumber;
+  if (strcmp (pLine, "LFUSE") == 0)
+    fusenumber = lowFuse;
+  else if (strcmp (pLine, "HFUSE") == 0)
+    fusenumber = highFuse;
+  else if (strcmp (pLine, "EFUSE") == 0)
+    fusenumber = extFuse;
+  else if (strcmp (pLine, "LOCK") == 0)
+    fusenumber = lockByte;
+  else
+    {
+    Serial.print (F("Unknown setting: "));
+    Serial.println (pLine);
+    return true;
+    }  // end if
+
+  job.plan.mask |= bit (fusenumber);
+  if (jobHex (pValue, &job.plan.fuses [fusenumber], 1))
+    return true;
+
+  return unsafeFuse (fusenumber, job.plan.fuses [fusenumber]);
+  }  // end of processJobLine
+
+// read a job file into "job"
+//  returns true if error, false if OK
+bool readJobFile (const char * fName)
+  {
+  const int maxLine = 80;
+  char buffer[maxLine];
+  ifstream sdin (fName);
+  int lineNumber = 0;
+
+  memset (&job, 0, sizeof job);
+
+  Serial.print (F("Processing job: "));
+  Serial.println (fName);
+
+  // check for open error
+  if (!sdin.is_open())
+    {
+    Serial.println (F("Could not open file."));
+    return true;
+    }
+
   while (sdin.getline (buffer, maxLine))
     {
     lineNumber++;
-    int count = sdin.gcount();
     if (sdin.fail())
       {
       Serial.print (F("Line "));
-      Serial.println (lineNumber);
-      Serial.print (F(" too long."));
+      Serial.print (lineNumber);
+      Serial.println (F(" too long."));
       return true;
       }  // end of fail (line too long?)
 
+    // drop spaces and comments, and force to upper case
+    char * pOut = buffer;
+    for (const char * pIn = buffer; *pIn && *pIn != '#'; pIn++)
+      if (!isspace (*pIn))
+        *pOut++ = toupper (*pIn);
+    *pOut = 0;
+
     // ignore empty lines
-    if (count > 1)
+    if (buffer [0] && processJobLine (buffer))
       {
-      if (processLine (buffer, action))
-        {
-        Serial.print (F("Error in line "));
-        Serial.println (lineNumber);
-        return true;  // error
-        }
+      Serial.print (F("Error in line "));
+      Serial.println (lineNumber);
+      return true;
       }
     }    // end of while each line
 
-  if (!gotEndOfFile)
+  if (job.flash [0] == 0 && job.eeprom [0] == 0 && job.plan.mask == 0)
     {
-    Serial.println (F("Did not get 'end of file' record."));
+    Serial.println (F("Job has nothing to do."));
     return true;
     }
 
-  switch (action)
+  return false;
+  }  // end of readJobFile
+
+// check the files in a job, and that it is for this chip
+//  returns true if error, false if OK
+bool checkJob ()
+  {
+  if (job.haveSig && memcmp (job.sig, currentSignature.sig, sizeof job.sig) != 0)
     {
-    case writeToFlash:
-      // commit final page
-      if (oldPage != NO_PAGE)
-        commitPage (oldPage);
-      Serial.println ();   // finish line of dots
-      Serial.println (F("Written."));
-      break;
+    Serial.println (F("Job is for a different processor."));
+    return true;
+    }
 
-    case verifyFlash:
-       Serial.println ();   // finish line of dots
-       if (errors == 0)
-          Serial.println (F("No errors found."));
-        else
-          {
-          Serial.print (errors, DEC);
-          Serial.println (F(" verification error(s)."));
-          if (errors > 100)
-            Serial.println (F("First 100 shown."));
-          }  // end if
-       break;
+  filePlan.mask = 0;
+  elfEEPROMSize = 0;
 
-    case checkFile:
-      Serial.println ();   // finish line of dots
-      Serial.print (F("Lowest address  = 0x"));
-      Serial.println (lowestAddress, HEX);
-      Serial.print (F("Highest address = 0x"));
-      Serial.println (highestAddress, HEX);
-      Serial.print (F("Bytes to write  = "));
-      Serial.println (bytesWritten, DEC);
-      break;
+  // EEPROM first, so the flash is the last file checked (the writing relies on that)
+  if (job.eeprom [0])
+    {
+    if (readHexFile (job.eeprom, checkFile) || checkFileFits (job.eeprom, false))
+      return true;
+    }  // end of having EEPROM
 
-    }  // end of switch
+  if (job.flash [0])
+    {
+    byte fusenumber = currentSignature.fuseWithBootloaderSize;
+    bool haveBootFuse = fusenumber != NO_FUSE && (job.plan.mask & bit (fusenumber));
+    if (readHexFile (job.flash, checkFile) || checkFileFits (job.flash, !haveBootFuse))
+      return true;
+    // an .ELF file could put something else in the EEPROM
+    if (job.eeprom [0] && elfEEPROMSize)
+      {
+      Serial.println (F("The .ELF file has EEPROM data as well as the EEPROM file."));
+      return true;
+      }
+    }  // end of having flash
+
+  // fuses in the job take precedence over any in an .ELF file
+  for (byte i = lowFuse; i <= lockByte; i++)
+    if (job.plan.mask & bit (i))
+      filePlan.fuses [i] = job.plan.fuses [i];
+  filePlan.mask |= job.plan.mask;
 
   return false;
-}  // end of readHexFile
+  }  // end of checkJob
+
+// verify everything a job writes (except the fuses)
+//  returns true if there were errors
+bool verifyJob ()
+  {
+  bool bad = false;
+
+  if (job.eeprom [0] && (readHexFile (job.eeprom, verifyEEPROM) || errors))
+    bad = true;
+
+  if (job.flash [0])
+    {
+    if (readHexFile (job.flash, verifyFlash) || errors)
+      bad = true;
+    if (elfEEPROMSize && (readHexFile (job.flash, verifyEEPROM) || errors))
+      bad = true;
+    }  // end of having flash
+
+  return bad;
+  }  // end of verifyJob
+
+// do everything in a job, in the one programming session
+//  returns true if error, false if OK
+bool runJob ()
+  {
+  // erases the chip (including the EEPROM, unless the EESAVE fuse is set)
+  if (job.flash [0])
+    {
+    if (writeFlashFile (job.flash))
+      return true;
+    if (elfEEPROMSize && readHexFile (job.flash, writeToEEPROM))
+      return true;
+    }  // end of having flash
 
+  if (job.eeprom [0] && readHexFile (job.eeprom, writeToEEPROM))
+    return true;
+
+  // one pass over everything, before the lock byte could stop us reading it
+  if (verifyJob ())
+    {
+    Serial.println (F("Job failed - fuses and lock byte not written."));
+    return true;
+    }
+
+  if (applyFuses (job.flash [0] != 0))
+    {
+    Serial.println (F("Job failed - fuses not as wanted."));
+    return true;
+    }
+
+  Serial.println (F("Job done."));
+  return false;
+  }  // end of runJob
 
 void showDirectory ()
   {
@@ -314,7 +1105,7 @@ void showDirectory ()
   char name[MAX_FILENAME];
 
   Serial.println ();
-  Serial.println (F("HEX files in root directory:"));
+  Serial.println (F("HEX, EEP, ELF and TXT (job) files in root directory:"));
   Serial.println ();
 
   // back to start of directory
@@ -323,8 +1114,7 @@ void showDirectory ()
   // open next file in root.  The volume working directory, vwd, is root
   while (file.openNext(sd.vwd(), O_READ)) {
     file.getName(name,13);
-    byte len = strlen (name);
-    if (len > 4 && strcmp (&name [len - 4], ".HEX") == 0)
+    if (hasSuffix (name, ".HEX") || isEEPROMFile (name) || isElfFile (name) || isJobFile (name))
       {
       Serial.print (name);
       for (byte i = strlen (name); i < 13; i++)
@@ -357,8 +1147,98 @@ void showDirectory ()
 
   }  // end of showDirectory
 
-char lastFileName [MAX_FILENAME] = { 0 };
+char lastFileName [MAX_FILE_LIST] = { 0 };
+
+
+// check a file (after its check pass) will fit into this chip
+//  returns true if error, false if OK
+bool checkFileFits (const char * fName, const bool checkStartAddress)
+  {
+  // EEPROM files just need to fit into the EEPROM
+  if (isEEPROMFile (fName))
+    {
+#if BOOTLOADER_PROGRAMMING
+    Serial.println (F("EEPROM cannot be written or verified through the bootloader."));
+    return true;
+#endif // BOOTLOADER_PROGRAMMING
+    if (highestAddress >= currentSignature.eepromSize)
+      {
+      Serial.print (F("Highest address of 0x"));
+      Serial.print (highestAddress, HEX);
+      Serial.print (F(" exceeds available EEPROM top 0x"));
+      Serial.println (currentSignature.eepromSize - 1, HEX);
+      return true;
+      }
+    return false;
+    }  // end of EEPROM file
+
+  // check file would fit into device memory
+  if (highestAddress > currentSignature.flashSize)
+    {
+    Serial.print (F("Highest address of 0x"));
+    Serial.print (highestAddress, HEX);
+    Serial.print (F(" exceeds available flash memory top 0x"));
+    Serial.println (currentSignature.flashSize, HEX);
+    return true;
+    }
+
+  // an .ELF file can have EEPROM contents too
+  if (elfEEPROMSize > currentSignature.eepromSize)
+    {
+    Serial.print (F("EEPROM data of "));
+    Serial.print (elfEEPROMSize);
+    Serial.print (F(" bytes exceeds available EEPROM of "));
+    Serial.println (currentSignature.eepromSize);
+    return true;
+    }
+
+#if BOOTLOADER_PROGRAMMING
+  if (elfEEPROMSize)
+    {
+    Serial.println (F("The .ELF file has EEPROM data, which cannot be written through the bootloader."));
+    return true;
+    }
+
+  // the bootloader is at the top of flash (and can't write over itself)
+  if (highestAddress >= currentSignature.flashSize - currentSignature.baseBootSize)
+    {
+    Serial.print (F("Highest address of 0x"));
+    Serial.print (highestAddress, HEX);
+    Serial.print (F(" is in the bootloader, which starts at 0x"));
+    Serial.print (currentSignature.flashSize - currentSignature.baseBootSize, HEX);
+    Serial.println (F(" or lower"));
+    return true;
+    }
+
+  return false;  // the bootloader fuse can't be changed anyway
+#else
+  // check start address makes sense
+  return checkStartAddress && updateFuses (false);
+#endif // BOOTLOADER_PROGRAMMING
+  }  // end of checkFileFits
+
+// use this file (or list of them, or job) instead of asking for one (see Batch_Mode.ino)
+//  returns true if error, false if OK
+bool setFileName (const char * fName)
+  {
+  if (strlen (fName) >= sizeof name)
+    {
+    Serial.println (F("File name too long."));
+    return true;
+    }
+  strcpy (name, fName);
+  return false;
+  }  // end of setFileName
+
+// check pass over the file (or job) in "name", and that it suits this chip
+//  returns true if error, false if OK
+bool checkInputFile ()
+  {
+  if (isJobFile (name) ? readJobFile (name) : readHexFile(name, checkFile))
+    return true;
 
+  return isJobFile (name) ? checkJob () : checkFileFits (name, true);
+  }  // end of checkInputFile
 
 bool chooseInputFile ()
   {
@@ -373,7 +1253,7 @@ bool chooseInputFile ()
   if (name [0] == 0)
     memcpy (name, lastFileName, sizeof name);
 
-  if (readHexFile(name, checkFile))
+  if (checkInputFile ())
     {
     Serial.println (F("***********************************"));
     return true;  // error, don't attempt to write
@@ -382,43 +1262,44 @@ bool chooseInputFile ()
   // remember name for next time
   memcpy (lastFileName, name, sizeof lastFileName);
 
-  char fileNameInEEPROM [MAX_FILENAME];
-  eeprom_read_block (&fileNameInEEPROM, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILENAME);
-  fileNameInEEPROM [MAX_FILENAME - 1] = 0;  // ensure terminating null
+  char fileNameInEEPROM [MAX_FILE_LIST];
+  eeprom_read_block (&fileNameInEEPROM, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILE_LIST);
+  fileNameInEEPROM [MAX_FILE_LIST - 1] = 0;  // ensure terminating null
 
   // save new file name if it changed from what we have saved
   if (strcmp (fileNameInEEPROM, lastFileName) != 0)
-    eeprom_write_block ((const void *) &lastFileName, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILENAME);
+    eeprom_write_block ((const void *) &lastFileName, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILE_LIST);
 
-  // check file would fit into device memory
-  if (highestAddress > currentSignature.flashSize)
-    {
-    Serial.print (F("Highest address of 0x"));
-    Serial.print (highestAddress, HEX);
-    Serial.print (F(" exceeds available flash memory top 0x"));
-    Serial.println (currentSignature.flashSize, HEX);
-    Serial.println (F("***********************************"));
-    return true;
-    }
+   return false;
+  }  // end of chooseInputFile
 
-  // check start address makes sense
-  if (updateFuses (false))
+#if ALLOW_FILE_SAVING
+// returns true (and says why) if the flash or EEPROM can't be saved as this
+bool badSaveName (const char * fName)
+  {
+  if (!hasSuffix (fName, ".HEX") && !isEEPROMFile (fName))
     {
-    Serial.println (F("***********************************"));
+    Serial.println (F("File name must end in .HEX (flash) or .EEP (EEPROM)"));
     return true;
     }
+  return false;
+  }  // end of badSaveName
 
-   return false;
-  }  // end of chooseInputFile
-
-#if ALLOW_FILE_SAVING
-void readFlashContents ()
+// copy the flash (for a .HEX file) or the EEPROM (for a .EEP file) to the file in "name",
+//  replacing it if it is there
+//  returns true if error, false if OK
+bool saveToFile ()
   {
-  if (!haveSDcard)
+  if (badSaveName (name))
+    return true;
+
+#if BOOTLOADER_PROGRAMMING
+  if (isEEPROMFile (name))
     {
-    Serial.println (F("*** No SD card detected."));
-    return;
+    Serial.println (F("EEPROM cannot be read through the bootloader."));
+    return true;
     }
+#endif // BOOTLOADER_PROGRAMMING
 
   progressBarCount = 0;
   pagesize = currentSignature.pageSize;
@@ -426,38 +1307,6 @@ void readFlashContents ()
   oldPage = NO_PAGE;
   byte lastMSBwritten = 0;
 
-  while (true)
-    {
-
-    Serial.println ();
-    Serial.println (F("Choose file to save as: "));
-
-    getline (name, sizeof name);
-    int len = strlen (name);
-
-    if (len < 5 || strcmp (&name [len - 4], ".HEX") != 0)
-      {
-      Serial.println (F("File name must end in .HEX"));
-      return;
-      }
-
-    // if file doesn't exist, proceed
-    if (!sd.vwd()->exists (name))
-      break;
-
-    Serial.print (F("File "));
-    Serial.print (name);
-    Serial.println (F(" exists. Overwrite? Type 'YES' to confirm ..."));
-
-    if (getYesNo ())
-      break;
-
-    }  // end of checking if file exists
-
-  // ensure back in programming mode
-  if (!startProgramming ())
-    return;
-
   SdFile myFile;
 
   // open the file for writing
@@ -466,7 +1315,7 @@ void readFlashContents ()
     Serial.print (F("Could not open file "));
     Serial.print (name);
     Serial.println (F(" for writing."));
-    return;
+    return true;
     }
 
   byte memBuf [16];
@@ -474,9 +1323,18 @@ void readFlashContents ()
   char linebuf [50];
   byte sumCheck;
 
-  Serial.println (F("Copying flash memory to SD card (disk) ..."));
+  const bool eeprom = isEEPROMFile (name);
+  unsigned long memorySize = currentSignature.flashSize;
 
-  for (unsigned long address = 0; address < currentSignature.flashSize; address += sizeof memBuf)
+  if (eeprom)
+    {
+    memorySize = currentSignature.eepromSize;
+    Serial.println (F("Copying EEPROM to SD card (disk) ..."));
+    }
+  else
+    Serial.println (F("Copying flash memory to SD card (disk) ..."));
+
+  for (unsigned long address = 0; address < memorySize; address += sizeof memBuf)
     {
     bool allFF;
 
@@ -492,7 +1350,7 @@ void readFlashContents ()
 
     for (i = 0; i < sizeof memBuf; i++)
       {
-      memBuf [i] = readFlash (address + i);
+      memBuf [i] = eeprom ? readEEPROM (address + i) : readFlash (address + i);
       if (memBuf [i] != 0xFF)
         allFF = false;
       }  // end of reading 16 bytes
@@ -530,7 +1388,7 @@ void readFlashContents ()
        Serial.println ();  // finish off progress bar
        Serial.println (F("Error writing file."));
        myFile.close ();
-       return;
+       return true;
        }   // end of an error
 
     }  // end of reading flash
@@ -543,10 +1401,10 @@ void readFlashContents ()
   Serial.print (F("File "));
   Serial.print (name);
   Serial.println (F(" saved."));
-  }  // end of readFlashContents
-#endif
+  return false;
+  }  // end of saveToFile
 
-void writeFlashContents ()
+void readFlashContents ()
   {
   if (!haveSDcard)
     {
@@ -554,22 +1412,150 @@ void writeFlashContents ()
     return;
     }
 
-  if (chooseInputFile ())
-    return;
+  while (true)
+    {
+
+    Serial.println ();
+    Serial.println (F("Choose file to save as: "));
+
+    getline (name, sizeof name);
+
+    if (badSaveName (name))
+      return;
+
+    // if file doesn't exist, proceed
+    if (!sd.vwd()->exists (name))
+      break;
+
+    Serial.print (F("File "));
+    Serial.print (name);
+    Serial.println (F(" exists. Overwrite? Type 'YES' to confirm ..."));
+
+    if (getYesNo ())
+      break;
+
+    }  // end of checking if file exists
 
   // ensure back in programming mode
-  if (!startProgramming ())
+  if (!beginSession ())
     return;
 
+  saveToFile ();
+  }  // end of readFlashContents
+#endif
+
+// compare flash to the file (and the bootloader fuse to what it should be)
+//  returns true if the chip is already current, and need not be written
+bool flashIsCurrent ()
+  {
+  if (readHexFile(name, compareFlash) || errors)
+    return false;
+
+  // flash is right, but the fuses might not be (these only write them if they differ)
+  applyFuses (true);
+
+  Serial.println (F("Already current - not erased or written."));
+  return true;
+  }  // end of flashIsCurrent
+
+// erase the chip and write a file (or list) to the flash, as found by the check pass
+//  returns true if error, false if OK
+bool writeFlashFile (const char * fName)
+  {
+  if (readHexFile(fName, writeToFlash))
+    return true;
+
+  // then the pages which were not in one piece in the file
+  for (byte i = 0; i < fragmentedPageCount; i++)
+    {
+    assemblyPage = fragmentedPages [i] * pagesize;
+    if (readHexFile(fName, writeFragmentedPage))
+      return true;
+    }  // end of for each fragmented page
+
+  return false;
+  }  // end of writeFlashFile
+
+// write the file (or job) in "name", after its check pass, and verify it
+//  returns true if error (or it didn't verify), false if OK
+bool writeInputFile ()
+  {
+  // a job does it all
+  if (isJobFile (name))
+    return runJob ();
+
+  // EEPROM is not erased first, and has no bootloader fuse
+  if (isEEPROMFile (name))
+    return readHexFile(name, writeToEEPROM) || readHexFile(name, verifyEEPROM) || errors;
+
+  // if it is already programmed with this file, leave it alone
+  if (verifyBeforeWriting && flashIsCurrent ())
+    return false;
+
   // now commit to flash
-  readHexFile(name, writeToFlash);
+  bool bad = writeFlashFile (name);
 
   // verify
-  readHexFile(name, verifyFlash);
+  if (readHexFile(name, verifyFlash) || errors)
+    bad = true;
+
+  // an .ELF file may have EEPROM contents as well
+  if (elfEEPROMSize && (readHexFile(name, writeToEEPROM) || readHexFile(name, verifyEEPROM) || errors))
+    bad = true;
+
+  // now fix up fuses so we can boot (using the ones in the .ELF file if it has them)
+  if (applyFuses (true))
+    bad = true;
+
+  return bad;
+  }  // end of writeInputFile
+
+// verify the file (or job) in "name", after its check pass
+//  returns true if error (or it didn't match), false if OK
+bool verifyInputFile ()
+  {
+  // a job is checked all over, fuses too
+  if (isJobFile (name))
+    {
+#if BOOTLOADER_PROGRAMMING
+    if (verifyJob ())   // its fuses can't be read through the bootloader
+#else
+    if (verifyJob () || checkFusePlan (filePlan))
+#endif // BOOTLOADER_PROGRAMMING
+      {
+      Serial.println (F("Job does not match the chip."));
+      return true;
+      }
+    Serial.println (F("Job matches the chip."));
+    return false;
+    }
+
+  // verify it
+  bool bad = readHexFile(name, isEEPROMFile (name) ? verifyEEPROM : verifyFlash) || errors;
 
-  // now fix up fuses so we can boot
-  updateFuses (true);
+  // an .ELF file may have EEPROM contents as well
+  if (elfEEPROMSize && (readHexFile(name, verifyEEPROM) || errors))
+    bad = true;
 
+  return bad;
+  }  // end of verifyInputFile
+
+void writeFlashContents ()
+  {
+  if (!haveSDcard)
+    {
+    Serial.println (F("*** No SD card detected."));
+    return;
+    }
+
+  if (chooseInputFile ())
+    return;
+
+  // ensure back in programming mode
+  if (!beginSession ())
+    return;
+
+  writeInputFile ();
   }  // end of writeFlashContents
 
 void verifyFlashContents ()
@@ -584,16 +1570,16 @@ void verifyFlashContents ()
     return;
 
   // ensure back in programming mode
-  if (!startProgramming ())
+  if (!beginSession ())
     return;
 
-  // verify it
-  readHexFile(name, verifyFlash);
+  verifyInputFile ();
   }  // end of verifyFlashContents
 
 void initFile ()
   {
-  Serial.println (F("Reading SD card ..."));
+  if (!batchMode)
+    Serial.println (F("Reading SD card ..."));
 
   // initialize the SD card at SPI_HALF_SPEED to avoid bus errors with
   // breadboards.  use SPI_FULL_SPEED for better performance.
@@ -605,15 +1591,16 @@ void initFile ()
   else
     {
     haveSDcard = true;
-    showDirectory ();
+    if (!batchMode)
+      showDirectory ();
     }
 
 //  Serial.print (F("Free memory = "));
 //  Serial.println (getFreeMemory (), DEC);
 
   // find what filename they used last
-  eeprom_read_block (&lastFileName, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILENAME);
-  lastFileName [MAX_FILENAME - 1] = 0;  // ensure terminating null
+  eeprom_read_block (&lastFileName, LAST_FILENAME_LOCATION_IN_EEPROM, MAX_FILE_LIST);
+  lastFileName [MAX_FILE_LIST - 1] = 0;  // ensure terminating null
 
   // ensure file name valid
   for (byte i = 0; i < strlen (lastFileName); i++)
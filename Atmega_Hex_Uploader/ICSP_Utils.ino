@@ -49,6 +49,11 @@ enum {
     loadExtendedAddressByte = 0x4D,
     loadProgramMemory = 0x40,
 
+    readEepromMemory = 0xA0,
+    writeEepromMemory = 0xC0,
+    loadEepromMemoryPage = 0xC1,
+    writeEepromMemoryPage = 0xC2,
+
 };  // end of enum
 
 // which program instruction writes which fuse
@@ -102,6 +107,39 @@ void writeFlash (unsigned long addr, const byte data)
   program (loadProgramMemory | high, 0, lowByte (addr), data);
   } // end of writeFlash
 
+// read a byte from EEPROM
+byte readEEPROM (unsigned long addr)
+  {
+  return program (readEepromMemory, highByte (addr), lowByte (addr));
+  } // end of readEEPROM
+
+// write a byte to the EEPROM page buffer (ready for committing)
+//  chips without EEPROM page access (eg. Atmega8) have the byte written immediately
+void writeEEPROM (unsigned long addr, const byte data)
+  {
+  if (currentSignature.eepromPageSize == 0)
+    {
+    program (writeEepromMemory, highByte (addr), lowByte (addr), data);
+    pollUntilReady ();
+    return;
+    }
+
+  program (loadEepromMemoryPage, 0, lowByte (addr) & (currentSignature.eepromPageSize - 1), data);
+  } // end of writeEEPROM
+
+// commit EEPROM page buffer to EEPROM
+void commitEEPROMPage (unsigned long addr)
+  {
+  showProgress ();
+
+  if (currentSignature.eepromPageSize == 0)
+    return;  // already written byte-by-byte
+
+  addr &= ~((unsigned long) currentSignature.eepromPageSize - 1);
+  program (writeEepromMemoryPage, highByte (addr), lowByte (addr));
+  pollUntilReady ();
+  }  // end of commitEEPROMPage
+
 byte readFuse (const byte which)
   {
   switch (which)
@@ -131,16 +169,22 @@ void readSignature (byte sig [3])
 void pollUntilReady ()
   {
   if (currentSignature.timedWrites)
-    delay (10);  // at least 2 x WD_FLASH which is 4.5 mS
+    {
+    const unsigned long start = micros ();
+    while (micros () - start < 10000)  // at least 2 x WD_FLASH which is 4.5 mS
+      if (whileBusy)
+        whileBusy ();
+    }
   else
     {
     while ((program (pollReady) & 1) == 1)
-      {}  // wait till ready
+      if (whileBusy)
+        whileBusy ();  // wait till ready
     }  // end of if
   }  // end of pollUntilReady
 
 // commit page to flash memory
-void commitPage (unsigned long addr, bool showMessage)
+void commitPage (unsigned long addr, bool showMessage, bool clearAfter)
   {
 
   if (showMessage)
@@ -164,7 +208,8 @@ void commitPage (unsigned long addr, bool showMessage)
   program (writeProgramMemory, highByte (addr), lowByte (addr));
   pollUntilReady ();
 
-  clearPage();  // clear ready for next page full
+  if (clearAfter)
+    clearPage();  // clear ready for next page full
   }  // end of commitPage
 
 void eraseMemory ()
@@ -173,6 +218,7 @@ void eraseMemory ()
   delay (20);  // for Atmega8
   pollUntilReady ();
   clearPage();  // clear temporary page
+  fuses [lockByte] = readFuse (lockByte);  // erasing clears the lock bits
   }  // end of eraseMemory
 
 // write specified value to specified fuse/lock byte
@@ -185,13 +231,60 @@ void writeFuse (const byte newValue, const byte whichFuse)
   pollUntilReady ();
   }  // end of writeFuse
 
+// send Programming Enable, returns true if the target echoed it back (ie. we are in sync)
+bool programEnable ()
+  {
+  byte confirm;
+
+  noInterrupts ();
+#if USE_BIT_BANGED_SPI
+  BB_SPITransfer (progamEnable);
+  BB_SPITransfer (programAcknowledge);
+  confirm = BB_SPITransfer (0);
+  BB_SPITransfer (0);
+#else
+  SPI.transfer (progamEnable);
+  SPI.transfer (programAcknowledge);
+  confirm = SPI.transfer (0);
+  SPI.transfer (0);
+#endif  // (not) USE_BIT_BANGED_SPI
+  interrupts ();
+
+  return confirm == programAcknowledge;
+  }  // end of programEnable
+
+// one positive pulse on SCK, to shift the target's idea of where a byte starts
+void pulseSCK ()
+  {
+#if USE_BIT_BANGED_SPI
+  digitalWrite (MSPIM_SCK, HIGH);
+  delayMicroseconds (BB_DELAY_MICROSECONDS);
+  digitalWrite (MSPIM_SCK, LOW);
+  delayMicroseconds (BB_DELAY_MICROSECONDS);
+#else
+  SPCR &= ~bit (SPE);   // take SCK away from the SPI hardware for a moment
+  digitalWrite (SCK, HIGH);
+  delayMicroseconds (10);
+  digitalWrite (SCK, LOW);
+  SPCR |= bit (SPE);
+#endif  // (not) USE_BIT_BANGED_SPI
+  }  // end of pulseSCK
+
+// how many times to pulse SCK and try again, before resetting the target again
+const byte SYNC_ATTEMPTS = 4;
+// pause before resetting the target again, doubled after each failure up to the maximum
+const unsigned long FIRST_RETRY_DELAY = 8;   // mS
+const unsigned long MAX_RETRY_DELAY = 128;   // mS
+
 // put chip into programming mode
+//  returns true if managed to enter programming mode
 bool startProgramming ()
   {
 
-  Serial.print (F("Attempting to enter ICSP programming mode ..."));
+  if (!serialIsBinary)
+    Serial.print (F("Attempting to enter ICSP programming mode ..."));
 
-  byte confirm;
+  const unsigned long startTime = millis ();
   pinMode (RESET, OUTPUT);
 
 #if USE_BIT_BANGED_SPI
@@ -206,13 +299,10 @@ bool startProgramming ()
 #endif  // (not) USE_BIT_BANGED_SPI
 
   unsigned int timeout = 0;
+  unsigned long retryDelay = FIRST_RETRY_DELAY;
 
-  // we are in sync if we get back programAcknowledge on the third byte
-  do
+  while (true)
     {
-    // regrouping pause
-    delay (100);
-
     // ensure SCK low
     noInterrupts ();
 
@@ -228,38 +318,43 @@ bool startProgramming ()
     digitalWrite (RESET, LOW);
     interrupts ();
 
-    delay (25);  // wait at least 20 mS
-    noInterrupts ();
-#if USE_BIT_BANGED_SPI
-    BB_SPITransfer (progamEnable);
-    BB_SPITransfer (programAcknowledge);
-    confirm = BB_SPITransfer (0);
-    BB_SPITransfer (0);
-#else
-    SPI.transfer (progamEnable);
-    SPI.transfer (programAcknowledge);
-    confirm = SPI.transfer (0);
-    SPI.transfer (0);
-#endif  // (not) USE_BIT_BANGED_SPI
-
-    interrupts ();
+    delay (20);  // wait at least 20 mS
 
-    if (confirm != programAcknowledge)
+    // we are in sync if we get back programAcknowledge on the third byte,
+    //  if not, a pulse on SCK may get us into sync without another reset
+    for (byte i = 0; i < SYNC_ATTEMPTS; i++)
       {
+      if (programEnable ())
+        {
+        if (!serialIsBinary)
+          {
+          Serial.println ();
+          Serial.print (F("Entered programming mode OK ("));
+          Serial.print (millis () - startTime);
+          Serial.println (F(" mS)."));
+          }
+        return true;
+        }
+      pulseSCK ();
+      }  // end of for each sync attempt
+
+    if (!serialIsBinary)
       Serial.print (".");
-      if (timeout++ >= ENTER_PROGRAMMING_ATTEMPTS)
+    if (timeout++ >= ENTER_PROGRAMMING_ATTEMPTS)
+      {
+      if (!serialIsBinary)
         {
         Serial.println ();
         Serial.println (F("Failed to enter programming mode. Double-check wiring!"));
-        return false;
-        }  // end of too many attempts
-      }  // end of not entered programming mode
+        }
+      return false;
+      }  // end of too many attempts
 
-    } while (confirm != programAcknowledge);
+    // give it longer each time before trying again
+    delay (retryDelay);
+    retryDelay = min (retryDelay * 2, MAX_RETRY_DELAY);
+    }  // end of while not in programming mode
 
-  Serial.println ();
-  Serial.println (F("Entered programming mode OK."));
-  return true;
   }  // end of startProgramming
 
 void stopProgramming ()
@@ -291,7 +386,8 @@ void stopProgramming ()
   pinMode (MISO,  INPUT);
 #endif  // (not) USE_BIT_BANGED_SPI
 
-  Serial.println (F("Programming mode off."));
+  if (!serialIsBinary)
+    Serial.println (F("Programming mode off."));
 
   } // end of stopProgramming
 
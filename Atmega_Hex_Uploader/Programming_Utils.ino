@@ -18,6 +18,8 @@ That will ensure that those directories now are using the same file.
 // show one progress symbol, wrap at 64 characters
 void showProgress ()
   {
+  if (serialIsBinary)
+    return;
   if (progressBarCount++ % 64 == 0)
     Serial.println (); 
   Serial.print (F("#"));  // progress bar
@@ -55,6 +57,24 @@ void writeData (const unsigned long addr, const byte * pData, const int length)
 #endif // HIGH_VOLTAGE_PARALLEL    
 
   }  // end of writeData
+
+// write data to the EEPROM page buffer, committing each page as we leave it
+void writeEEPROMData (const unsigned long addr, const byte * pData, const int length)
+  {
+  // write each byte
+  for (int i = 0; i < length; i++)
+    {
+    unsigned long thisPage = (addr + i) & pagemask;
+    // page changed? commit old one
+    if (thisPage != oldPage && oldPage != NO_PAGE)
+      commitEEPROMPage (oldPage);
+    // now this is the current page
+    oldPage = thisPage;
+    // put byte into page buffer
+    writeEEPROM (addr + i, pData [i]);
+    }  // end of for
+
+  }  // end of writeEEPROMData
   
  
 // show a byte in hex with leading zero and optional newline
@@ -78,6 +98,84 @@ void showHex (const byte b, const boolean newline, const boolean show0x)
   }  // end of showHex
 
 
+// show the name of a fuse (eg. "high")
+void showFuseName (const byte which)
+  {
+  switch (which)
+    {
+    case lowFuse:         Serial.print (F("low"));      break;
+    case highFuse:        Serial.print (F("high"));     break;
+    case extFuse:         Serial.print (F("extended")); break;
+    case lockByte:        Serial.print (F("lock"));     break;
+    case calibrationByte: Serial.print (F("clock"));    break;
+    }  // end of switch
+  }  // end of showFuseName
+
+/*
+Fuse plans.
+
+Rather than writing fuses one at a time as they come up, the ones wanted are put
+into a plan. Only those which differ from what the chip has now (fuses []) are
+written, the lock byte last (so it can't get in the way of anything else), and then
+they are read back once to confirm them.
+
+Give values as the chip reads them back, that is with any unused bits as 1
+(eg. an extended fuse of 0xFD rather than 0x05), otherwise they will never match.
+*/
+
+// write the fuses in the plan which have changed, then read them back
+//  returns true if error, false if OK
+bool writeFusePlan (const fusePlanType & plan)
+  {
+  // lock byte is last in the array, so it is written last
+  for (byte i = lowFuse; i <= lockByte; i++)
+    {
+    if ((plan.mask & bit (i)) == 0 || plan.fuses [i] == fuses [i])
+      continue;
+    Serial.print (F("Setting "));
+    showFuseName (i);
+    Serial.print (F(" fuse = "));
+    showHex (plan.fuses [i], true);
+    writeFuse (plan.fuses [i], i);
+    }  // end of for each fuse
+
+  return checkFusePlan (plan);
+  }  // end of writeFusePlan
+
+// read back the fuses in the plan (updating our copy) and report any differences
+//  returns true if any differ, false if OK
+bool checkFusePlan (const fusePlanType & plan)
+  {
+  bool bad = false;
+  for (byte i = lowFuse; i <= lockByte; i++)
+    {
+    if ((plan.mask & bit (i)) == 0)
+      continue;
+    fuses [i] = readFuse (i);
+    if (fuses [i] == plan.fuses [i])
+      continue;
+    Serial.print (F("Wanted "));
+    showFuseName (i);
+    Serial.print (F(" fuse = "));
+    showHex (plan.fuses [i]);
+    Serial.print (F("but found "));
+    showHex (fuses [i], true);
+    bad = true;
+    }  // end of for each fuse
+
+  return bad;
+  }  // end of checkFusePlan
+
+// a new clock setting only takes effect when the chip comes out of reset, so leave
+//  programming mode and enter it again (startProgramming retries until the chip
+//  answers, so there is no need for a fixed delay)
+//  returns true if back in programming mode
+bool relatchFuses ()
+  {
+  stopProgramming ();
+  return startProgramming ();
+  }  // end of relatchFuses
+
 // convert a boolean to Yes/No
 void showYesNo (const boolean b, const boolean newline)
   {
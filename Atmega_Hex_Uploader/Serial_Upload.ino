@@ -0,0 +1,355 @@
+// Serial_Upload.ino
+//
+// Receive a flash image from a PC over the serial port (the U command), rather than from the SD card
+//
+// Author: Nick Gammon
+
+#if SERIAL_UPLOAD
+
+/*
+
+After the U command the programmer changes to UPLOAD_BAUD_RATE and waits for frames from the PC:
+
+  0x01, type, seq, address (4 bytes), length (2 bytes), data (length bytes), CRC (2 bytes)
+
+It replies to each one with:
+
+  0x01, type, seq, info (2 bytes), CRC (2 bytes)
+
+Numbers are little-endian. The CRC is CRC-16/XMODEM of everything after the 0x01.
+
+  PC sends                           Programmer replies
+  --------                           ------------------
+  'S' start (no data)                'R' ready: seq = credits, info = page size (the chip is erased first)
+  'P' page: address, one page        'K' (seq): page written and verified
+                                     'N' (seq): bad frame, or one missed: send again from page seq
+                                     'F' (seq): failed, info = reason (see below), upload abandoned
+  'E' end: seq = pages sent          'D' done: info = pages written
+
+Pages are numbered from 0 (seq wraps around at 256). The PC may have as many pages not yet
+answered as there are credits; each reply to a page gives one back. There are two page buffers,
+so the next page is received while the one before it is being written to the target and polled
+(via whileBusy), and then checked.
+
+A page sent again is answered again with 'K' only if it has been written. If it is still waiting
+in a buffer it is ignored, as its 'K' comes when it is written.
+
+See serialUpload.cpp for the PC side, and serialUploadSimulator.cpp for a pretend programmer.
+
+Fuses are left alone, so if the image includes a bootloader set the bootloader fuses separately.
+
+*/
+
+const unsigned long UPLOAD_BAUD_RATE = 500000;  // exact on a 16 MHz Arduino
+
+const byte UPLOAD_SOH = 0x01;                   // start of frame
+const unsigned int UPLOAD_MAX_PAGE = 256;       // largest flash page
+const byte UPLOAD_CREDITS = 2;                  // one page buffer being written, one being received
+const byte NO_UPLOAD_BUFFER = 0xFF;
+
+const unsigned long UPLOAD_START_TIMEOUT = 10000;  // mS to wait for the PC to start
+const unsigned long UPLOAD_IDLE_TIMEOUT = 5000;    // mS to wait for the next frame
+const unsigned long UPLOAD_BYTE_TIMEOUT = 50;      // mS between bytes of a frame
+
+// reasons for 'F', in info
+enum {
+    uploadBadAddress = 1,     // page not on a page boundary, or past the end of flash
+    uploadVerifyFailed = 2,   // page did not read back the same
+};
+
+// frame header, after the 0x01
+enum {
+    uploadType,
+    uploadSeq,
+    uploadAddress,            // 4 bytes
+    uploadLength = 6,         // 2 bytes
+    UPLOAD_HEADER_LENGTH = 8
+};
+
+// page buffers
+byte uploadBuffer [UPLOAD_CREDITS] [UPLOAD_MAX_PAGE];
+unsigned long uploadBufferAddress [UPLOAD_CREDITS];
+byte uploadBufferSeq [UPLOAD_CREDITS];
+byte uploadFull;                // how many buffers are waiting to be written
+byte uploadNext;                // which buffer is written next
+
+// state of the frame being received
+byte uploadHeader [UPLOAD_HEADER_LENGTH];
+unsigned int uploadReceived;    // bytes of the frame so far, including the 0x01 (0 = between frames)
+byte uploadFrameBuffer;         // buffer its data goes into, or NO_UPLOAD_BUFFER
+unsigned int uploadCRC;
+byte uploadCRCLow;
+unsigned long uploadLastByte;   // when it arrived (millis)
+
+byte uploadExpectedSeq;         // next page wanted
+byte uploadWrittenSeq;          // next page to be written (the ones before it are written and verified)
+unsigned int uploadPagesWritten;
+bool uploadStarted;
+bool uploadEnded;
+bool uploadFailed;
+
+// send a reply frame to the PC
+void sendUploadReply (const byte type, const byte seq, const unsigned int info)
+  {
+  const byte reply [4] = { type, seq, lowByte (info), highByte (info) };
+  unsigned int crc = 0;
+
+  Serial.write (UPLOAD_SOH);
+  for (byte i = 0; i < sizeof reply; i++)
+    {
+    crc = _crc_xmodem_update (crc, reply [i]);
+    Serial.write (reply [i]);
+    }
+  Serial.write (lowByte (crc));
+  Serial.write (highByte (crc));
+  }  // end of sendUploadReply
+
+// act on a complete frame from the PC
+void uploadFrame (const bool crcOK)
+  {
+  const byte seq = uploadHeader [uploadSeq];
+
+  if (!crcOK)
+    {
+    sendUploadReply ('N', uploadExpectedSeq, 0);
+    return;
+    }
+
+  switch (uploadHeader [uploadType])
+    {
+    case 'S':
+      if (!uploadStarted)
+        {
+        // nothing is received while erasing, the PC will send 'S' again
+        whileBusy = NULL;
+        eraseMemory ();
+        whileBusy = receiveUpload;
+        uploadStarted = true;
+        }
+      sendUploadReply ('R', UPLOAD_CREDITS, currentSignature.pageSize);
+      break;
+
+    case 'P':
+      {
+      unsigned long addr = 0;
+      for (byte i = 0; i < 4; i++)
+        addr |= (unsigned long) uploadHeader [uploadAddress + i] << (i * 8);
+
+      if (seq != uploadExpectedSeq)
+        {
+        // a page sent again (after a retry) is answered again if it is written, and ignored if it
+        //  is still in a buffer (it is answered when written), one after a gap is not wanted
+        if ((byte) (uploadWrittenSeq - seq - 1) < UPLOAD_CREDITS)
+          sendUploadReply ('K', seq, 0);
+        else if ((byte) (seq - uploadWrittenSeq) >= (byte) (uploadExpectedSeq - uploadWrittenSeq))
+          sendUploadReply ('N', uploadExpectedSeq, 0);
+        break;
+        }
+
+      // not the right size, or not started, or the PC didn't wait for a credit
+      if (!uploadStarted || uploadFrameBuffer == NO_UPLOAD_BUFFER ||
+          word (uploadHeader [uploadLength + 1], uploadHeader [uploadLength]) != currentSignature.pageSize)
+        {
+        sendUploadReply ('N', uploadExpectedSeq, 0);
+        break;
+        }
+
+      if ((addr & (currentSignature.pageSize - 1)) || addr + currentSignature.pageSize > currentSignature.flashSize)
+        {
+        sendUploadReply ('F', seq, uploadBadAddress);
+        uploadFailed = true;
+        break;
+        }
+
+      uploadBufferAddress [uploadFrameBuffer] = addr;
+      uploadBufferSeq [uploadFrameBuffer] = seq;
+      uploadFull++;
+      uploadExpectedSeq++;
+      }
+      break;
+
+    case 'E':
+      // answered when all pages are written
+      if (seq == uploadExpectedSeq)
+        uploadEnded = true;
+      else
+        sendUploadReply ('N', uploadExpectedSeq, 0);
+      break;
+
+    default:
+      sendUploadReply ('N', uploadExpectedSeq, 0);
+      break;
+    }  // end of switch on frame type
+
+  }  // end of uploadFrame
+
+// take whatever has arrived from the PC, the data of a page going straight into a free buffer
+//  (also called while waiting for the target, see whileBusy)
+void receiveUpload ()
+  {
+  // a frame which stops part way is thrown away
+  if (uploadReceived && millis () - uploadLastByte > UPLOAD_BYTE_TIMEOUT)
+    {
+    uploadReceived = 0;
+    sendUploadReply ('N', uploadExpectedSeq, 0);
+    }
+
+  while (Serial.available ())
+    {
+    const byte c = Serial.read ();
+    uploadLastByte = millis ();
+
+    // anything between frames is ignored
+    if (uploadReceived == 0)
+      {
+      if (c == UPLOAD_SOH)
+        {
+        uploadReceived = 1;
+        uploadCRC = 0;
+        }
+      continue;
+      }
+
+    const unsigned int pos = uploadReceived++ - 1;  // position after the 0x01
+    if (pos < UPLOAD_HEADER_LENGTH)
+      {
+      uploadHeader [pos] = c;
+      uploadCRC = _crc_xmodem_update (uploadCRC, c);
+      if (pos == UPLOAD_HEADER_LENGTH - 1)
+        {
+        // too long to be a page? must be rubbish
+        if (word (c, uploadHeader [uploadLength]) > UPLOAD_MAX_PAGE)
+          {
+          uploadReceived = 0;
+          sendUploadReply ('N', uploadExpectedSeq, 0);
+          }
+        // if there is no free buffer the data is thrown away (and the page rejected by uploadFrame)
+        else if (uploadFull < UPLOAD_CREDITS)
+          uploadFrameBuffer = (uploadNext + uploadFull) % UPLOAD_CREDITS;
+        else
+          uploadFrameBuffer = NO_UPLOAD_BUFFER;
+        }
+      continue;
+      }
+
+    const unsigned int length = word (uploadHeader [uploadLength + 1], uploadHeader [uploadLength]);
+    if (pos < UPLOAD_HEADER_LENGTH + length)
+      {
+      uploadCRC = _crc_xmodem_update (uploadCRC, c);
+      if (uploadFrameBuffer != NO_UPLOAD_BUFFER)
+        uploadBuffer [uploadFrameBuffer] [pos - UPLOAD_HEADER_LENGTH] = c;
+      }
+    else if (pos == UPLOAD_HEADER_LENGTH + length)
+      uploadCRCLow = c;
+    else
+      {
+      uploadReceived = 0;
+      uploadFrame (word (c, uploadCRCLow) == uploadCRC);
+      }
+    }  // end of while available
+
+  }  // end of receiveUpload
+
+// write the page in buffer uploadNext to the target, and read it back
+//  returns true if error, false if OK
+bool writeUploadPage ()
+  {
+  const byte * data = uploadBuffer [uploadNext];
+  const unsigned long addr = uploadBufferAddress [uploadNext];
+  const unsigned int len = currentSignature.pageSize;
+
+  for (unsigned int i = 0; i < len; i++)
+    {
+    writeFlash (addr + i, data [i]);
+    receiveUpload ();
+    }
+
+  // the whole page buffer was loaded, so it doesn't need clearing
+  commitPage (addr, false, false);
+
+  for (unsigned int i = 0; i < len; i++)
+    {
+    if (readFlash (addr + i) != data [i])
+      return true;
+    receiveUpload ();
+    }
+
+  return false;
+  }  // end of writeUploadPage
+
+// the U command: receive pages from the PC, writing each one as the next arrives
+void serialUpload ()
+  {
+  Serial.print (F("Serial upload at "));
+  Serial.print (UPLOAD_BAUD_RATE);
+  Serial.println (F(" baud, waiting for the PC to start ..."));
+  Serial.flush ();
+  Serial.begin (UPLOAD_BAUD_RATE);
+
+  uploadFull = 0;
+  uploadNext = 0;
+  uploadReceived = 0;
+  uploadExpectedSeq = 0;
+  uploadWrittenSeq = 0;
+  uploadPagesWritten = 0;
+  uploadStarted = false;
+  uploadEnded = false;
+  uploadFailed = false;
+  uploadLastByte = millis ();
+  const unsigned long startTime = uploadLastByte;
+
+  serialIsBinary = true;
+  whileBusy = receiveUpload;
+
+  while (!uploadFailed)
+    {
+    receiveUpload ();
+
+    if (uploadFull)
+      {
+      const byte seq = uploadBufferSeq [uploadNext];
+      if (writeUploadPage ())
+        {
+        sendUploadReply ('F', seq, uploadVerifyFailed);
+        uploadFailed = true;
+        break;
+        }
+      uploadNext = (uploadNext + 1) % UPLOAD_CREDITS;
+      uploadFull--;
+      uploadWrittenSeq = seq + 1;
+      uploadPagesWritten++;
+      sendUploadReply ('K', seq, 0);
+      continue;
+      }  // end of having a page to write
+
+    if (uploadEnded)
+      {
+      sendUploadReply ('D', uploadExpectedSeq, uploadPagesWritten);
+      break;
+      }
+
+    if (millis () - uploadLastByte > (uploadStarted ? UPLOAD_IDLE_TIMEOUT : UPLOAD_START_TIMEOUT))
+      break;
+    }  // end of while
+
+  whileBusy = NULL;
+  serialIsBinary = false;
+
+  // back to the usual rate (see setup), giving the PC time to change too
+  Serial.flush ();
+  Serial.begin (115200);
+  delay (100);
+
+  Serial.println ();
+  if (!uploadStarted)
+    Serial.println (F("No upload started."));
+  else if (!uploadEnded)
+    Serial.println (uploadFailed ? F("Upload failed.") : F("Upload timed out."));
+
+  Serial.print (uploadPagesWritten);
+  Serial.print (F(" pages written and verified in "));
+  Serial.print (millis () - startTime);
+  Serial.println (F(" mS."));
+  }  // end of serialUpload
+
+#endif // SERIAL_UPLOAD
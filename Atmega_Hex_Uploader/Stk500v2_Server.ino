@@ -0,0 +1,484 @@
+// Stk500v2_Server.ino
+//
+// Let avrdude drive the programmer (as an STK500 version 2), instead of using the menu
+//
+// Author: Nick Gammon
+
+#if STK500V2_SERVER
+
+/*
+
+With STK500V2_SERVER true there is no menu: the serial port talks the STK500 version 2
+protocol (Atmel application note AVR068) at STK500V2_BAUD_RATE, so avrdude can be used, eg.
+
+  avrdude -c stk500v2 -P /dev/ttyACM0 -b 500000 -p m328p -U flash:w:sketch.hex:i
+
+Each message from avrdude is:
+
+  0x1B, sequence, size (2 bytes, MSB first), 0x0E, body (size bytes), checksum
+
+The checksum is all the other bytes XORed together. The reply is in the same form, with the
+same sequence number. The first byte of the body is the command, and in the reply it is
+followed by a status.
+
+The ISP commands are carried out with the functions the rest of the sketch uses (writeFlash,
+commitPage, readFuse and so on), rather than by passing avrdude's SPI instructions straight
+through. So a whole page is loaded and written for each message, and the same commands
+work in the high-voltage modes as well. The fuse safety checks (SAFETY_CHECKS) still apply.
+
+With BOOTLOADER_PROGRAMMING only the flash can be read and written: a chip erase, or reading
+or writing the fuses, lock byte or EEPROM, fails (so use avrdude -D, to not erase the chip first).
+
+Nothing else is sent on the serial port while this is active (see serialIsBinary).
+
+See stk500v2Simulator.cpp for trying it out (with avrdude) without any hardware.
+
+*/
+
+const unsigned long STK500V2_BAUD_RATE = 500000;   // exact on a 16 MHz Arduino, use -b 500000
+
+const unsigned int STK500V2_MAX_MESSAGE = 275;     // largest body, as on the STK500
+const unsigned long STK500V2_BYTE_TIMEOUT = 100;   // mS between bytes of a message
+const unsigned long STK500V2_IDLE_TIMEOUT = 30000; // mS before the target is let go, if avrdude goes away
+
+// message framing
+enum {
+    STK_MESSAGE_START = 0x1B,
+    STK_TOKEN = 0x0E,
+};
+
+// commands (first byte of the body)
+enum {
+    CMD_SIGN_ON = 0x01,
+    CMD_SET_PARAMETER = 0x02,
+    CMD_GET_PARAMETER = 0x03,
+    CMD_LOAD_ADDRESS = 0x06,
+
+    CMD_ENTER_PROGMODE_ISP = 0x10,
+    CMD_LEAVE_PROGMODE_ISP = 0x11,
+    CMD_CHIP_ERASE_ISP = 0x12,
+    CMD_PROGRAM_FLASH_ISP = 0x13,
+    CMD_READ_FLASH_ISP = 0x14,
+    CMD_PROGRAM_EEPROM_ISP = 0x15,
+    CMD_READ_EEPROM_ISP = 0x16,
+    CMD_PROGRAM_FUSE_ISP = 0x17,
+    CMD_READ_FUSE_ISP = 0x18,
+    CMD_PROGRAM_LOCK_ISP = 0x19,
+    CMD_READ_LOCK_ISP = 0x1A,
+    CMD_READ_SIGNATURE_ISP = 0x1B,
+    CMD_READ_OSCCAL_ISP = 0x1C,
+    CMD_SPI_MULTI = 0x1D,
+
+    ANSWER_CKSUM_ERROR = 0xB0,
+};
+
+// status (second byte of a reply)
+enum {
+    STATUS_CMD_OK = 0x00,
+    STATUS_CMD_FAILED = 0xC0,
+    STATUS_CKSUM_ERROR = 0xC1,
+    STATUS_CMD_UNKNOWN = 0xC9,
+};
+
+// parameters avrdude asks about
+enum {
+    PARAM_HW_VER = 0x90,
+    PARAM_SW_MAJOR = 0x91,
+    PARAM_SW_MINOR = 0x92,
+    PARAM_VTARGET = 0x94,
+    PARAM_SCK_DURATION = 0x98,
+};
+
+// bits in the mode byte of CMD_PROGRAM_FLASH_ISP / CMD_PROGRAM_EEPROM_ISP
+const byte STK_PAGE_MODE = 0x01;
+const byte STK_WRITE_PAGE = 0x80;
+
+// body of the message being handled, replaced by the reply
+byte stkBuffer [STK500V2_MAX_MESSAGE];
+
+unsigned long stkAddress;       // from CMD_LOAD_ADDRESS: words for flash, bytes for EEPROM
+bool stkProgramming;            // target is in programming mode
+unsigned long stkLastMessage;   // when the last message arrived (millis)
+byte stkStatus;                 // status for the message being handled
+
+// wait for the next byte of a message
+//  returns false if it doesn't come
+bool stkReadByte (byte & c)
+  {
+  const unsigned long start = millis ();
+  while (!Serial.available ())
+    if (millis () - start >= STK500V2_BYTE_TIMEOUT)
+      return false;
+  c = Serial.read ();
+  return true;
+  }  // end of stkReadByte
+
+// send the reply (the first length bytes of stkBuffer)
+void stkSend (const byte seq, const unsigned int length)
+  {
+  const byte header [5] = { STK_MESSAGE_START, seq, highByte (length), lowByte (length), STK_TOKEN };
+  byte checksum = 0;
+
+  for (byte i = 0; i < sizeof header; i++)
+    checksum ^= header [i];
+  for (unsigned int i = 0; i < length; i++)
+    checksum ^= stkBuffer [i];
+
+  Serial.write (header, sizeof header);
+  Serial.write (stkBuffer, length);
+  Serial.write (checksum);
+  }  // end of stkSend
+
+// find out what the target is, so pages and polling are done properly for it
+void stkIdentifyTarget ()
+  {
+  byte sig [3];
+  readSignature (sig);
+  foundSig = findSignature (sig);
+  if (foundSig != -1)
+    memcpy_P (&currentSignature, &signatures [foundSig], sizeof currentSignature);
+  else
+    memset (&currentSignature, 0, sizeof currentSignature);  // avrdude will complain about it
+  }  // end of stkIdentifyTarget
+
+// read a fuse (or the lock byte, or calibration byte)
+byte stkReadFuse (const byte fusenumber)
+  {
+#if BOOTLOADER_PROGRAMMING
+  stkStatus = STATUS_CMD_FAILED;  // the bootloader can't read them
+  return 0;
+#else
+  return readFuse (fusenumber);
+#endif // BOOTLOADER_PROGRAMMING
+  }  // end of stkReadFuse
+
+// write a fuse (or the lock byte), unless the safety checks say no
+void stkWriteFuse (const byte fusenumber, const byte newValue)
+  {
+#if BOOTLOADER_PROGRAMMING
+  stkStatus = STATUS_CMD_FAILED;  // the bootloader can't change them, don't let avrdude think it did
+#else
+  if (unsafeFuse (fusenumber, newValue))
+    stkStatus = STATUS_CMD_FAILED;
+  else
+    writeFuse (newValue, fusenumber);
+#endif // BOOTLOADER_PROGRAMMING
+  }  // end of stkWriteFuse
+
+// erase the whole chip
+void stkEraseChip ()
+  {
+#if BOOTLOADER_PROGRAMMING
+  stkStatus = STATUS_CMD_FAILED;  // the bootloader can't (each page is erased as it is written)
+#else
+  eraseMemory ();
+#endif // BOOTLOADER_PROGRAMMING
+  }  // end of stkEraseChip
+
+// carry out one of avrdude's 4-byte ISP instructions with the functions for our programming mode
+//  returns what the target would have sent back in the fourth byte
+byte stkInstruction (const byte * cmd)
+  {
+  switch (cmd [0])
+    {
+    case 0x30:  // read signature byte
+      {
+      byte sig [3];
+      readSignature (sig);
+      return sig [cmd [2] % 3];
+      }
+    case 0x38:  return stkReadFuse (calibrationByte);
+    case 0x50:  return stkReadFuse (cmd [1] == 0x08 ? extFuse : lowFuse);
+    case 0x58:  return stkReadFuse (cmd [1] == 0x08 ? highFuse : lockByte);
+    case 0x20:  // read flash low byte
+    case 0x28:  // read flash high byte
+      return readFlash ((word (cmd [1], cmd [2]) * 2UL) | (cmd [0] == 0x28));
+    case 0xA0:  // read EEPROM byte
+#if BOOTLOADER_PROGRAMMING
+      break;      // the bootloader only does flash
+#else
+      return readEEPROM (word (cmd [1], cmd [2]));
+#endif // BOOTLOADER_PROGRAMMING
+
+    case 0xAC:  // writes
+      switch (cmd [1])
+        {
+        case 0x80: stkEraseChip ();                   return 0;
+        case 0xA0: stkWriteFuse (lowFuse,  cmd [3]);  return 0;
+        case 0xA8: stkWriteFuse (highFuse, cmd [3]);  return 0;
+        case 0xA4: stkWriteFuse (extFuse,  cmd [3]);  return 0;
+        case 0xE0: stkWriteFuse (lockByte, cmd [3]);  return 0;
+        }  // end of switch on which write
+      break;
+    }  // end of switch on instruction
+
+#if ICSP_PROGRAMMING
+  // something else, the target can deal with it
+  return program (cmd [0], cmd [1], cmd [2], cmd [3]);
+#else
+  stkStatus = STATUS_CMD_FAILED;
+  return 0;
+#endif // ICSP_PROGRAMMING
+  }  // end of stkInstruction
+
+// write numBytes from stkBuffer [10] onwards to flash, or EEPROM, at stkAddress
+void stkProgramMemory (const bool flash, const unsigned int numBytes, const byte mode)
+  {
+  const byte * data = &stkBuffer [10];
+
+  if (flash)
+    {
+    // only paged writes, which all the chips we know about can do
+    if ((mode & STK_PAGE_MODE) == 0)
+      {
+      stkStatus = STATUS_CMD_FAILED;
+      return;
+      }
+
+    const unsigned long addr = (stkAddress & 0x7FFFFFFF) * 2;
+    for (unsigned int i = 0; i < numBytes; i++)
+      writeFlash (addr + i, data [i]);
+    // write the page when avrdude says it is all there
+    if (mode & STK_WRITE_PAGE)
+      commitPage (addr, false, false);
+    stkAddress += numBytes / 2;
+    return;
+    }  // end of flash
+
+#if BOOTLOADER_PROGRAMMING
+  stkStatus = STATUS_CMD_FAILED;  // the bootloader only does flash
+#else
+  // EEPROM: commit each page as we finish it (chips without EEPROM pages write each byte as it comes)
+  const unsigned long addr = stkAddress & 0x7FFFFFFF;
+  const byte eepromPageSize = currentSignature.eepromPageSize ? currentSignature.eepromPageSize : 1;
+  for (unsigned int i = 0; i < numBytes; i++)
+    {
+    writeEEPROM (addr + i, data [i]);
+    if (i == numBytes - 1 || (addr + i + 1) % eepromPageSize == 0)
+      commitEEPROMPage (addr + i);
+    }  // end of for each byte
+  stkAddress += numBytes;
+#endif // BOOTLOADER_PROGRAMMING
+  }  // end of stkProgramMemory
+
+// read numBytes of flash, or EEPROM, at stkAddress into stkBuffer [2] onwards
+void stkReadMemory (const bool flash, const unsigned int numBytes)
+  {
+  byte * data = &stkBuffer [2];
+
+  if (flash)
+    {
+    const unsigned long addr = (stkAddress & 0x7FFFFFFF) * 2;
+    for (unsigned int i = 0; i < numBytes; i++)
+      data [i] = readFlash (addr + i);
+    stkAddress += numBytes / 2;
+    }
+  else
+    {
+#if BOOTLOADER_PROGRAMMING
+    stkStatus = STATUS_CMD_FAILED;  // the bootloader only does flash
+#else
+    const unsigned long addr = stkAddress & 0x7FFFFFFF;
+    for (unsigned int i = 0; i < numBytes; i++)
+      data [i] = readEEPROM (addr + i);
+    stkAddress += numBytes;
+#endif // BOOTLOADER_PROGRAMMING
+    }
+  }  // end of stkReadMemory
+
+// carry out the command in stkBuffer (size bytes), leaving the reply there
+//  returns the length of the reply
+unsigned int stkCommand (const unsigned int size)
+  {
+  const byte command = stkBuffer [0];
+  stkStatus = STATUS_CMD_OK;
+
+  // the ISP commands need the target in programming mode (CMD_ENTER_PROGMODE_ISP first)
+  if (command > CMD_ENTER_PROGMODE_ISP && command <= CMD_SPI_MULTI && command != CMD_LEAVE_PROGMODE_ISP && !stkProgramming)
+    {
+    stkBuffer [1] = STATUS_CMD_FAILED;
+    return 2;
+    }
+
+  switch (command)
+    {
+    case CMD_SIGN_ON:
+      stkBuffer [1] = STATUS_CMD_OK;
+      stkBuffer [2] = 8;
+      memcpy (&stkBuffer [3], "STK500_2", 8);
+      return 11;
+
+    case CMD_SET_PARAMETER:   // nothing to set (the SPI speed is fixed)
+      break;
+
+    case CMD_GET_PARAMETER:
+      switch (stkBuffer [1])
+        {
+        case PARAM_HW_VER:       stkBuffer [2] = 2;  break;
+        case PARAM_SW_MAJOR:     stkBuffer [2] = 2;  break;
+        case PARAM_SW_MINOR:     stkBuffer [2] = 10; break;
+        case PARAM_VTARGET:      stkBuffer [2] = 50; break;   // 5.0V
+        case PARAM_SCK_DURATION: stkBuffer [2] = 1;  break;
+        default:                 stkBuffer [2] = 0;  break;
+        }  // end of switch on parameter
+      stkBuffer [1] = STATUS_CMD_OK;
+      return 3;
+
+    case CMD_LOAD_ADDRESS:
+      stkAddress = ((unsigned long) stkBuffer [1] << 24) | ((unsigned long) stkBuffer [2] << 16) |
+                   word (stkBuffer [3], stkBuffer [4]);
+      break;
+
+    case CMD_ENTER_PROGMODE_ISP:
+      // still there from last time (eg. after a chip erase)? no need to reset it
+      if (!stkProgramming)
+        stkProgramming = startProgramming ();
+      if (stkProgramming)
+        stkIdentifyTarget ();
+      else
+        stkStatus = STATUS_CMD_FAILED;
+      break;
+
+    case CMD_LEAVE_PROGMODE_ISP:
+      if (stkProgramming)
+        stopProgramming ();
+      stkProgramming = false;
+      break;
+
+    case CMD_CHIP_ERASE_ISP:
+      stkEraseChip ();
+      break;
+
+    case CMD_PROGRAM_FLASH_ISP:
+    case CMD_PROGRAM_EEPROM_ISP:
+      {
+      const unsigned int numBytes = word (stkBuffer [1], stkBuffer [2]);
+      if (size < 10 + numBytes)
+        stkStatus = STATUS_CMD_FAILED;
+      else
+        stkProgramMemory (command == CMD_PROGRAM_FLASH_ISP, numBytes, stkBuffer [3]);
+      }
+      break;
+
+    case CMD_READ_FLASH_ISP:
+    case CMD_READ_EEPROM_ISP:
+      {
+      const unsigned int numBytes = word (stkBuffer [1], stkBuffer [2]);
+      if (numBytes > STK500V2_MAX_MESSAGE - 3)
+        {
+        stkStatus = STATUS_CMD_FAILED;  // too long
+        break;
+        }
+      stkReadMemory (command == CMD_READ_FLASH_ISP, numBytes);
+      if (stkStatus != STATUS_CMD_OK)
+        break;
+      stkBuffer [1] = STATUS_CMD_OK;
+      stkBuffer [2 + numBytes] = STATUS_CMD_OK;
+      return numBytes + 3;
+      }
+
+    case CMD_PROGRAM_FUSE_ISP:
+    case CMD_PROGRAM_LOCK_ISP:
+      stkInstruction (&stkBuffer [1]);
+      stkBuffer [1] = stkStatus;
+      stkBuffer [2] = stkStatus;
+      return 3;
+
+    case CMD_READ_FUSE_ISP:
+    case CMD_READ_LOCK_ISP:
+    case CMD_READ_SIGNATURE_ISP:
+    case CMD_READ_OSCCAL_ISP:
+      stkBuffer [2] = stkInstruction (&stkBuffer [2]);
+      stkBuffer [1] = stkStatus;
+      stkBuffer [3] = stkStatus;
+      return 4;
+
+    case CMD_SPI_MULTI:
+      {
+      // only single instructions (as avrdude sends them), answered as the target would:
+      //  it echoes each byte one byte later, and the result is in the fourth
+      const byte numTx = stkBuffer [1];
+      const byte numRx = stkBuffer [2];
+      const byte rxStart = stkBuffer [3];
+      if (numTx != 4 || numRx > 4 || rxStart + numRx > 4)
+        {
+        stkStatus = STATUS_CMD_FAILED;
+        break;
+        }
+      byte rx [4] = { 0, stkBuffer [4], stkBuffer [5], 0 };
+      rx [3] = stkInstruction (&stkBuffer [4]);
+      stkBuffer [1] = stkStatus;
+      memcpy (&stkBuffer [2], &rx [rxStart], numRx);
+      stkBuffer [2 + numRx] = stkStatus;
+      return numRx + 3;
+      }
+
+    default:
+      stkBuffer [1] = STATUS_CMD_UNKNOWN;
+      return 2;
+    }  // end of switch on command
+
+  // replies which are just the status
+  stkBuffer [1] = stkStatus;
+  return 2;
+  }  // end of stkCommand
+
+// called from setup, instead of showing the banner
+void stk500v2Begin ()
+  {
+  Serial.begin (STK500V2_BAUD_RATE);
+  while (!Serial) ;  // for Leonardo, Micro etc.
+  serialIsBinary = true;
+  }  // end of stk500v2Begin
+
+// handle one message from avrdude, if there is one (called from loop)
+void stk500v2Server ()
+  {
+  if (!Serial.available ())
+    {
+    // avrdude went away without letting the target go?
+    if (allowTargetToRun && stkProgramming && millis () - stkLastMessage >= STK500V2_IDLE_TIMEOUT)
+      {
+      stopProgramming ();
+      stkProgramming = false;
+      }
+    return;
+    }
+
+  // anything outside a message is ignored
+  if (Serial.read () != STK_MESSAGE_START)
+    return;
+
+  byte seq, sizeHigh, sizeLow, token, c;
+  if (!stkReadByte (seq) || !stkReadByte (sizeHigh) || !stkReadByte (sizeLow) || !stkReadByte (token))
+    return;
+
+  const unsigned int size = word (sizeHigh, sizeLow);
+  if (token != STK_TOKEN || size == 0 || size > STK500V2_MAX_MESSAGE)
+    return;
+
+  byte checksum = STK_MESSAGE_START ^ seq ^ sizeHigh ^ sizeLow ^ token;
+  for (unsigned int i = 0; i < size; i++)
+    {
+    if (!stkReadByte (stkBuffer [i]))
+      return;
+    checksum ^= stkBuffer [i];
+    }
+
+  if (!stkReadByte (c))
+    return;
+
+  stkLastMessage = millis ();
+
+  if (c != checksum)
+    {
+    stkBuffer [0] = ANSWER_CKSUM_ERROR;
+    stkBuffer [1] = STATUS_CKSUM_ERROR;
+    stkSend (seq, 2);
+    return;
+    }
+
+  stkSend (seq, stkCommand (size));
+  }  // end of stk500v2Server
+
+#endif // STK500V2_SERVER
@@ -1,7 +1,7 @@
 // Atmega hex file uploader (from SD card)
 // Author: Nick Gammon
 // Date: 22nd May 2012
-// Version: 1.25h     // NB update 'Version' variable below!
+// Version: 1.28      // NB update 'Version' variable below!
 
 // Version 1.1: Some code cleanups as suggested on the Arduino forum.
 // Version 1.2: Cleared temporary flash area to 0xFF before doing each page
@@ -39,6 +39,27 @@
 // Version 1.25f: Added support for Crossroads' standalone programming board with 1 x 7-segment LEDs
 // Version 1.25g: Allowed for 256 file names (ie. hex file names)
 // Version 1.25h: Slowed down bit-banged programming slightly to improve reliability
+// Version 1.25i: Added optional verify-first mode: chips already holding the file are not reprogrammed
+// Version 1.25j: Status LEDs (and 7-segment messages) shown in the background, so the next chip can be started at once
+// Version 1.25k: Added optional auto-start when a board is plugged in
+// Version 1.25l: Faster entry to programming mode (pulse SCK to regain sync, back off only on failure)
+// Version 1.25m: Added job files (JOB.TXT): flash, EEPROM, fuses and lock byte done in one go
+// Version 1.25n: Only fuses which change are written, then read back to check them
+// Version 1.25o: Added a log of each board programmed (PROGLOG.CSV) and pass/fail totals in EEPROM
+// Version 1.25p: The selected file is checked while waiting for the switch, so it need not be checked again
+// Version 1.25q: Added a catalog (CATALOG.TXT) giving the chip, fuses, CRC and address range of each file
+// Version 1.25r: Added optional gang programming (several identical boards at once)
+// Version 1.25s: Signature table generated from devices.txt, chip names no longer held in RAM, indexed lookup
+// Version 1.25t: Added TARGET_DEVICE, to build for one chip only with its details as constants
+// Version 1.25u: The CRC of a catalogued file is checked as it is written, an out-of-date catalog fails the board
+// Version 1.25v: Nothing is programmed while the catalog cannot be understood
+// Version 1.25w: High fuse safety check for catalog fuses uses the bits for that chip (from devices.txt)
+// Version 1.25x: High fuse safety check for job files also uses the bits for the chip being programmed
+// Version 1.25y: Gang programming: SCK is not pulsed to regain sync once any board has answered
+// Version 1.25z: autoStart senses the board's power (targetSensePin), a programmed board is no longer reset to look for it
+// Version 1.26: A job's EEPROM file is checked against the size of the chip's EEPROM
+// Version 1.27: A file which comes back to a flash page it has already left is rejected (it would be written twice)
+// Version 1.28: Writing and verifying track the page by counting down the bytes left in it, 16-bit addresses for each byte
 
 /*
 
@@ -59,6 +80,7 @@ Red x 5 = Cannot read chip signature (Sg)
 Red x 6 = Unrecognized signature (Un)
 Red x 7 = Bad start address in hex file for code (Ad)
 Red x 8 = Verification error (bd)
+Red x 9 = Job file is for a different chip (dC)
 
 Problems with firmware.hex file
 -------------------------------
@@ -71,7 +93,11 @@ Red + yellow x 5 = Bad sumcheck at end of line (E5)
 Red + yellow x 6 = Line not expected length (E6)
 Red + yellow x 7 = Unknown record type (E7)
 Red + yellow x 8 = No 'end of file' record in file (E8)
-Red + yellow x 9 = File will not fit into flash of target (LG)
+Red + yellow x 9 = File will not fit into flash (or EEPROM) of target (LG)
+Red + yellow x 10 = Error in job file (Jb)
+Red + yellow x 11 = Error in catalog file (CA)
+Red + yellow x 12 = File is not the one in the catalog (CC)
+Red + yellow x 13 = File comes back to a flash page it has already left (PG)
 
 Worked OK
 ---------
@@ -97,12 +123,39 @@ No LEDs on = No power?
 #define HEX_FILE_NAMES true
 
 const bool allowTargetToRun = true;  // if true, programming lines are freed when not programming
+const bool verifyBeforeWriting = false;  // if true, chips which already match the file are not reprogrammed
+const bool checkWhileIdle = true;  // if true, the file is checked while waiting for the switch
 
 // fixed file name to read from SD card (root directory)
 const char wantedFile [] = "firmware.hex";
+// if this is on the SD card it is used instead (for the Crossroads board: JOBxx.TXT instead of CODExx.HEX)
+const char jobFile [] = "JOB.TXT";
+// if this is on the SD card it describes the .HEX files (see scanCatalog)
+const char catalogFile [] = "CATALOG.TXT";
+
+// make true to add a line to logFileName (on the SD card) for each board programmed
+const bool logResults = true;
+const char logFileName [] = "PROGLOG.CSV";
+
+// running totals of boards passed/failed, kept in EEPROM after the file number (in address 0)
+const int PASS_COUNT_ADDRESS = 1;   // unsigned long
+const int FAIL_COUNT_ADDRESS = PASS_COUNT_ADDRESS + sizeof (unsigned long);
 
 // which switch to close to start programming the target chip
 const byte startSwitch = 2;
+const unsigned long SWITCH_DEBOUNCE_TIME = 20;  // milliseconds
+
+// make true to start programming as soon as a board is plugged in (the switch still works too)
+const bool autoStart = false;
+const unsigned long PROBE_INTERVAL = 500;  // milliseconds between checks for a board
+const byte PROBES_TO_CHANGE = 3;           // checks in a row needed to decide a board is there (or gone)
+// analog pin sensing the target's +5V (eg. A3), needed for autoStart, or -1 if not connected
+const int targetSensePin = -1;
+const int TARGET_SENSE_THRESHOLD = 600;    // about 3V
+
+// a board which has been programmed is left running until it is taken out, so it can't
+//  be looked for by resetting it: autoStart has to sense its power instead
+static_assert (!autoStart || targetSensePin >= 0, "autoStart needs targetSensePin");
 
 // the three "status" LEDs
 const int errorLED = A0;
@@ -123,7 +176,11 @@ typedef enum {
   MSG_LINE_NOT_EXPECTED_LENGTH,  // record not length expected
   MSG_UNKNOWN_RECORD_TYPE,  // record type not known
   MSG_NO_END_OF_FILE_RECORD,  // no 'end of file' at end of file
-  MSG_FILE_TOO_LARGE_FOR_FLASH,  // file will not fit into flash
+  MSG_FILE_TOO_LARGE_FOR_FLASH,  // file will not fit into flash (or the job's EEPROM file into EEPROM)
+  MSG_BAD_JOB_FILE,        // job file could not be understood
+  MSG_BAD_CATALOG,         // catalog file could not be understood
+  MSG_CATALOG_MISMATCH,    // file is not the one the catalog describes (different CRC)
+  MSG_PAGES_OUT_OF_ORDER,  // file comes back to a flash page it has already left
 
   MSG_CANNOT_ENTER_PROGRAMMING_MODE,  // cannot program target chip
   MSG_NO_BOOTLOADER_FUSE,             // chip does not have bootloader
@@ -131,7 +188,9 @@ typedef enum {
   MSG_UNRECOGNIZED_SIGNATURE,     // signature not known
   MSG_BAD_START_ADDRESS,          // file start address invalid
   MSG_VERIFICATION_ERROR,         // verification error after programming
+  MSG_WRONG_CHIP,                 // job file (or catalog) is for a different chip
   MSG_FLASHED_OK,                 // flashed OK
+  MSG_ALREADY_CURRENT,            // chip already matched the file, not reprogrammed
  } msgType;
 
 /*
@@ -171,8 +230,9 @@ typedef enum {
 
 #include <SdFat.h>
 #include <EEPROM.h>
+#include <util/crc16.h>
 
-const char Version [] = "1.25h";
+const char Version [] = "1.28";
 
 const unsigned int ENTER_PROGRAMMING_ATTEMPTS = 2;
 
@@ -266,6 +326,64 @@ const byte BB_DELAY_MICROSECONDS = 6;
 // target board reset goes to here
 const byte RESET = MSPIM_SS;
 
+/*
+Gang programming.
+
+If GANG_PROGRAMMING is true, up to 8 identical boards are programmed at once. They share
+SCK and MOSI, and each has its own /RESET pin and MISO pin. The MISO pins must all be on
+the same port as BB_MISO, so that one read of the port gets a bit from every board.
+
+Each page is sent once (to all of them), and each board is verified separately. A board
+which fails is let run (as after programming), and the rest carry on, so the boards
+must not drive SCK or MOSI when running. Each board gets its own line in the log.
+If the boards don't all end up the same, the yellow LED flashes the number of each board
+(1 is the first) followed by its result.
+
+autoStart only senses the power of the board in the first position.
+*/
+#define GANG_PROGRAMMING false
+
+#if GANG_PROGRAMMING
+  // for each board: its MISO bit (on BB_MISO_PORT), and its /RESET pin, the first as above
+  #ifdef __AVR_ATmega2560__
+    const byte GANG_MISO_BITS [] = { BB_MISO_BIT, 5 };   // D6, D8
+  #elif defined(__AVR_ATmega1284P__)
+    const byte GANG_MISO_BITS [] = { BB_MISO_BIT, 7 };   // D13, D15
+  #else
+    const byte GANG_MISO_BITS [] = { BB_MISO_BIT, 3 };   // D6, D3
+  #endif
+  const byte GANG_RESET_PINS [] = { RESET, A3 };
+  const byte GANG_SIZE = sizeof GANG_MISO_BITS;
+
+  // what happened to each board
+  typedef struct {
+    byte result;              // msgType, if it was dropped
+    byte sig [3];
+    byte fusesBefore [4];     // low, high, extended, lock
+    byte fuses [4];           // as last read
+    unsigned int verifyErrors;
+  } targetType;
+
+  targetType targets [GANG_SIZE];
+  byte gangActive;            // one bit for each board still being programmed
+  byte leadTarget;            // the first of them, program () returns what it sent back
+  byte gangAcked;             // boards which answered the last programEnable
+  byte misoSamples [8];       // BB_MISO_PORT as read for each bit of the last byte transferred
+#endif // GANG_PROGRAMMING
+
+/*
+Single chip.
+
+A fixture which only ever programs one type of chip can be built for just that chip,
+by setting TARGET_DEVICE to its name as in devices.txt (eg. ATmega328P). Its page size,
+flash size and so on are then constants, so the compiler works out the page masks in
+advance, the extended address byte is never sent for chips of 128 KB or less, and
+there is no signature table (any other chip is rejected as an unrecognized signature).
+
+Leave it as ANY_DEVICE to program any chip in devices.txt.
+*/
+#define TARGET_DEVICE ANY_DEVICE
+
 // SD chip select pin
 const uint8_t chipSelect = SS;
 
@@ -303,8 +421,12 @@ const int MAX_FILENAME = 13;
 // actions to take
 enum {
     checkFile,
+    checkEEPROM,    // like checkFile, for an EEPROM file (which isn't written a page at a time)
     verifyFlash,
     writeToFlash,
+    compareFlash,   // like verifyFlash, but stops at the first difference
+    verifyEEPROM,
+    writeToEEPROM,
 };
 
 // file system object
@@ -322,90 +444,248 @@ enum {
       calibrationByte
 };
 
-// structure to hold signature and other relevant data about each chip
+// fuses (and lock byte) wanted for a chip, see writeFusePlan
 typedef struct {
-   byte sig [3];
-   const char * desc;
-   unsigned long flashSize;
-   unsigned int baseBootSize;
-   unsigned long pageSize;     // bytes
-   byte fuseWithBootloaderSize;  // ie. one of: lowFuse, highFuse, extFuse
-   byte timedWrites;    // if pollUntilReady won't work by polling the chip
-} signatureType;
-
-const unsigned long kb = 1024;
-const byte NO_FUSE = 0xFF;
-
-// see Atmega datasheets
-const signatureType signatures [] PROGMEM = 
-  {
-//     signature        description   flash size   bootloader  flash  fuse
-//                                                     size    page    to
-//                                                             size   change
-
-  // Attiny84 family
-  { { 0x1E, 0x91, 0x0B }, "ATtiny24",   2 * kb,           0,   32,   NO_FUSE, false },
-  { { 0x1E, 0x92, 0x07 }, "ATtiny44",   4 * kb,           0,   64,   NO_FUSE, false },
-  { { 0x1E, 0x93, 0x0C }, "ATtiny84",   8 * kb,           0,   64,   NO_FUSE, false },
-
-  // Attiny85 family
-  { { 0x1E, 0x91, 0x08 }, "ATtiny25",   2 * kb,           0,   32,   NO_FUSE, false },
-  { { 0x1E, 0x92, 0x06 }, "ATtiny45",   4 * kb,           0,   64,   NO_FUSE, false },
-  { { 0x1E, 0x93, 0x0B }, "ATtiny85",   8 * kb,           0,   64,   NO_FUSE, false },
-
-  // Atmega328 family
-  { { 0x1E, 0x92, 0x0A }, "ATmega48PA",   4 * kb,         0,    64,  NO_FUSE, false },
-  { { 0x1E, 0x93, 0x0F }, "ATmega88PA",   8 * kb,       256,   128,  extFuse, false },
-  { { 0x1E, 0x94, 0x0B }, "ATmega168PA", 16 * kb,       256,   128,  extFuse, false },
-  { { 0x1E, 0x95, 0x0F }, "ATmega328P",  32 * kb,       512,   128,  highFuse, false },
-
-  // Atmega644 family
-  { { 0x1E, 0x94, 0x0A }, "ATmega164P",   16 * kb,      256,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x08 }, "ATmega324P",   32 * kb,      512,   128,  highFuse, false },
-  { { 0x1E, 0x96, 0x0A }, "ATmega644P",   64 * kb,   1 * kb,   256,  highFuse, false },
-
-  // Atmega2560 family
-  { { 0x1E, 0x96, 0x08 }, "ATmega640",    64 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x97, 0x03 }, "ATmega1280",  128 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x97, 0x04 }, "ATmega1281",  128 * kb,   1 * kb,   256,  highFuse, false },
-  { { 0x1E, 0x98, 0x01 }, "ATmega2560",  256 * kb,   1 * kb,   256,  highFuse, false },
-      
-  { { 0x1E, 0x98, 0x02 }, "ATmega2561",  256 * kb,   1 * kb,   256,  highFuse, false },
-  
-  // AT90USB family
-  { { 0x1E, 0x93, 0x82 }, "At90USB82",    8 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x94, 0x82 }, "At90USB162",  16 * kb,       512,   128,  highFuse, false },
+  byte fuses [4];   // indexed by lowFuse, highFuse, extFuse, lockByte
+  byte mask;        // one bit for each of those wanted
+} fusePlanType;
 
-  // Atmega32U2 family
-  { { 0x1E, 0x93, 0x89 }, "ATmega8U2",    8 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x94, 0x89 }, "ATmega16U2",  16 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x8A }, "ATmega32U2",  32 * kb,       512,   128,  highFuse, false },
+// what we know about a file which checked OK, see checkFileInBackground
+typedef struct {
+  char fileName [MAX_FILENAME];
+  unsigned long fileSize;
+  unsigned int lastWriteDate;
+  unsigned int lastWriteTime;
+  unsigned long lowestAddress;
+  unsigned long highestAddress;
+  unsigned long bytesWritten;
+  unsigned int crc;
+} fileSummaryType;
+
+// what the catalog says about a file, see scanCatalog
+typedef struct {
+  byte sig [3];                 // signature of the chip it is for
+  fusePlanType plan;            // fuses and lock byte
+  unsigned int crc;             // CRC-CCITT of the data bytes
+  unsigned long lowestAddress;
+  unsigned long highestAddress;
+} catalogEntryType;
+
+// chip signatures, flash and page sizes: generated from devices.txt
+#include "Signatures.h"
+
+// true if this high fuse would stop the chip being programmed again: RSTDISBL or DWEN
+//  programmed, or SPIEN not programmed (where they are depends on the chip)
+bool unsafeHighFuse (const byte sig [3], const byte value)
+  {
+  const int j = findSignature (sig);
+  if (j < 0)
+    return false;  // we never program a chip we don't know
 
-  // Atmega32U4 family -  (datasheet is wrong about flash page size being 128 words)
-  { { 0x1E, 0x94, 0x88 }, "ATmega16U4",  16 * kb,       512,   128,  highFuse, false },
-  { { 0x1E, 0x95, 0x87 }, "ATmega32U4",  32 * kb,       512,   128,  highFuse, false },
+#if TARGET_DEVICE == ANY_DEVICE
+  const byte keepSet = pgm_read_byte (&signatures [j].highFuseKeepSet);
+  const byte keepClear = pgm_read_byte (&signatures [j].highFuseKeepClear);
+#else
+  const byte keepSet = currentSignature.highFuseKeepSet;
+  const byte keepClear = currentSignature.highFuseKeepClear;
+#endif // TARGET_DEVICE == ANY_DEVICE
 
-  // ATmega1284P family
-  { { 0x1E, 0x97, 0x05 }, "ATmega1284P", 128 * kb,   1 * kb,   256,  highFuse , false },
-  
-  // ATtiny4313 family
-  { { 0x1E, 0x91, 0x0A }, "ATtiny2313A",   2 * kb,        0,    32,  NO_FUSE, false },
-  { { 0x1E, 0x92, 0x0D }, "ATtiny4313",    4 * kb,        0,    64,  NO_FUSE, false },
+  return (value & keepSet) != keepSet || (value & keepClear) != 0;
+  }  // end of unsafeHighFuse
 
-  // ATtiny13 family
-  { { 0x1E, 0x90, 0x07 }, "ATtiny13A",     1 * kb,        0,    32,  NO_FUSE, false },
- 
-   // Atmega8A family
-  { { 0x1E, 0x93, 0x07 }, "ATmega8A",      8 * kb,      256,    64,  highFuse, true },
+char name[MAX_FILENAME] = { 0 };  // current file name
 
-  // ATmega64rfr2 family
-  { { 0x1E, 0xA6, 0x02 }, "ATmega64rfr2",  256 * kb, 1 * kb,   256, highFuse, false },
-  { { 0x1E, 0xA7, 0x02 }, "ATmega128rfr2", 256 * kb, 1 * kb,   256, highFuse, false },
-  { { 0x1E, 0xA8, 0x02 }, "ATmega256rfr2", 256 * kb, 1 * kb,   256, highFuse, false },
+// catalog entry for the file named catalogName, if haveCatalogEntry
+bool catalogLoaded;
+bool catalogBad;          // there is a catalog, but it could not be understood
+bool haveCatalogEntry;
+char catalogName [MAX_FILENAME];
+catalogEntryType catalogEntry;
 
-  };  // end of signatures
+// true if the catalog describes this file
+bool catalogued (const char * fName)
+  {
+  return haveCatalogEntry && strcasecmp (fName, catalogName) == 0;
+  }  // end of catalogued
 
-char name[MAX_FILENAME] = { 0 };  // current file name
+/*
+Production log.
+
+One line is added to the log file for each board, with these columns:
+
+  cycle         - number of boards done so far (pass + fail totals below)
+  target        - which board, when gang programming (otherwise 0)
+  signature     - as read from the chip (eg. 1E950F)
+  fuses_before  - low, high, extended and lock byte before programming (eg. FFDEFDCF)
+  fuses_after   - the same, afterwards
+  file          - .HEX (or job) file used
+  crc           - CRC-CCITT of the data bytes in the .HEX file
+  enter_ms      - time taken to enter programming mode
+  check_ms, write_ms, verify_ms, fuses_ms - time taken by each phase
+  errors        - number of verification errors
+  result        - the status shown (msgType: 0 is MSG_NO_SD_CARD, and so on)
+
+The file is kept open, and written through the SdFat cache, with a sync at the
+end of each line, so it costs very little.
+*/
+
+// phases of programming a board, which are timed for the log
+enum {
+  PHASE_CHECK,
+  PHASE_WRITE,
+  PHASE_VERIFY,
+  PHASE_FUSES,
+  PHASE_COUNT,  // number of phases
+  NO_PHASE = 0xFF
+};
+
+// what happened to the current board
+typedef struct {
+  unsigned long cycle;
+  byte sig [3];
+  byte fusesBefore [4];   // low, high, extended, lock
+  byte fusesAfter [4];
+  char fileName [MAX_FILENAME];
+  unsigned int crc;
+  unsigned long entryTime;
+  unsigned long phaseTime [PHASE_COUNT];
+  unsigned int verifyErrors;
+  byte result;            // msgType
+} cycleLogType;
+
+cycleLogType cycleLog;
+byte currentPhase = NO_PHASE;
+unsigned long phaseStarted;
+unsigned long passCount;
+unsigned long failCount;
+
+SdFile logFile;
+bool logFileOpen;
+
+// charge the time since the last phase started to it
+void endPhase ()
+  {
+  if (currentPhase != NO_PHASE)
+    cycleLog.phaseTime [currentPhase] += millis () - phaseStarted;
+  currentPhase = NO_PHASE;
+  }  // end of endPhase
+
+void startPhase (const byte which)
+  {
+  endPhase ();
+  currentPhase = which;
+  phaseStarted = millis ();
+  }  // end of startPhase
+
+// get the pass/fail totals, and open the log file (kept open from now on)
+void openLog ()
+  {
+  EEPROM.get (PASS_COUNT_ADDRESS, passCount);
+  EEPROM.get (FAIL_COUNT_ADDRESS, failCount);
+  // erased EEPROM is all 0xFF
+  if (passCount == 0xFFFFFFFF)
+    passCount = 0;
+  if (failCount == 0xFFFFFFFF)
+    failCount = 0;
+
+  if (!logResults)
+    return;
+
+  logFileOpen = logFile.open (logFileName, O_WRITE | O_CREAT | O_AT_END);
+  if (logFileOpen && logFile.fileSize () == 0)
+    {
+    logFile.println (F("cycle,target,signature,fuses_before,fuses_after,file,crc,enter_ms,check_ms,write_ms,verify_ms,fuses_ms,errors,result"));
+    logFile.sync ();
+    }
+  }  // end of openLog
+
+// start a new board
+void startCycle ()
+  {
+  memset (&cycleLog, 0, sizeof cycleLog);
+  currentPhase = NO_PHASE;
+#if GANG_PROGRAMMING
+  memset (targets, 0, sizeof targets);
+  gangActive = (1 << GANG_SIZE) - 1;
+  leadTarget = 0;
+#endif // GANG_PROGRAMMING
+  }  // end of startCycle
+
+// show bytes in hex, with no spaces
+void logHex (const byte * pData, const byte length)
+  {
+  for (byte i = 0; i < length; i++)
+    {
+    logFile.print (pData [i] >> 4, HEX);
+    logFile.print (pData [i] & 0x0F, HEX);
+    }
+  logFile.write (',');
+  }  // end of logHex
+
+// add to the totals, and add a line to the log for this board
+void logResult (const byte target)
+  {
+  if (cycleLog.result == MSG_FLASHED_OK || cycleLog.result == MSG_ALREADY_CURRENT)
+    {
+    passCount++;
+    EEPROM.put (PASS_COUNT_ADDRESS, passCount);
+    }
+  else
+    {
+    failCount++;
+    EEPROM.put (FAIL_COUNT_ADDRESS, failCount);
+    }
+  cycleLog.cycle = passCount + failCount;
+
+  if (!logFileOpen)
+    return;
+
+  logFile.print (cycleLog.cycle);
+  logFile.write (',');
+  logFile.print (target);
+  logFile.write (',');
+  logHex (cycleLog.sig, sizeof cycleLog.sig);
+  logHex (cycleLog.fusesBefore, sizeof cycleLog.fusesBefore);
+  logHex (cycleLog.fusesAfter, sizeof cycleLog.fusesAfter);
+  logFile.print (cycleLog.fileName);
+  logFile.write (',');
+  logFile.print (cycleLog.crc, HEX);
+  logFile.write (',');
+  logFile.print (cycleLog.entryTime);
+  for (byte i = 0; i < PHASE_COUNT; i++)
+    {
+    logFile.write (',');
+    logFile.print (cycleLog.phaseTime [i]);
+    }
+  logFile.write (',');
+  logFile.print (cycleLog.verifyErrors);
+  logFile.write (',');
+  logFile.println (cycleLog.result);
+  logFile.sync ();   // once per line
+  }  // end of logResult
+
+// the board (or boards) are done
+void endCycle ()
+  {
+  endPhase ();
+
+#if GANG_PROGRAMMING
+  // a line for each board, those dropped along the way have their own result
+  const byte overall = cycleLog.result;
+  for (byte i = 0; i < GANG_SIZE; i++)
+    {
+    cycleLog.result = (gangActive & bit (i)) ? overall : targets [i].result;
+    memcpy (cycleLog.sig, targets [i].sig, sizeof cycleLog.sig);
+    memcpy (cycleLog.fusesBefore, targets [i].fusesBefore, sizeof cycleLog.fusesBefore);
+    memcpy (cycleLog.fusesAfter, targets [i].fuses, sizeof cycleLog.fusesAfter);
+    cycleLog.verifyErrors = targets [i].verifyErrors;
+    logResult (i);
+    }
+  cycleLog.result = overall;
+#else
+  logResult (0);
+#endif // GANG_PROGRAMMING
+  }  // end of endCycle
        
 // number of items in an array
 #define NUMITEMS(arg) ((unsigned int) (sizeof (arg) / sizeof (arg [0])))
@@ -435,6 +715,8 @@ enum {
     
     readProgramMemory = 0x20,  
     writeProgramMemory = 0x4C,
+    readEEPROMMemory = 0xA0,
+    writeEEPROMMemory = 0xC0,
     loadExtendedAddressByte = 0x4D,
     loadProgramMemory = 0x40,
     
@@ -542,33 +824,95 @@ void show7SegmentMessage (char * what)
 #endif //  CROSSROADS_PROGRAMMING_BOARD
 
 
+// the LED pattern being shown by blink / updateBlink
+int blinkLED1 = noLED;
+int blinkLED2 = noLED;
+byte blinkTimes;
+unsigned long blinkRepeat;
+unsigned long blinkInterval;
+byte blinkPhase;                // even = LEDs on, odd = LEDs off, blinkTimes * 2 = pause between repeats
+unsigned long blinkRepeatsDone;
+unsigned long blinkStepStart;   // when the current phase started
+unsigned long blinkStepLength;  // how long it lasts
+bool blinkActive;
+
+void setBlinkLEDs (const byte state)
+  {
+  digitalWrite (blinkLED1, state);
+  if (blinkLED2 != noLED)
+    digitalWrite (blinkLED2, state);
+  }  // end of setBlinkLEDs
+
 // blink one or two LEDs for "times" times, with a delay of "interval". Wait a second and do it again "repeat" times.
+//  This just starts the pattern, updateBlink does the rest in the background.
 void blink (const int whichLED1, 
             const int whichLED2, 
             const byte times = 1, 
             const unsigned long repeat = 1, 
             const unsigned long interval = 200)
   {
-  for (unsigned long i = 0; i < repeat; i++)
-    {
-    for (byte j = 0; j < times; j++)
-      {
-      digitalWrite (whichLED1, HIGH);
-      if (whichLED2 != noLED)
-        digitalWrite (whichLED2, HIGH);
-      delay (interval);
-      digitalWrite (whichLED1, LOW);
-      if (whichLED2 != noLED)
-        digitalWrite (whichLED2, LOW);
-      delay (interval);
-      }  // end of for loop
-    if (i < (repeat - 1))
-      delay (1000);
-    }  // end of repeating the sequence
+  blinkLED1 = whichLED1;
+  blinkLED2 = whichLED2;
+  blinkTimes = times;
+  blinkRepeat = repeat;
+  blinkInterval = interval;
+  blinkRepeatsDone = 0;
+  // start at the end of the pause, so the first update turns the LEDs on
+  blinkPhase = times * 2;
+  blinkStepStart = millis ();
+  blinkStepLength = 0;
+  blinkActive = times > 0 && repeat > 0;
   }  // end of blink
+
+// call often: moves the LED pattern along when it is time to
+void updateBlink ()
+  {
+  if (!blinkActive || millis () - blinkStepStart < blinkStepLength)
+    return;
+
+  blinkStepStart = millis ();
+  blinkStepLength = blinkInterval;
+
+  if (++blinkPhase == blinkTimes * 2)
+    {
+    // finished one sequence, pause before the next one (unless that was the last)
+    if (++blinkRepeatsDone >= blinkRepeat)
+      blinkActive = false;
+    blinkStepLength = 1000;
+    return;
+    }  // end of sequence
+
+  if (blinkPhase > blinkTimes * 2)
+    blinkPhase = 0;
+
+  setBlinkLEDs ((blinkPhase & 1) ? LOW : HIGH);
+  }  // end of updateBlink
+
+// stop the current pattern (eg. they want to program another chip)
+void cancelBlink ()
+  {
+  if (blinkActive)
+    setBlinkLEDs (LOW);
+  blinkActive = false;
+  }  // end of cancelBlink
+
+// show the whole pattern before going on
+void waitForBlink ()
+  {
+  while (blinkActive)
+    updateBlink ();
+  }  // end of waitForBlink
   
+// true while checking the file in the background (errors are not shown)
+bool checkingInBackground;
+
 void ShowMessage (const byte which)
   {
+  if (checkingInBackground)
+    return;
+
+  cycleLog.result = which;  // for the log
+
   // first turn off all LEDs
   digitalWrite (errorLED, LOW);
   digitalWrite (workingLED, LOW);
@@ -594,6 +938,10 @@ void ShowMessage (const byte which)
       
       // problems with the file contents
       case MSG_FILE_TOO_LARGE_FOR_FLASH:        show7SegmentMessage ("LG"); break;
+      case MSG_BAD_JOB_FILE:                    show7SegmentMessage ("Jb"); break;
+      case MSG_BAD_CATALOG:                     show7SegmentMessage ("CA"); break;
+      case MSG_CATALOG_MISMATCH:                show7SegmentMessage ("CC"); break;
+      case MSG_PAGES_OUT_OF_ORDER:              show7SegmentMessage ("PG"); break;
       
       // problems programming the chip
       case MSG_CANNOT_ENTER_PROGRAMMING_MODE:   show7SegmentMessage ("Ch"); break;
@@ -602,7 +950,9 @@ void ShowMessage (const byte which)
       case MSG_UNRECOGNIZED_SIGNATURE:          show7SegmentMessage ("Un"); break;
       case MSG_BAD_START_ADDRESS:               show7SegmentMessage ("Ad"); break;
       case MSG_VERIFICATION_ERROR:              show7SegmentMessage ("bd"); break;
+      case MSG_WRONG_CHIP:                      show7SegmentMessage ("dC"); break;
       case MSG_FLASHED_OK:                      show7SegmentMessage ("AA"); break;
+      case MSG_ALREADY_CURRENT:                 show7SegmentMessage ("CU"); break;
       
      default:                                   show7SegmentMessage ("--"); break;   // unknown error
      }  // end of switch on which message 
@@ -627,6 +977,10 @@ void ShowMessage (const byte which)
       
       // problems with the file contents
       case MSG_FILE_TOO_LARGE_FOR_FLASH:        blink (errorLED, workingLED, 9, 5); break;
+      case MSG_BAD_JOB_FILE:                    blink (errorLED, workingLED, 10, 5); break;
+      case MSG_BAD_CATALOG:                     blink (errorLED, workingLED, 11, 5); break;
+      case MSG_CATALOG_MISMATCH:                blink (errorLED, workingLED, 12, 5); break;
+      case MSG_PAGES_OUT_OF_ORDER:              blink (errorLED, workingLED, 13, 5); break;
       
       // problems programming the chip
       case MSG_CANNOT_ENTER_PROGRAMMING_MODE:  blink (errorLED, noLED, 3, 5); break;
@@ -635,9 +989,11 @@ void ShowMessage (const byte which)
       case MSG_UNRECOGNIZED_SIGNATURE:         blink (errorLED, noLED, 6, 5); break;
       case MSG_BAD_START_ADDRESS:              blink (errorLED, noLED, 7, 5); break;
       case MSG_VERIFICATION_ERROR:             blink (errorLED, noLED, 8, 5); break;
+      case MSG_WRONG_CHIP:                     blink (errorLED, noLED, 9, 5); break;
       case MSG_FLASHED_OK:                     blink (readyLED, noLED, 3, 10); break;
+      case MSG_ALREADY_CURRENT:                blink (readyLED, workingLED, 3, 10); break;
       
-     default:                                  blink (errorLED, 10, 10);  break;   // unknown error
+     default:                                  blink (errorLED, noLED, 10);  break;   // unknown error
      }  // end of switch on which message 
   }  // end of ShowMessage
   
@@ -656,7 +1012,12 @@ byte BB_SPITransfer (byte c)
     c <<= 1;
  
     // read MISO
+#if GANG_PROGRAMMING
+    misoSamples [bit] = BB_MISO_PORT;   // every board's MISO at once
+    c |= (misoSamples [bit] & bit (BB_MISO_BIT)) != 0;
+#else
     c |= (BB_MISO_PORT & bit (BB_MISO_BIT)) != 0;
+#endif // GANG_PROGRAMMING
  
    // clock high
     BB_SCK_PORT |= bit (BB_SCK_BIT);
@@ -674,12 +1035,71 @@ byte BB_SPITransfer (byte c)
   return c;
   }  // end of BB_SPITransfer 
 
+#if GANG_PROGRAMMING
+
+// the byte which board "which" sent back during the last transfer
+byte targetByte (const byte which)
+  {
+  byte b = 0;
+  for (byte i = 0; i < 8; i++)
+    b = (b << 1) | ((misoSamples [i] & bit (GANG_MISO_BITS [which])) != 0);
+  return b;
+  }  // end of targetByte
+
+// what happened to this board
+byte targetResult (const byte which)
+  {
+  return (gangActive & bit (which)) ? cycleLog.result : targets [which].result;
+  }  // end of targetResult
+
+// stop programming this board (let it run), and carry on with the rest
+void dropTarget (const byte which, const byte result)
+  {
+  if ((gangActive & bit (which)) == 0)
+    return;  // already dropped, keep the first reason
+  targets [which].result = result;
+  gangActive &= ~bit (which);
+
+  // turn off pull-up
+  digitalWrite (GANG_RESET_PINS [which], LOW);
+  pinMode (GANG_RESET_PINS [which], INPUT);
+
+  // the next one still going now leads
+  while (leadTarget < GANG_SIZE - 1 && (gangActive & bit (leadTarget)) == 0)
+    leadTarget++;
+  }  // end of dropTarget
+
+#endif // GANG_PROGRAMMING
+
+// drive /RESET on the target (on every board still being programmed, if gang programming)
+void setReset (const byte level)
+  {
+#if GANG_PROGRAMMING
+  for (byte i = 0; i < GANG_SIZE; i++)
+    if (gangActive & bit (i))
+      {
+      digitalWrite (GANG_RESET_PINS [i], level);
+      pinMode (GANG_RESET_PINS [i], OUTPUT);
+      }
+#else
+  digitalWrite (RESET, level);
+  pinMode (RESET, OUTPUT);
+#endif // GANG_PROGRAMMING
+  }  // end of setReset
+
 
 // if signature found in above table, this is its index
 int foundSig = -1;
 byte lastAddressMSB = 0;
-// copy of current signature entry for matching processor
-signatureType currentSignature;
+
+#if TARGET_DEVICE != ANY_DEVICE
+  // currentSignature is a constant (see Signatures.h)
+  const bool extendedAddressing = currentSignature.flashSize > 128 * kb;
+#else
+  // copy of current signature entry for matching processor
+  signatureType currentSignature;
+  const bool extendedAddressing = true;
+#endif // TARGET_DEVICE != ANY_DEVICE
 
 // execute one programming instruction ... b1 is command, b2, b3, b4 are arguments
 //  processor may return a result on the 4th transfer, this is returned.
@@ -691,33 +1111,60 @@ byte program (const byte b1, const byte b2 = 0, const byte b3 = 0, const byte b4
   BB_SPITransfer (b3);  
   byte b = BB_SPITransfer (b4);  
   interrupts ();
+#if GANG_PROGRAMMING
+  if (leadTarget != 0)
+    b = targetByte (leadTarget);
+#endif // GANG_PROGRAMMING
   return b;
   } // end of program
   
-// read a byte from flash memory
-byte readFlash (unsigned long addr)
+// set the extended (most significant) address byte if necessary, for this word address
+void setExtendedAddress (const unsigned long addr)
   {
-  byte high = (addr & 1) ? 0x08 : 0;  // set if high byte wanted
-  addr >>= 1;  // turn into word address
-
-  // set the extended (most significant) address byte if necessary
   byte MSB = (addr >> 16) & 0xFF;
-  if (MSB != lastAddressMSB)
+  if (extendedAddressing && MSB != lastAddressMSB)
     {
     program (loadExtendedAddressByte, 0, MSB); 
     lastAddressMSB = MSB;
     }  // end if different MSB
+  }  // end of setExtendedAddress
 
+// read a byte from flash memory: the word address within the 64K words chosen by
+//  setExtendedAddress, and high is 0x08 if the high byte of the word is wanted
+byte readFlash (const unsigned int addr, const byte high)
+  {
   return program (readProgramMemory | high, highByte (addr), lowByte (addr));
   } // end of readFlash
   
 // write a byte to the flash memory buffer (ready for committing)
-void writeFlash (unsigned long addr, const byte data)
+//  only the low bits of the address (the place in the page) are needed
+void writeFlash (unsigned int addr, const byte data)
   {
   byte high = (addr & 1) ? 0x08 : 0;  // set if high byte wanted
   addr >>= 1;  // turn into word address
   program (loadProgramMemory | high, 0, lowByte (addr), data);
   } // end of writeFlash  
+
+// read a byte from the EEPROM
+byte readEEPROM (const unsigned int addr)
+  {
+  return program (readEEPROMMemory, highByte (addr), lowByte (addr));
+  } // end of readEEPROM
+
+// read a fuse (or the lock byte, or the clock calibration byte)
+byte readFuse (const byte which)
+  {
+  switch (which)
+    {
+    case lowFuse:         return program (readLowFuseByte, readLowFuseByteArg2);
+    case highFuse:        return program (readHighFuseByte, readHighFuseByteArg2);
+    case extFuse:         return program (readExtendedFuseByte, readExtendedFuseByteArg2);
+    case lockByte:        return program (readLockByte, readLockByteArg2);
+    case calibrationByte: return program (readCalibrationByte);
+    }  // end of switch
+
+   return 0;
+  }  // end of readFuse
       
    
 // convert two hex characters into a byte
@@ -754,13 +1201,31 @@ void pollUntilReady ()
     delay (10);  // at least 2 x WD_FLASH which is 4.5 mS
   else
     {  
+#if GANG_PROGRAMMING
+    // wait till they are all ready
+    bool busy = true;
+    while (busy)
+      {
+      program (pollReady);
+      busy = false;
+      for (byte i = 0; i < GANG_SIZE; i++)
+        if ((gangActive & bit (i)) && (targetByte (i) & 1) == 1)
+          busy = true;
+      }  // end of while any busy
+#else
     while ((program (pollReady) & 1) == 1)
       {}  // wait till ready  
+#endif // GANG_PROGRAMMING
     }  // end of if
   }  // end of pollUntilReady
 
-unsigned long pagesize;
-unsigned long pagemask;
+#if TARGET_DEVICE != ANY_DEVICE
+  const unsigned long pagesize = currentSignature.pageSize;
+  const unsigned long pagemask = ~(pagesize - 1);
+#else
+  unsigned long pagesize;
+  unsigned long pagemask;
+#endif // TARGET_DEVICE != ANY_DEVICE
 unsigned long oldPage;
 unsigned int progressBarCount;
 
@@ -782,14 +1247,7 @@ void clearPage ()
 void commitPage (unsigned long addr)
   {
   addr >>= 1;  // turn into word address
-  
-  // set the extended (most significant) address byte if necessary
-  byte MSB = (addr >> 16) & 0xFF;
-  if (MSB != lastAddressMSB)
-    {
-    program (loadExtendedAddressByte, 0, MSB); 
-    lastAddressMSB = MSB;
-    }  // end if different MSB
+  setExtendedAddress (addr);
     
   showProgress ();
   
@@ -800,46 +1258,168 @@ void commitPage (unsigned long addr)
   }  // end of commitPage
  
 // write data to temporary buffer, ready for committing  
+//  the page is worked out once, then the bytes left in it are counted down, so each
+//  byte costs only 16-bit arithmetic
 void writeData (const unsigned long addr, const byte * pData, const int length)
   {
+  if (length <= 0)
+    return;
+
+  // page changed? commit old one
+  const unsigned long thisPage = addr & pagemask;
+  if (thisPage != oldPage && oldPage != NO_PAGE)
+    commitPage (oldPage);
+  // now this is the current page
+  oldPage = thisPage;
+
+  unsigned int left = pagesize - (addr - thisPage);  // bytes to the end of the page
+  unsigned int offset = addr;                        // the page buffer only needs the low bits
+
   // write each byte
   for (int i = 0; i < length; i++)
     {
-    unsigned long thisPage = (addr + i) & pagemask;
-    // page changed? commit old one
-    if (thisPage != oldPage && oldPage != NO_PAGE)
+    // run into the next page? commit this one
+    if (left == 0)
+      {
       commitPage (oldPage);
-    // now this is the current page
-    oldPage = thisPage;
+      oldPage += pagesize;
+      left = pagesize;
+      }
+    left--;
     // put byte into work buffer
-    writeFlash (addr + i, pData [i]);
+    writeFlash (offset++, pData [i]);
     }  // end of for
     
   }  // end of writeData
   
+// write data to the EEPROM (a byte at a time)
+void writeEEPROMData (const unsigned long addr, const byte * pData, const int length)
+  {
+  for (int i = 0; i < length; i++)
+    {
+    program (writeEEPROMMemory, highByte (addr + i), lowByte (addr + i), pData [i]);
+    pollUntilReady ();
+    }  // end of for
+  showProgress ();
+  }  // end of writeEEPROMData
+
 // count errors
 unsigned int errors;
   
-void verifyData (const unsigned long addr, const byte * pData, const int length)
+void verifyData (const unsigned long addr, const byte * pData, const int length, const byte action)
   {
+  // already found a difference? no point in reading any more
+  if ((action == compareFlash && errors) || length <= 0)
+    return;
+
+  // page changed? show progress
+  const unsigned long thisPage = addr & pagemask;
+  if (thisPage != oldPage && oldPage != NO_PAGE)
+    showProgress ();
+  // now this is the current page
+  oldPage = thisPage;
+
+  // as in writeData, from here on each byte only needs 16-bit arithmetic
+  unsigned int left = pagesize - (addr - thisPage);  // bytes to the end of the page
+  unsigned int eepromAddr = addr;
+  unsigned int wordAddr = addr >> 1;
+  byte high = (addr & 1) ? 0x08 : 0;  // set if high byte wanted
+  if (action != verifyEEPROM)
+    setExtendedAddress (addr >> 1);
+
   // check each byte
   for (int i = 0; i < length; i++)
     {
-    unsigned long thisPage = (addr + i) & pagemask;
-    // page changed? show progress
-    if (thisPage != oldPage && oldPage != NO_PAGE)
+    // into the next page? show progress
+    if (left == 0)
+      {
       showProgress ();
-    // now this is the current page
-    oldPage = thisPage;
-      
-    byte found = readFlash (addr + i);
+      oldPage += pagesize;
+      left = pagesize;
+      }
+    left--;
+
+    byte found;
+    if (action == verifyEEPROM)
+      found = readEEPROM (eepromAddr++);
+    else
+      {
+      found = readFlash (wordAddr, high);
+      // next byte, the extended address byte changes every 64K words
+      if (high && (++wordAddr & 0xFFFF) == 0)
+        setExtendedAddress ((addr + i + 1) >> 1);
+      high ^= 0x08;
+      }
     byte expected = pData [i];
-    if (found != expected)
+    bool differs = found != expected;
+#if GANG_PROGRAMMING
+    // check every board, those with errors are dropped at the end of the pass
+    differs = false;
+    for (byte j = 0; j < GANG_SIZE; j++)
+      if ((gangActive & bit (j)) && targetByte (j) != expected)
+        {
+        if (action != compareFlash)
+          targets [j].verifyErrors++;
+        differs = true;
+        }
+#endif // GANG_PROGRAMMING
+    if (differs)
+      {
       errors++;
+      if (action == compareFlash)
+        return;  // one difference is enough
+      }
     }  // end of for
     
   }  // end of verifyData
   
+/*
+Pages out of order.
+
+Each flash page is committed when the file moves on to another page. If a file left a
+page and later came back to it (eg. a sketch and bootloader combined by hand) that page
+would be committed twice, without an erase in between. Atmega_Hex_Uploader assembles
+such pages from extra passes through the file, but that needs a check pass, which is
+skipped here for a catalogued file or one checked in the background (before the page
+size is known). So such a file is rejected instead: by the check pass, before the chip
+is touched, if there is one, otherwise by the write pass, before the page is committed
+the second time.
+*/
+
+const unsigned int MAX_PAGES = 1024;          // 256 Kb of flash in 256 byte pages
+
+byte pagesSeen [MAX_PAGES / 8];               // one bit per page the file has been in
+unsigned long lastRecordPage;                 // page of the previous byte in the file
+
+// returns true if the data goes back into a page which the file has already left
+bool pageRevisited (const unsigned long addr, const int length)
+  {
+  if (length <= 0)
+    return false;
+
+  // each page the data is in, in turn
+  const unsigned long lastPage = (addr + length - 1) & pagemask;
+  for (unsigned long thisPage = addr & pagemask; thisPage <= lastPage; thisPage += pagesize)
+    {
+    if (thisPage == lastRecordPage)
+      continue;
+    lastRecordPage = thisPage;
+
+    unsigned long pageNumber = thisPage / pagesize;
+    if (pageNumber >= MAX_PAGES)
+      continue;  // won't fit into flash anyway, chooseInputFile will reject it
+
+    if (pagesSeen [pageNumber / 8] & bit (pageNumber % 8))
+      {
+      ShowMessage (MSG_PAGES_OUT_OF_ORDER);
+      return true;
+      }
+    pagesSeen [pageNumber / 8] |= bit (pageNumber % 8);
+    }  // end of for each page
+
+  return false;
+  }  // end of pageRevisited
+
 bool gotEndOfFile;
 unsigned long extendedAddress;
 
@@ -847,6 +1427,7 @@ unsigned long lowestAddress;
 unsigned long highestAddress;
 unsigned long bytesWritten;
 unsigned int lineCount;
+unsigned int fileCRC;   // CRC-CCITT of the data bytes, found each time the file is read
 
 /*
 Line format:
@@ -887,7 +1468,7 @@ bool processLine (const char * pLine, const byte action)
   byte hexBuffer [maxHexData];
   int bytesInLine = 0;
   
-  if (action == checkFile)
+  if ((action == checkFile || action == checkEEPROM) && !checkingInBackground)
     if (lineCount++ % 40 == 0)
       showProgress ();
     
@@ -951,21 +1532,38 @@ bool processLine (const char * pLine, const byte action)
     // stuff to be written to memory
     case hexDataRecord:
       lowestAddress  = min (lowestAddress, addr + extendedAddress);
-      highestAddress = max (lowestAddress, addr + extendedAddress + len - 1);
+      highestAddress = max (highestAddress, addr + extendedAddress + len - 1);
       bytesWritten += len;
+      for (byte i = 0; i < len; i++)
+        fileCRC = _crc_ccitt_update (fileCRC, hexBuffer [4 + i]);
     
       switch (action)
         {
         case checkFile:  // nothing much to do, we do the checks anyway
+          // (except the page order, which can't be checked before we know the chip)
+          if (!checkingInBackground && pageRevisited (addr + extendedAddress, len))
+            return true;
+          break;
+
+        case checkEEPROM:
           break;
           
         case verifyFlash:
-          verifyData (addr + extendedAddress, &hexBuffer [4], len);
+        case verifyEEPROM:
+        case compareFlash:
+          verifyData (addr + extendedAddress, &hexBuffer [4], len, action);
           break;
         
         case writeToFlash:
+          // a file which wasn't checked here (see pageRevisited) is stopped before a page is committed twice
+          if (pageRevisited (addr + extendedAddress, len))
+            return true;
           writeData (addr + extendedAddress, &hexBuffer [4], len);
           break;      
+
+        case writeToEEPROM:
+          writeEEPROMData (addr + extendedAddress, &hexBuffer [4], len);
+          break;
         } // end of switch on action
       break;
   
@@ -993,6 +1591,23 @@ bool processLine (const char * pLine, const byte action)
   return false;
   } // end of processLine
   
+// a catalogued file is not checked before writing, so once all of it has been read
+//  make sure it is the file the catalog describes
+//  returns true if error, false if OK
+bool catalogMismatch (const char * fName)
+  {
+  if (!catalogued (fName))
+    return false;
+
+  cycleLog.crc = fileCRC;
+  if (fileCRC != catalogEntry.crc)
+    {
+    ShowMessage (MSG_CATALOG_MISMATCH);
+    return true;
+    }
+  return false;
+  }  // end of catalogMismatch
+
 //------------------------------------------------------------------------------
 // returns true if error, false if OK
 bool readHexFile (const char * fName, const byte action)
@@ -1009,9 +1624,14 @@ bool readHexFile (const char * fName, const byte action)
   bytesWritten = 0;
   progressBarCount = 0;
 
+#if TARGET_DEVICE == ANY_DEVICE
   pagesize = currentSignature.pageSize;
   pagemask = ~(pagesize - 1);
+#endif // TARGET_DEVICE == ANY_DEVICE
   oldPage = NO_PAGE;
+  fileCRC = 0xFFFF;
+  memset (pagesSeen, 0, sizeof pagesSeen);
+  lastRecordPage = NO_PAGE;
 
   // check for open error
   if (!sdin.is_open()) 
@@ -1023,9 +1643,11 @@ bool readHexFile (const char * fName, const byte action)
   switch (action)
     {
     case checkFile:
-      break;
-      
+    case checkEEPROM:
     case verifyFlash:
+    case verifyEEPROM:
+    case compareFlash:
+    case writeToEEPROM:
       break;
     
     case writeToFlash:
@@ -1033,6 +1655,7 @@ bool readHexFile (const char * fName, const byte action)
       delay (20);  // for Atmega8
       pollUntilReady (); 
       clearPage();  // clear temporary page
+      fuses [lockByte] = readFuse (lockByte);  // erasing clears the lock bits
       break;      
     } // end of switch
  
@@ -1054,6 +1677,10 @@ bool readHexFile (const char * fName, const byte action)
         return true;  // error
         }
       }
+
+    // one difference is all we need to know about
+    if (action == compareFlash && errors)
+      return false;
     }    // end of while each line
     
   if (!gotEndOfFile)
@@ -1068,17 +1695,40 @@ bool readHexFile (const char * fName, const byte action)
       // commit final page
       if (oldPage != NO_PAGE)
         commitPage (oldPage);
+      if (catalogMismatch (fName))
+        return true;
       break;
       
     case verifyFlash:
+    case verifyEEPROM:
+       cycleLog.verifyErrors += errors;
+#if GANG_PROGRAMMING
+       // drop the boards which failed, carry on with the rest
+       for (byte i = 0; i < GANG_SIZE; i++)
+         if (targets [i].verifyErrors)
+           dropTarget (i, MSG_VERIFICATION_ERROR);
+       if (gangActive)
+         errors = 0;
+#endif // GANG_PROGRAMMING
        if (errors > 0)
           {
           ShowMessage (MSG_VERIFICATION_ERROR);
           return true;
           }  // end if
        break;
-        
+
     case checkFile:
+    case checkEEPROM:
+      cycleLog.crc = fileCRC;
+      break;
+        
+    case compareFlash:
+      // already matches the chip, but it must still be the file in the catalog
+      if (errors == 0 && catalogMismatch (fName))
+        return true;
+      break;
+
+    case writeToEEPROM:
       break;
     }  // end of switch
   
@@ -1086,50 +1736,149 @@ bool readHexFile (const char * fName, const byte action)
 }  // end of readHexFile
 
 
+// send Programming Enable, returns true if the target echoed it back (ie. we are in sync)
+bool programEnable ()
+  {
+  noInterrupts ();
+  BB_SPITransfer (progamEnable);  
+  BB_SPITransfer (programAcknowledge);  
+  byte confirm = BB_SPITransfer (0);  
+#if GANG_PROGRAMMING
+  gangAcked = 0;
+  for (byte i = 0; i < GANG_SIZE; i++)
+    if (targetByte (i) == programAcknowledge)
+      gangAcked |= bit (i);
+#endif // GANG_PROGRAMMING
+  BB_SPITransfer (0);  
+  interrupts ();
+#if GANG_PROGRAMMING
+  return (gangAcked & gangActive) == gangActive;
+#else
+  return confirm == programAcknowledge;
+#endif // GANG_PROGRAMMING
+  }  // end of programEnable
+
+// one positive pulse on SCK, to shift the target's idea of where a byte starts
+void pulseSCK ()
+  {
+  digitalWrite (MSPIM_SCK, HIGH);
+  delayMicroseconds (BB_DELAY_MICROSECONDS);
+  digitalWrite (MSPIM_SCK, LOW);
+  delayMicroseconds (BB_DELAY_MICROSECONDS);
+  }  // end of pulseSCK
+
+// how many times to pulse SCK and try again, before resetting the target again
+const byte SYNC_ATTEMPTS = 4;
+// pause before resetting the target again, doubled after each failure up to the maximum
+const unsigned long FIRST_RETRY_DELAY = 8;   // mS
+const unsigned long MAX_RETRY_DELAY = 128;   // mS
+
+// how long the last successful startProgramming took (mS)
+unsigned long programmingEntryTime;
+
 // returns true if managed to enter programming mode
 bool startProgramming ()
   {
     
-  byte confirm;
-  pinMode (RESET, OUTPUT);
+  const unsigned long startTime = millis ();
+  setReset (LOW);
   digitalWrite (MSPIM_SCK, LOW);
   pinMode (MSPIM_SCK, OUTPUT);
   pinMode (BB_MOSI, OUTPUT);
   unsigned int timeout = 0;
+  unsigned long retryDelay = FIRST_RETRY_DELAY;
   
-  // we are in sync if we get back programAcknowledge on the third byte
-  do 
+  while (true)
     {
-    // regrouping pause
-    delay (100);
-
     // ensure SCK low
     noInterrupts ();
     digitalWrite (MSPIM_SCK, LOW);
     // then pulse reset, see page 309 of datasheet
-    digitalWrite (RESET, HIGH);
+    setReset (HIGH);
     delayMicroseconds (10);  // pulse for at least 2 clock cycles
-    digitalWrite (RESET, LOW);
+    setReset (LOW);
     interrupts ();
 
-    delay (25);  // wait at least 20 mS
-    noInterrupts ();
-    BB_SPITransfer (progamEnable);  
-    BB_SPITransfer (programAcknowledge);  
-    confirm = BB_SPITransfer (0);  
-    BB_SPITransfer (0);  
-    interrupts ();
+    delay (20);  // wait at least 20 mS
+
+    // we are in sync if we get back programAcknowledge on the third byte,
+    //  if not, a pulse on SCK may get us into sync without another reset
+    for (byte i = 0; i < SYNC_ATTEMPTS; i++)
+      {
+      if (programEnable ())
+        {
+        programmingEntryTime = millis () - startTime;
+        return true;  // entered programming mode OK
+        }
+#if GANG_PROGRAMMING
+      // SCK is shared, so a pulse would put the boards which did answer out of sync:
+      //  once any has answered, the rest get another reset instead
+      if (gangAcked & gangActive)
+        break;
+#endif // GANG_PROGRAMMING
+      pulseSCK ();
+      }  // end of for each sync attempt
     
-    if (confirm != programAcknowledge)
+    if (timeout++ >= ENTER_PROGRAMMING_ATTEMPTS)
       {
-      if (timeout++ >= ENTER_PROGRAMMING_ATTEMPTS)
+#if GANG_PROGRAMMING
+      // carry on with the boards which do answer (if any), after one more reset
+      setReset (HIGH);
+      delayMicroseconds (10);
+      setReset (LOW);
+      delay (20);
+      if (!programEnable () && (gangAcked & gangActive) == 0)
         return false;
-      }  // end of not entered programming mode
-    
-    } while (confirm != programAcknowledge);
-  return true;  // entered programming mode OK
+      for (byte i = 0; i < GANG_SIZE; i++)
+        if ((gangAcked & bit (i)) == 0)
+          dropTarget (i, MSG_CANNOT_ENTER_PROGRAMMING_MODE);
+      programmingEntryTime = millis () - startTime;
+      return true;
+#else
+      return false;
+#endif // GANG_PROGRAMMING
+      }
+
+    // give it longer each time before trying again
+    delay (retryDelay);
+    retryDelay = min (retryDelay * 2, MAX_RETRY_DELAY);
+    }  // end of while not in programming mode
+
   }  // end of startProgramming
 
+// autoStart: these are checked every PROBE_INTERVAL while idle
+bool boardFitted;              // the last board is still there (so wait for it to be removed)
+byte probeCount;               // checks in a row which disagree with boardFitted
+unsigned long lastProbeTime;
+
+// autoStart: see if a board is plugged in, by sensing its power (the board is not touched)
+bool targetPresent ()
+  {
+  return analogRead (targetSensePin) > TARGET_SENSE_THRESHOLD;
+  }  // end of targetPresent
+
+// autoStart: returns true once a new board has been plugged in
+bool boardInserted ()
+  {
+  if (millis () - lastProbeTime < PROBE_INTERVAL)
+    return false;
+  lastProbeTime = millis ();
+
+  if (targetPresent () == boardFitted)
+    {
+    probeCount = 0;
+    return false;
+    }
+
+  // it might be half-way in (or out), so make sure
+  if (++probeCount < PROBES_TO_CHANGE)
+    return false;
+
+  probeCount = 0;
+  boardFitted = !boardFitted;
+  return boardFitted;
+  }  // end of boardInserted
+
 void stopProgramming ()
   {
   // turn off pull-ups
@@ -1143,6 +1892,14 @@ void stopProgramming ()
   pinMode (MSPIM_SCK, INPUT);
   pinMode (BB_MOSI, INPUT);
   pinMode (BB_MISO, INPUT);
+
+#if GANG_PROGRAMMING
+  for (byte i = 0; i < GANG_SIZE; i++)
+    {
+    digitalWrite (GANG_RESET_PINS [i], LOW);
+    pinMode (GANG_RESET_PINS [i], INPUT);
+    }
+#endif // GANG_PROGRAMMING
     
   } // end of stopProgramming
   
@@ -1155,31 +1912,46 @@ void getSignature ()
   for (byte i = 0; i < 3; i++)
     {
     sig [i] = program (readSignatureByte, 0, i); 
+#if GANG_PROGRAMMING
+    for (byte j = 0; j < GANG_SIZE; j++)
+      targets [j].sig [i] = targetByte (j);
+#endif // GANG_PROGRAMMING
     }  // end for each signature byte
+  memcpy (cycleLog.sig, sig, sizeof sig);
+
+#if GANG_PROGRAMMING
+  // they should all be the same chip as the lead one
+  for (byte j = 0; j < GANG_SIZE; j++)
+    if (memcmp (targets [j].sig, sig, sizeof sig) != 0)
+      dropTarget (j, MSG_WRONG_CHIP);
+#endif // GANG_PROGRAMMING
   
-  for (unsigned int j = 0; j < NUMITEMS (signatures); j++)
+  foundSig = findSignature (sig);
+  if (foundSig != -1)
     {
-    memcpy_P (&currentSignature, &signatures [j], sizeof currentSignature);
-    
-    if (memcmp (sig, currentSignature.sig, sizeof sig) == 0)
-      {
-      foundSig = j;
-      // make sure extended address is zero to match lastAddressMSB variable
-      program (loadExtendedAddressByte, 0, 0); 
-      return;
-      }  // end of signature found
-    }  // end of for each signature
+#if TARGET_DEVICE == ANY_DEVICE
+    memcpy_P (&currentSignature, &signatures [foundSig], sizeof currentSignature);
+#endif // TARGET_DEVICE == ANY_DEVICE
+    // make sure extended address is zero to match lastAddressMSB variable
+    program (loadExtendedAddressByte, 0, 0); 
+    return;
+    }  // end of signature found
 
   ShowMessage (MSG_UNRECOGNIZED_SIGNATURE);
   }  // end of getSignature
   
 void getFuseBytes ()
   {
-  fuses [lowFuse]   = program (readLowFuseByte, readLowFuseByteArg2);
-  fuses [highFuse]  = program (readHighFuseByte, readHighFuseByteArg2);
-  fuses [extFuse]   = program (readExtendedFuseByte, readExtendedFuseByteArg2);
-  fuses [lockByte]  = program (readLockByte, readLockByteArg2);
-  fuses [calibrationByte]  = program (readCalibrationByte);
+  for (byte i = lowFuse; i <= calibrationByte; i++)
+    {
+    fuses [i] = readFuse (i);
+#if GANG_PROGRAMMING
+    if (i <= lockByte)
+      for (byte j = 0; j < GANG_SIZE; j++)
+        if (gangActive & bit (j))
+          targets [j].fuses [i] = targetByte (j);
+#endif // GANG_PROGRAMMING
+    }
   }  // end of getFuseBytes
 
   
@@ -1193,8 +1965,40 @@ void writeFuse (const byte newValue, const byte instruction)
   pollUntilReady (); 
   }  // end of writeFuse
   
-// returns true if error, false if OK
-bool updateFuses (const bool writeIt)
+// write the fuses in the plan which differ from fuses [] (lock byte last), then read
+//  them back once
+//  returns true if any did not take, false if OK
+bool writeFusePlan (const fusePlanType & plan)
+  {
+  // (when gang programming the boards may differ, so write them all)
+  for (byte i = lowFuse; i <= lockByte; i++)
+    if ((plan.mask & bit (i)) && (GANG_PROGRAMMING || plan.fuses [i] != fuses [i]))
+      writeFuse (plan.fuses [i], fuseCommands [i]);
+
+  bool bad = false;
+  for (byte i = lowFuse; i <= lockByte; i++)
+    {
+    if ((plan.mask & bit (i)) == 0)
+      continue;
+    fuses [i] = readFuse (i);
+#if GANG_PROGRAMMING
+    // drop the boards where it didn't take
+    for (byte j = 0; j < GANG_SIZE; j++)
+      if ((gangActive & bit (j)) && targetByte (j) != plan.fuses [i])
+        dropTarget (j, MSG_VERIFICATION_ERROR);
+    bad = gangActive == 0;
+#else
+    if (fuses [i] != plan.fuses [i])
+      bad = true;
+#endif // GANG_PROGRAMMING
+    }  // end of for each fuse
+
+  return bad;
+  }  // end of writeFusePlan
+
+// work out the bootloader fuse from where the file starts, and add it to the plan
+//  returns true if error, false if OK
+bool planBootFuse (fusePlanType & plan)
   {
   unsigned long addr;
   unsigned int  len;
@@ -1210,11 +2014,13 @@ bool updateFuses (const bool writeIt)
     
   addr = currentSignature.flashSize;
   len = currentSignature.baseBootSize;
+
+  byte newFuse = fuses [fusenumber];
     
   if (lowestAddress == 0)
     {
     // don't use bootloader  
-    fuses [fusenumber] |= 1;
+    newFuse |= 1;
     }
   else 
     {
@@ -1237,21 +2043,306 @@ bool updateFuses (const bool writeIt)
     if (newval != 0xFF)
       {
       newval <<= 1; 
-      fuses [fusenumber] &= ~0x07;   // also program (clear) "boot into bootloader" bit 
-      fuses [fusenumber] |= newval;  
+      newFuse &= ~0x07;   // also program (clear) "boot into bootloader" bit 
+      newFuse |= newval;  
       }  // if valid
       
     }  // if not address 0
   
-  if (writeIt)
-    {
-    writeFuse (fuses [fusenumber], fuseCommands [fusenumber]);      
-    }
-    
+  plan.fuses [fusenumber] = newFuse;
+  plan.mask |= bit (fusenumber);
   return false;
-  }  // end of updateFuses
-  
-//------------------------------------------------------------------------------
+  }  // end of planBootFuse
+
+// returns true if error, false if OK
+bool updateFuses (const bool writeIt)
+  {
+  fusePlanType plan;
+  plan.mask = 0;
+
+  // start with the catalog's fuses, its bootloader fuse (if given) is used as is
+  if (catalogued (name))
+    plan = catalogEntry.plan;
+  byte fusenumber = currentSignature.fuseWithBootloaderSize;
+
+  if ((fusenumber == NO_FUSE || (plan.mask & bit (fusenumber)) == 0) && planBootFuse (plan))
+    return true;
+
+  if (writeIt && writeFusePlan (plan))
+    {
+    ShowMessage (MSG_VERIFICATION_ERROR);
+    return true;
+    }
+
+  return false;
+  }  // end of updateFuses
+  
+/*
+Job files.
+
+A job file (JOB.TXT) lists everything needed to program a board, so it is all done
+in the one go, in the right order. For example:
+
+  # production job for the widget board
+  signature = 1E 95 0F
+  flash     = firmware.hex
+  eeprom    = settings.eep
+  lfuse     = FF
+  hfuse     = DE
+  efuse     = FD
+  lock      = CF
+
+Everything is optional. The flash is erased and written, then the EEPROM, then both
+are verified. After that the fuses are written, with the lock byte last, and read back.
+If the job has no fuse for the bootloader size, it is worked out from the flash file.
+*/
+
+typedef struct {
+  char flash [MAX_FILENAME];    // .HEX file for the flash
+  char eeprom [MAX_FILENAME];   // .EEP file for the EEPROM
+  byte sig [3];                 // signature of the chip it is for
+  bool haveSig;
+  fusePlanType plan;            // fuses and lock byte
+} jobType;
+
+jobType job;
+
+// convert "count" bytes of hex (eg. "1E950F") with nothing left over
+//  returns true if error, false if OK
+bool jobHex (const char * pValue, byte * pData, const byte count)
+  {
+  if (strlen (pValue) != count * 2)
+    return true;
+  for (byte i = 0; i < count * 2; i++)
+    if (!isxdigit (pValue [i]))
+      return true;
+  for (byte i = 0; i < count; i++)
+    hexConv (pValue, pData [i]);
+  return false;
+  }  // end of jobHex
+
+// one line of a job file (with spaces and comments removed, forced to upper case)
+//  returns true if error, false if OK
+bool processJobLine (char * pLine)
+  {
+  char * pValue = strchr (pLine, '=');
+  if (pValue == NULL)
+    return true;
+  *pValue++ = 0;
+
+  if (strcmp (pLine, "FLASH") == 0 || strcmp (pLine, "EEPROM") == 0)
+    {
+    if (strlen (pValue) >= MAX_FILENAME)
+      return true;
+    strcpy (pLine [0] == 'F' ? job.flash : job.eeprom, pValue);
+    return false;
+    }  // end of file name
+
+  if (strcmp (pLine, "SIGNATURE") == 0)
+    {
+    job.haveSig = true;
+    return jobHex (pValue, job.sig, sizeof job.sig);
+    }  // end of signature
+
+  byte fusenumber;
+  if (strcmp (pLine, "LFUSE") == 0)
+    fusenumber = lowFuse;
+  else if (strcmp (pLine, "HFUSE") == 0)
+    fusenumber = highFuse;
+  else if (strcmp (pLine, "EFUSE") == 0)
+    fusenumber = extFuse;
+  else if (strcmp (pLine, "LOCK") == 0)
+    fusenumber = lockByte;
+  else
+    return true;
+
+  job.plan.mask |= bit (fusenumber);
+  return jobHex (pValue, &job.plan.fuses [fusenumber], 1);
+  }  // end of processJobLine
+
+// read a job file into "job"
+//  returns true if error, false if OK
+bool readJobFile (const char * fName)
+  {
+  const int maxLine = 80;
+  char buffer[maxLine];
+  ifstream sdin (fName);
+
+  memset (&job, 0, sizeof job);
+
+  // check for open error
+  if (!sdin.is_open()) 
+    {
+    ShowMessage (MSG_CANNOT_OPEN_FILE);
+    return true;
+    }
+
+  while (sdin.getline (buffer, maxLine))
+    {
+    if (sdin.fail()) 
+      {
+      ShowMessage (MSG_LINE_TOO_LONG);
+      return true;
+      }  // end of fail (line too long?)
+
+    // drop spaces and comments, and force to upper case
+    char * pOut = buffer;
+    for (const char * pIn = buffer; *pIn && *pIn != '#'; pIn++)
+      if (!isspace (*pIn))
+        *pOut++ = toupper (*pIn);
+    *pOut = 0;
+
+    // ignore empty lines
+    if (buffer [0] && processJobLine (buffer))
+      {
+      ShowMessage (MSG_BAD_JOB_FILE);
+      return true;
+      }
+    }    // end of while each line
+
+  return false;
+  }  // end of readJobFile
+
+/*
+Catalog.
+
+The catalog (CATALOG.TXT) has a line for each .HEX file, giving the chip it is for,
+the fuses it needs, and the CRC and address range of its contents. For example:
+
+  # file       signature  lfuse hfuse efuse lock  crc   start  end    description
+  CODE00.HEX   1E950F     FF    DE    FD    CF    3A7C  0000   7FFF   widget v1.2
+  CODE01.HEX   1E950F     -     -     -     -     91B2  7E00   7FFF   bootloader only
+
+A "-" means the fuse is left alone (the bootloader fuse is then worked out from the
+start address). The crc is the "crc" column of PROGLOG.CSV, start and end are the lowest
+and highest addresses written. A catalogued file is not checked before writing (it
+is still verified afterwards) and a chip with a different signature is rejected at once.
+The CRC is worked out as the file is written, and if it differs the board fails, so a
+catalog which is out of date doesn't go unnoticed.
+
+The catalog is checked when we start, the entry for the selected file is looked up
+while waiting for the switch. If the catalog can't be understood nothing is programmed
+(it might be what stops a file going onto the wrong chip) until it is fixed or removed.
+*/
+
+// one line of the catalog, after the file name (already taken with strtok)
+//  returns true if error, false if OK
+bool parseCatalogLine (catalogEntryType & entry)
+  {
+  const char * pSig = strtok (NULL, " \t\r");
+  if (pSig == NULL || jobHex (pSig, entry.sig, sizeof entry.sig))
+    return true;
+
+  entry.plan.mask = 0;
+  for (byte i = lowFuse; i <= lockByte; i++)
+    {
+    const char * pFuse = strtok (NULL, " \t\r");
+    if (pFuse == NULL)
+      return true;
+    if (strcmp (pFuse, "-") == 0)
+      continue;  // leave this one alone
+    if (jobHex (pFuse, &entry.plan.fuses [i], 1))
+      return true;
+    entry.plan.mask |= bit (i);
+    }  // end of for each fuse
+
+  // don't allow RSTDISBL/DWEN, or disabling SPIEN, we couldn't program it again
+  if ((entry.plan.mask & bit (highFuse)) && unsafeHighFuse (entry.sig, entry.plan.fuses [highFuse]))
+    return true;
+
+  byte crc [2];
+  const char * pCRC = strtok (NULL, " \t\r");
+  if (pCRC == NULL || jobHex (pCRC, crc, sizeof crc))
+    return true;
+  entry.crc = ((unsigned int) crc [0] << 8) | crc [1];
+
+  // start and end addresses
+  unsigned long * pAddress [2] = { &entry.lowestAddress, &entry.highestAddress };
+  for (byte i = 0; i < 2; i++)
+    {
+    const char * pValue = strtok (NULL, " \t\r");
+    if (pValue == NULL)
+      return true;
+    char * pEnd;
+    *pAddress [i] = strtoul (pValue, &pEnd, 16);
+    if (pEnd == pValue || *pEnd)
+      return true;
+    }  // end of for each address
+
+  return entry.lowestAddress > entry.highestAddress;
+  }  // end of parseCatalogLine
+
+// read through the catalog, checking each line, until we find fName (if not NULL)
+//  returns true if error, false if OK (haveCatalogEntry is true if fName was found)
+bool scanCatalog (const char * fName)
+  {
+  const int maxLine = 80;
+  char buffer[maxLine];
+  ifstream sdin (catalogFile);
+
+  haveCatalogEntry = false;
+
+  if (!sdin.is_open()) 
+    return true;
+
+  while (sdin.getline (buffer, maxLine))
+    {
+    if (sdin.fail()) 
+      return true;  // line too long
+
+    // drop comments
+    char * pComment = strchr (buffer, '#');
+    if (pComment)
+      *pComment = 0;
+
+    // ignore empty lines
+    const char * pName = strtok (buffer, " \t\r");
+    if (pName == NULL)
+      continue;
+
+    if (parseCatalogLine (catalogEntry))
+      return true;
+
+    if (fName && strcasecmp (fName, pName) == 0)
+      {
+      haveCatalogEntry = true;
+      return false;
+      }
+    }    // end of while each line
+
+  return false;
+  }  // end of scanCatalog
+
+// check the whole catalog (if there is one), so we know we can rely on it
+//  returns true if error, false if OK (or there is no catalog)
+bool loadCatalog ()
+  {
+  catalogLoaded = false;
+  catalogBad = false;
+  catalogName [0] = 0;  // look the file up again
+  if (!sd.exists (catalogFile))
+    return false;
+
+  if (scanCatalog (NULL))
+    {
+    catalogBad = true;
+    ShowMessage (MSG_BAD_CATALOG);
+    return true;
+    }
+  catalogLoaded = true;
+  return false;
+  }  // end of loadCatalog
+
+// find the catalog entry for this file (only looked up if it is a different file)
+void lookUpCatalog (const char * fName)
+  {
+  if (!catalogLoaded || strcmp (fName, catalogName) == 0)
+    return;
+  strcpy (catalogName, fName);
+  scanCatalog (fName);
+  }  // end of lookUpCatalog
+
+//------------------------------------------------------------------------------
 //      SETUP
 //------------------------------------------------------------------------------
 void setup () 
@@ -1304,19 +2395,165 @@ void setup ()
   while (!sd.begin (chipSelect, SPI_HALF_SPEED)) 
     {
     ShowMessage (MSG_NO_SD_CARD);
+    waitForBlink ();
     delay (1000);
     }
+
+  openLog ();
+  if (loadCatalog ())
+    waitForBlink ();
   
 }  // end of setup
 
 
+/*
+Background check.
+
+While waiting for the switch, the selected file is checked a few lines at a time (so the
+switch still responds at once). What was found is kept, and when the switch is pressed the
+file is not checked again, unless it has changed since (different size or modification time).
+*/
+
+const byte BACKGROUND_CHECK_LINES = 4;  // lines checked each time around the wait loop
+
+enum {
+  CHECK_NOT_STARTED,
+  CHECK_RUNNING,
+  CHECK_OK,
+  CHECK_FAILED
+};
+
+fileSummaryType checkedFile;
+byte checkState = CHECK_NOT_STARTED;
+SdFile checkingFile;
+
+// get the size and modification time of an open file, returns true if error
+bool getFileStamp (SdBaseFile & file, fileSummaryType & summary)
+  {
+  dir_t entry;
+  if (!file.dirEntry (&entry))
+    return true;
+  summary.fileSize = file.fileSize ();
+  summary.lastWriteDate = entry.lastWriteDate;
+  summary.lastWriteTime = entry.lastWriteTime;
+  return false;
+  }  // end of getFileStamp
+
+// remember the results of checking this file (which must have checked OK)
+void saveFileSummary (const char * fName)
+  {
+  checkingFile.close ();  // in case the switch was pressed part-way through
+  SdFile file;
+  if (!file.open (fName, O_READ) || getFileStamp (file, checkedFile))
+    {
+    checkState = CHECK_NOT_STARTED;
+    return;
+    }
+  strcpy (checkedFile.fileName, fName);
+  checkedFile.lowestAddress = lowestAddress;
+  checkedFile.highestAddress = highestAddress;
+  checkedFile.bytesWritten = bytesWritten;
+  checkedFile.crc = fileCRC;
+  checkState = CHECK_OK;
+  }  // end of saveFileSummary
+
+// returns true if this file has already been checked, and has not changed since
+bool fileAlreadyChecked (const char * fName)
+  {
+  if (checkState != CHECK_OK || strcmp (fName, checkedFile.fileName) != 0)
+    return false;
+
+  SdFile file;
+  fileSummaryType now;
+  if (!file.open (fName, O_READ) || getFileStamp (file, now))
+    return false;
+  return now.fileSize == checkedFile.fileSize &&
+         now.lastWriteDate == checkedFile.lastWriteDate &&
+         now.lastWriteTime == checkedFile.lastWriteTime;
+  }  // end of fileAlreadyChecked
+
+// check a few more lines of the selected file (called while waiting for the switch)
+void checkFileInBackground ()
+  {
+  // a different file chosen? start again
+  if (strcmp (name, checkedFile.fileName) != 0)
+    {
+    checkingFile.close ();
+    strcpy (checkedFile.fileName, name);
+    checkState = CHECK_NOT_STARTED;
+    }
+
+  if (checkState == CHECK_NOT_STARTED)
+    {
+    if (!checkingFile.open (name, O_READ) || getFileStamp (checkingFile, checkedFile))
+      {
+      checkingFile.close ();
+      checkState = CHECK_FAILED;
+      return;
+      }
+    gotEndOfFile = false;
+    extendedAddress = 0;
+    lowestAddress = 0xFFFFFFFF;
+    highestAddress = 0;
+    bytesWritten = 0;
+    fileCRC = 0xFFFF;
+    checkState = CHECK_RUNNING;
+    return;
+    }  // end of starting
+
+  if (checkState != CHECK_RUNNING)
+    return;
+
+  checkingInBackground = true;
+  char buffer [80];
+  for (byte i = 0; i < BACKGROUND_CHECK_LINES && checkState == CHECK_RUNNING; i++)
+    {
+    int count = checkingFile.fgets (buffer, sizeof (buffer));
+    if (count <= 0)
+      {
+      // end of file (or read error)
+      checkingFile.close ();
+      if (count == 0 && gotEndOfFile)
+        saveFileSummary (name);
+      else
+        checkState = CHECK_FAILED;
+      }
+    // line too long, or bad line
+    else if ((count == (int) sizeof (buffer) - 1 && buffer [count - 1] != '\n') ||
+             (count > 1 && processLine (buffer, checkFile)))
+      {
+      checkingFile.close ();
+      checkState = CHECK_FAILED;
+      }
+    }  // end of for each line
+  checkingInBackground = false;
+  }  // end of checkFileInBackground
+
 // returns true if error, false if OK
 bool chooseInputFile ()
   {
  
-  if (readHexFile(name, checkFile))
+  // the catalog tells us what is in it? no need to check it (the CRC is checked as it is written)
+  if (catalogued (name))
+    {
+    lowestAddress = catalogEntry.lowestAddress;
+    highestAddress = catalogEntry.highestAddress;
+    }
+  // checked while we were waiting? use what we found then
+  else if (fileAlreadyChecked (name))
     {
-    return true;  // error, don't attempt to write
+    lowestAddress = checkedFile.lowestAddress;
+    highestAddress = checkedFile.highestAddress;
+    bytesWritten = checkedFile.bytesWritten;
+    cycleLog.crc = checkedFile.crc;
+    }
+  else
+    {
+    if (readHexFile(name, checkFile))
+      {
+      return true;  // error, don't attempt to write
+      }
+    saveFileSummary (name);
     }
   
   // check file would fit into device memory
@@ -1335,12 +2572,17 @@ bool chooseInputFile ()
    return false;   
   }  // end of chooseInputFile
 
+// true if the last chip was already current (not reprogrammed)
+bool alreadyCurrent;
+
 // returns true if OK, false on error
 bool writeFlashContents ()
   {
     
   errors = 0;
+  alreadyCurrent = false;
   
+  startPhase (PHASE_CHECK);
   if (chooseInputFile ())
     return false;  
 
@@ -1352,7 +2594,26 @@ bool writeFlashContents ()
   if (!startProgramming ())
     return false;
 
+  // if it is already programmed with this file, leave it alone
+  if (verifyBeforeWriting)
+    {
+    startPhase (PHASE_VERIFY);
+    if (readHexFile(name, compareFlash))
+      return false;
+    if (errors == 0)
+      {
+      // flash is right, but the bootloader fuse might not be (only written if it differs)
+      startPhase (PHASE_FUSES);
+      if (updateFuses (true))
+        return false;
+      alreadyCurrent = true;
+      return true;
+      }
+    errors = 0;
+    }  // end of verifyBeforeWriting
+
   // now commit to flash
+  startPhase (PHASE_WRITE);
   if (readHexFile(name, writeToFlash))
     return false;
 
@@ -1364,27 +2625,230 @@ bool writeFlashContents ()
   digitalWrite (readyLED, HIGH);
 
   // verify
+  startPhase (PHASE_VERIFY);
   if (readHexFile(name, verifyFlash))
     return false;
 
   // now fix up fuses so we can boot    
-  if (errors == 0)
-    updateFuses (true);
+  startPhase (PHASE_FUSES);
+  if (updateFuses (true))
+    return false;
     
-  return errors == 0;
+  return true;
   }  // end of writeFlashContents
 
+// returns true if OK, false on error
+bool runJob (const char * jobName)
+  {
+  errors = 0;
+  alreadyCurrent = false;
+
+  startPhase (PHASE_CHECK);
+  if (readJobFile (jobName))
+    return false;
+
+  if (job.haveSig && memcmp (job.sig, currentSignature.sig, sizeof job.sig) != 0)
+    {
+    ShowMessage (MSG_WRONG_CHIP);
+    return false;
+    }
+
+  // don't allow RSTDISBL/DWEN, or disabling SPIEN, we couldn't program it again
+  //  (the job might not say which chip, so this is checked now we know)
+  if ((job.plan.mask & bit (highFuse)) && unsafeHighFuse (currentSignature.sig, job.plan.fuses [highFuse]))
+    {
+    ShowMessage (MSG_BAD_JOB_FILE);
+    return false;
+    }
+
+  // check the files before we touch the chip
+  if (job.eeprom [0])
+    {
+    if (readHexFile (job.eeprom, checkEEPROM))
+      return false;
+    // too big would wrap round in the chip (and still verify)
+    if (highestAddress >= currentSignature.eepromSize)
+      {
+      ShowMessage (MSG_FILE_TOO_LARGE_FOR_FLASH);
+      return false;
+      }
+    }  // end of having EEPROM
+
+  byte fusenumber = currentSignature.fuseWithBootloaderSize;
+  if (job.flash [0])
+    {
+    strcpy (name, job.flash);
+    if (chooseInputFile ())
+      return false;
+    // use the bootloader fuse worked out from the file, if the job doesn't give it
+    if (fusenumber != NO_FUSE && (job.plan.mask & bit (fusenumber)) == 0)
+      planBootFuse (job.plan);
+    }  // end of having flash
+
+#if CROSSROADS_PROGRAMMING_BOARD
+  show7SegmentMessage ("Pr");
+#endif //  CROSSROADS_PROGRAMMING_BOARD
+
+  // erases the chip (including the EEPROM, unless the EESAVE fuse is set)
+  startPhase (PHASE_WRITE);
+  if (job.flash [0] && readHexFile (job.flash, writeToFlash))
+    return false;
+
+  if (job.eeprom [0] && readHexFile (job.eeprom, writeToEEPROM))
+    return false;
+
+#if CROSSROADS_PROGRAMMING_BOARD
+  show7SegmentMessage ("uF");
+#endif //  CROSSROADS_PROGRAMMING_BOARD
+
+  // turn ready LED on during verification
+  digitalWrite (readyLED, HIGH);
+
+  // verify everything, before the lock byte could stop us reading it
+  startPhase (PHASE_VERIFY);
+  if (job.flash [0] && readHexFile (job.flash, verifyFlash))
+    return false;
+
+  if (job.eeprom [0] && readHexFile (job.eeprom, verifyEEPROM))
+    return false;
+
+  // now the fuses, only the ones which need changing, lock byte last
+  startPhase (PHASE_FUSES);
+  if (writeFusePlan (job.plan))
+    {
+    ShowMessage (MSG_VERIFICATION_ERROR);
+    return false;
+    }
+
+  return true;
+  }  // end of runJob
+
+// program the board which has just been plugged in, showing the result
+void programBoard ()
+  {
+  digitalWrite (readyLED, LOW);
+
+  // a bad catalog might be what stops a file going onto the wrong chip, so
+  //  don't program anything until it is fixed (or removed)
+  if (catalogBad && loadCatalog ())
+    return;
+    
+  if (!startProgramming ())
+    {
+    ShowMessage (MSG_CANNOT_ENTER_PROGRAMMING_MODE);
+    return;
+    }  // end of could not enter programming mode
+  cycleLog.entryTime = programmingEntryTime;
+    
+  getSignature ();
+  getFuseBytes ();
+  memcpy (cycleLog.fusesBefore, fuses, sizeof cycleLog.fusesBefore);
+#if GANG_PROGRAMMING
+  for (byte i = 0; i < GANG_SIZE; i++)
+    memcpy (targets [i].fusesBefore, targets [i].fuses, sizeof targets [i].fusesBefore);
+#endif // GANG_PROGRAMMING
+  
+  // don't have signature? don't proceed (getSignature has shown why)
+  if (foundSig == -1)
+    {
+    stopProgramming ();
+    return;
+    }
+  
+  // a job file, if there is one, is used instead of the .HEX file
+#if CROSSROADS_PROGRAMMING_BOARD
+  char jobName [MAX_FILENAME];
+  snprintf (jobName, sizeof (jobName), "JOB%.2s.TXT", &name [4]);   // CODExx.HEX -> JOBxx.TXT
+#else
+  const char * jobName = jobFile;
+#endif //  CROSSROADS_PROGRAMMING_BOARD
+
+  const bool haveJob = sd.vwd()->exists (jobName);
+  strcpy (cycleLog.fileName, haveJob ? jobName : name);
+
+  // the catalog says which chip this file is for
+  lookUpCatalog (name);
+  if (!haveJob && catalogued (name) && 
+      memcmp (catalogEntry.sig, currentSignature.sig, sizeof catalogEntry.sig) != 0)
+    {
+    stopProgramming ();
+    ShowMessage (MSG_WRONG_CHIP);
+    return;
+    }
+
+  digitalWrite (workingLED, HIGH);
+  bool ok = haveJob ? runJob (jobName) : writeFlashContents ();
+  endPhase ();
+  getFuseBytes ();
+  memcpy (cycleLog.fusesAfter, fuses, sizeof cycleLog.fusesAfter);
+  digitalWrite (workingLED, LOW);
+  digitalWrite (readyLED, LOW);
+  stopProgramming ();
+  
+  if (ok)
+    ShowMessage (alreadyCurrent ? MSG_ALREADY_CURRENT : MSG_FLASHED_OK);
+  }  // end of programBoard
+
+#if GANG_PROGRAMMING
+// if the boards did not all end up the same, show each one's result in turn
+//  (the yellow LED flashes the number of the board first)
+void showTargetResults ()
+  {
+  bool same = true;
+  for (byte i = 0; i < GANG_SIZE; i++)
+    if (targetResult (i) != cycleLog.result)
+      same = false;
+  if (same)
+    return;  // already shown
+
+  cancelBlink ();
+  for (byte i = 0; i < GANG_SIZE; i++)
+    {
+    const byte result = targetResult (i);
+    blink (workingLED, noLED, i + 1);
+    waitForBlink ();
+    ShowMessage (result);
+    // leave the last one showing in the background
+    if (i < GANG_SIZE - 1)
+      waitForBlink ();
+    }  // end of for each board
+  }  // end of showTargetResults
+#endif // GANG_PROGRAMMING
+
 //------------------------------------------------------------------------------
 //      LOOP
 //------------------------------------------------------------------------------
 void loop () 
 {
 
-  digitalWrite (readyLED, HIGH);
+  // the switch has to be seen released for a while first, in case it is still held
+  //  down (or bouncing) from last time
+  bool switchReleased = false;
+  unsigned long whenReleased = 0;
 
-  // wait till they press the start switch
-  while (digitalRead (startSwitch) == HIGH)
+  // wait till they press the start switch, showing the last status meanwhile
+  while (true)
     {
+    if (digitalRead (startSwitch) == HIGH)
+      {
+      if (!switchReleased)
+        whenReleased = millis ();
+      switchReleased = true;
+      }
+    else if (switchReleased && millis () - whenReleased >= SWITCH_DEBOUNCE_TIME)
+      break;  // pressed
+    else
+      switchReleased = false;
+
+    // or start when the next board is plugged in
+    if (autoStart && boardInserted ())
+      break;
+
+    // ready LED is on once the status has been shown
+    updateBlink ();
+    if (!blinkActive)
+      digitalWrite (readyLED, HIGH);
+
 #if CROSSROADS_PROGRAMMING_BOARD
 
   #if !NO_ENCODER
@@ -1412,6 +2876,7 @@ void loop ()
   #endif     
       if (fileNumber > MAX_FILE_NUMBER)
         fileNumber -= MAX_FILE_NUMBER + 1;
+      cancelBlink ();  // show the new file number straight away
       delay (20);  // debounce
       }  // if switch pressed
       
@@ -1435,12 +2900,25 @@ void loop ()
     #endif
   #endif //   #if HEX_FILE_NAMES
 
-    show7SegmentMessage (buf);
+    // the status stays on the display until its LED pattern finishes
+    if (!blinkActive)
+      show7SegmentMessage (buf);
 
 #else
     strcpy (name, wantedFile);   // use fixed name
 #endif //  CROSSROADS_PROGRAMMING_BOARD
+
+    lookUpCatalog (name);
+    if (checkWhileIdle && !catalogued (name))
+      checkFileInBackground ();
     }  // end of waiting for switch press
+
+  // they want to go on, so stop showing the last status
+  cancelBlink ();
+
+  // autoStart: this board has to be taken out before we start again
+  boardFitted = true;
+  probeCount = 0;
     
 #if CROSSROADS_PROGRAMMING_BOARD
    // remember the file they chose when they hit the switch
@@ -1448,33 +2926,12 @@ void loop ()
      EEPROM.write (0, (byte) fileNumber);
 #endif // CROSSROADS_PROGRAMMING_BOARD
 
-  digitalWrite (readyLED, LOW);
-    
-  if (!startProgramming ())
-    {
-    ShowMessage (MSG_CANNOT_ENTER_PROGRAMMING_MODE);
-    return;
-    }  // end of could not enter programming mode
-    
-  getSignature ();
-  getFuseBytes ();
-  
-  // don't have signature? don't proceed
-  if (foundSig == -1)
-    {
-    ShowMessage (MSG_CANNOT_FIND_SIGNATURE);
-    return;
-    }  // end of no signature
-  
-  digitalWrite (workingLED, HIGH);
-  bool ok = writeFlashContents ();
-  digitalWrite (workingLED, LOW);
-  digitalWrite (readyLED, LOW);
-  stopProgramming ();
-  delay (500);
-  
-  if (ok)
-    ShowMessage (MSG_FLASHED_OK);
+  startCycle ();
+  programBoard ();
+  endCycle ();
+#if GANG_PROGRAMMING
+  showTargetResults ();
+#endif // GANG_PROGRAMMING
 
 }  // end of loop
 
@@ -0,0 +1,252 @@
+// Signatures.h
+//
+// Signatures and extra information for known chips
+//
+// Author: Nick Gammon
+
+/* ----------------------------------------------------------------------------
+NOTE: This file is generated from devices.txt by generateDeviceTables.
+Change devices.txt and regenerate it, rather than editing it here.
+------------------------------------------------------------------------------ */
+
+// structure to hold signature and other relevant data about each chip
+typedef struct {
+   byte sig [3];                // chip signature
+   unsigned long flashSize;     // how big the flash is (bytes)
+   unsigned int baseBootSize;   // base bootloader size (others are multiples of 2/4/8)
+   unsigned long pageSize;      // flash programming page size (bytes)
+   byte fuseWithBootloaderSize; // ie. one of: lowFuse, highFuse, extFuse
+   bool timedWrites;            // true if pollUntilReady won't work by polling the chip
+   unsigned int eepromSize;     // how big the EEPROM is (bytes)
+   byte highFuseKeepSet;        // high fuse bits which must stay 1 (RSTDISBL, DWEN)
+   byte highFuseKeepClear;      // high fuse bit which must stay 0 (SPIEN)
+} signatureType;
+
+const unsigned long kb = 1024;
+const byte NO_FUSE = 0xFF;
+
+// chip names for TARGET_DEVICE
+#define ANY_DEVICE    1      // not 0, so a misspelt name is an error
+#define ATtiny13A     0x1E9007
+#define ATtiny25      0x1E9108
+#define ATtiny2313A   0x1E910A
+#define ATtiny24      0x1E910B
+#define ATtiny45      0x1E9206
+#define ATtiny44      0x1E9207
+#define ATmega48PA    0x1E920A
+#define ATtiny4313    0x1E920D
+#define ATmega8A      0x1E9307
+#define ATtiny85      0x1E930B
+#define ATtiny84      0x1E930C
+#define ATmega88PA    0x1E930F
+#define At90USB82     0x1E9382
+#define ATmega8U2     0x1E9389
+#define ATmega168V    0x1E9406
+#define ATmega164P    0x1E940A
+#define ATmega168PA   0x1E940B
+#define At90USB162    0x1E9482
+#define ATmega16U4    0x1E9488
+#define ATmega16U2    0x1E9489
+#define ATmega324P    0x1E9508
+#define ATmega328P    0x1E950F
+#define ATmega328     0x1E9514
+#define ATmega328PB   0x1E9516
+#define ATmega32U4    0x1E9587
+#define ATmega32U2    0x1E958A
+#define ATmega640     0x1E9608
+#define ATmega644P    0x1E960A
+#define ATmega1280    0x1E9703
+#define ATmega1281    0x1E9704
+#define ATmega1284P   0x1E9705
+#define ATmega1284    0x1E9706
+#define ATmega2560    0x1E9801
+#define ATmega2561    0x1E9802
+#define ATmega64rfr2  0x1EA602
+#define ATmega128rfr2 0x1EA702
+#define ATmega256rfr2 0x1EA802
+
+#if TARGET_DEVICE != ANY_DEVICE
+
+// Only this chip is programmed. Its details are constants, so the compiler
+// can work out page masks and so on in advance, and no table is needed.
+#if TARGET_DEVICE == ATtiny13A
+  const signatureType currentSignature = { { 0x1E, 0x90, 0x07 },    1 * kb,         0,   32, NO_FUSE,  false,    64, 0x09, 0x00 };
+#elif TARGET_DEVICE == ATtiny25
+  const signatureType currentSignature = { { 0x1E, 0x91, 0x08 },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATtiny2313A
+  const signatureType currentSignature = { { 0x1E, 0x91, 0x0A },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0x81, 0x20 };
+#elif TARGET_DEVICE == ATtiny24
+  const signatureType currentSignature = { { 0x1E, 0x91, 0x0B },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATtiny45
+  const signatureType currentSignature = { { 0x1E, 0x92, 0x06 },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATtiny44
+  const signatureType currentSignature = { { 0x1E, 0x92, 0x07 },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega48PA
+  const signatureType currentSignature = { { 0x1E, 0x92, 0x0A },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATtiny4313
+  const signatureType currentSignature = { { 0x1E, 0x92, 0x0D },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0x81, 0x20 };
+#elif TARGET_DEVICE == ATmega8A
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x07 },    8 * kb,       256,   64, highFuse, true,    512, 0x80, 0x20 };
+#elif TARGET_DEVICE == ATtiny85
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x0B },    8 * kb,         0,   64, NO_FUSE,  false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATtiny84
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x0C },    8 * kb,         0,   64, NO_FUSE,  false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega88PA
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x0F },    8 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == At90USB82
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x82 },    8 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega8U2
+  const signatureType currentSignature = { { 0x1E, 0x93, 0x89 },    8 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega168V
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x06 },   16 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega164P
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x0A },   16 * kb,       256,  128, highFuse, false,   512, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega168PA
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x0B },   16 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == At90USB162
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x82 },   16 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega16U4
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x88 },   16 * kb,       512,  128, highFuse, false,   512, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega16U2
+  const signatureType currentSignature = { { 0x1E, 0x94, 0x89 },   16 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega324P
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x08 },   32 * kb,       512,  128, highFuse, false,  1024, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega328P
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x0F },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega328
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x14 },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega328PB
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x16 },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega32U4
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x87 },   32 * kb,       512,  128, highFuse, false,  1024, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega32U2
+  const signatureType currentSignature = { { 0x1E, 0x95, 0x8A },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 };
+#elif TARGET_DEVICE == ATmega640
+  const signatureType currentSignature = { { 0x1E, 0x96, 0x08 },   64 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega644P
+  const signatureType currentSignature = { { 0x1E, 0x96, 0x0A },   64 * kb,    1 * kb,  256, highFuse, false,  2048, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega1280
+  const signatureType currentSignature = { { 0x1E, 0x97, 0x03 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega1281
+  const signatureType currentSignature = { { 0x1E, 0x97, 0x04 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega1284P
+  const signatureType currentSignature = { { 0x1E, 0x97, 0x05 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega1284
+  const signatureType currentSignature = { { 0x1E, 0x97, 0x06 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega2560
+  const signatureType currentSignature = { { 0x1E, 0x98, 0x01 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega2561
+  const signatureType currentSignature = { { 0x1E, 0x98, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega64rfr2
+  const signatureType currentSignature = { { 0x1E, 0xA6, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  2048, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega128rfr2
+  const signatureType currentSignature = { { 0x1E, 0xA7, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 };
+#elif TARGET_DEVICE == ATmega256rfr2
+  const signatureType currentSignature = { { 0x1E, 0xA8, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  8192, 0x00, 0x20 };
+#else
+  #error TARGET_DEVICE is not one of the chips in devices.txt
+#endif
+
+// returns 0 if this is the target chip, or -1 if not
+int findSignature (const byte sig [3])
+  {
+  return memcmp (sig, currentSignature.sig, sizeof currentSignature.sig) == 0 ? 0 : -1;
+  }  // end of findSignature
+
+#else
+
+// see Atmega datasheets - sorted by signature, for findSignature ()
+const signatureType signatures [] PROGMEM =
+  {
+  { { 0x1E, 0x90, 0x07 },    1 * kb,         0,   32, NO_FUSE,  false,    64, 0x09, 0x00 },  // ATtiny13A, ATtiny13 family
+  { { 0x1E, 0x91, 0x08 },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0xC0, 0x20 },  // ATtiny25, Attiny85 family
+  { { 0x1E, 0x91, 0x0A },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0x81, 0x20 },  // ATtiny2313A, ATtiny4313 family
+  { { 0x1E, 0x91, 0x0B },    2 * kb,         0,   32, NO_FUSE,  false,   128, 0xC0, 0x20 },  // ATtiny24, Attiny84 family
+  { { 0x1E, 0x92, 0x06 },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 },  // ATtiny45, Attiny85 family
+  { { 0x1E, 0x92, 0x07 },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 },  // ATtiny44, Attiny84 family
+  { { 0x1E, 0x92, 0x0A },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0xC0, 0x20 },  // ATmega48PA, Atmega328 family
+  { { 0x1E, 0x92, 0x0D },    4 * kb,         0,   64, NO_FUSE,  false,   256, 0x81, 0x20 },  // ATtiny4313, ATtiny4313 family
+  { { 0x1E, 0x93, 0x07 },    8 * kb,       256,   64, highFuse, true,    512, 0x80, 0x20 },  // ATmega8A, Atmega8A family
+  { { 0x1E, 0x93, 0x0B },    8 * kb,         0,   64, NO_FUSE,  false,   512, 0xC0, 0x20 },  // ATtiny85, Attiny85 family
+  { { 0x1E, 0x93, 0x0C },    8 * kb,         0,   64, NO_FUSE,  false,   512, 0xC0, 0x20 },  // ATtiny84, Attiny84 family
+  { { 0x1E, 0x93, 0x0F },    8 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 },  // ATmega88PA, Atmega328 family
+  { { 0x1E, 0x93, 0x82 },    8 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 },  // At90USB82, AT90USB family
+  { { 0x1E, 0x93, 0x89 },    8 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 },  // ATmega8U2, Atmega32U2 family
+  { { 0x1E, 0x94, 0x06 },   16 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 },  // ATmega168V, Atmega328 family
+  { { 0x1E, 0x94, 0x0A },   16 * kb,       256,  128, highFuse, false,   512, 0x00, 0x20 },  // ATmega164P, Atmega644 family
+  { { 0x1E, 0x94, 0x0B },   16 * kb,       256,  128, extFuse,  false,   512, 0xC0, 0x20 },  // ATmega168PA, Atmega328 family
+  { { 0x1E, 0x94, 0x82 },   16 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 },  // At90USB162, AT90USB family
+  { { 0x1E, 0x94, 0x88 },   16 * kb,       512,  128, highFuse, false,   512, 0x00, 0x20 },  // ATmega16U4, Atmega32U4 family
+  { { 0x1E, 0x94, 0x89 },   16 * kb,       512,  128, highFuse, false,   512, 0xC0, 0x20 },  // ATmega16U2, Atmega32U2 family
+  { { 0x1E, 0x95, 0x08 },   32 * kb,       512,  128, highFuse, false,  1024, 0x00, 0x20 },  // ATmega324P, Atmega644 family
+  { { 0x1E, 0x95, 0x0F },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 },  // ATmega328P, Atmega328 family
+  { { 0x1E, 0x95, 0x14 },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 },  // ATmega328, Atmega328 family
+  { { 0x1E, 0x95, 0x16 },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 },  // ATmega328PB, Atmega328 family
+  { { 0x1E, 0x95, 0x87 },   32 * kb,       512,  128, highFuse, false,  1024, 0x00, 0x20 },  // ATmega32U4, Atmega32U4 family
+  { { 0x1E, 0x95, 0x8A },   32 * kb,       512,  128, highFuse, false,  1024, 0xC0, 0x20 },  // ATmega32U2, Atmega32U2 family
+  { { 0x1E, 0x96, 0x08 },   64 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega640, Atmega2560 family
+  { { 0x1E, 0x96, 0x0A },   64 * kb,    1 * kb,  256, highFuse, false,  2048, 0x00, 0x20 },  // ATmega644P, Atmega644 family
+  { { 0x1E, 0x97, 0x03 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega1280, Atmega2560 family
+  { { 0x1E, 0x97, 0x04 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega1281, Atmega2560 family
+  { { 0x1E, 0x97, 0x05 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega1284P, ATmega1284P family
+  { { 0x1E, 0x97, 0x06 },  128 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega1284, ATmega1284P family
+  { { 0x1E, 0x98, 0x01 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega2560, Atmega2560 family
+  { { 0x1E, 0x98, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega2561, Atmega2560 family
+  { { 0x1E, 0xA6, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  2048, 0x00, 0x20 },  // ATmega64rfr2, ATmega64rfr2 family
+  { { 0x1E, 0xA7, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  4096, 0x00, 0x20 },  // ATmega128rfr2, ATmega64rfr2 family
+  { { 0x1E, 0xA8, 0x02 },  256 * kb,    1 * kb,  256, highFuse, false,  8192, 0x00, 0x20 },  // ATmega256rfr2, ATmega64rfr2 family
+
+  };  // end of signatures
+
+// signatures [] entries with a middle byte of n start at
+//   signatureIndex [n - FIRST_SIGNATURE_MIDDLE] and stop before the next one
+const byte FIRST_SIGNATURE_MIDDLE = 0x90;
+const byte LAST_SIGNATURE_MIDDLE = 0xA8;
+
+const byte signatureIndex [] PROGMEM =
+  {
+   0,  // 0x90
+   1,  // 0x91
+   4,  // 0x92
+   8,  // 0x93
+  14,  // 0x94
+  20,  // 0x95
+  26,  // 0x96
+  28,  // 0x97
+  32,  // 0x98
+  34,  // 0x99
+  34,  // 0x9A
+  34,  // 0x9B
+  34,  // 0x9C
+  34,  // 0x9D
+  34,  // 0x9E
+  34,  // 0x9F
+  34,  // 0xA0
+  34,  // 0xA1
+  34,  // 0xA2
+  34,  // 0xA3
+  34,  // 0xA4
+  34,  // 0xA5
+  34,  // 0xA6
+  35,  // 0xA7
+  36,  // 0xA8
+  37,  // 0xA9
+  };  // end of signatureIndex
+
+// returns the index into signatures [] of this signature, or -1 if not known
+int findSignature (const byte sig [3])
+  {
+  if (sig [0] != 0x1E || sig [1] < FIRST_SIGNATURE_MIDDLE || sig [1] > LAST_SIGNATURE_MIDDLE)
+    return -1;
+
+  const byte * bucket = &signatureIndex [sig [1] - FIRST_SIGNATURE_MIDDLE];
+  const byte stop = pgm_read_byte (bucket + 1);
+  for (byte j = pgm_read_byte (bucket); j < stop; j++)
+    if (pgm_read_byte (&signatures [j].sig [2]) == sig [2])
+      return j;
+
+  return -1;
+  }  // end of findSignature
+
+#endif // TARGET_DEVICE != ANY_DEVICE
+
@@ -0,0 +1,378 @@
+// optibootSimulator.cpp
+//
+// Pretends to be a board with Optiboot on it, on a pseudo-terminal, so that programming
+// through the bootloader (BOOTLOADER_PROGRAMMING in Atmega_Hex_Uploader, or avrdude -c arduino)
+// can be tried out without any hardware.
+//
+// Author: Nick Gammon
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -o optibootSimulator optibootSimulator.cpp
+//
+// To use:
+//
+//   optibootSimulator [-d device] [-b bootloader_size] [-t timeout_mS] [-s startup_mS] [-o file.bin] [-v]
+//
+//   -d  which chip to pretend to be, as named in Signatures.h (default ATmega328P)
+//   -b  bootloader size at the top of flash, which can't be written (default: smallest for the chip)
+//   -t  start the application if nothing arrives for this long (default 1000 mS, as Optiboot), 0 for never
+//   -s  time after a reset before the bootloader listens (Optiboot flashes its LED), default 0 mS
+//   -o  write the flash contents to this file when programming mode is left
+//   -v  show the commands
+//
+// It shows the name of the pseudo-terminal (eg. /dev/pts/3), and its process ID. A pseudo-terminal
+// has no DTR line, so to reset the simulated chip send it SIGUSR1 (kill -USR1 <pid>). It starts in
+// the bootloader, so avrdude can be run against it straight away (if within the timeout), eg.
+//
+//   avrdude -c arduino -P /dev/pts/3 -b 115200 -p m328p -U flash:w:sketch.hex:i
+//
+// The commands are handled as in Optiboot version 8: the flash address is a word address (with
+// the top of it in RAMPZ for big chips), each page is erased as it is written, and anything it
+// doesn't expect makes it give up and start the application.
+
+#include "serialTools.h"
+#include <signal.h>
+
+// ---------------------- enough for Signatures.h ----------------------
+
+typedef uint8_t byte;
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *) (p))
+
+#include "../Atmega_Hex_Uploader/Signatures.h"
+
+// ---------------------- STK500 version 1 ----------------------
+
+enum {
+    STK_OK              = 0x10,
+    STK_INSYNC          = 0x14,
+    CRC_EOP             = 0x20,
+
+    STK_GET_SYNC        = 0x30,
+    STK_GET_PARAMETER   = 0x41,
+    STK_SET_DEVICE      = 0x42,
+    STK_SET_DEVICE_EXT  = 0x45,
+    STK_LOAD_ADDRESS    = 0x55,
+    STK_UNIVERSAL       = 0x56,
+    STK_LEAVE_PROGMODE  = 0x51,
+    STK_PROG_PAGE       = 0x64,
+    STK_READ_PAGE       = 0x74,
+    STK_READ_SIGN       = 0x75,
+
+    STK_SW_MAJOR        = 0x81,
+    STK_SW_MINOR        = 0x82,
+};
+
+const uint8_t OPTIBOOT_MAJVER = 8;
+const uint8_t OPTIBOOT_MINVER = 0;
+
+// ---------------------- the simulated chip ----------------------
+
+signatureType chip;
+std::vector <uint8_t> chipFlash;
+unsigned long bootSize = 0;
+unsigned long timeout = 1000;
+unsigned long startupTime = 0;
+bool verbose = false;
+const char * outputFile = NULL;
+int fd = -1;
+
+volatile sig_atomic_t resetWanted = 0;
+
+// the ways out of the bootloader
+struct ExternalReset { };        // SIGUSR1, it starts again
+struct ApplicationStarted         // timed out, or told to leave, or lost sync
+  {
+  const char * why;
+  };
+
+void onSignal (int)
+  {
+  resetWanted = 1;
+  }  // end of onSignal
+
+// the application, once it runs, ignores the serial port until the next reset
+void runApplication (const char * why)
+  {
+  fprintf (stderr, "Application started (%s)\n", why);
+  while (true)
+    {
+    uint8_t c;
+    if (resetWanted)
+      return;
+    readByte (fd, c, 10);
+    }  // end of while
+  }  // end of runApplication
+
+// as Optiboot's getch: waits for a byte, but the watchdog restarts the chip if it takes too long
+uint8_t getch ()
+  {
+  const unsigned long start = msNow ();
+  while (true)
+    {
+    if (resetWanted)
+      throw ExternalReset ();
+    uint8_t c;
+    if (readByte (fd, c, 10))
+      return c;
+    if (timeout && msNow () - start >= timeout)
+      throw ApplicationStarted { "timed out" };
+    }  // end of while
+  }  // end of getch
+
+void putch (const uint8_t c)
+  {
+  writeAll (fd, &c, 1);
+  }  // end of putch
+
+// every command ends with CRC_EOP, otherwise Optiboot lets the watchdog restart it (into the application)
+void verifySpace ()
+  {
+  if (getch () != CRC_EOP)
+    throw ApplicationStarted { "expected CRC_EOP, lost sync" };
+  putch (STK_INSYNC);
+  }  // end of verifySpace
+
+void getNch (unsigned int count)
+  {
+  while (count--)
+    getch ();
+  verifySpace ();
+  }  // end of getNch
+
+void saveFlash ()
+  {
+  if (!outputFile)
+    return;
+
+  FILE * f = fopen (outputFile, "wb");
+  if (!f || fwrite (chipFlash.data (), 1, chipFlash.size (), f) != chipFlash.size ())
+    perror (outputFile);
+  if (f)
+    fclose (f);
+  }  // end of saveFlash
+
+// one run of the bootloader, from a reset until it gives up (or is reset again)
+void bootloader ()
+  {
+  // flashing the LED, anything sent now is lost
+  const unsigned long start = msNow ();
+  while (msNow () - start < startupTime)
+    {
+    uint8_t c;
+    if (resetWanted)
+      throw ExternalReset ();
+    readByte (fd, c, 1);
+    }  // end of while starting up
+
+  unsigned long address = 0;   // byte address
+  uint8_t rampz = 0;
+  const bool hasRampz = chip.flashSize > 64 * kb;
+
+  while (true)
+    {
+    const uint8_t ch = getch ();
+
+    switch (ch)
+      {
+      case STK_GET_PARAMETER:
+        {
+        const uint8_t which = getch ();
+        verifySpace ();
+        putch (which == STK_SW_MINOR ? OPTIBOOT_MINVER : which == STK_SW_MAJOR ? OPTIBOOT_MAJVER : 0x03);
+        }
+        break;
+
+      case STK_SET_DEVICE:
+        getNch (20);
+        break;
+
+      case STK_SET_DEVICE_EXT:
+        getNch (5);
+        break;
+
+      case STK_LOAD_ADDRESS:
+        {
+        unsigned int word = getch ();
+        word |= getch () << 8;
+        if (hasRampz)
+          rampz = (word & 0x8000) ? (rampz | 1) : (rampz & 0xFE);
+        address = ((unsigned long) rampz << 16) | ((word * 2) & 0xFFFF);   // convert from word address to byte address
+        verifySpace ();
+        if (verbose)
+          fprintf (stderr, "Address 0x%05lX\n", address);
+        }
+        break;
+
+      case STK_UNIVERSAL:
+        {
+        uint8_t instruction [4];
+        for (int i = 0; i < 4; i++)
+          instruction [i] = getch ();
+        // the only one it does is the extended address (as sent by avrdude above 128K)
+        if (hasRampz && instruction [0] == 0x4D)
+          rampz = (rampz & 0x01) | (instruction [2] << 1);
+        verifySpace ();
+        putch (0x00);
+        }
+        break;
+
+      case STK_PROG_PAGE:
+        {
+        unsigned int length = getch () << 8;
+        length |= getch ();
+        const uint8_t memType = getch ();
+        std::vector <uint8_t> data (length);
+        for (unsigned int i = 0; i < length; i++)
+          data [i] = getch ();
+        verifySpace ();
+
+        if (memType != 'F')
+          fprintf (stderr, "Memory type '%c' written to flash (Optiboot built without EEPROM support)\n", memType);
+
+        const unsigned long page = address & ~(chip.pageSize - 1);
+        if (length > chip.pageSize || address + length > page + chip.pageSize)
+          fprintf (stderr, "Page write of %u bytes at 0x%05lX goes past the end of the page\n", length, address);
+        else if (address + length > chip.flashSize - bootSize)
+          fprintf (stderr, "Page at 0x%05lX is in the bootloader, not written\n", page);
+        else
+          {
+          // the page is erased, then the buffer is written into it
+          std::fill (chipFlash.begin () + page, chipFlash.begin () + page + chip.pageSize, 0xFF);
+          std::copy (data.begin (), data.end (), chipFlash.begin () + address);
+          if (verbose)
+            fprintf (stderr, "Flash page at 0x%05lX written\n", page);
+          }
+        }
+        break;
+
+      case STK_READ_PAGE:
+        {
+        unsigned int length = getch () << 8;
+        length |= getch ();
+        const uint8_t memType = getch ();
+        verifySpace ();
+        for (unsigned int i = 0; i < length; i++)
+          {
+          const unsigned long addr = address + i;
+          putch (memType == 'F' && addr < chipFlash.size () ? chipFlash [addr] : 0xFF);
+          }
+        if (verbose)
+          fprintf (stderr, "Read %u bytes at 0x%05lX\n", length, address);
+        }
+        break;
+
+      case STK_READ_SIGN:
+        verifySpace ();
+        putch (chip.sig [0]);
+        putch (chip.sig [1]);
+        putch (chip.sig [2]);
+        break;
+
+      case STK_LEAVE_PROGMODE:
+        verifySpace ();
+        putch (STK_OK);
+        saveFlash ();
+        throw ApplicationStarted { "left programming mode" };
+
+      default:
+        // eg. STK_GET_SYNC, STK_ENTER_PROGMODE
+        verifySpace ();
+        break;
+      }  // end of switch
+
+    putch (STK_OK);
+    }  // end of while
+
+  }  // end of bootloader
+
+int main (int argc, char * argv [])
+  {
+  const char * device = "ATmega328P";
+  long bootSizeWanted = -1;
+
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv [i], "-d") == 0 && i + 1 < argc)
+      device = argv [++i];
+    else if (strcmp (argv [i], "-b") == 0 && i + 1 < argc)
+      bootSizeWanted = strtol (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-t") == 0 && i + 1 < argc)
+      timeout = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-s") == 0 && i + 1 < argc)
+      startupTime = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-o") == 0 && i + 1 < argc)
+      outputFile = argv [++i];
+    else if (strcmp (argv [i], "-v") == 0)
+      verbose = true;
+    else
+      {
+      fprintf (stderr, "Usage: %s [-d device] [-b bootloader_size] [-t timeout_mS] [-s startup_mS] [-o file.bin] [-v]\n", argv [0]);
+      return 1;
+      }
+    }  // end of for each argument
+
+  bool found = false;
+  for (unsigned int i = 0; i < sizeof signatures / sizeof signatures [0] && !found; i++)
+    if (strcasecmp (signatures [i].desc, device) == 0)
+      {
+      chip = signatures [i];
+      found = true;
+      }
+
+  if (!found)
+    {
+    fprintf (stderr, "Unknown device %s\n", device);
+    return 1;
+    }
+
+  bootSize = bootSizeWanted >= 0 ? bootSizeWanted : chip.baseBootSize;
+  if (bootSize >= chip.flashSize)
+    {
+    fprintf (stderr, "Bootloader size must be less than the flash size\n");
+    return 1;
+    }
+
+  // the bootloader itself is something other than 0xFF, so it can be seen when read back
+  chipFlash.assign (chip.flashSize, 0xFF);
+  std::fill (chipFlash.end () - bootSize, chipFlash.end (), 0xB0);
+
+  std::string slaveName;
+  int slave;
+  fd = openPseudoTerminal (slaveName, slave);
+  if (fd < 0)
+    {
+    perror ("pseudo-terminal");
+    return 1;
+    }
+
+  struct sigaction action;
+  memset (&action, 0, sizeof action);
+  action.sa_handler = onSignal;
+  sigaction (SIGUSR1, &action, NULL);
+
+  printf ("Simulated %s with Optiboot on %s (process %d)\n", chip.desc, slaveName.c_str (), (int) getpid ());
+  fflush (stdout);
+
+  while (true)
+    {
+    resetWanted = 0;
+    if (verbose)
+      fprintf (stderr, "Reset\n");
+
+    try
+      {
+      bootloader ();
+      }
+    catch (const ExternalReset &)
+      {
+      continue;
+      }
+    catch (const ApplicationStarted & started)
+      {
+      runApplication (started.why);
+      }
+    }  // end of while
+
+  }  // end of main
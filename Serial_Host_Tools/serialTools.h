@@ -0,0 +1,220 @@
+// serialTools.h
+//
+// Serial port, pseudo-terminal, Intel hex and CRC functions shared by the Linux host tools
+// in this directory.
+//
+// Author: Nick Gammon
+
+#ifndef SERIAL_TOOLS_H
+#define SERIAL_TOOLS_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <map>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+// milliseconds from an arbitrary starting point
+static inline unsigned long msNow ()
+  {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000UL + ts.tv_nsec / 1000000;
+  }  // end of msNow
+
+// CRC-16/XMODEM, the same as _crc_xmodem_update in avr-libc
+static inline uint16_t crcXmodemUpdate (uint16_t crc, const uint8_t data)
+  {
+  crc ^= (uint16_t) data << 8;
+  for (int i = 0; i < 8; i++)
+    crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  return crc;
+  }  // end of crcXmodemUpdate
+
+// the termios constant for a baud rate, or B0 if not known
+static inline speed_t baudConstant (const unsigned long baud)
+  {
+  switch (baud)
+    {
+    case 9600:    return B9600;
+    case 19200:   return B19200;
+    case 38400:   return B38400;
+    case 57600:   return B57600;
+    case 115200:  return B115200;
+    case 230400:  return B230400;
+    case 460800:  return B460800;
+    case 500000:  return B500000;
+    case 576000:  return B576000;
+    case 921600:  return B921600;
+    case 1000000: return B1000000;
+    case 2000000: return B2000000;
+    }  // end of switch
+  return B0;
+  }  // end of baudConstant
+
+// put a port (or pseudo-terminal) into raw mode at this baud rate, returns false on error
+static inline bool setSerialMode (const int fd, const unsigned long baud)
+  {
+  const speed_t speed = baudConstant (baud);
+  struct termios tio;
+  if (speed == B0 || tcgetattr (fd, &tio) != 0)
+    return false;
+  cfmakeraw (&tio);
+  tio.c_cflag |= CLOCAL | CREAD;
+  tio.c_cflag &= ~CRTSCTS;
+  tio.c_cc [VMIN] = 0;
+  tio.c_cc [VTIME] = 0;
+  cfsetispeed (&tio, speed);
+  cfsetospeed (&tio, speed);
+  return tcsetattr (fd, TCSANOW, &tio) == 0;
+  }  // end of setSerialMode
+
+// open a serial port, returns -1 on error
+static inline int openSerialPort (const char * name, const unsigned long baud)
+  {
+  const int fd = open (name, O_RDWR | O_NOCTTY);
+  if (fd < 0)
+    return -1;
+  if (!setSerialMode (fd, baud))
+    {
+    close (fd);
+    return -1;
+    }
+  return fd;
+  }  // end of openSerialPort
+
+// make a pseudo-terminal for a simulator, returns the master side, or -1 on error
+//  slave is kept open (and raw), so the master doesn't see a hang-up between clients
+static inline int openPseudoTerminal (std::string & slaveName, int & slave)
+  {
+  const int master = posix_openpt (O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt (master) != 0 || unlockpt (master) != 0)
+    return -1;
+  slaveName = ptsname (master);
+  slave = open (slaveName.c_str (), O_RDWR | O_NOCTTY);
+  if (slave < 0 || !setSerialMode (slave, 115200))
+    return -1;
+  return master;
+  }  // end of openPseudoTerminal
+
+// read one byte, waiting up to timeout mS, returns false if none
+static inline bool readByte (const int fd, uint8_t & b, const int timeout)
+  {
+  struct pollfd pfd = { fd, POLLIN, 0 };
+  if (poll (&pfd, 1, timeout) <= 0 || !(pfd.revents & POLLIN))
+    return false;
+  return read (fd, &b, 1) == 1;
+  }  // end of readByte
+
+// write it all, returns false on error
+static inline bool writeAll (const int fd, const void * data, size_t length)
+  {
+  const uint8_t * p = (const uint8_t *) data;
+  while (length > 0)
+    {
+    const ssize_t n = write (fd, p, length);
+    if (n <= 0)
+      return false;
+    p += n;
+    length -= n;
+    }
+  return true;
+  }  // end of writeAll
+
+static inline bool writeText (const int fd, const char * text)
+  {
+  return writeAll (fd, text, strlen (text));
+  }  // end of writeText
+
+// read the data records of an Intel hex file into image (address -> byte)
+//  returns false (with error set) on error
+static inline bool readHexFile (const char * fileName, std::map <unsigned long, uint8_t> & image, std::string & error)
+  {
+  FILE * f = fopen (fileName, "r");
+  if (!f)
+    {
+    error = "cannot open file";
+    return false;
+    }
+
+  unsigned long extendedAddress = 0;
+  int lineNumber = 0;
+  char line [600];
+  while (fgets (line, sizeof line, f))
+    {
+    lineNumber++;
+    size_t len = strlen (line);
+    while (len > 0 && isspace ((unsigned char) line [len - 1]))
+      line [--len] = 0;
+    if (len == 0)
+      continue;
+
+    if (line [0] != ':' || len < 11 || (len % 2) == 0)
+      {
+      error = "line " + std::to_string (lineNumber) + ": not a hex record";
+      fclose (f);
+      return false;
+      }
+
+    std::vector <uint8_t> record;
+    uint8_t sumCheck = 0;
+    for (size_t i = 1; i < len; i += 2)
+      {
+      char pair [3] = { line [i], line [i + 1], 0 };
+      char * end;
+      const uint8_t b = strtoul (pair, &end, 16);
+      if (*end)
+        {
+        error = "line " + std::to_string (lineNumber) + ": invalid hex digits";
+        fclose (f);
+        return false;
+        }
+      record.push_back (b);
+      sumCheck += b;
+      }  // end of for each pair
+
+    if (sumCheck != 0 || record [0] != record.size () - 5)
+      {
+      error = "line " + std::to_string (lineNumber) + ": bad sumcheck or length";
+      fclose (f);
+      return false;
+      }
+
+    const unsigned long addr = ((unsigned long) record [1] << 8) | record [2];
+    switch (record [3])
+      {
+      case 0:   // data
+        for (unsigned int i = 0; i < record [0]; i++)
+          image [extendedAddress + addr + i] = record [4 + i];
+        break;
+
+      case 1:   // end of file
+        fclose (f);
+        return true;
+
+      case 2:   // extended segment address
+        extendedAddress = (((unsigned long) record [4] << 8) | record [5]) << 4;
+        break;
+
+      case 4:   // extended linear address
+        extendedAddress = (((unsigned long) record [4] << 8) | record [5]) << 16;
+        break;
+
+      default:  // start addresses
+        break;
+      }  // end of switch
+    }  // end of while each line
+
+  fclose (f);
+  return true;  // no end-of-file record, but what we have is OK
+  }  // end of readHexFile
+
+#endif // SERIAL_TOOLS_H
@@ -0,0 +1,272 @@
+// serialUpload.cpp
+//
+// Sends a .hex file to Atmega_Hex_Uploader over the serial port (its U command, which
+// needs SERIAL_UPLOAD true), so the file doesn't have to go onto an SD card first.
+//
+// Author: Nick Gammon
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -o serialUpload serialUpload.cpp
+//
+// To use:
+//
+//   serialUpload [-b baud] port file.hex
+//
+// The port is opened at 115200 baud, where the menu is, and after the U command
+// changed to the upload rate (default 500000, which must match UPLOAD_BAUD_RATE in
+// Serial_Upload.ino). Each page with any data in the file is sent (padded with 0xFF),
+// as many at a time as the programmer has given credits for, and sent again if
+// the programmer asks for it.
+//
+// To try it without the hardware, run serialUploadSimulator and give this the
+// pseudo-terminal it shows.
+
+#include "serialUploadProtocol.h"
+
+using namespace std;
+
+// show text from the programmer until this appears, returns false if it doesn't
+bool waitForText (const int fd, const char * wanted, const int timeout)
+  {
+  const unsigned long start = msNow ();
+  string received;
+  while (received.find (wanted) == string::npos)
+    {
+    const long left = timeout - (long) (msNow () - start);
+    uint8_t c;
+    if (left <= 0 || !readByte (fd, c, left))
+      return false;
+    if (c == '\r')
+      continue;
+    putchar (c);
+    received += c;
+    }  // end of while
+  fflush (stdout);
+  return true;
+  }  // end of waitForText
+
+int main (int argc, char * argv [])
+  {
+  unsigned long baud = UPLOAD_BAUD_RATE;
+  const char * portName = NULL;
+  const char * fileName = NULL;
+
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv [i], "-b") == 0 && i + 1 < argc)
+      baud = strtoul (argv [++i], NULL, 10);
+    else if (argv [i][0] == '-')
+      {
+      fprintf (stderr, "Unknown option: %s\n", argv [i]);
+      return 1;
+      }
+    else if (!portName)
+      portName = argv [i];
+    else if (!fileName)
+      fileName = argv [i];
+    }  // end of for each argument
+
+  if (!portName || !fileName)
+    {
+    fprintf (stderr, "Usage: %s [-b baud] port file.hex\n", argv [0]);
+    return 1;
+    }
+
+  if (baudConstant (baud) == B0)
+    {
+    fprintf (stderr, "Baud rate %lu not supported\n", baud);
+    return 1;
+    }
+
+  map <unsigned long, uint8_t> image;
+  string error;
+  if (!readHexFile (fileName, image, error))
+    {
+    fprintf (stderr, "%s: %s\n", fileName, error.c_str ());
+    return 1;
+    }
+  if (image.empty ())
+    {
+    fprintf (stderr, "%s: no data\n", fileName);
+    return 1;
+    }
+
+  const int fd = openSerialPort (portName, MENU_BAUD_RATE);
+  if (fd < 0)
+    {
+    perror (portName);
+    return 1;
+    }
+
+  // opening the port may reset the Arduino, so wait for the menu (an empty line gets it again)
+  if (!waitForText (fd, "Enter action:", 3000))
+    {
+    writeText (fd, "\n");
+    if (!waitForText (fd, "Enter action:", 10000))
+      {
+      fprintf (stderr, "\nNo menu from the programmer\n");
+      return 1;
+      }
+    }  // end of no menu at first
+
+  writeText (fd, "U");
+  if (!waitForText (fd, "waiting for the PC to start ...\n", 5000))
+    {
+    fprintf (stderr, "\nProgrammer does not support serial upload (SERIAL_UPLOAD in Atmega_Hex_Uploader)\n");
+    return 1;
+    }
+
+  tcdrain (fd);
+  if (!setSerialMode (fd, baud))
+    {
+    perror (portName);
+    return 1;
+    }
+
+  const unsigned long startTime = msNow ();
+
+  // start (the chip is erased), keep asking until it is ready
+  uploadReplyType reply;
+  bool ready = false;
+  for (int i = 0; i < 40 && !ready; i++)
+    {
+    const vector <uint8_t> frame = makeUploadFrame ({ 'S', 0, 0, {} });
+    writeAll (fd, frame.data (), frame.size ());
+    while (!ready && readUploadReply (fd, reply, 250))
+      ready = reply.type == 'R';
+    }  // end of for each attempt
+
+  if (!ready || reply.info == 0 || reply.info > UPLOAD_MAX_PAGE || reply.seq == 0)
+    {
+    fprintf (stderr, "No response to start of upload\n");
+    return 1;
+    }
+
+  const unsigned int pageSize = reply.info;
+  const unsigned int credits = reply.seq;
+
+  // pages with anything in them
+  vector <unsigned long> pages;
+  for (const auto & item : image)
+    if (pages.empty () || item.first / pageSize * pageSize != pages.back ())
+      pages.push_back (item.first / pageSize * pageSize);
+
+  printf ("Sending %u pages of %u bytes (%u at a time) at %lu baud\n",
+          (unsigned int) pages.size (), pageSize, credits, baud);
+
+  size_t base = 0;      // oldest page not yet written
+  size_t next = 0;      // next page to send
+  unsigned int available = credits;
+  vector <bool> written (pages.size (), false);
+  unsigned int resent = 0;
+  unsigned int timeouts = 0;
+  bool failed = false;
+
+  while (base < pages.size () && !failed)
+    {
+    // send as many as we have credits for
+    while (available > 0 && next < pages.size ())
+      {
+      uploadFrameType frame = { 'P', (uint8_t) next, pages [next], vector <uint8_t> (pageSize, 0xFF) };
+      for (unsigned int i = 0; i < pageSize; i++)
+        {
+        auto found = image.find (pages [next] + i);
+        if (found != image.end ())
+          frame.data [i] = found->second;
+        }
+      const vector <uint8_t> bytes = makeUploadFrame (frame);
+      writeAll (fd, bytes.data (), bytes.size ());
+      next++;
+      available--;
+      }  // end of while credits
+
+    if (!readUploadReply (fd, reply, 2000))
+      {
+      if (++timeouts > 5)
+        {
+        fprintf (stderr, "\nNo response from the programmer\n");
+        failed = true;
+        break;
+        }
+      // start again from the oldest page not yet written
+      next = base;
+      available = credits;
+      continue;
+      }  // end of timeout
+    timeouts = 0;
+
+    // which page the reply is about (seq is the page number, modulo 256)
+    const size_t page = base + (uint8_t) (reply.seq - (uint8_t) base);
+
+    switch (reply.type)
+      {
+      case 'K':
+        if (page < next)
+          written [page] = true;
+        while (base < pages.size () && written [base])
+          {
+          base++;
+          putchar ('#');
+          if (base % 64 == 0)
+            putchar ('\n');
+          fflush (stdout);
+          }
+        available++;
+        break;
+
+      case 'N':
+        // send again from that one
+        if (page < next)
+          {
+          next = page;
+          resent++;
+          }
+        available++;
+        break;
+
+      case 'F':
+        fprintf (stderr, "\nPage at 0x%lX failed: %s\n", pages [min (page, pages.size () - 1)],
+                 reply.info == uploadBadAddress ? "address not in flash" :
+                 reply.info == uploadVerifyFailed ? "did not verify" : "unknown reason");
+        failed = true;
+        break;
+
+      default:
+        break;
+      }  // end of switch on reply type
+
+    available = min (available, credits);
+    }  // end of while pages left
+
+  // finish off, the programmer answers when everything is written
+  bool done = false;
+  for (int i = 0; i < 5 && !done && !failed; i++)
+    {
+    const vector <uint8_t> frame = makeUploadFrame ({ 'E', (uint8_t) pages.size (), 0, {} });
+    writeAll (fd, frame.data (), frame.size ());
+    while (!done && readUploadReply (fd, reply, 2000))
+      done = reply.type == 'D';
+    }  // end of for each attempt
+
+  const unsigned long elapsed = msNow () - startTime;
+
+  // back to the menu rate, show what it says
+  tcdrain (fd);
+  setSerialMode (fd, MENU_BAUD_RATE);
+  printf ("\n");
+  waitForText (fd, "Enter action:", 3000);
+  printf ("\n");
+
+  if (!done)
+    {
+    fprintf (stderr, "Upload failed\n");
+    return 1;
+    }
+
+  printf ("%u pages (%lu bytes) written and verified in %lu mS (%lu bytes/second), %u sent again\n",
+          reply.info, (unsigned long) pages.size () * pageSize, elapsed,
+          elapsed ? (unsigned long) pages.size () * pageSize * 1000 / elapsed : 0, resent);
+  close (fd);
+  return 0;
+  }  // end of main
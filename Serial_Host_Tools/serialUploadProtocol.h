@@ -0,0 +1,102 @@
+// serialUploadProtocol.h
+//
+// Frames for uploading to Atmega_Hex_Uploader over the serial port (its U command).
+// The protocol is described at the start of Atmega_Hex_Uploader/Serial_Upload.ino.
+//
+// Author: Nick Gammon
+
+#ifndef SERIAL_UPLOAD_PROTOCOL_H
+#define SERIAL_UPLOAD_PROTOCOL_H
+
+#include "serialTools.h"
+
+const uint8_t UPLOAD_SOH = 0x01;
+const unsigned int UPLOAD_MAX_PAGE = 256;
+const unsigned long UPLOAD_BAUD_RATE = 500000;   // as in Serial_Upload.ino
+const unsigned long MENU_BAUD_RATE = 115200;
+
+// reasons for 'F', in info
+enum {
+    uploadBadAddress = 1,
+    uploadVerifyFailed = 2,
+};
+
+// a frame from the PC
+typedef struct {
+  uint8_t type;
+  uint8_t seq;
+  unsigned long address;
+  std::vector <uint8_t> data;
+  } uploadFrameType;
+
+// a reply from the programmer
+typedef struct {
+  uint8_t type;
+  uint8_t seq;
+  unsigned int info;
+  } uploadReplyType;
+
+// the bytes of a frame from the PC
+static inline std::vector <uint8_t> makeUploadFrame (const uploadFrameType & frame)
+  {
+  std::vector <uint8_t> bytes;
+  bytes.reserve (frame.data.size () + 11);
+  for (uint8_t b : { UPLOAD_SOH, frame.type, frame.seq,
+                     (uint8_t) frame.address, (uint8_t) (frame.address >> 8),
+                     (uint8_t) (frame.address >> 16), (uint8_t) (frame.address >> 24),
+                     (uint8_t) frame.data.size (), (uint8_t) (frame.data.size () >> 8) })
+    bytes.push_back (b);
+  bytes.insert (bytes.end (), frame.data.begin (), frame.data.end ());
+  uint16_t crc = 0;
+  for (size_t i = 1; i < bytes.size (); i++)
+    crc = crcXmodemUpdate (crc, bytes [i]);
+  bytes.push_back (crc & 0xFF);
+  bytes.push_back (crc >> 8);
+  return bytes;
+  }  // end of makeUploadFrame
+
+// the bytes of a reply from the programmer
+static inline std::vector <uint8_t> makeUploadReply (const uploadReplyType & reply)
+  {
+  std::vector <uint8_t> bytes = { UPLOAD_SOH, reply.type, reply.seq,
+                                  (uint8_t) reply.info, (uint8_t) (reply.info >> 8) };
+  uint16_t crc = 0;
+  for (size_t i = 1; i < bytes.size (); i++)
+    crc = crcXmodemUpdate (crc, bytes [i]);
+  bytes.push_back (crc & 0xFF);
+  bytes.push_back (crc >> 8);
+  return bytes;
+  }  // end of makeUploadReply
+
+// wait up to timeout mS for a reply with a good CRC (anything else is skipped)
+//  returns false if none
+static inline bool readUploadReply (const int fd, uploadReplyType & reply, const int timeout)
+  {
+  const unsigned long start = msNow ();
+  uint8_t bytes [7];
+  size_t count = 0;
+  while (true)
+    {
+    const long left = timeout - (long) (msNow () - start);
+    uint8_t b;
+    if (left <= 0 || !readByte (fd, b, left))
+      return false;
+    if (count == 0 && b != UPLOAD_SOH)
+      continue;
+    bytes [count++] = b;
+    if (count < sizeof bytes)
+      continue;
+    count = 0;
+    uint16_t crc = 0;
+    for (size_t i = 1; i < 5; i++)
+      crc = crcXmodemUpdate (crc, bytes [i]);
+    if (crc != (bytes [5] | (bytes [6] << 8)))
+      continue;  // not a good frame, look for the next one
+    reply.type = bytes [1];
+    reply.seq = bytes [2];
+    reply.info = bytes [3] | (bytes [4] << 8);
+    return true;
+    }  // end of while
+  }  // end of readUploadReply
+
+#endif // SERIAL_UPLOAD_PROTOCOL_H
@@ -0,0 +1,357 @@
+// serialUploadSimulator.cpp
+//
+// Pretends to be Atmega_Hex_Uploader (with SERIAL_UPLOAD true) and its target chip, on a
+// pseudo-terminal, so that serialUpload can be tried out without any hardware.
+//
+// Author: Nick Gammon
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -o serialUploadSimulator serialUploadSimulator.cpp
+//
+// To use:
+//
+//   serialUploadSimulator [-p page_size] [-f flash_size] [-w write_mS] [-e n] [-o file.bin] [-1]
+//
+//   -p  flash page size (default 128, as for the Atmega328P)
+//   -f  flash size (default 32768)
+//   -w  time each page takes to write (default 5 mS), pages arrive during it as on the real thing
+//   -e  throw away every nth frame as if its CRC was wrong, to try out the retries
+//   -o  write the flash contents to this file after each upload
+//   -1  exit after one upload (the exit code is 0 if it worked)
+//
+// It shows the name of the pseudo-terminal (eg. /dev/pts/3) to give to serialUpload.
+// The frames are handled the same way as in Atmega_Hex_Uploader/Serial_Upload.ino.
+
+#include "serialUploadProtocol.h"
+
+using namespace std;
+
+unsigned int pageSize = 128;
+unsigned long flashSize = 32768;
+unsigned long writeTime = 5;
+unsigned int corruptEvery = 0;
+const char * outputFile = NULL;
+
+const uint8_t UPLOAD_CREDITS = 2;
+const unsigned long UPLOAD_IDLE_TIMEOUT = 5000;
+const unsigned long UPLOAD_BYTE_TIMEOUT = 50;
+
+vector <uint8_t> flash;
+
+// the programmer's side of one upload
+class Upload
+  {
+  public:
+    Upload (const int fd) : fd_ (fd) { }
+
+    bool run ();
+
+  private:
+    void reply (const uint8_t type, const uint8_t seq, const unsigned int info);
+    void frame (const bool crcOK);
+    void receive (const uint8_t c);
+
+    int fd_;
+
+    // page buffers
+    uint8_t buffer_ [UPLOAD_CREDITS] [UPLOAD_MAX_PAGE];
+    unsigned long bufferAddress_ [UPLOAD_CREDITS];
+    uint8_t bufferSeq_ [UPLOAD_CREDITS];
+    unsigned int full_ = 0;
+    unsigned int next_ = 0;
+
+    // frame being received
+    uint8_t header_ [8];
+    unsigned int received_ = 0;
+    unsigned int frameBuffer_ = 0;   // UPLOAD_CREDITS if none
+    uint16_t crc_ = 0;
+    uint8_t crcLow_ = 0;
+    unsigned long lastByte_ = 0;
+    unsigned int frames_ = 0;
+
+    uint8_t expectedSeq_ = 0;
+    uint8_t writtenSeq_ = 0;        // next page to be written
+    unsigned int pagesWritten_ = 0;
+    bool started_ = false;
+    bool ended_ = false;
+    bool failed_ = false;
+  };  // end of class Upload
+
+void Upload::reply (const uint8_t type, const uint8_t seq, const unsigned int info)
+  {
+  const vector <uint8_t> bytes = makeUploadReply ({ type, seq, info });
+  writeAll (fd_, bytes.data (), bytes.size ());
+  }  // end of Upload::reply
+
+void Upload::frame (bool crcOK)
+  {
+  const uint8_t seq = header_ [1];
+
+  if (corruptEvery && ++frames_ % corruptEvery == 0)
+    crcOK = false;
+
+  if (!crcOK)
+    {
+    reply ('N', expectedSeq_, 0);
+    return;
+    }
+
+  switch (header_ [0])
+    {
+    case 'S':
+      if (!started_)
+        {
+        flash.assign (flashSize, 0xFF);
+        started_ = true;
+        }
+      reply ('R', UPLOAD_CREDITS, pageSize);
+      break;
+
+    case 'P':
+      {
+      unsigned long addr = 0;
+      for (int i = 0; i < 4; i++)
+        addr |= (unsigned long) header_ [2 + i] << (i * 8);
+
+      if (seq != expectedSeq_)
+        {
+        // as the programmer: answered if written, ignored if still buffered
+        if ((uint8_t) (writtenSeq_ - seq - 1) < UPLOAD_CREDITS)
+          reply ('K', seq, 0);
+        else if ((uint8_t) (seq - writtenSeq_) >= (uint8_t) (expectedSeq_ - writtenSeq_))
+          reply ('N', expectedSeq_, 0);
+        break;
+        }
+
+      if (!started_ || frameBuffer_ == UPLOAD_CREDITS || (unsigned int) (header_ [6] | (header_ [7] << 8)) != pageSize)
+        {
+        reply ('N', expectedSeq_, 0);
+        break;
+        }
+
+      if ((addr & (pageSize - 1)) || addr + pageSize > flashSize)
+        {
+        reply ('F', seq, uploadBadAddress);
+        failed_ = true;
+        break;
+        }
+
+      bufferAddress_ [frameBuffer_] = addr;
+      bufferSeq_ [frameBuffer_] = seq;
+      full_++;
+      expectedSeq_++;
+      }
+      break;
+
+    case 'E':
+      if (seq == expectedSeq_)
+        ended_ = true;
+      else
+        reply ('N', expectedSeq_, 0);
+      break;
+
+    default:
+      reply ('N', expectedSeq_, 0);
+      break;
+    }  // end of switch on frame type
+  }  // end of Upload::frame
+
+void Upload::receive (const uint8_t c)
+  {
+  lastByte_ = msNow ();
+
+  if (received_ == 0)
+    {
+    if (c == UPLOAD_SOH)
+      {
+      received_ = 1;
+      crc_ = 0;
+      }
+    return;
+    }
+
+  const unsigned int pos = received_++ - 1;
+  if (pos < sizeof header_)
+    {
+    header_ [pos] = c;
+    crc_ = crcXmodemUpdate (crc_, c);
+    if (pos == sizeof header_ - 1)
+      {
+      if ((unsigned int) (header_ [6] | (header_ [7] << 8)) > UPLOAD_MAX_PAGE)
+        {
+        received_ = 0;
+        reply ('N', expectedSeq_, 0);
+        }
+      else
+        frameBuffer_ = full_ < UPLOAD_CREDITS ? (next_ + full_) % UPLOAD_CREDITS : UPLOAD_CREDITS;
+      }
+    return;
+    }
+
+  const unsigned int length = header_ [6] | (header_ [7] << 8);
+  if (pos < sizeof header_ + length)
+    {
+    crc_ = crcXmodemUpdate (crc_, c);
+    if (frameBuffer_ != UPLOAD_CREDITS)
+      buffer_ [frameBuffer_] [pos - sizeof header_] = c;
+    }
+  else if (pos == sizeof header_ + length)
+    crcLow_ = c;
+  else
+    {
+    received_ = 0;
+    frame ((crcLow_ | (c << 8)) == crc_);
+    }
+  }  // end of Upload::receive
+
+// returns true if the upload finished
+bool Upload::run ()
+  {
+  lastByte_ = msNow ();
+  unsigned long writeDone = 0;   // when the page being written will be finished (0 = none being written)
+
+  while (!failed_)
+    {
+    // take what has arrived, waiting a little if nothing has
+    uint8_t c;
+    if (readByte (fd_, c, 1))
+      {
+      receive (c);
+      while (readByte (fd_, c, 0))
+        receive (c);
+      }
+
+    if (received_ && msNow () - lastByte_ > UPLOAD_BYTE_TIMEOUT)
+      {
+      received_ = 0;
+      reply ('N', expectedSeq_, 0);
+      }
+
+    // start writing the next page, or finish the one being written
+    if (full_ && !writeDone)
+      writeDone = msNow () + writeTime;
+    else if (writeDone && msNow () >= writeDone)
+      {
+      copy (buffer_ [next_], buffer_ [next_] + pageSize, flash.begin () + bufferAddress_ [next_]);
+      const uint8_t seq = bufferSeq_ [next_];
+      next_ = (next_ + 1) % UPLOAD_CREDITS;
+      full_--;
+      writtenSeq_ = seq + 1;
+      pagesWritten_++;
+      writeDone = 0;
+      reply ('K', seq, 0);
+      continue;
+      }
+
+    if (ended_ && !full_)
+      {
+      reply ('D', expectedSeq_, pagesWritten_);
+      return true;
+      }
+
+    if (msNow () - lastByte_ > UPLOAD_IDLE_TIMEOUT)
+      return false;
+    }  // end of while
+
+  return false;
+  }  // end of Upload::run
+
+void showMenu (const int fd)
+  {
+  writeText (fd, "Actions:\r\n"
+                 " [U] upload to flash from the PC (serialUpload)\r\n"
+                 "Enter action:\r\n");
+  }  // end of showMenu
+
+int main (int argc, char * argv [])
+  {
+  bool once = false;
+
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv [i], "-p") == 0 && i + 1 < argc)
+      pageSize = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-f") == 0 && i + 1 < argc)
+      flashSize = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-w") == 0 && i + 1 < argc)
+      writeTime = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-e") == 0 && i + 1 < argc)
+      corruptEvery = strtoul (argv [++i], NULL, 0);
+    else if (strcmp (argv [i], "-o") == 0 && i + 1 < argc)
+      outputFile = argv [++i];
+    else if (strcmp (argv [i], "-1") == 0)
+      once = true;
+    else
+      {
+      fprintf (stderr, "Usage: %s [-p page_size] [-f flash_size] [-w write_mS] [-e n] [-o file.bin] [-1]\n", argv [0]);
+      return 1;
+      }
+    }  // end of for each argument
+
+  if (pageSize == 0 || pageSize > UPLOAD_MAX_PAGE || (pageSize & (pageSize - 1)) || flashSize % pageSize)
+    {
+    fprintf (stderr, "Page size must be a power of 2, up to %u, and divide the flash size\n", UPLOAD_MAX_PAGE);
+    return 1;
+    }
+
+  string slaveName;
+  int slave;
+  const int fd = openPseudoTerminal (slaveName, slave);
+  if (fd < 0)
+    {
+    perror ("pseudo-terminal");
+    return 1;
+    }
+
+  printf ("Simulated programmer on %s\n", slaveName.c_str ());
+  fflush (stdout);
+
+  flash.assign (flashSize, 0xFF);
+  showMenu (fd);
+
+  while (true)
+    {
+    uint8_t c;
+    if (!readByte (fd, c, -1))
+      continue;
+
+    if (c == '\n')
+      {
+      showMenu (fd);
+      continue;
+      }
+
+    if (toupper (c) != 'U')
+      continue;
+
+    writeText (fd, "U\r\nSerial upload at 500000 baud, waiting for the PC to start ...\r\n");
+
+    const unsigned long start = msNow ();
+    Upload upload (fd);
+    const bool ok = upload.run ();
+
+    // give the PC time to change back to the menu baud rate
+    usleep (100000);
+
+    char message [100];
+    snprintf (message, sizeof message, "\r\n%s in %lu mS.\r\n", ok ? "Upload done" : "Upload failed", msNow () - start);
+    writeText (fd, message);
+    fprintf (stderr, "%s", message + 2);
+
+    if (ok && outputFile)
+      {
+      FILE * f = fopen (outputFile, "wb");
+      if (!f || fwrite (flash.data (), 1, flash.size (), f) != flash.size ())
+        perror (outputFile);
+      if (f)
+        fclose (f);
+      }  // end of writing the flash
+
+    if (once)
+      return ok ? 0 : 1;
+
+    showMenu (fd);
+    }  // end of while
+
+  }  // end of main
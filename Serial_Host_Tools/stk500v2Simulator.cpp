@@ -0,0 +1,276 @@
+// stk500v2Simulator.cpp
+//
+// Runs the STK500 version 2 server from Atmega_Hex_Uploader (Stk500v2_Server.ino) on a
+// pseudo-terminal, with a simulated target chip, so that avrdude can be tried against it
+// without any hardware.
+//
+// Author: Nick Gammon
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -o stk500v2Simulator stk500v2Simulator.cpp
+//
+// To use:
+//
+//   stk500v2Simulator [-d device] [-o file.bin] [-v]
+//
+//   -d  which chip to pretend to be, as named in Signatures.h (default ATmega328P)
+//   -o  write the flash contents to this file when avrdude leaves programming mode
+//   -v  show what is done to the chip
+//
+// It shows the name of the pseudo-terminal (eg. /dev/pts/3) to give to avrdude, eg.
+//
+//   avrdude -c stk500v2 -P /dev/pts/3 -b 500000 -p m328p -U flash:w:sketch.hex:i
+//
+// The server code is the sketch's own: this file supplies just enough of the Arduino core for
+// it, and a chip in place of the functions in ICSP_Utils.ino. Flash bits can only be cleared
+// by writing, as on the real thing, so a page written without an erase first shows up.
+
+#include "serialTools.h"
+
+// ---------------------- just enough of the Arduino core ----------------------
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *) (p))
+#define memcpy_P memcpy
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t) ((w) & 0xFF))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+static inline unsigned int word (const uint8_t high, const uint8_t low)
+  {
+  return (high << 8) | low;
+  }  // end of word
+
+static inline unsigned long millis ()
+  {
+  return msNow ();
+  }  // end of millis
+
+// the serial port is the pseudo-terminal
+class SimulatedSerial
+  {
+  public:
+    int fd = -1;
+
+    void begin (const unsigned long) { }
+    explicit operator bool () const { return true; }
+
+    // waits a moment if there is nothing, so the server's loop doesn't use all the CPU
+    int available ()
+      {
+      struct pollfd pfd = { fd, POLLIN, 0 };
+      return poll (&pfd, 1, 1) > 0 && (pfd.revents & POLLIN);
+      }
+    int read ()
+      {
+      uint8_t b;
+      return readByte (fd, b, 0) ? b : -1;
+      }
+    void write (const uint8_t b) { writeAll (fd, &b, 1); }
+    void write (const uint8_t * data, const size_t length) { writeAll (fd, data, length); }
+  };  // end of class SimulatedSerial
+
+SimulatedSerial Serial;
+
+// ---------------------- the sketch ----------------------
+
+#define ICSP_PROGRAMMING false   // no SPI instructions are passed through to the chip
+#define STK500V2_SERVER true
+
+const bool allowTargetToRun = true;
+
+#include "../Atmega_Hex_Uploader/Signatures.h"
+#include "../Atmega_Hex_Uploader/General_Stuff.h"
+
+bool unsafeFuse (const byte fusenumber, const byte newValue);
+void eraseMemory ();
+byte readFuse (const byte which);
+void writeFuse (const byte newValue, const byte whichFuse);
+void readSignature (byte sig [3]);
+byte readFlash (unsigned long addr);
+void writeFlash (unsigned long addr, const byte data);
+byte readEEPROM (unsigned long addr);
+void writeEEPROM (unsigned long addr, const byte data);
+void commitEEPROMPage (unsigned long addr);
+bool startProgramming ();
+void stopProgramming ();
+
+#include "../Atmega_Hex_Uploader/Stk500v2_Server.ino"
+
+// ---------------------- the simulated chip ----------------------
+
+signatureType chip;
+std::vector <uint8_t> chipFlash;
+std::vector <uint8_t> chipEEPROM;
+std::vector <uint8_t> chipPage;           // flash page buffer
+std::map <unsigned int, uint8_t> chipEEPROMPage;  // EEPROM page buffer (offset -> byte), only those loaded
+uint8_t chipFuses [5] = { 0xFF, 0xDE, 0xFD, 0xFF, 0x9A };  // low, high, extended, lock, calibration
+bool verbose = false;
+const char * outputFile = NULL;
+
+// the same checks as in Atmega_Hex_Uploader.ino
+bool unsafeFuse (const byte fusenumber, const byte newValue)
+  {
+  return fusenumber == highFuse && ((newValue & 0xC0) != 0xC0 || (newValue & 0x20) != 0);
+  }  // end of unsafeFuse
+
+void eraseMemory ()
+  {
+  std::fill (chipFlash.begin (), chipFlash.end (), 0xFF);
+  std::fill (chipEEPROM.begin (), chipEEPROM.end (), 0xFF);  // EESAVE is not simulated
+  chipFuses [lockByte] = 0xFF;
+  if (verbose)
+    fprintf (stderr, "Chip erased\n");
+  }  // end of eraseMemory
+
+byte readFuse (const byte which)
+  {
+  return chipFuses [which];
+  }  // end of readFuse
+
+void writeFuse (const byte newValue, const byte whichFuse)
+  {
+  if (newValue == 0)
+    return;  // ignored, as in ICSP_Utils.ino
+  chipFuses [whichFuse] = newValue;
+  if (verbose)
+    fprintf (stderr, "Fuse %u = 0x%02X\n", whichFuse, newValue);
+  }  // end of writeFuse
+
+void readSignature (byte sig [3])
+  {
+  memcpy (sig, chip.sig, 3);
+  }  // end of readSignature
+
+byte readFlash (unsigned long addr)
+  {
+  return addr < chipFlash.size () ? chipFlash [addr] : 0xFF;
+  }  // end of readFlash
+
+void writeFlash (unsigned long addr, const byte data)
+  {
+  chipPage [addr % chip.pageSize] = data;
+  }  // end of writeFlash
+
+void commitPage (unsigned long addr, bool, bool)
+  {
+  addr &= ~(chip.pageSize - 1);
+  if (addr + chip.pageSize > chipFlash.size ())
+    fprintf (stderr, "Page at 0x%lX is past the end of flash\n", addr);
+  else
+    for (unsigned int i = 0; i < chip.pageSize; i++)
+      chipFlash [addr + i] &= chipPage [i];  // writing can only clear bits
+  std::fill (chipPage.begin (), chipPage.end (), 0xFF);
+  if (verbose)
+    fprintf (stderr, "Flash page at 0x%05lX written\n", addr);
+  }  // end of commitPage
+
+byte readEEPROM (unsigned long addr)
+  {
+  return addr < chipEEPROM.size () ? chipEEPROM [addr] : 0xFF;
+  }  // end of readEEPROM
+
+void writeEEPROM (unsigned long addr, const byte data)
+  {
+  if (chip.eepromPageSize == 0)
+    {
+    if (addr < chipEEPROM.size ())
+      chipEEPROM [addr] = data;
+    return;
+    }
+  chipEEPROMPage [addr % chip.eepromPageSize] = data;
+  }  // end of writeEEPROM
+
+void commitEEPROMPage (unsigned long addr)
+  {
+  addr &= ~((unsigned long) chip.eepromPageSize - 1);
+  for (const auto & item : chipEEPROMPage)
+    if (addr + item.first < chipEEPROM.size ())
+      chipEEPROM [addr + item.first] = item.second;
+  chipEEPROMPage.clear ();
+  }  // end of commitEEPROMPage
+
+bool startProgramming ()
+  {
+  if (verbose)
+    fprintf (stderr, "Programming mode on\n");
+  return true;
+  }  // end of startProgramming
+
+void stopProgramming ()
+  {
+  if (verbose)
+    fprintf (stderr, "Programming mode off\n");
+
+  if (!outputFile)
+    return;
+
+  FILE * f = fopen (outputFile, "wb");
+  if (!f || fwrite (chipFlash.data (), 1, chipFlash.size (), f) != chipFlash.size ())
+    perror (outputFile);
+  if (f)
+    fclose (f);
+  }  // end of stopProgramming
+
+int main (int argc, char * argv [])
+  {
+  const char * device = "ATmega328P";
+
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv [i], "-d") == 0 && i + 1 < argc)
+      device = argv [++i];
+    else if (strcmp (argv [i], "-o") == 0 && i + 1 < argc)
+      outputFile = argv [++i];
+    else if (strcmp (argv [i], "-v") == 0)
+      verbose = true;
+    else
+      {
+      fprintf (stderr, "Usage: %s [-d device] [-o file.bin] [-v]\n", argv [0]);
+      return 1;
+      }
+    }  // end of for each argument
+
+  bool found = false;
+  for (unsigned int i = 0; i < NUMITEMS (signatures) && !found; i++)
+    if (strcasecmp (signatures [i].desc, device) == 0)
+      {
+      chip = signatures [i];
+      found = true;
+      }
+
+  if (!found)
+    {
+    fprintf (stderr, "Unknown device %s, choose one of:\n", device);
+    for (unsigned int i = 0; i < NUMITEMS (signatures); i++)
+      fprintf (stderr, " %s", signatures [i].desc);
+    fprintf (stderr, "\n");
+    return 1;
+    }
+
+  chipFlash.assign (chip.flashSize, 0xFF);
+  chipEEPROM.assign (chip.eepromSize, 0xFF);
+  chipPage.assign (chip.pageSize, 0xFF);
+
+  std::string slaveName;
+  int slave;
+  Serial.fd = openPseudoTerminal (slaveName, slave);
+  if (Serial.fd < 0)
+    {
+    perror ("pseudo-terminal");
+    return 1;
+    }
+
+  printf ("Simulated %s on %s\n", chip.desc, slaveName.c_str ());
+  fflush (stdout);
+
+  // as in setup and loop in Atmega_Hex_Uploader.ino
+  stk500v2Begin ();
+  while (true)
+    stk500v2Server ();
+
+  }  // end of main
@@ -0,0 +1,767 @@
+// convertHexToByteArray.cpp
+//
+// Converts bootloader .hex files into the C arrays (and table rows) used by
+// Atmega_Board_Programmer and Atmega_Board_Detector.
+//
+// Author: Nick Gammon
+//
+// Does the same job as convertHexToByteArray.py and bootloader_converter.lua, but
+// needs nothing except a C++ compiler, and does a whole directory of files at once
+// (one thread per core).
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -pthread -o convertHexToByteArray convertHexToByteArray.cpp
+//
+// To use:
+//
+//   convertHexToByteArray [-o output_directory] file.hex|file.h|directory ...
+//
+// For each .hex file (or each .hex file in each directory) this writes <name>.h into
+// the output directory (default: the current directory), holding:
+//
+//   const byte <name>_hex [] PROGMEM = { ... };        (packed, see below)
+//   const unsigned int <name>_hex_length = ...;        (unpacked length)
+//
+// A .h file holding an unpacked array (eg. from the Python or Lua scripts) is packed,
+// keeping its name and comments, and written to the output directory.
+//
+// The image is packed as Atmega_Board_Programmer expects (see unpackByte there).
+// Each code byte is followed by its data:
+//
+//   0x00 to 0x7F: n + 1 bytes, as they are
+//   0x80 to 0xBF: one more byte, making a 14-bit count with the low 6 bits of the code,
+//                 then the byte to repeat count + 1 times
+//   0xC0 to 0xFF: one byte d, then (code & 0x3F) + 3 bytes are copied from d + 1
+//                 bytes back (within the last 256 unpacked bytes)
+//
+// Then it shows, on standard output, ready to paste in:
+//
+//   * rows for bootloaders [] in Atmega_Board_Programmer.ino (the signature and fuses
+//     can't be worked out from the .hex file, so check those)
+//   * the file name strings and deviceDatabase [] rows for Atmega_Board_Detector.ino
+//
+// The MD5 sum is of the whole bootloader area (padded with 0xFF), as the detector
+// calculates it. The end of that area is deduced from the start address, using
+// the same table as the Python and Lua scripts.
+//
+// Errors are shown on standard error, and the exit code is 1 if any file failed.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <dirent.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// given a start address, deduce where the bootloader ends
+const map <unsigned long, unsigned long> endAddresses =
+  {
+  { 0x1000,  0x2000 },
+  { 0x1C00,  0x2000 },
+  { 0x1D00,  0x2000 },
+  { 0x1E00,  0x2000 },
+  { 0x3000,  0x4000 },
+  { 0x3800,  0x4000 },
+  { 0x3E00,  0x4000 },
+  { 0x7000,  0x8000 },
+  { 0x7800,  0x8000 },
+  { 0x7E00,  0x8000 },
+  { 0xF800,  0x10000 },
+  { 0x1F000, 0x20000 },
+  { 0x1FC00, 0x20000 },
+  { 0x3E000, 0x40000 },
+  };  // end of endAddresses
+
+//------------------------------------------------------------------------------
+// MD5 (RFC 1321)
+//------------------------------------------------------------------------------
+
+class MD5
+  {
+  public:
+    MD5 () : length_ (0), used_ (0)
+      {
+      state_ [0] = 0x67452301;
+      state_ [1] = 0xEFCDAB89;
+      state_ [2] = 0x98BADCFE;
+      state_ [3] = 0x10325476;
+      }
+
+    void update (const uint8_t * data, size_t count);
+    void finish (uint8_t digest [16]);
+
+  private:
+    void transform (const uint8_t block [64]);
+
+    uint32_t state_ [4];
+    uint64_t length_;     // bytes so far
+    uint8_t  buffer_ [64];
+    size_t   used_;       // bytes in buffer_
+  };  // end of class MD5
+
+void MD5::transform (const uint8_t block [64])
+  {
+  static const uint32_t K [64] =
+    {
+    0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+    0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+    0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+    0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+    0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+    0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+    0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+    0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391,
+    };
+  static const uint8_t S [64] =
+    {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+    };
+
+  uint32_t M [16];
+  for (int i = 0; i < 16; i++)
+    M [i] = (uint32_t) block [i * 4]
+          | ((uint32_t) block [i * 4 + 1] << 8)
+          | ((uint32_t) block [i * 4 + 2] << 16)
+          | ((uint32_t) block [i * 4 + 3] << 24);
+
+  uint32_t a = state_ [0], b = state_ [1], c = state_ [2], d = state_ [3];
+
+  for (int i = 0; i < 64; i++)
+    {
+    uint32_t f;
+    int g;
+    switch (i / 16)
+      {
+      case 0:  f = (b & c) | (~b & d); g = i;                break;
+      case 1:  f = (d & b) | (~d & c); g = (5 * i + 1) % 16; break;
+      case 2:  f = b ^ c ^ d;          g = (3 * i + 5) % 16; break;
+      default: f = c ^ (b | ~d);       g = (7 * i) % 16;     break;
+      }  // end of switch
+    f += a + K [i] + M [g];
+    a = d;
+    d = c;
+    c = b;
+    b += (f << S [i]) | (f >> (32 - S [i]));
+    }  // end of for each step
+
+  state_ [0] += a;
+  state_ [1] += b;
+  state_ [2] += c;
+  state_ [3] += d;
+  }  // end of MD5::transform
+
+void MD5::update (const uint8_t * data, size_t count)
+  {
+  length_ += count;
+  while (count > 0)
+    {
+    size_t n = min (count, sizeof buffer_ - used_);
+    memcpy (&buffer_ [used_], data, n);
+    used_ += n;
+    data += n;
+    count -= n;
+    if (used_ == sizeof buffer_)
+      {
+      transform (buffer_);
+      used_ = 0;
+      }
+    }  // end of while
+  }  // end of MD5::update
+
+void MD5::finish (uint8_t digest [16])
+  {
+  const uint64_t bits = length_ * 8;
+  const uint8_t pad = 0x80;
+  const uint8_t zero = 0;
+  update (&pad, 1);
+  while (used_ != 56)
+    update (&zero, 1);
+  uint8_t lengthBytes [8];
+  for (int i = 0; i < 8; i++)
+    lengthBytes [i] = (uint8_t) (bits >> (i * 8));
+  update (lengthBytes, sizeof lengthBytes);
+
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      digest [i * 4 + j] = (uint8_t) (state_ [i] >> (j * 8));
+  }  // end of MD5::finish
+
+//------------------------------------------------------------------------------
+// Conversion
+//------------------------------------------------------------------------------
+
+// what we found out about one .hex file
+typedef struct
+  {
+  string path;                // as given to us
+  string fileName;            // without the directory or ".hex"
+  string identifier;          // fileName made into a C identifier
+  string error;               // empty if OK
+  bool repack;                // a .h file to be packed, rather than a .hex file
+  string preamble;            // lines of the .h file before the array
+  unsigned long loaderStart;
+  unsigned long loaderLength; // whole bootloader area
+  vector <uint8_t> image;     // from loaderStart to the highest byte in the file
+  vector <uint8_t> packed;    // image, packed
+  uint8_t md5 [16];           // of the whole area, padded with 0xFF
+  uint8_t fileMd5 [16];       // of the .hex file itself
+  } bootloaderFile;
+
+// read a whole file, returns false on error
+bool readFile (const string & path, string & contents)
+  {
+  FILE * f = fopen (path.c_str (), "rb");
+  if (!f)
+    return false;
+  char buffer [65536];
+  size_t n;
+  while ((n = fread (buffer, 1, sizeof buffer, f)) > 0)
+    contents.append (buffer, n);
+  bool ok = !ferror (f);
+  fclose (f);
+  return ok;
+  }  // end of readFile
+
+int hexDigit (const char c)
+  {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+  }  // end of hexDigit
+
+// parse the Intel hex records, fill in the image, returns false on error (with file.error set)
+bool parseHex (const string & contents, bootloaderFile & file)
+  {
+  map <unsigned long, uint8_t> bytes;   // address -> data
+  unsigned long extendedAddress = 0;
+  bool gotEndOfFile = false;
+  int lineNumber = 0;
+
+  size_t pos = 0;
+  while (pos < contents.size () && !gotEndOfFile)
+    {
+    size_t eol = contents.find ('\n', pos);
+    if (eol == string::npos)
+      eol = contents.size ();
+    string line = contents.substr (pos, eol - pos);
+    pos = eol + 1;
+    lineNumber++;
+
+    // trailing spaces, CR etc.
+    while (!line.empty () && isspace ((unsigned char) line.back ()))
+      line.pop_back ();
+    if (line.empty ())
+      continue;
+
+    if (line [0] != ':' || line.size () < 11 || (line.size () % 2) == 0)
+      {
+      file.error = "line " + to_string (lineNumber) + ": not a hex record";
+      return false;
+      }
+
+    vector <uint8_t> record;
+    for (size_t i = 1; i < line.size (); i += 2)
+      {
+      int high = hexDigit (line [i]);
+      int low = hexDigit (line [i + 1]);
+      if (high < 0 || low < 0)
+        {
+        file.error = "line " + to_string (lineNumber) + ": invalid hex digits";
+        return false;
+        }
+      record.push_back ((uint8_t) ((high << 4) | low));
+      }  // end of for each pair
+
+    uint8_t sumCheck = 0;
+    for (uint8_t b : record)
+      sumCheck += b;
+    if (sumCheck != 0)
+      {
+      file.error = "line " + to_string (lineNumber) + ": bad sumcheck";
+      return false;
+      }
+
+    const unsigned int len = record [0];
+    if (len != record.size () - 5)
+      {
+      file.error = "line " + to_string (lineNumber) + ": record not length expected";
+      return false;
+      }
+
+    const unsigned long addr = ((unsigned long) record [1] << 8) | record [2];
+    switch (record [3])
+      {
+      case 0:   // data
+        for (unsigned int i = 0; i < len; i++)
+          bytes [extendedAddress + addr + i] = record [4 + i];
+        break;
+
+      case 1:   // end of file
+        gotEndOfFile = true;
+        break;
+
+      case 2:   // extended segment address
+        extendedAddress = (((unsigned long) record [4] << 8) | record [5]) << 4;
+        break;
+
+      case 4:   // extended linear address
+        extendedAddress = (((unsigned long) record [4] << 8) | record [5]) << 16;
+        break;
+
+      case 3:   // start segment address
+      case 5:   // start linear address
+        break;
+
+      default:
+        file.error = "line " + to_string (lineNumber) + ": unknown record type";
+        return false;
+      }  // end of switch
+    }  // end of while each line
+
+  if (!gotEndOfFile)
+    {
+    file.error = "no 'end of file' record";
+    return false;
+    }
+  if (bytes.empty ())
+    {
+    file.error = "no data";
+    return false;
+    }
+
+  file.loaderStart = bytes.begin ()->first;
+  auto end = endAddresses.find (file.loaderStart);
+  if (end == endAddresses.end ())
+    {
+    char buf [80];
+    snprintf (buf, sizeof buf, "don't know end address for start address 0x%lX", file.loaderStart);
+    file.error = buf;
+    return false;
+    }
+  file.loaderLength = end->second - file.loaderStart;
+
+  const unsigned long highest = bytes.rbegin ()->first;
+  if (highest >= end->second)
+    {
+    file.error = "data goes past the end of the bootloader area";
+    return false;
+    }
+
+  file.image.assign (highest - file.loaderStart + 1, 0xFF);
+  for (const auto & b : bytes)
+    file.image [b.first - file.loaderStart] = b.second;
+
+  return true;
+  }  // end of parseHex
+
+//------------------------------------------------------------------------------
+// Packing
+//------------------------------------------------------------------------------
+
+const size_t PACK_WINDOW = 256;     // how far back a copy can be from
+const size_t MAX_LITERAL = 128;
+const size_t MIN_COPY = 3;
+const size_t MAX_COPY = 0x3F + MIN_COPY;
+const size_t MIN_FILL = 4;          // 3 bytes to encode, so shorter isn't worth it
+const size_t MAX_FILL = 0x4000;
+
+vector <uint8_t> pack (const vector <uint8_t> & image)
+  {
+  vector <uint8_t> out;
+  size_t literalStart = 0, literalCount = 0;
+
+  // write out the pending literal bytes
+  auto flushLiterals = [&] ()
+    {
+    while (literalCount > 0)
+      {
+      const size_t n = min (literalCount, MAX_LITERAL);
+      out.push_back (n - 1);
+      out.insert (out.end (), image.begin () + literalStart, image.begin () + literalStart + n);
+      literalStart += n;
+      literalCount -= n;
+      }
+    };  // end of flushLiterals
+
+  size_t i = 0;
+  while (i < image.size ())
+    {
+    // a run of the same byte?
+    size_t run = 1;
+    while (i + run < image.size () && run < MAX_FILL && image [i + run] == image [i])
+      run++;
+
+    // longest match in the window (it may run on into the bytes it is making)
+    size_t bestLength = 0, bestDistance = 0;
+    for (size_t distance = 1; distance <= min (PACK_WINDOW, i); distance++)
+      {
+      size_t length = 0;
+      while (i + length < image.size () && length < MAX_COPY &&
+             image [i + length - distance] == image [i + length])
+        length++;
+      if (length > bestLength)
+        {
+        bestLength = length;
+        bestDistance = distance;
+        }
+      }  // end of for each distance
+
+    if (run >= MIN_FILL && run >= bestLength)
+      {
+      flushLiterals ();
+      out.push_back (0x80 | ((run - 1) >> 8));
+      out.push_back ((run - 1) & 0xFF);
+      out.push_back (image [i]);
+      i += run;
+      }
+    else if (bestLength >= MIN_COPY)
+      {
+      flushLiterals ();
+      out.push_back (0xC0 | (bestLength - MIN_COPY));
+      out.push_back (bestDistance - 1);
+      i += bestLength;
+      }
+    else
+      {
+      if (literalCount == 0)
+        literalStart = i;
+      literalCount++;
+      i++;
+      }
+    }  // end of while
+
+  flushLiterals ();
+  return out;
+  }  // end of pack
+
+// the same as unpackByte in Atmega_Board_Programmer, to check pack
+vector <uint8_t> unpack (const vector <uint8_t> & packed, const size_t length)
+  {
+  vector <uint8_t> out;
+  size_t next = 0;
+  while (out.size () < length && next < packed.size ())
+    {
+    const uint8_t code = packed [next++];
+    if (code < 0x80)
+      for (unsigned int n = code + 1; n > 0 && next < packed.size (); n--)
+        out.push_back (packed [next++]);
+    else if (code < 0xC0 && next + 1 < packed.size ())
+      {
+      const unsigned int count = (((code & 0x3F) << 8) | packed [next]) + 1;
+      out.insert (out.end (), count, packed [next + 1]);
+      next += 2;
+      }
+    else if (code >= 0xC0 && next < packed.size ())
+      {
+      const size_t distance = packed [next++] + 1;
+      if (distance > out.size ())
+        break;
+      for (unsigned int n = (code & 0x3F) + MIN_COPY; n > 0; n--)
+        out.push_back (out [out.size () - distance]);
+      }
+    else
+      break;
+    }  // end of while
+  return out;
+  }  // end of unpack
+
+// pack the image, and check it comes back the same
+void packImage (bootloaderFile & file)
+  {
+  file.packed = pack (file.image);
+  if (unpack (file.packed, file.image.size ()) != file.image)
+    file.error = "packed image does not unpack to the same bytes";
+  }  // end of packImage
+
+// get the unpacked array (and the comments before it) from a .h file
+bool parseArray (const string & contents, bootloaderFile & file)
+  {
+  const size_t progmem = contents.find ("PROGMEM");
+  const size_t start = contents.rfind ("const", progmem);
+  const size_t open = contents.find ('{', progmem);
+  const size_t close = contents.find ('}', open);
+  if (progmem == string::npos || start == string::npos || open == string::npos || close == string::npos)
+    {
+    file.error = "no PROGMEM array found";
+    return false;
+    }
+  if (contents.find ("_length") != string::npos)
+    {
+    file.error = "already packed";
+    return false;
+    }
+
+  file.preamble = contents.substr (0, start);
+
+  // the array name is the identifier just before the [
+  const size_t bracket = contents.find ('[', start);
+  size_t nameEnd = bracket;
+  while (nameEnd > start && isspace ((unsigned char) contents [nameEnd - 1]))
+    nameEnd--;
+  size_t nameStart = nameEnd;
+  while (nameStart > start && (isalnum ((unsigned char) contents [nameStart - 1]) || contents [nameStart - 1] == '_'))
+    nameStart--;
+  file.identifier = contents.substr (nameStart, nameEnd - nameStart);
+
+  for (size_t i = open; i + 3 < close; i++)
+    if (contents [i] == '0' && (contents [i + 1] == 'x' || contents [i + 1] == 'X'))
+      {
+      const int high = hexDigit (contents [i + 2]), low = hexDigit (contents [i + 3]);
+      if (high < 0 || low < 0)
+        {
+        file.error = "bad hex byte in array";
+        return false;
+        }
+      file.image.push_back ((high << 4) | low);
+      i += 3;
+      }
+
+  if (file.image.empty () || file.identifier.empty ())
+    {
+    file.error = "no PROGMEM array found";
+    return false;
+    }
+  return true;
+  }  // end of parseArray
+
+// work out everything about one file (run on a worker thread)
+void convertFile (bootloaderFile & file)
+  {
+  string contents;
+  if (!readFile (file.path, contents))
+    {
+    file.error = "cannot read file";
+    return;
+    }
+
+  if (file.repack)
+    {
+    if (parseArray (contents, file))
+      packImage (file);
+    return;
+    }
+
+  MD5 fileSum;
+  fileSum.update ((const uint8_t *) contents.data (), contents.size ());
+  fileSum.finish (file.fileMd5);
+
+  if (!parseHex (contents, file))
+    return;
+
+  MD5 sum;
+  sum.update (file.image.data (), file.image.size ());
+  const vector <uint8_t> padding (file.loaderLength - file.image.size (), 0xFF);
+  sum.update (padding.data (), padding.size ());
+  sum.finish (file.md5);
+
+  packImage (file);
+  }  // end of convertFile
+
+string md5Text (const uint8_t md5 [16], const char * format)
+  {
+  string result;
+  char buf [8];
+  for (int i = 0; i < 16; i++)
+    {
+    snprintf (buf, sizeof buf, format, md5 [i]);
+    result += buf;
+    }
+  return result;
+  }  // end of md5Text
+
+// write <name>.h into the output directory, returns false on error
+bool writeHeader (const bootloaderFile & file, const string & outputDirectory)
+  {
+  const string path = outputDirectory + "/" + file.fileName + ".h";
+  FILE * f = fopen (path.c_str (), "w");
+  if (!f)
+    return false;
+
+  // a repacked file keeps its array name (which doesn't have to end in _hex)
+  const string name = file.repack ? file.identifier : file.identifier + "_hex";
+
+  if (file.repack)
+    fprintf (f, "%s", file.preamble.c_str ());
+  else
+    {
+    fprintf (f, "// File = %s.hex\n", file.fileName.c_str ());
+    fprintf (f, "// Loader start: %lX, length: %lu\n", file.loaderStart, file.loaderLength);
+    fprintf (f, "// MD5 sum = %s\n", md5Text (file.md5, "%02X ").c_str ());
+    fprintf (f, "// Original file MD5 sum = %s\n", md5Text (file.fileMd5, "%02x").c_str ());
+    fprintf (f, "\n");
+    }
+  fprintf (f, "// Packed by convertHexToByteArray: %u bytes, %u unpacked\n",
+           (unsigned int) file.packed.size (), (unsigned int) file.image.size ());
+  fprintf (f, "const unsigned int %s_length = %u;\n", name.c_str (), (unsigned int) file.image.size ());
+  fprintf (f, "const byte %s [] PROGMEM = {\n", name.c_str ());
+  for (size_t i = 0; i < file.packed.size (); i++)
+    {
+    fprintf (f, "0x%02X,%s", file.packed [i], (i % 16 == 15 || i == file.packed.size () - 1) ? "\n" : " ");
+    }
+  fprintf (f, "};  // end of %s\n", name.c_str ());
+
+  return fclose (f) == 0;
+  }  // end of writeHeader
+
+bool endsWith (const string & s, const string & suffix)
+  {
+  if (s.size () < suffix.size ())
+    return false;
+  return strcasecmp (s.c_str () + s.size () - suffix.size (), suffix.c_str ()) == 0;
+  }  // end of endsWith
+
+// add a file, or all the .hex files in a directory, to the list
+bool addPath (const string & path, vector <bootloaderFile> & files)
+  {
+  struct stat st;
+  if (stat (path.c_str (), &st) != 0)
+    {
+    fprintf (stderr, "%s: does not exist\n", path.c_str ());
+    return false;
+    }
+
+  vector <string> paths;
+  if (S_ISDIR (st.st_mode))
+    {
+    DIR * dir = opendir (path.c_str ());
+    if (!dir)
+      {
+      fprintf (stderr, "%s: cannot open directory\n", path.c_str ());
+      return false;
+      }
+    while (struct dirent * entry = readdir (dir))
+      if (endsWith (entry->d_name, ".hex"))
+        paths.push_back (path + "/" + entry->d_name);
+    closedir (dir);
+    }
+  else
+    paths.push_back (path);
+
+  for (const string & p : paths)
+    {
+    bootloaderFile file;
+    file.path = p;
+    size_t slash = p.find_last_of ("/\\");
+    file.fileName = p.substr (slash == string::npos ? 0 : slash + 1);
+    file.repack = endsWith (file.fileName, ".h");
+    if (endsWith (file.fileName, ".hex"))
+      file.fileName.resize (file.fileName.size () - 4);
+    else if (file.repack)
+      file.fileName.resize (file.fileName.size () - 2);
+    file.identifier = file.fileName;
+    for (char & c : file.identifier)
+      if (!isalnum ((unsigned char) c))
+        c = '_';
+    if (isdigit ((unsigned char) file.identifier [0]))
+      file.identifier = "_" + file.identifier;
+    files.push_back (file);
+    }  // end of for each path
+
+  return true;
+  }  // end of addPath
+
+int main (int argc, char * argv [])
+  {
+  string outputDirectory = ".";
+  vector <bootloaderFile> files;
+  bool ok = true;
+
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv [i], "-o") == 0 && i + 1 < argc)
+      outputDirectory = argv [++i];
+    else if (argv [i][0] == '-')
+      {
+      fprintf (stderr, "Unknown option: %s\n", argv [i]);
+      return 1;
+      }
+    else
+      ok &= addPath (argv [i], files);
+    }  // end of for each argument
+
+  if (files.empty ())
+    {
+    fprintf (stderr, "Usage: %s [-o output_directory] file.hex|file.h|directory ...\n", argv [0]);
+    return 1;
+    }
+
+  // same order every time, whatever order the directory is in
+  sort (files.begin (), files.end (),
+        [] (const bootloaderFile & a, const bootloaderFile & b) { return a.fileName < b.fileName; });
+
+  // convert them on all cores
+  atomic <size_t> next (0);
+  const unsigned int threadCount = max (1U, min ((unsigned int) files.size (), thread::hardware_concurrency ()));
+  vector <thread> threads;
+  for (unsigned int t = 0; t < threadCount; t++)
+    threads.emplace_back ([&]
+      {
+      for (size_t i; (i = next++) < files.size (); )
+        {
+        convertFile (files [i]);
+        if (files [i].error.empty () && !writeHeader (files [i], outputDirectory))
+          files [i].error = "cannot write " + outputDirectory + "/" + files [i].fileName + ".h";
+        }
+      });
+  for (thread & t : threads)
+    t.join ();
+
+  for (const bootloaderFile & file : files)
+    if (!file.error.empty ())
+      {
+      fprintf (stderr, "%s: %s\n", file.path.c_str (), file.error.c_str ());
+      ok = false;
+      }
+
+  // only .hex files give table rows
+  if (none_of (files.begin (), files.end (),
+               [] (const bootloaderFile & file) { return file.error.empty () && !file.repack; }))
+    return ok ? 0 : 1;
+
+  // rows for bootloaders [] in Atmega_Board_Programmer.ino
+  printf ("// For bootloaders [] in Atmega_Board_Programmer.ino (check the signature and fuses)\n\n");
+  for (const bootloaderFile & file : files)
+    {
+    if (!file.error.empty () || file.repack)
+      continue;
+    // the second signature byte gives the flash size, the third depends on the chip
+    unsigned long flashSize = file.loaderStart + file.loaderLength;
+    int sizeCode = 0x90;
+    while ((1024UL << (sizeCode - 0x90)) < flashSize)
+      sizeCode++;
+    printf ("  // %s.hex\n", file.fileName.c_str ());
+    printf ("  { { 0x1E, 0x%02X, 0x00 },\n", sizeCode);
+    printf ("        0x%lX,               // start address\n", file.loaderStart);
+    printf ("        %s_hex,   // loader image\n", file.identifier.c_str ());
+    printf ("        %s_hex_length,\n", file.identifier.c_str ());
+    printf ("        0, 0, 0, 0 },  // fuses and lock bits (0 = leave alone)\n\n");
+    }  // end of for each file
+
+  // names and MD5 sums for Atmega_Board_Detector.ino
+  printf ("// For Atmega_Board_Detector.ino\n\n");
+  for (const bootloaderFile & file : files)
+    if (file.error.empty () && !file.repack)
+      printf ("const char %-40s [] PROGMEM = \"%s\";\n", file.identifier.c_str (), file.fileName.c_str ());
+  printf ("\n");
+  for (const bootloaderFile & file : files)
+    if (file.error.empty () && !file.repack)
+      printf ("  { { %s }, %s }, \n", md5Text (file.md5, "0x%02X, ").c_str (), file.identifier.c_str ());
+
+  return ok ? 0 : 1;
+  }  // end of main
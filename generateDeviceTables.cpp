@@ -0,0 +1,447 @@
+// generateDeviceTables.cpp
+//
+// Generates the chip signature tables used by the sketches from devices.txt.
+//
+// Author: Nick Gammon
+//
+// devices.txt is the only place the chip details should be edited. This program
+// turns it into:
+//
+//   Atmega_Hex_Uploader/Signatures.h                 (shared with Atmega_Board_Programmer
+//                                                    and Atmega_Board_Detector)
+//   Atmega_Hex_Uploader_Fixed_Filename/Signatures.h  (only the fields that sketch uses, including
+//                                                    the EEPROM size and the high fuse bits it must
+//                                                    not change)
+//
+// The Fixed_Filename copy also has a #define for each chip name, so that sketch can be
+// built for one chip only (eg. #define TARGET_DEVICE ATmega328P). Then that chip's
+// details are a const currentSignature instead of a table.
+//
+// The rows are sorted by signature and followed by a small index on the middle
+// signature byte, so findSignature () looks at only the one or two chips whose
+// middle byte matches, and reads them straight from PROGMEM. Only the matching
+// entry is then copied into RAM.
+//
+// To compile:
+//
+//   g++ -O2 -std=c++11 -o generateDeviceTables generateDeviceTables.cpp
+//
+// To use (from the top-level directory):
+//
+//   generateDeviceTables [devices.txt]
+//
+// Then run fixup_links.sh in Atmega_Board_Programmer and Atmega_Board_Detector as usual.
+//
+// Atmega_Fuse_Calculator and Atmega_Self_Read_Signature have their own tables, which are
+// not generated (see the start of devices.txt), so a new chip has to be added to them by hand.
+//
+// Errors are shown on standard error, and the exit code is 1 if nothing was written.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+// one line of devices.txt
+typedef struct
+  {
+  unsigned int sig [3];
+  string name;
+  unsigned long flashSize;
+  unsigned long baseBootSize;
+  unsigned long pageSize;
+  string fuse;              // "lowFuse", "highFuse", "extFuse" or "NO_FUSE"
+  bool timedWrites;
+  unsigned long eepromSize;
+  unsigned long eepromPageSize;
+  unsigned int keepSet;     // high fuse bits which must stay 1 (RSTDISBL, DWEN)
+  unsigned int keepClear;   // high fuse bit which must stay 0 (SPIEN)
+  string family;
+  } deviceType;
+
+// what goes into each generated file
+typedef struct
+  {
+  const char * fileName;
+  bool shared;             // the copy hard-linked into the other sketches
+  bool withDescription;    // chip name (only the sketches that show it need it)
+  bool withEeprom;         // EEPROM size
+  bool withEepromPage;     // EEPROM page size (for writing it a page at a time)
+  bool withTarget;         // TARGET_DEVICE can make it a single chip
+  bool withFuseSafety;     // high fuse bits which must not change (for job and catalog fuses)
+  } outputType;
+
+const outputType outputs [] =
+  {
+  { "Atmega_Hex_Uploader/Signatures.h",                true,  true,  true,  true,  false, false },
+  { "Atmega_Hex_Uploader_Fixed_Filename/Signatures.h", false, false, true,  false, true,  true  },
+  };
+
+const unsigned int MAX_DESCRIPTION = 13;   // fits into desc [14]
+
+// parse a size like 512, 4K or 256K
+static bool parseSize (const string & s, unsigned long & result)
+  {
+  char * end;
+  result = strtoul (s.c_str (), &end, 10);
+  if (end == s.c_str ())
+    return false;
+  if (*end == 'K' || *end == 'k')
+    {
+    result *= 1024;
+    end++;
+    }
+  return *end == 0;
+  }  // end of parseSize
+
+// a size in the style of the original tables, eg. "256 * kb"
+static string showSize (const unsigned long n)
+  {
+  char buf [30];
+  if (n >= 1024 && n % 1024 == 0)
+    snprintf (buf, sizeof buf, "%lu * kb", n / 1024);
+  else
+    snprintf (buf, sizeof buf, "%lu", n);
+  return buf;
+  }  // end of showSize
+
+static bool readDevices (const char * fileName, vector <deviceType> & devices)
+  {
+  ifstream f (fileName);
+  if (!f)
+    {
+    fprintf (stderr, "Cannot open %s\n", fileName);
+    return false;
+    }
+
+  bool ok = true;
+  string line, family;
+  unsigned int lineNumber = 0;
+  set <unsigned long> seen;
+
+  while (getline (f, line))
+    {
+    lineNumber++;
+    const size_t start = line.find_first_not_of (" \t\r");
+    if (start == string::npos || line [start] == '#')
+      continue;
+
+    if (line [start] == '[')
+      {
+      const size_t end = line.find (']', start);
+      family = line.substr (start + 1, end == string::npos ? string::npos : end - start - 1);
+      continue;
+      }
+
+    istringstream fields (line);
+    string s [13];
+    unsigned int count = 0;
+    while (count < 13 && fields >> s [count])
+      count++;
+
+    deviceType d;
+    char * end;
+    bool lineOK = count == 13;
+    for (int i = 0; lineOK && i < 3; i++)
+      {
+      d.sig [i] = strtoul (s [i].c_str (), &end, 16);
+      lineOK = *end == 0 && s [i].size () == 2;
+      }
+
+    unsigned int * keep [2] = { &d.keepSet, &d.keepClear };
+    for (int i = 0; lineOK && i < 2; i++)
+      {
+      *keep [i] = strtoul (s [11 + i].c_str (), &end, 16);
+      lineOK = *end == 0 && s [11 + i].size () == 2;
+      }
+
+    // SPIEN can't be both
+    lineOK = lineOK && (d.keepSet & d.keepClear) == 0;
+
+    d.name = s [3];
+    d.family = family;
+    lineOK = lineOK && parseSize (s [4], d.flashSize)
+                    && parseSize (s [5], d.baseBootSize)
+                    && parseSize (s [6], d.pageSize)
+                    && parseSize (s [9], d.eepromSize)
+                    && parseSize (s [10], d.eepromPageSize);
+
+    if (s [7] == "low")
+      d.fuse = "lowFuse";
+    else if (s [7] == "high")
+      d.fuse = "highFuse";
+    else if (s [7] == "ext")
+      d.fuse = "extFuse";
+    else if (s [7] == "-")
+      d.fuse = "NO_FUSE";
+    else
+      lineOK = false;
+
+    if (s [8] == "yes" || s [8] == "no")
+      d.timedWrites = s [8] == "yes";
+    else
+      lineOK = false;
+
+    if (!lineOK)
+      {
+      fprintf (stderr, "%s(%u): cannot understand: %s\n", fileName, lineNumber, line.c_str ());
+      ok = false;
+      continue;
+      }
+
+    // the lookup only indexes on the middle byte, so they must all be Atmel chips
+    if (d.sig [0] != 0x1E)
+      {
+      fprintf (stderr, "%s(%u): signature must start with 1E\n", fileName, lineNumber);
+      ok = false;
+      }
+    if (d.name.size () > MAX_DESCRIPTION)
+      {
+      fprintf (stderr, "%s(%u): name %s is longer than %u characters\n",
+               fileName, lineNumber, d.name.c_str (), MAX_DESCRIPTION);
+      ok = false;
+      }
+    const unsigned long key = (d.sig [0] << 16) | (d.sig [1] << 8) | d.sig [2];
+    if (!seen.insert (key).second)
+      {
+      fprintf (stderr, "%s(%u): signature of %s is already in the list\n",
+               fileName, lineNumber, d.name.c_str ());
+      ok = false;
+      }
+
+    devices.push_back (d);
+    }  // end of while each line
+
+  if (devices.empty ())
+    {
+    fprintf (stderr, "No devices in %s\n", fileName);
+    ok = false;
+    }
+
+  return ok;
+  }  // end of readDevices
+
+// one row of signatures [], without the leading spaces or the trailing comma
+static void writeRow (FILE * f, const outputType & out, const deviceType & d)
+  {
+  fprintf (f, "{ { 0x%02X, 0x%02X, 0x%02X }, ", d.sig [0], d.sig [1], d.sig [2]);
+  if (out.withDescription)
+    fprintf (f, "%-16s", ("\"" + d.name + "\",").c_str ());
+  fprintf (f, "%9s, %9s, %4lu, %-9s %s",
+           showSize (d.flashSize).c_str (), showSize (d.baseBootSize).c_str (),
+           d.pageSize, (d.fuse + ",").c_str (), d.timedWrites ? "true" : "false");
+  const char * pad = d.timedWrites ? " " : "";   // so "true" lines up with "false"
+  if (out.withEeprom)
+    {
+    fprintf (f, ",%s %5lu", pad, d.eepromSize);
+    pad = "";
+    }
+  if (out.withEepromPage)
+    fprintf (f, ", %lu", d.eepromPageSize);
+  if (out.withFuseSafety)
+    {
+    fprintf (f, ",%s 0x%02X, 0x%02X", pad, d.keepSet, d.keepClear);
+    pad = "";
+    }
+  fprintf (f, "%s }", pad);
+  }  // end of writeRow
+
+static bool writeTable (const outputType & out, const vector <deviceType> & devices)
+  {
+  FILE * f = fopen (out.fileName, "w");
+  if (!f)
+    {
+    fprintf (stderr, "Cannot write %s\n", out.fileName);
+    return false;
+    }
+
+  fprintf (f, "// Signatures.h\n"
+              "//\n"
+              "// Signatures and extra information for known chips\n"
+              "//\n"
+              "// Author: Nick Gammon\n"
+              "\n"
+              "/* ----------------------------------------------------------------------------\n"
+              "NOTE: This file is generated from devices.txt by generateDeviceTables.\n"
+              "Change devices.txt and regenerate it, rather than editing it here.\n");
+  if (out.shared)
+    fprintf (f, "Copies in other directories are hard-linked to the one in Atmega_Hex_Uploader.\n"
+                "After regenerating it run the shell script:\n"
+                "  fixup_links.sh\n"
+                "This script needs to be run in the directories:\n"
+                "  Atmega_Board_Programmer and Atmega_Board_Detector\n"
+                "That will ensure that those directories now are using the same file.\n");
+  fprintf (f, "------------------------------------------------------------------------------ */\n"
+              "\n");
+
+  if (out.shared)
+    fprintf (f, "\n"
+                "// copy of fuses/lock bytes found for this processor\n"
+                "byte fuses [5];\n"
+                "\n"
+                "// meaning of positions in above array\n"
+                "enum {\n"
+                "      lowFuse,\n"
+                "      highFuse,\n"
+                "      extFuse,\n"
+                "      lockByte,\n"
+                "      calibrationByte\n"
+                "};\n"
+                "\n");
+
+  fprintf (f, "// structure to hold signature and other relevant data about each chip\n"
+              "typedef struct {\n"
+              "   byte sig [3];                // chip signature\n");
+  if (out.withDescription)
+    fprintf (f, "   char desc [14];              // fixed array size keeps chip names in PROGMEM\n");
+  fprintf (f, "   unsigned long flashSize;     // how big the flash is (bytes)\n"
+              "   unsigned int baseBootSize;   // base bootloader size (others are multiples of 2/4/8)\n"
+              "   unsigned long pageSize;      // flash programming page size (bytes)\n"
+              "   byte fuseWithBootloaderSize; // ie. one of: lowFuse, highFuse, extFuse\n"
+              "   bool timedWrites;            // true if pollUntilReady won't work by polling the chip\n");
+  if (out.withEeprom)
+    fprintf (f, "   unsigned int eepromSize;     // how big the EEPROM is (bytes)\n");
+  if (out.withEepromPage)
+    fprintf (f, "   byte eepromPageSize;         // EEPROM programming page size (bytes), 0 if byte writes only\n");
+  if (out.withFuseSafety)
+    fprintf (f, "   byte highFuseKeepSet;        // high fuse bits which must stay 1 (RSTDISBL, DWEN)\n"
+                "   byte highFuseKeepClear;      // high fuse bit which must stay 0 (SPIEN)\n");
+  fprintf (f, "} signatureType;\n"
+              "\n"
+              "const unsigned long kb = 1024;\n"
+              "const byte NO_FUSE = 0xFF;\n"
+              "\n");
+
+  if (out.withTarget)
+    {
+    fprintf (f, "// chip names for TARGET_DEVICE\n"
+                "#define ANY_DEVICE    1      // not 0, so a misspelt name is an error\n");
+    for (const deviceType & d : devices)
+      fprintf (f, "#define %-13s 0x%02X%02X%02X\n", d.name.c_str (), d.sig [0], d.sig [1], d.sig [2]);
+
+    fprintf (f, "\n"
+                "#if TARGET_DEVICE != ANY_DEVICE\n"
+                "\n"
+                "// Only this chip is programmed. Its details are constants, so the compiler\n"
+                "// can work out page masks and so on in advance, and no table is needed.\n");
+    for (size_t i = 0; i < devices.size (); i++)
+      {
+      fprintf (f, "%s TARGET_DEVICE == %s\n"
+                  "  const signatureType currentSignature = ",
+               i == 0 ? "#if" : "#elif", devices [i].name.c_str ());
+      writeRow (f, out, devices [i]);
+      fprintf (f, ";\n");
+      }  // end of for each device
+    fprintf (f, "#else\n"
+                "  #error TARGET_DEVICE is not one of the chips in devices.txt\n"
+                "#endif\n"
+                "\n"
+                "// returns 0 if this is the target chip, or -1 if not\n"
+                "int findSignature (const byte sig [3])\n"
+                "  {\n"
+                "  return memcmp (sig, currentSignature.sig, sizeof currentSignature.sig) == 0 ? 0 : -1;\n"
+                "  }  // end of findSignature\n"
+                "\n"
+                "#else\n");
+    }  // end of if TARGET_DEVICE allowed
+
+  fprintf (f, "\n"
+              "// see Atmega datasheets - sorted by signature, for findSignature ()\n"
+              "const signatureType signatures [] PROGMEM =\n"
+              "  {\n");
+
+  for (const deviceType & d : devices)
+    {
+    fprintf (f, "  ");
+    writeRow (f, out, d);
+    fprintf (f, ",  // %s\n", (out.withDescription ? d.family : d.name + ", " + d.family).c_str ());
+    }  // end of for each device
+
+  fprintf (f, "\n"
+              "  };  // end of signatures\n"
+              "\n");
+
+  // index on the middle byte: entries for middle byte n are from
+  //  signatureIndex [n - FIRST_SIGNATURE_MIDDLE] up to (not including) the next one
+  const unsigned int first = devices.front ().sig [1];
+  const unsigned int last = devices.back ().sig [1];
+
+  fprintf (f, "// signatures [] entries with a middle byte of n start at\n"
+              "//   signatureIndex [n - FIRST_SIGNATURE_MIDDLE] and stop before the next one\n"
+              "const byte FIRST_SIGNATURE_MIDDLE = 0x%02X;\n"
+              "const byte LAST_SIGNATURE_MIDDLE = 0x%02X;\n"
+              "\n"
+              "const byte signatureIndex [] PROGMEM =\n"
+              "  {\n", first, last);
+
+  size_t j = 0;
+  for (unsigned int middle = first; middle <= last + 1; middle++)
+    {
+    while (j < devices.size () && devices [j].sig [1] < middle)
+      j++;
+    fprintf (f, "  %2u,  // 0x%02X\n", (unsigned int) j, middle);
+    }
+
+  fprintf (f, "  };  // end of signatureIndex\n"
+              "\n"
+              "// returns the index into signatures [] of this signature, or -1 if not known\n"
+              "int findSignature (const byte sig [3])\n"
+              "  {\n"
+              "  if (sig [0] != 0x%02X || sig [1] < FIRST_SIGNATURE_MIDDLE || sig [1] > LAST_SIGNATURE_MIDDLE)\n"
+              "    return -1;\n"
+              "\n"
+              "  const byte * bucket = &signatureIndex [sig [1] - FIRST_SIGNATURE_MIDDLE];\n"
+              "  const byte stop = pgm_read_byte (bucket + 1);\n"
+              "  for (byte j = pgm_read_byte (bucket); j < stop; j++)\n"
+              "    if (pgm_read_byte (&signatures [j].sig [2]) == sig [2])\n"
+              "      return j;\n"
+              "\n"
+              "  return -1;\n"
+              "  }  // end of findSignature\n"
+              "\n", devices.front ().sig [0]);
+
+  if (out.withTarget)
+    fprintf (f, "#endif // TARGET_DEVICE != ANY_DEVICE\n"
+                "\n");
+
+  fclose (f);
+  printf ("Wrote %s (%u chips)\n", out.fileName, (unsigned int) devices.size ());
+  return true;
+  }  // end of writeTable
+
+int main (int argc, char * argv [])
+  {
+  const char * fileName = argc > 1 ? argv [1] : "devices.txt";
+  vector <deviceType> devices;
+
+  if (argc > 2 || !readDevices (fileName, devices))
+    {
+    if (argc > 2)
+      fprintf (stderr, "Usage: %s [devices.txt]\n", argv [0]);
+    return 1;
+    }
+
+  stable_sort (devices.begin (), devices.end (),
+               [] (const deviceType & a, const deviceType & b)
+                 { return a.sig [1] != b.sig [1] ? a.sig [1] < b.sig [1] : a.sig [2] < b.sig [2]; });
+
+  // the index is a byte, so it can't point past 255 chips
+  if (devices.size () > 255)
+    {
+    fprintf (stderr, "Too many devices (%u), the maximum is 255\n", (unsigned int) devices.size ());
+    return 1;
+    }
+
+  bool ok = true;
+  for (const outputType & out : outputs)
+    ok &= writeTable (out, devices);
+
+  return ok ? 0 : 1;
+  }  // end of main